@@ -37,6 +37,7 @@
 
 #define VIRTIO_MMIO_MAGIC_VALUE 0x74726976U
 #define VIRTIO_MMIO_VERSION_VALUE 2U
+#define VIRTIO_MMIO_DEVICE_ID_BLOCK 2U
 #define VIRTIO_MMIO_DEVICE_ID_INPUT 18U
 #define VIRTIO_MMIO_REGISTER_MAGIC 0x000U
 #define VIRTIO_MMIO_REGISTER_VERSION 0x004U
@@ -62,6 +63,7 @@
 #define VIRTIO_MMIO_REGISTER_QUEUE_AVAIL_HIGH 0x094U
 #define VIRTIO_MMIO_REGISTER_QUEUE_USED_LOW 0x0a0U
 #define VIRTIO_MMIO_REGISTER_QUEUE_USED_HIGH 0x0a4U
+#define VIRTIO_MMIO_REGISTER_CONFIG 0x100U
 
 #define VIRTIO_STATUS_ACKNOWLEDGE 0x01U
 #define VIRTIO_STATUS_DRIVER 0x02U
@@ -70,12 +72,18 @@
 #define VIRTIO_STATUS_FAILED 0x80U
 #define VIRTIO_FEATURE_VERSION_1 32U
 
+#define VIRTQ_DESC_F_NEXT 0x01U
 #define VIRTQ_DESC_F_WRITE 0x02U
 #define VIRTIO_INPUT_EVENT_QUEUE_INDEX 0U
 #define VIRTIO_INPUT_QUEUE_SIZE 32U
 #define KEYBOARD_QUEUE_ALIGNMENT 4096U
 #define KEYBOARD_QUEUE_REGION_SIZE (KEYBOARD_QUEUE_ALIGNMENT * 2U)
 #define KEYBOARD_CHAR_QUEUE_SIZE 512U
+#define VIRTIO_BLOCK_REQUEST_QUEUE_INDEX 0U
+#define VIRTIO_BLOCK_REQUEST_IN 0U
+#define VIRTIO_BLOCK_REQUEST_OUT 1U
+#define VIRTIO_BLOCK_STATUS_OK 0U
+#define BLOCK_TRANSFER_SECTOR_LIMIT 128U
 
 #define INPUT_EVENT_TYPE_SYN 0U
 #define INPUT_EVENT_TYPE_KEY 1U
@@ -183,6 +191,12 @@ struct virtio_input_event {
     uint32_t value;
 } __attribute__((packed));
 
+struct virtio_block_request {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t sector;
+} __attribute__((packed));
+
 struct fdt_header {
     uint32_t magic;
     uint32_t totalsize;
@@ -273,6 +287,16 @@ static struct virtq_desc *keyboard_desc = 0;
 static struct virtq_avail *keyboard_avail = 0;
 static volatile struct virtq_used *keyboard_used = 0;
 static struct virtio_input_event keyboard_events[VIRTIO_INPUT_QUEUE_SIZE];
+static uintptr_t block_mmio_base = 0U;
+static uint16_t block_queue_size = 0U;
+static uint16_t block_used_index = 0U;
+static uint32_t block_sector_count = 0U;
+static uint8_t block_queue_region[KEYBOARD_QUEUE_REGION_SIZE] __attribute__((aligned(KEYBOARD_QUEUE_ALIGNMENT)));
+static struct virtq_desc *block_desc = 0;
+static struct virtq_avail *block_avail = 0;
+static volatile struct virtq_used *block_used = 0;
+static struct virtio_block_request block_request;
+static volatile uint8_t block_status;
 
 static uint16_t bswap16(uint16_t value) {
     return (uint16_t)((value >> 8) | (value << 8));
@@ -793,18 +817,14 @@ static void keyboard_discard_pending_events(void) {
     }
 }
 
-static uint8_t keyboard_init_transport(uintptr_t base) {
+static uint32_t virtio_begin_transport(uintptr_t base, uint32_t device_id) {
     uint32_t version = mmio_read32(base, VIRTIO_MMIO_REGISTER_VERSION);
     uint32_t device_features_high;
-    uint16_t queue_num_max;
-    uint16_t descriptor_index;
-    uintptr_t queue_region_base;
-    uintptr_t used_region_base;
 
     if (mmio_read32(base, VIRTIO_MMIO_REGISTER_MAGIC) != VIRTIO_MMIO_MAGIC_VALUE) {
         return 0U;
     }
-    if (mmio_read32(base, VIRTIO_MMIO_REGISTER_DEVICE_ID) != VIRTIO_MMIO_DEVICE_ID_INPUT) {
+    if (mmio_read32(base, VIRTIO_MMIO_REGISTER_DEVICE_ID) != device_id) {
         return 0U;
     }
     if (version != 1U && version != VIRTIO_MMIO_VERSION_VALUE) {
@@ -838,20 +858,81 @@ static uint8_t keyboard_init_transport(uintptr_t base) {
     } else {
         mmio_write32(base, VIRTIO_MMIO_REGISTER_DRIVER_FEATURES, 0U);
     }
+    return version;
+}
 
-    mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_SEL, VIRTIO_INPUT_EVENT_QUEUE_INDEX);
+static uint16_t virtio_select_queue(uintptr_t base, uint32_t queue_index) {
+    uint16_t queue_num_max;
+    uint16_t queue_size;
+
+    mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_SEL, queue_index);
     queue_num_max = (uint16_t)mmio_read32(base, VIRTIO_MMIO_REGISTER_QUEUE_NUM_MAX);
-    keyboard_queue_size = floor_power_of_two_u16(min_u16(queue_num_max, VIRTIO_INPUT_QUEUE_SIZE));
-    if (keyboard_queue_size == 0U) {
+    queue_size = floor_power_of_two_u16(min_u16(queue_num_max, VIRTIO_INPUT_QUEUE_SIZE));
+    if (queue_size == 0U) {
         mmio_write32(base, VIRTIO_MMIO_REGISTER_STATUS, VIRTIO_STATUS_FAILED);
-        return 0U;
     }
+    return queue_size;
+}
 
-    queue_region_base = (uintptr_t)keyboard_queue_region;
-    keyboard_desc = (struct virtq_desc *)queue_region_base;
-    keyboard_avail = (struct virtq_avail *)(queue_region_base + sizeof(struct virtq_desc) * VIRTIO_INPUT_QUEUE_SIZE);
-    used_region_base = align_up((uintptr_t)keyboard_avail + sizeof(struct virtq_avail), KEYBOARD_QUEUE_ALIGNMENT);
-    keyboard_used = (volatile struct virtq_used *)used_region_base;
+static void virtio_layout_queue(
+    uint8_t *queue_region,
+    struct virtq_desc **desc_out,
+    struct virtq_avail **avail_out,
+    volatile struct virtq_used **used_out
+) {
+    uintptr_t queue_region_base = (uintptr_t)queue_region;
+
+    *desc_out = (struct virtq_desc *)queue_region_base;
+    *avail_out = (struct virtq_avail *)(queue_region_base + sizeof(struct virtq_desc) * VIRTIO_INPUT_QUEUE_SIZE);
+    *used_out = (volatile struct virtq_used *)align_up(
+        (uintptr_t)*avail_out + sizeof(struct virtq_avail),
+        KEYBOARD_QUEUE_ALIGNMENT
+    );
+}
+
+static void virtio_activate_queue(
+    uintptr_t base,
+    uint32_t version,
+    uint16_t queue_size,
+    const struct virtq_desc *desc,
+    const struct virtq_avail *avail,
+    const volatile struct virtq_used *used
+) {
+    mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_NUM, queue_size);
+    if (version == VIRTIO_MMIO_VERSION_VALUE) {
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_DESC_LOW, (uint32_t)(uintptr_t)desc);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_DESC_HIGH, 0U);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_AVAIL_LOW, (uint32_t)(uintptr_t)avail);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_AVAIL_HIGH, 0U);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_USED_LOW, (uint32_t)(uintptr_t)used);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_USED_HIGH, 0U);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_READY, 1U);
+        mmio_write32(
+            base,
+            VIRTIO_MMIO_REGISTER_STATUS,
+            VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_FEATURES_OK | VIRTIO_STATUS_DRIVER_OK
+        );
+    } else {
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_GUEST_PAGE_SIZE, KEYBOARD_QUEUE_ALIGNMENT);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_ALIGN, KEYBOARD_QUEUE_ALIGNMENT);
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_PFN, (uint32_t)((uintptr_t)desc / KEYBOARD_QUEUE_ALIGNMENT));
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_STATUS, VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_DRIVER_OK);
+    }
+    __sync_synchronize();
+}
+
+static uint8_t keyboard_init_transport(uintptr_t base) {
+    uint32_t version = virtio_begin_transport(base, VIRTIO_MMIO_DEVICE_ID_INPUT);
+    uint16_t descriptor_index;
+
+    if (version == 0U) {
+        return 0U;
+    }
+    keyboard_queue_size = virtio_select_queue(base, VIRTIO_INPUT_EVENT_QUEUE_INDEX);
+    if (keyboard_queue_size == 0U) {
+        return 0U;
+    }
+    virtio_layout_queue(keyboard_queue_region, &keyboard_desc, &keyboard_avail, &keyboard_used);
 
     for (descriptor_index = 0U; descriptor_index < keyboard_queue_size; ++descriptor_index) {
         keyboard_desc[descriptor_index].addr = (uint64_t)(uintptr_t)&keyboard_events[descriptor_index];
@@ -872,27 +953,7 @@ static uint8_t keyboard_init_transport(uintptr_t base) {
     keyboard_shift_down = 0U;
     keyboard_ctrl_down = 0U;
 
-    mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_NUM, keyboard_queue_size);
-    if (version == VIRTIO_MMIO_VERSION_VALUE) {
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_DESC_LOW, (uint32_t)(uintptr_t)keyboard_desc);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_DESC_HIGH, 0U);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_AVAIL_LOW, (uint32_t)(uintptr_t)keyboard_avail);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_AVAIL_HIGH, 0U);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_USED_LOW, (uint32_t)(uintptr_t)keyboard_used);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_USED_HIGH, 0U);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_READY, 1U);
-        mmio_write32(
-            base,
-            VIRTIO_MMIO_REGISTER_STATUS,
-            VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_FEATURES_OK | VIRTIO_STATUS_DRIVER_OK
-        );
-    } else {
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_GUEST_PAGE_SIZE, KEYBOARD_QUEUE_ALIGNMENT);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_ALIGN, KEYBOARD_QUEUE_ALIGNMENT);
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_PFN, (uint32_t)(queue_region_base / KEYBOARD_QUEUE_ALIGNMENT));
-        mmio_write32(base, VIRTIO_MMIO_REGISTER_STATUS, VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_DRIVER_OK);
-    }
-    __sync_synchronize();
+    virtio_activate_queue(base, version, keyboard_queue_size, keyboard_desc, keyboard_avail, keyboard_used);
     mmio_write32(base, VIRTIO_MMIO_REGISTER_QUEUE_NOTIFY, VIRTIO_INPUT_EVENT_QUEUE_INDEX);
 
     keyboard_mmio_base = base;
@@ -900,6 +961,94 @@ static uint8_t keyboard_init_transport(uintptr_t base) {
     return 1U;
 }
 
+static uint8_t block_init_transport(uintptr_t base) {
+    uint32_t version = virtio_begin_transport(base, VIRTIO_MMIO_DEVICE_ID_BLOCK);
+    uint32_t capacity_high;
+
+    if (version == 0U) {
+        return 0U;
+    }
+    block_queue_size = virtio_select_queue(base, VIRTIO_BLOCK_REQUEST_QUEUE_INDEX);
+    if (block_queue_size < 4U) {
+        mmio_write32(base, VIRTIO_MMIO_REGISTER_STATUS, VIRTIO_STATUS_FAILED);
+        return 0U;
+    }
+    virtio_layout_queue(block_queue_region, &block_desc, &block_avail, &block_used);
+    block_avail->flags = 0U;
+    block_avail->idx = 0U;
+    block_avail->used_event = 0U;
+    block_used->flags = 0U;
+    block_used->idx = 0U;
+    block_used->avail_event = 0U;
+    block_used_index = 0U;
+    virtio_activate_queue(base, version, block_queue_size, block_desc, block_avail, block_used);
+
+    capacity_high = mmio_read32(base, VIRTIO_MMIO_REGISTER_CONFIG + 4U);
+    block_sector_count = capacity_high != 0U ? 0xffffffffU : mmio_read32(base, VIRTIO_MMIO_REGISTER_CONFIG);
+    block_mmio_base = base;
+    return 1U;
+}
+
+static void block_transfer(uint32_t type, uint32_t sector, void *buffer, uint32_t sector_count) {
+    uint16_t ring_index;
+
+    block_request.type = type;
+    block_request.reserved = 0U;
+    block_request.sector = sector;
+    block_status = 0xffU;
+    block_desc[0].addr = (uint64_t)(uintptr_t)&block_request;
+    block_desc[0].len = sizeof(block_request);
+    block_desc[0].flags = VIRTQ_DESC_F_NEXT;
+    block_desc[0].next = 1U;
+    block_desc[1].addr = (uint64_t)(uintptr_t)buffer;
+    block_desc[1].len = sector_count * MACHINE_BLOCK_SECTOR_SIZE;
+    block_desc[1].flags = (uint16_t)(VIRTQ_DESC_F_NEXT | (type == VIRTIO_BLOCK_REQUEST_IN ? VIRTQ_DESC_F_WRITE : 0U));
+    block_desc[1].next = 2U;
+    block_desc[2].addr = (uint64_t)(uintptr_t)&block_status;
+    block_desc[2].len = 1U;
+    block_desc[2].flags = VIRTQ_DESC_F_WRITE;
+    block_desc[2].next = 0U;
+
+    ring_index = (uint16_t)(block_avail->idx % block_queue_size);
+    block_avail->ring[ring_index] = 0U;
+    __sync_synchronize();
+    block_avail->idx = (uint16_t)(block_avail->idx + 1U);
+    __sync_synchronize();
+    mmio_write32(block_mmio_base, VIRTIO_MMIO_REGISTER_QUEUE_NOTIFY, VIRTIO_BLOCK_REQUEST_QUEUE_INDEX);
+
+    while (block_used->idx == block_used_index) {
+        __sync_synchronize();
+    }
+    block_used_index = (uint16_t)(block_used_index + 1U);
+    {
+        uint32_t interrupt_status = mmio_read32(block_mmio_base, VIRTIO_MMIO_REGISTER_INTERRUPT_STATUS);
+
+        if (interrupt_status != 0U) {
+            mmio_write32(block_mmio_base, VIRTIO_MMIO_REGISTER_INTERRUPT_ACK, interrupt_status);
+        }
+    }
+    if (block_status != VIRTIO_BLOCK_STATUS_OK) {
+        machine_panic("virtio-blk request failed");
+    }
+}
+
+static void block_transfer_range(uint32_t type, uint32_t sector, uint8_t *buffer, uint32_t sector_count) {
+    if (block_mmio_base == 0U) {
+        machine_panic("virtio-blk device is not available");
+    }
+    if (sector > block_sector_count || sector_count > block_sector_count - sector) {
+        machine_panic("virtio-blk transfer exceeds device capacity");
+    }
+    while (sector_count != 0U) {
+        uint32_t chunk = sector_count < BLOCK_TRANSFER_SECTOR_LIMIT ? sector_count : BLOCK_TRANSFER_SECTOR_LIMIT;
+
+        block_transfer(type, sector, buffer, chunk);
+        sector += chunk;
+        buffer += chunk * MACHINE_BLOCK_SECTOR_SIZE;
+        sector_count -= chunk;
+    }
+}
+
 static int discover_devices_from_dtb(const void *fdt, struct discovered_devices *devices) {
     const struct fdt_header *header = (const struct fdt_header *)fdt;
     const uint8_t *bytes = (const uint8_t *)fdt;
@@ -1095,9 +1244,16 @@ void machine_init(const void *fdt) {
     keyboard_initialized = 0U;
     keyboard_mmio_base = 0U;
     keyboard_queue_size = 0U;
+    block_mmio_base = 0U;
+    block_sector_count = 0U;
     for (virtio_index = 0U; virtio_index < devices.virtio_count; ++virtio_index) {
-        if (keyboard_init_transport((uintptr_t)devices.virtio_bases[virtio_index])) {
-            break;
+        uintptr_t base = (uintptr_t)devices.virtio_bases[virtio_index];
+
+        if (!keyboard_initialized && keyboard_init_transport(base)) {
+            continue;
+        }
+        if (block_mmio_base == 0U) {
+            (void)block_init_transport(base);
         }
     }
 }
@@ -1271,3 +1427,15 @@ uint32_t machine_fw_cfg_try_read_file(const char *target, void *buffer, uint32_t
     fw_cfg_dma_transfer(selector, FW_CFG_DMA_CTL_READ, buffer, size);
     return size;
 }
+
+uint32_t machine_block_sector_count(void) {
+    return block_mmio_base == 0U ? 0U : block_sector_count;
+}
+
+void machine_block_read(uint32_t sector, void *buffer, uint32_t sector_count) {
+    block_transfer_range(VIRTIO_BLOCK_REQUEST_IN, sector, (uint8_t *)buffer, sector_count);
+}
+
+void machine_block_write(uint32_t sector, const void *buffer, uint32_t sector_count) {
+    block_transfer_range(VIRTIO_BLOCK_REQUEST_OUT, sector, (uint8_t *)(uintptr_t)buffer, sector_count);
+}
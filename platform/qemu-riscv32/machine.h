@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#define MACHINE_BLOCK_SECTOR_SIZE 512U
+
 typedef void (*machine_panic_hook)(const char *message);
 
 void machine_init(const void *fdt);
@@ -11,11 +13,14 @@ uint8_t machine_try_getc(char *out);
 char machine_wait_getc(void);
 void machine_discard_pending_input(void);
 void machine_puts(const char *text);
-void machine_wait_forever(void);
+void machine_wait_forever(void) __attribute__((noreturn));
 void machine_shutdown(void);
 void machine_set_panic_hook(machine_panic_hook hook);
-void machine_panic(const char *message);
+void machine_panic(const char *message) __attribute__((noreturn));
 void machine_ramfb_init(void *framebuffer, uint32_t width, uint32_t height, uint32_t stride);
 uint32_t machine_fw_cfg_try_read_file(const char *target, void *buffer, uint32_t buffer_size);
+uint32_t machine_block_sector_count(void);
+void machine_block_read(uint32_t sector, void *buffer, uint32_t sector_count);
+void machine_block_write(uint32_t sector, const void *buffer, uint32_t sector_count);
 
 #endif
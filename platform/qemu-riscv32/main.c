@@ -51,12 +51,12 @@ void main(const void *fdt) {
     uint32_t image_size = (uint32_t)((uintptr_t)recorz_demo_image_blob_end - (uintptr_t)recorz_demo_image_blob_start);
     uint32_t built_in_file_in_size =
         (uint32_t)((uintptr_t)recorz_default_file_in_blob_end - (uintptr_t)recorz_default_file_in_blob_start);
-    uint8_t method_update_blob[RECORZ_MVP_METHOD_UPDATE_HEADER_SIZE + (RECORZ_MVP_COMPILED_METHOD_MAX_INSTRUCTIONS * 4U)];
+    uint8_t method_update_blob[RECORZ_MVP_METHOD_UPDATE_HEADER_SIZE + ((RECORZ_MVP_COMPILED_METHOD_MAX_INSTRUCTIONS + RECORZ_MVP_COMPILED_METHOD_MAX_LITERALS) * 4U)];
     uint32_t method_update_size;
     static uint8_t file_in_blob[RECORZ_MVP_FILE_IN_BUFFER_SIZE];
     uint32_t file_in_size;
     uint32_t external_file_in_size;
-    static uint8_t snapshot_blob[RECORZ_MVP_SNAPSHOT_BUFFER_SIZE];
+    uint8_t *snapshot_blob = recorz_mvp_vm_snapshot_buffer();
     uint32_t snapshot_size;
 
     machine_init(fdt);
@@ -91,7 +91,7 @@ void main(const void *fdt) {
     snapshot_size = machine_fw_cfg_try_read_file(
         RECORZ_MVP_SNAPSHOT_FW_CFG_NAME,
         snapshot_blob,
-        sizeof(snapshot_blob)
+        RECORZ_MVP_SNAPSHOT_BUFFER_SIZE
     );
     recorz_mvp_vm_run(
         image->program,
@@ -10,7 +10,7 @@
 #define LEXICAL_LIMIT 32U
 #define MAX_SEND_ARGS 10U
 #define PRINT_BUFFER_SIZE 32U
-#define MEMORY_REPORT_BUFFER_SIZE 256U
+#define MEMORY_REPORT_BUFFER_SIZE 576U
 #define HEAP_LIMIT RECORZ_MVP_HEAP_LIMIT
 #define OBJECT_FIELD_LIMIT 4U
 #define MONO_BITMAP_LIMIT RECORZ_MVP_MONO_BITMAP_LIMIT
@@ -57,8 +57,19 @@
 #define LIVE_METHOD_SOURCE_POOL_LIMIT RECORZ_MVP_LIVE_METHOD_SOURCE_POOL_LIMIT
 #define LIVE_PACKAGE_DO_IT_SOURCE_LIMIT 64U
 #define LIVE_PACKAGE_DO_IT_SOURCE_POOL_LIMIT 32768U
+#define LIVE_METHOD_PROGRAM_INSTRUCTION_LIMIT RECORZ_MVP_LIVE_METHOD_PROGRAM_INSTRUCTION_LIMIT
+#define LIVE_METHOD_PROGRAM_LITERAL_LIMIT RECORZ_MVP_LIVE_METHOD_PROGRAM_LITERAL_LIMIT
+#define LIVE_METHOD_PROGRAM_LEXICAL_LIMIT RECORZ_MVP_LIVE_METHOD_PROGRAM_LEXICAL_LIMIT
+#define LIVE_METHOD_PROGRAM_METHOD_INSTRUCTION_LIMIT 1024U
+#define LIVE_METHOD_PROGRAM_METHOD_LITERAL_LIMIT 128U
+#define COMPILED_BLOCK_LIMIT RECORZ_MVP_COMPILED_BLOCK_LIMIT
+#define COMPILED_BLOCK_INDEX_SIZE (2U * COMPILED_BLOCK_LIMIT)
+#define COMPILED_BLOCK_INSTRUCTION_LIMIT RECORZ_MVP_COMPILED_BLOCK_INSTRUCTION_LIMIT
+#define COMPILED_BLOCK_LITERAL_LIMIT RECORZ_MVP_COMPILED_BLOCK_LITERAL_LIMIT
+#define COMPILED_BLOCK_LEXICAL_LIMIT RECORZ_MVP_COMPILED_BLOCK_LEXICAL_LIMIT
 #define LIVE_STRING_LITERAL_LIMIT 128U
 #define RUNTIME_STRING_POOL_LIMIT RECORZ_MVP_RUNTIME_STRING_POOL_LIMIT
+#define RUNTIME_STRING_INDEX_SIZE RECORZ_MVP_RUNTIME_STRING_INDEX_SIZE
 #define SNAPSHOT_STRING_LIMIT RECORZ_MVP_SNAPSHOT_STRING_LIMIT
 #define SNAPSHOT_BUFFER_LIMIT RECORZ_MVP_SNAPSHOT_BUFFER_LIMIT
 #define SCHEDULED_PROCESS_LIMIT 16U
@@ -70,26 +81,66 @@
 #define SNAPSHOT_MAGIC_1 'C'
 #define SNAPSHOT_MAGIC_2 'Z'
 #define SNAPSHOT_MAGIC_3 'T'
-#define SNAPSHOT_VERSION 10U
+#define SNAPSHOT_VERSION 13U
 #define SNAPSHOT_COMPATIBILITY_PROFILE "RV32MVP1"
 #define DEBUG_DUMP_RENDER_COUNTERS_BYTE 0x1fU
-#define GC_TEMP_ROOT_LIMIT 8U
-#define SNAPSHOT_HEADER_SIZE 64U
-#define SNAPSHOT_VALUE_SIZE 8U
+#define GC_NURSERY_LIMIT RECORZ_MVP_GC_NURSERY_LIMIT
+#define GC_REMEMBERED_SET_LIMIT RECORZ_MVP_GC_REMEMBERED_SET_LIMIT
+#define GC_GREY_STACK_LIMIT RECORZ_MVP_GC_GREY_STACK_LIMIT
+#define GC_ALLOCATION_TRIGGER RECORZ_MVP_GC_ALLOCATION_TRIGGER
+#define GC_OCCUPANCY_TRIGGER_PERCENT RECORZ_MVP_GC_OCCUPANCY_TRIGGER_PERCENT
+#define GC_INCREMENTAL_MARK_BUDGET 64U
+#define GC_INCREMENTAL_SWEEP_BUDGET 512U
+#define GC_INCREMENTAL_IDLE 0U
+#define GC_INCREMENTAL_MARK 1U
+#define GC_INCREMENTAL_SWEEP 2U
+#define SNAPSHOT_HEADER_SIZE 68U
+#define SNAPSHOT_TOTAL_SIZE_OFFSET 60U
+#define SNAPSHOT_SAVE_AND_SHUT_DOWN 1U
+#define SNAPSHOT_SAVE_AND_CONTINUE 2U
+#define SNAPSHOT_VALUE_SIZE 4U
 #define SNAPSHOT_OBJECT_SIZE (4U + (OBJECT_FIELD_LIMIT * SNAPSHOT_VALUE_SIZE))
-#define SNAPSHOT_DYNAMIC_CLASS_RECORD_SIZE \
-    (8U + (2U * METHOD_SOURCE_NAME_LIMIT) + CLASS_COMMENT_LIMIT + (DYNAMIC_CLASS_IVAR_LIMIT * METHOD_SOURCE_NAME_LIMIT))
-#define SNAPSHOT_PACKAGE_RECORD_SIZE (METHOD_SOURCE_NAME_LIMIT + PACKAGE_COMMENT_LIMIT)
-#define SNAPSHOT_NAMED_OBJECT_RECORD_SIZE (2U + METHOD_SOURCE_NAME_LIMIT)
-#define SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SIZE (13U + METHOD_SOURCE_NAME_LIMIT)
+#define SNAPSHOT_DYNAMIC_CLASS_RECORD_PREFIX_SIZE 5U
+#define SNAPSHOT_NAMED_OBJECT_RECORD_PREFIX_SIZE 2U
+#define SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_PREFIX_SIZE 5U
+#define SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SUFFIX_SIZE 8U
 #define SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE 9U
-#define SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_SIZE (4U + SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT)
-#define SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_SIZE \
-    (26U + SNAPSHOT_VALUE_SIZE + \
-     (MAX_SEND_ARGS * SNAPSHOT_VALUE_SIZE) + \
-     (STACK_LIMIT * SNAPSHOT_VALUE_SIZE) + \
-     (LEXICAL_LIMIT * SNAPSHOT_VALUE_SIZE))
+#define SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_PREFIX_SIZE 4U
+#define SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_PREFIX_SIZE 26U
 #define SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE 12U
+#define SNAPSHOT_ROOTS_SECTION_SIZE \
+    ((MAX_GLOBAL_ID * 2U) + (RECORZ_MVP_SEED_ROOT_TRANSCRIPT_FONT * 2U) + (128U * 2U))
+#define SNAPSHOT_DIRECTORY_OFFSET SNAPSHOT_HEADER_SIZE
+#define SNAPSHOT_DIRECTORY_ENTRY_SIZE 8U
+#define SNAPSHOT_PAYLOAD_OFFSET (SNAPSHOT_DIRECTORY_OFFSET + (SNAPSHOT_SECTION_COUNT * SNAPSHOT_DIRECTORY_ENTRY_SIZE))
+#define SNAPSHOT_LZ_MIN_MATCH 4U
+#define SNAPSHOT_LZ_MAX_OFFSET 0xFFFFU
+#define SNAPSHOT_LZ_HASH_BITS 10U
+#define SNAPSHOT_GENERATION_OFFSET 66U
+#define SNAPSHOT_SECTION_OBJECTS 0U
+#define SNAPSHOT_SECTION_ROOTS 1U
+#define SNAPSHOT_SECTION_DYNAMIC_CLASSES 2U
+#define SNAPSHOT_SECTION_PACKAGES 3U
+#define SNAPSHOT_SECTION_NAMED_OBJECTS 4U
+#define SNAPSHOT_SECTION_LIVE_METHOD_SOURCES 5U
+#define SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL 6U
+#define SNAPSHOT_SECTION_LIVE_STRING_LITERALS 7U
+#define SNAPSHOT_SECTION_MONO_BITMAPS 8U
+#define SNAPSHOT_SECTION_COMPILED_METHOD_BODIES 9U
+#define SNAPSHOT_SECTION_METHOD_DICTIONARIES 10U
+#define SNAPSHOT_SECTION_SCHEDULED_PROCESS_SOURCES 11U
+#define SNAPSHOT_SECTION_SCHEDULED_ACTIVATIONS 12U
+#define SNAPSHOT_SECTION_SCHEDULED_PROCESSES 13U
+#define SNAPSHOT_SECTION_STRINGS 14U
+#define SNAPSHOT_SECTION_COUNT 15U
+#define SNAPSHOT_DELTA_MAGIC_3 'D'
+#define SNAPSHOT_DELTA_LIMIT (SNAPSHOT_BUFFER_LIMIT / 4U)
+#define SNAPSHOT_DELTA_CHAIN_LIMIT 8U
+#define SNAPSHOT_DELTA_CHECKSUM_OFFSET 16U
+#define SNAPSHOT_DELTA_FIRST_OFFSET 20U
+#define SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET (SNAPSHOT_DELTA_FIRST_OFFSET + (SNAPSHOT_SECTION_COUNT * 4U))
+#define SNAPSHOT_DELTA_HEADER_SIZE (SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET + SNAPSHOT_PAYLOAD_OFFSET)
+#define SNAPSHOT_DELTA_PATCH_RECORD_SIZE (2U + SNAPSHOT_OBJECT_SIZE)
 
 #define FORM_FIELD_BITS RECORZ_MVP_FORM_FIELD_BITS
 #define BITMAP_FIELD_WIDTH RECORZ_MVP_BITMAP_FIELD_WIDTH
@@ -138,6 +189,11 @@
 #define TEXT_BEHAVIOR_FIELD_FALLBACK_BITMAP RECORZ_MVP_TEXT_BEHAVIOR_FIELD_FALLBACK_GLYPH
 #define TEXT_BEHAVIOR_FIELD_CLEAR_ON_OVERFLOW RECORZ_MVP_TEXT_BEHAVIOR_FIELD_CLEAR_ON_OVERFLOW
 #define FONT_FIELD_GLYPHS RECORZ_MVP_FONT_FIELD_GLYPHS
+#define INDEXABLE_FIELD_SIZE RECORZ_MVP_ARRAY_FIELD_SIZE
+#define INDEXABLE_BYTES_PER_FIELD 3U
+#define INDEXABLE_FIELDS_PER_WORD 2U
+#define LARGE_POSITIVE_INTEGER_FIELD_DIGIT0 RECORZ_MVP_LARGE_POSITIVE_INTEGER_FIELD_DIGIT0
+#define LARGE_POSITIVE_INTEGER_DIGIT_COUNT 4U
 #define FONT_FIELD_METRICS RECORZ_MVP_FONT_FIELD_METRICS
 #define FONT_FIELD_BEHAVIOR RECORZ_MVP_FONT_FIELD_BEHAVIOR
 #define FONT_FIELD_POINT_SIZE RECORZ_MVP_FONT_FIELD_POINT_SIZE
@@ -152,6 +208,7 @@
 #define METHOD_ENTRY_FIELD_EXECUTION_ID RECORZ_MVP_METHOD_ENTRY_FIELD_EXECUTION_ID
 #define METHOD_ENTRY_FIELD_IMPLEMENTATION RECORZ_MVP_METHOD_ENTRY_FIELD_IMPLEMENTATION
 #define SELECTOR_FIELD_SELECTOR_ID RECORZ_MVP_SELECTOR_FIELD_VALUE
+#define SELECTOR_FIELD_NAME (SELECTOR_FIELD_SELECTOR_ID + 1U)
 #define BLOCK_CLOSURE_FIELD_SOURCE RECORZ_MVP_BLOCK_CLOSURE_FIELD_SOURCE
 #define BLOCK_CLOSURE_FIELD_HOME_RECEIVER RECORZ_MVP_BLOCK_CLOSURE_FIELD_HOME_RECEIVER
 #define BLOCK_CLOSURE_FIELD_LEXICAL0 RECORZ_MVP_BLOCK_CLOSURE_FIELD_LEXICAL0
@@ -165,8 +222,30 @@
 #define TEST_RUNNER_FIELD_TOTAL RECORZ_MVP_TEST_RUNNER_FIELD_TOTAL
 #define TEST_RUNNER_FIELD_LAST_LABEL RECORZ_MVP_TEST_RUNNER_FIELD_LAST_LABEL
 #define COMPILED_METHOD_MAX_INSTRUCTIONS RECORZ_MVP_COMPILED_METHOD_MAX_INSTRUCTIONS
+#define COMPILED_METHOD_MAX_LITERALS RECORZ_MVP_COMPILED_METHOD_MAX_LITERALS
+#define COMPILED_METHOD_INLINE_INSTRUCTIONS RECORZ_MVP_COMPILED_METHOD_INLINE_INSTRUCTIONS
+#define COMPILED_METHOD_BODY_WORD_LIMIT RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT
+#define DECODED_INSTRUCTION_LIMIT RECORZ_MVP_DECODED_INSTRUCTION_LIMIT
+#define COMPILED_METHOD_BODY_FIELD_OFFSET 1U
+#define COMPILED_METHOD_BODY_FIELD_INSTRUCTION_COUNT 2U
+#define COMPILED_METHOD_BODY_FIELD_LITERAL_COUNT 3U
+#define METHOD_DICTIONARY_SLOT_LIMIT RECORZ_MVP_METHOD_DICTIONARY_SLOT_LIMIT
+#define METHOD_DICTIONARY_HEADER_SLOTS 2U
+#define METHOD_DICTIONARY_MIN_CAPACITY 4U
+#define METHOD_CACHE_SIZE RECORZ_MVP_METHOD_CACHE_SIZE
+#define METHOD_CACHE_PRIMITIVE 1U
+#define METHOD_CACHE_COMPILED_METHOD 2U
+#define METHOD_CACHE_LIVE_SOURCE 3U
+#define METHOD_CACHE_GETTER 4U
+#define METHOD_CACHE_SETTER 5U
+#define METHOD_CACHE_RETURN_SELF 6U
+#define SEND_SITE_LIMIT RECORZ_MVP_SEND_SITE_LIMIT
+#define SEND_SITE_POLYMORPHIC_LIMIT RECORZ_MVP_SEND_SITE_POLYMORPHIC_LIMIT
+#define SEND_SITE_POLYMORPHIC_WAYS 4U
+#define SEND_SITE_MEGAMORPHIC 0xFFFFU
 
 #define COMPILED_METHOD_OP_PUSH_GLOBAL RECORZ_MVP_COMPILED_METHOD_OP_PUSH_GLOBAL
+#define COMPILED_METHOD_OP_PUSH_LITERAL RECORZ_MVP_COMPILED_METHOD_OP_PUSH_LITERAL
 #define COMPILED_METHOD_OP_PUSH_ROOT RECORZ_MVP_COMPILED_METHOD_OP_PUSH_ROOT
 #define COMPILED_METHOD_OP_PUSH_ARGUMENT RECORZ_MVP_COMPILED_METHOD_OP_PUSH_ARGUMENT
 #define COMPILED_METHOD_OP_PUSH_NIL RECORZ_MVP_COMPILED_METHOD_OP_PUSH_NIL
@@ -185,6 +264,11 @@
 #define COMPILED_METHOD_OP_JUMP_IF_TRUE RECORZ_MVP_COMPILED_METHOD_OP_JUMP_IF_TRUE
 #define COMPILED_METHOD_OP_JUMP_IF_FALSE RECORZ_MVP_COMPILED_METHOD_OP_JUMP_IF_FALSE
 #define COMPILED_METHOD_OP_PUSH_THIS_CONTEXT RECORZ_MVP_COMPILED_METHOD_OP_PUSH_THIS_CONTEXT
+#define COMPILED_METHOD_OP_RETURN_FIELD RECORZ_MVP_COMPILED_METHOD_OP_RETURN_FIELD
+#define COMPILED_METHOD_OP_STORE_FIELD_FROM_ARGUMENT RECORZ_MVP_COMPILED_METHOD_OP_STORE_FIELD_FROM_ARGUMENT
+#define COMPILED_METHOD_OP_STORE_LEXICAL_FROM_ARGUMENT RECORZ_MVP_COMPILED_METHOD_OP_STORE_LEXICAL_FROM_ARGUMENT
+#define COMPILED_METHOD_OP_SEND_ADD RECORZ_MVP_COMPILED_METHOD_OP_SEND_ADD
+#define COMPILED_METHOD_OP_SEND_MIN RECORZ_MVP_COMPILED_METHOD_OP_SEND_MIN
 #define CURSOR_FIELD_BITS RECORZ_MVP_CURSOR_FIELD_BITS
 #define CURSOR_FIELD_HOTSPOT_X RECORZ_MVP_CURSOR_FIELD_HOTSPOT_X
 #define CURSOR_FIELD_HOTSPOT_Y RECORZ_MVP_CURSOR_FIELD_HOTSPOT_Y
@@ -205,19 +289,37 @@
 #define CHARACTER_SCANNER_STOP_CONTROL 4U
 #define CHARACTER_SCANNER_STOP_SELECTION 5U
 #define CHARACTER_SCANNER_STOP_CURSOR 6U
-#define MAX_OBJECT_KIND RECORZ_MVP_OBJECT_WORKSPACE_DEBUGGER_MODEL
-#define MAX_SELECTOR_ID RECORZ_MVP_SELECTOR_RESTORE_ON_TOOL
+#define MAX_OBJECT_KIND RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER
+#define MAX_SELECTOR_ID RECORZ_MVP_SELECTOR_MIN
+#define MAX_OPCODE RECORZ_MVP_OP_SEND_MIN
+#define DYNAMIC_SELECTOR_LIMIT RECORZ_MVP_DYNAMIC_SELECTOR_LIMIT
+#define SELECTOR_TABLE_SIZE RECORZ_MVP_SELECTOR_TABLE_SIZE
 #define MAX_GLOBAL_ID RECORZ_MVP_GLOBAL_WORKSPACE_SELECTION
 #define SOURCE_EVAL_BINDING_LIMIT (MAX_SEND_ARGS + LEXICAL_LIMIT)
 #if defined(RECORZ_MVP_PROFILE_DEV)
 #define SOURCE_EVAL_ENV_LIMIT 4096U
 #define SOURCE_EVAL_HOME_CONTEXT_LIMIT 4096U
 #define SOURCE_EVAL_BLOCK_STATE_LIMIT 4096U
+#define SOURCE_BINDING_NAME_LIMIT 2048U
+#define SOURCE_BINDING_NAME_POOL_LIMIT 24576U
 #else
 #define SOURCE_EVAL_ENV_LIMIT 256U
 #define SOURCE_EVAL_HOME_CONTEXT_LIMIT 256U
 #define SOURCE_EVAL_BLOCK_STATE_LIMIT 512U
+#define SOURCE_BINDING_NAME_LIMIT 256U
+#define SOURCE_BINDING_NAME_POOL_LIMIT 3072U
 #endif
+#define SOURCE_BINDING_NAME_INDEX_SIZE (SOURCE_BINDING_NAME_LIMIT * 2U)
+#if defined(RECORZ_MVP_PROFILE_DEV)
+#define ACTIVATION_FRAME_LIMIT 1024U
+#define INTERPRETER_ACTIVATION_LIMIT 1024U
+#define INTERPRETER_VALUE_LIMIT 16384U
+#else
+#define ACTIVATION_FRAME_LIMIT 128U
+#define INTERPRETER_ACTIVATION_LIMIT 128U
+#define INTERPRETER_VALUE_LIMIT 2048U
+#endif
+#define ACTIVATION_FRAME_HANDLE_TAG 0x8000U
 
 #define WORKSPACE_VIEW_NONE 0U
 #define WORKSPACE_VIEW_CLASSES 1U
@@ -249,12 +351,18 @@ enum recorz_mvp_value_kind {
     RECORZ_MVP_VALUE_SMALL_INTEGER = 3,
 };
 
+/* A value is one tagged machine word. SmallIntegers set the low bit; strings are tagged 2 and
+   carry their byte displacement from the heap base above the tag; every other word is an object
+   handle shifted past the tag, with the zero word standing for nil. */
 struct recorz_mvp_value {
-    uint8_t kind;
-    int32_t integer;
-    const char *string;
+    uintptr_t bits;
 };
 
+#define VALUE_TAG_MASK 3U
+#define VALUE_TAG_STRING 2U
+#define SMALL_INTEGER_MIN (-0x40000000L)
+#define SMALL_INTEGER_MAX 0x3FFFFFFFL
+
 struct recorz_mvp_heap_object {
     uint8_t kind;
     uint8_t field_count;
@@ -297,11 +405,39 @@ struct recorz_mvp_workspace_source_program {
     uint16_t lexical_count;
 };
 
+struct recorz_mvp_live_method_program_builder {
+    const struct recorz_mvp_heap_object *class_object;
+    struct recorz_mvp_instruction instructions[LIVE_METHOD_PROGRAM_METHOD_INSTRUCTION_LIMIT];
+    struct recorz_mvp_literal literals[LIVE_METHOD_PROGRAM_METHOD_LITERAL_LIMIT];
+    char literal_text_pool[METHOD_SOURCE_CHUNK_LIMIT];
+    char scratch_text[3U * METHOD_SOURCE_CHUNK_LIMIT];
+    char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
+    char lexical_names[LEXICAL_LIMIT][METHOD_SOURCE_NAME_LIMIT];
+    uint16_t instruction_count;
+    uint16_t literal_count;
+    uint16_t literal_text_pool_used;
+    uint16_t scratch_text_used;
+    uint16_t argument_count;
+    uint16_t lexical_count;
+    uint16_t cascade_receiver_end;
+    int16_t outer_lexical_environment_index;
+    uint8_t arguments_are_lexical;
+    uint8_t has_block_literal;
+    uint8_t needs_lexical_arguments;
+    uint8_t is_block_body;
+};
+
 struct recorz_mvp_named_object_binding {
     char name[METHOD_SOURCE_NAME_LIMIT];
     uint16_t object_handle;
 };
 
+enum recorz_mvp_live_method_execution_kind {
+    RECORZ_MVP_LIVE_METHOD_EXECUTION_COMPILED = 0,
+    RECORZ_MVP_LIVE_METHOD_EXECUTION_PROGRAM = 1,
+    RECORZ_MVP_LIVE_METHOD_EXECUTION_SOURCE = 2,
+};
+
 struct recorz_mvp_live_method_source {
     uint16_t class_handle;
     uint16_t selector_id;
@@ -309,6 +445,51 @@ struct recorz_mvp_live_method_source {
     char protocol_name[METHOD_SOURCE_NAME_LIMIT];
     uint32_t source_offset;
     uint32_t source_length;
+    uint8_t execution_kind;
+    uint8_t program_has_block_literal;
+    uint8_t program_lexical_count;
+    uint16_t program_instruction_offset;
+    uint16_t program_instruction_count;
+    uint16_t program_literal_offset;
+    uint16_t program_literal_count;
+    uint16_t program_lexical_name_offset;
+    uint16_t send_site_base;
+};
+
+enum recorz_mvp_compiled_block_state {
+    RECORZ_MVP_COMPILED_BLOCK_FREE = 0,
+    RECORZ_MVP_COMPILED_BLOCK_PROGRAM = 1,
+    RECORZ_MVP_COMPILED_BLOCK_SOURCE = 2,
+};
+
+/* Keyed by the closure's source pointer: every closure made from one block literal shares it. */
+struct recorz_mvp_compiled_block {
+    const char *source;
+    uint16_t class_handle;
+    uint8_t state;
+    uint8_t argument_count;
+    uint8_t has_block_literal;
+    uint8_t lexical_count;
+    uint16_t instruction_offset;
+    uint16_t instruction_count;
+    uint16_t literal_offset;
+    uint16_t literal_count;
+    uint16_t lexical_name_offset;
+    uint16_t send_site_base;
+};
+
+struct recorz_mvp_method_cache_entry {
+    uint16_t class_handle;
+    uint16_t selector_id;
+    uint8_t argument_count;
+    uint8_t implementation_kind;
+    uint16_t implementation;
+    uint16_t owner_class_handle;
+};
+
+struct recorz_mvp_integer {
+    uint8_t negative;
+    uint64_t magnitude;
 };
 
 struct recorz_mvp_live_package_do_it_source {
@@ -339,16 +520,21 @@ struct recorz_mvp_source_eval_result {
     struct recorz_mvp_value value;
 };
 
-struct recorz_mvp_source_binding {
-    char name[METHOD_SOURCE_NAME_LIMIT];
-    struct recorz_mvp_value value;
-};
-
+/* Binding names are ids into source_binding_name_offsets, so a lookup compares integers rather than strings. */
 struct recorz_mvp_source_lexical_environment {
     uint8_t in_use;
     uint8_t binding_count;
     int16_t parent_index;
-    struct recorz_mvp_source_binding bindings[SOURCE_EVAL_BINDING_LIMIT];
+    uint16_t name_ids[SOURCE_EVAL_BINDING_LIMIT];
+    struct recorz_mvp_value values[SOURCE_EVAL_BINDING_LIMIT];
+};
+
+/* A Context that has not been reified yet; its handle is ACTIVATION_FRAME_HANDLE_TAG | frame index. */
+struct recorz_mvp_activation_frame {
+    uint16_t context_handle;
+    uint16_t sender_context_handle;
+    struct recorz_mvp_value receiver;
+    struct recorz_mvp_value detail;
 };
 
 struct recorz_mvp_source_home_context {
@@ -453,6 +639,22 @@ struct recorz_mvp_scheduler_send_result {
     struct recorz_mvp_value value;
 };
 
+struct recorz_mvp_snapshot_string_writer {
+    uint8_t *bytes;
+    uint32_t base;
+    uint32_t used;
+    uint32_t limit;
+};
+
+struct recorz_mvp_gc_root_frame {
+    struct recorz_mvp_gc_root_frame *previous;
+    const struct recorz_mvp_value *values;
+    const uint32_t *value_count;
+    uint32_t fixed_value_count;
+    const uint16_t *handles;
+    uint32_t handle_count;
+};
+
 static struct recorz_mvp_value stack[STACK_LIMIT];
 static struct recorz_mvp_heap_object heap[HEAP_LIMIT];
 static uint32_t stack_size = 0U;
@@ -461,7 +663,9 @@ static uint16_t heap_live_count = 0U;
 static uint16_t heap_high_water_mark = 0U;
 static uint16_t class_handles_by_kind[MAX_OBJECT_KIND + 1U];
 static uint16_t class_descriptor_handles_by_kind[MAX_OBJECT_KIND + 1U];
-static uint16_t selector_handles_by_id[MAX_SELECTOR_ID + 1U];
+static uint16_t selector_handles_by_id[MAX_SELECTOR_ID + DYNAMIC_SELECTOR_LIMIT + 1U];
+static uint16_t selector_table[SELECTOR_TABLE_SIZE];
+static uint16_t dynamic_selector_count = 0U;
 static uint16_t global_handles[MAX_GLOBAL_ID + 1U];
 static struct recorz_mvp_dynamic_class_definition dynamic_classes[DYNAMIC_CLASS_LIMIT];
 static struct recorz_mvp_live_package_definition live_packages[PACKAGE_LIMIT];
@@ -471,6 +675,45 @@ static struct recorz_mvp_live_package_do_it_source live_package_do_it_sources[LI
 static struct recorz_mvp_live_string_literal live_string_literals[LIVE_STRING_LITERAL_LIMIT];
 static char live_method_source_pool[LIVE_METHOD_SOURCE_POOL_LIMIT];
 static uint32_t live_method_source_pool_used = 0U;
+static struct recorz_mvp_instruction live_method_program_instructions[LIVE_METHOD_PROGRAM_INSTRUCTION_LIMIT];
+static struct recorz_mvp_literal live_method_program_literals[LIVE_METHOD_PROGRAM_LITERAL_LIMIT];
+static char live_method_program_lexical_names[LIVE_METHOD_PROGRAM_LEXICAL_LIMIT][METHOD_SOURCE_NAME_LIMIT];
+static struct recorz_mvp_live_method_program_builder live_method_program_builder;
+static uint16_t live_method_program_instructions_used = 0U;
+static uint16_t live_method_program_literals_used = 0U;
+static uint16_t live_method_program_lexical_names_used = 0U;
+static uint16_t live_method_program_activation_depth = 0U;
+static struct recorz_mvp_compiled_block compiled_blocks[COMPILED_BLOCK_LIMIT];
+static uint16_t compiled_block_index[COMPILED_BLOCK_INDEX_SIZE];
+static struct recorz_mvp_instruction compiled_block_instructions[COMPILED_BLOCK_INSTRUCTION_LIMIT];
+static struct recorz_mvp_literal compiled_block_literals[COMPILED_BLOCK_LITERAL_LIMIT];
+static char compiled_block_lexical_names[COMPILED_BLOCK_LEXICAL_LIMIT][METHOD_SOURCE_NAME_LIMIT];
+static uint16_t compiled_block_count = 0U;
+static uint16_t compiled_block_instructions_used = 0U;
+static uint16_t compiled_block_literals_used = 0U;
+static uint16_t compiled_block_lexical_names_used = 0U;
+static uint16_t compiled_block_activation_depth = 0U;
+static int16_t block_return_home_context_index = -1;
+static uint32_t compiled_method_body_words[COMPILED_METHOD_BODY_WORD_LIMIT];
+static uint32_t compiled_method_body_words_used = 0U;
+static uint16_t method_dictionary_slots[METHOD_DICTIONARY_SLOT_LIMIT];
+static uint16_t method_dictionary_slots_used = 0U;
+static struct recorz_mvp_method_cache_entry method_cache[METHOD_CACHE_SIZE];
+static uint32_t method_cache_hit_count = 0U;
+static uint32_t method_cache_miss_count = 0U;
+static struct recorz_mvp_method_cache_entry send_site_entries[SEND_SITE_LIMIT];
+static uint16_t send_site_polymorphic_indexes[SEND_SITE_LIMIT];
+static struct recorz_mvp_method_cache_entry
+    send_site_polymorphic_entries[SEND_SITE_POLYMORPHIC_LIMIT * SEND_SITE_POLYMORPHIC_WAYS];
+static uint16_t send_sites_used = 1U;
+static uint16_t send_site_polymorphic_used = 0U;
+static uint16_t compiled_method_send_site_bases[HEAP_LIMIT];
+static uint16_t compiled_method_decoded_offsets[HEAP_LIMIT];
+static struct recorz_mvp_instruction decoded_instructions[DECODED_INSTRUCTION_LIMIT];
+static uint32_t decoded_instructions_used = 0U;
+static uint8_t decoded_instructions_exhausted = 0U;
+static uint32_t send_site_hit_count = 0U;
+static uint32_t send_site_miss_count = 0U;
 static char live_package_do_it_source_pool[LIVE_PACKAGE_DO_IT_SOURCE_POOL_LIMIT];
 static uint16_t live_package_do_it_source_count = 0U;
 static uint16_t live_package_do_it_source_pool_used = 0U;
@@ -492,9 +735,19 @@ static uint16_t transcript_metrics_handle = 0U;
 static uint16_t transcript_behavior_handle = 0U;
 static uint16_t transcript_font_handle = 0U;
 static struct recorz_mvp_source_lexical_environment source_eval_environments[SOURCE_EVAL_ENV_LIMIT];
+static char source_binding_name_pool[SOURCE_BINDING_NAME_POOL_LIMIT];
+static uint16_t source_binding_name_offsets[SOURCE_BINDING_NAME_LIMIT + 1U];
+static uint16_t source_binding_name_index[SOURCE_BINDING_NAME_INDEX_SIZE];
+static uint16_t source_binding_name_count = 0U;
+static uint16_t source_binding_name_pool_used = 0U;
 static struct recorz_mvp_source_home_context source_eval_home_contexts[SOURCE_EVAL_HOME_CONTEXT_LIMIT];
+static struct recorz_mvp_activation_frame activation_frames[ACTIVATION_FRAME_LIMIT];
+static uint16_t activation_frame_count = 0U;
 static uint16_t startup_hook_receiver_handle = 0U;
 static uint16_t startup_hook_selector_id = 0U;
+static uint16_t snapshot_restored_startup_hook_receiver_handle = 0U;
+static uint16_t snapshot_restored_startup_hook_selector_id = 0U;
+static uint8_t snapshot_restores_startup_hook = 0U;
 static uint32_t mono_bitmap_pool[MONO_BITMAP_LIMIT][MONO_BITMAP_MAX_HEIGHT];
 static uint16_t mono_bitmap_count = 0U;
 static uint16_t named_object_count = 0U;
@@ -502,6 +755,9 @@ static uint16_t live_method_source_count = 0U;
 static uint16_t compiling_method_class_handle = 0U;
 static uint16_t compiling_method_selector_id = 0U;
 static uint8_t compiling_method_argument_count = 0U;
+static uint32_t compiling_method_instruction_words[COMPILED_METHOD_MAX_INSTRUCTIONS];
+static uint32_t compiling_method_literal_words[COMPILED_METHOD_MAX_LITERALS];
+static uint16_t compiling_method_literal_count = 0U;
 static uint32_t cursor_x = 0U;
 static uint32_t cursor_y = 0U;
 static char print_buffer[PRINT_BUFFER_SIZE];
@@ -539,6 +795,9 @@ static char file_in_source_io_buffer[FILE_IN_SOURCE_BUFFER_LIMIT + 1U];
 static char regenerated_source_io_buffer[REGENERATED_SOURCE_BUFFER_LIMIT];
 static char runtime_string_pool[RUNTIME_STRING_POOL_LIMIT];
 static uint32_t runtime_string_pool_offset = 0U;
+static uint32_t runtime_string_index[RUNTIME_STRING_INDEX_SIZE];
+static uint32_t runtime_string_index_count = 0U;
+static uint8_t runtime_string_index_overflowed = 0U;
 static const char recorz_mvp_image_profile_name[] = {
     RECORZ_MVP_IMAGE_PROFILE_0,
     RECORZ_MVP_IMAGE_PROFILE_1,
@@ -551,15 +810,52 @@ static const char recorz_mvp_image_profile_name[] = {
     '\0'
 };
 static uint8_t gc_mark_bits[(HEAP_LIMIT + 7U) / 8U];
-static uint16_t gc_temp_roots[GC_TEMP_ROOT_LIMIT];
-static uint8_t gc_temp_root_count = 0U;
+static struct recorz_mvp_gc_root_frame *gc_root_frames = 0;
 static uint32_t gc_collection_count = 0U;
 static uint32_t gc_last_reclaimed_count = 0U;
 static uint32_t gc_total_reclaimed_count = 0U;
-static uintptr_t gc_stack_base_address = 0U;
+static uint8_t gc_young_bits[(HEAP_LIMIT + 7U) / 8U];
+static uint8_t gc_remembered_bits[(HEAP_LIMIT + 7U) / 8U];
+static uint16_t gc_nursery_handles[GC_NURSERY_LIMIT];
+static uint16_t gc_nursery_count = 0U;
+static uint16_t gc_nursery_safepoint_count = 0U;
+static uint8_t gc_nursery_overflowed = 0U;
+static uint16_t gc_remembered_handles[GC_REMEMBERED_SET_LIMIT];
+static uint16_t gc_remembered_count = 0U;
+static uint8_t gc_remembered_set_overflowed = 0U;
+static uint8_t gc_minor_collection_active = 0U;
+static uint32_t gc_minor_collection_count = 0U;
+static uint32_t gc_promoted_since_full_count = 0U;
+static uint32_t gc_allocated_since_collection_count = 0U;
+static uint16_t heap_free_hint = 1U;
+static uint16_t gc_grey_stack[GC_GREY_STACK_LIMIT];
+static uint16_t gc_grey_count = 0U;
+static uint8_t gc_grey_stack_overflowed = 0U;
+static uint8_t gc_incremental_phase = GC_INCREMENTAL_IDLE;
+static uint16_t gc_incremental_sweep_cursor = 0U;
+static uint16_t gc_incremental_reclaimed = 0U;
+static uint16_t gc_input_session_depth = 0U;
+static uint32_t gc_incremental_step_count = 0U;
+static uint32_t gc_pause_work = 0U;
+static uint32_t gc_last_pause_work = 0U;
+static uint32_t gc_max_pause_work = 0U;
 static uint8_t gc_bootstrap_file_in_active = 0U;
 static char snapshot_string_pool[SNAPSHOT_STRING_LIMIT];
 static uint8_t snapshot_buffer[SNAPSHOT_BUFFER_LIMIT];
+static uint8_t snapshot_replay_buffer[SNAPSHOT_BUFFER_LIMIT];
+static uint8_t snapshot_delta_buffer[SNAPSHOT_DELTA_LIMIT];
+static uint8_t snapshot_dirty_bits[(HEAP_LIMIT + 7U) / 8U];
+static uint32_t snapshot_dirty_live_method_source_index = 0U;
+static uint32_t snapshot_dirty_live_method_source_pool_offset = 0U;
+static uint32_t snapshot_dirty_compiled_method_body_word = 0U;
+static uint32_t snapshot_image_lengths[SNAPSHOT_SECTION_COUNT];
+static uint32_t snapshot_image_fingerprints[SNAPSHOT_SECTION_COUNT];
+static uint16_t snapshot_image_live_method_source_count = 0U;
+static uint32_t snapshot_lz_table[1U << SNAPSHOT_LZ_HASH_BITS];
+static uint8_t snapshot_chain_active = 0U;
+static uint16_t snapshot_chain_generation = 0U;
+static uint16_t snapshot_chain_sequence = 0U;
+static uint32_t snapshot_chain_next_sector = 0U;
 static uint8_t booted_from_snapshot = 0U;
 static struct recorz_mvp_scheduled_process_source scheduled_process_sources[SCHEDULED_PROCESS_SOURCE_LIMIT];
 static struct recorz_mvp_scheduled_activation_record scheduled_activation_records[SCHEDULED_ACTIVATION_LIMIT];
@@ -569,6 +865,7 @@ static uint16_t scheduled_runnable_tail = 0xFFFFU;
 static int16_t scheduled_active_process_index = -1;
 static uint8_t scheduled_yield_requested = 0U;
 static uint8_t scheduled_suspend_requested = 0U;
+static uint8_t scheduled_snapshot_save_mode = 0U;
 static uint8_t scheduled_terminate_requested = 0U;
 static uint8_t scheduled_debug_mode = RECORZ_MVP_SCHEDULER_DEBUG_NONE;
 static int16_t scheduled_debug_target_process_index = -1;
@@ -576,9 +873,7 @@ static uint32_t scheduled_debug_start_depth = 0U;
 
 static uint16_t seeded_handles[HEAP_LIMIT];
 static const char *panic_phase = "idle";
-static uint32_t panic_pc = 0U;
-static struct recorz_mvp_instruction panic_instruction;
-static uint8_t panic_have_instruction = 0U;
+static struct recorz_mvp_execution_frame *current_execution_frame = 0;
 static uint8_t panic_have_send = 0U;
 static uint16_t panic_send_selector = 0U;
 static uint16_t panic_send_argument_count = 0U;
@@ -586,16 +881,31 @@ static struct recorz_mvp_value panic_send_receiver;
 static struct recorz_mvp_value panic_send_arguments[MAX_SEND_ARGS];
 
 static struct recorz_mvp_value nil_value(void);
+static uint8_t value_kind(struct recorz_mvp_value value);
+static uint8_t value_is_nil(struct recorz_mvp_value value);
+static uint8_t value_is_object(struct recorz_mvp_value value);
+static uint8_t value_is_string(struct recorz_mvp_value value);
+static uint8_t value_is_small_integer(struct recorz_mvp_value value);
+static uint16_t value_handle(struct recorz_mvp_value value);
+static int32_t value_small_integer(struct recorz_mvp_value value);
+static int32_t value_integer(struct recorz_mvp_value value);
+static const char *value_string(struct recorz_mvp_value value);
 static uint32_t small_integer_u32(struct recorz_mvp_value value, const char *message);
 static int32_t small_integer_i32(struct recorz_mvp_value value, const char *message);
+static uint8_t integer_from_value(struct recorz_mvp_value value, struct recorz_mvp_integer *integer);
+static uint8_t integer_value(const struct recorz_mvp_integer *integer, struct recorz_mvp_value *value);
 static void heap_set_field(uint16_t handle, uint8_t index, struct recorz_mvp_value value);
 static void heap_set_class(uint16_t handle, uint16_t class_handle);
 static const struct recorz_mvp_heap_object *heap_object_for_value(struct recorz_mvp_value value);
 static struct recorz_mvp_value heap_get_field(const struct recorz_mvp_heap_object *object, uint8_t index);
 static const struct recorz_mvp_heap_object *class_object_for_heap_object(const struct recorz_mvp_heap_object *object);
-static uint32_t compiled_method_instruction_word(const struct recorz_mvp_heap_object *compiled_method, uint8_t index);
+static uint32_t compiled_method_instruction_word(const struct recorz_mvp_heap_object *compiled_method, uint16_t index);
+static uint16_t compiled_method_instruction_count(const struct recorz_mvp_heap_object *compiled_method);
+static uint16_t compiled_method_literal_count(const struct recorz_mvp_heap_object *compiled_method);
+static uint32_t compiled_method_literal_word(const struct recorz_mvp_heap_object *compiled_method, uint16_t index);
 static uint16_t compiled_method_lexical_count(const struct recorz_mvp_heap_object *compiled_method);
 static uint32_t text_length(const char *text);
+static uint32_t text_hash(const char *text);
 static uint32_t text_left_margin(void);
 static uint32_t text_right_margin(void);
 static uint32_t text_bottom_margin(void);
@@ -653,7 +963,9 @@ static void file_in_class_source_on_existing_class(
 );
 static uint16_t allocate_compiled_method_from_words(
     const uint32_t instruction_words[],
-    uint8_t instruction_count
+    uint16_t instruction_count,
+    const uint32_t literal_words[],
+    uint16_t literal_count
 );
 static const struct recorz_mvp_heap_object *lookup_class_by_name(const char *class_name);
 static const struct recorz_mvp_heap_object *ensure_class_defined(
@@ -691,7 +1003,9 @@ static void scheduled_process_suspend_by_handle(uint16_t process_handle);
 static void scheduled_process_resume_by_handle(uint16_t process_handle);
 static void scheduled_process_terminate_by_handle(uint16_t process_handle);
 static void load_snapshot_state(const uint8_t *blob, uint32_t size);
-static void emit_live_snapshot(void);
+static uint8_t current_execution_instruction(uint32_t *pc, struct recorz_mvp_instruction *instruction);
+static void decoded_instructions_reset(void);
+static void emit_live_snapshot(uint8_t save_mode);
 static void file_in_class_chunks_source(const char *source);
 static void file_in_chunk_stream_source(const char *source);
 static const char *file_out_class_source_text(const char *class_name, char buffer[], uint32_t buffer_size);
@@ -711,12 +1025,24 @@ static int compare_source_names(const char *left, const char *right);
 static const char *runtime_string_allocate_copy(const char *text);
 static const char *runtime_string_intern_copy(const char *text);
 static void runtime_string_compact_live_references(void);
+static void compiled_block_index_rebuild(void);
+static void runtime_string_index_clear(void);
+static void compiled_method_body_compact(void);
+static void method_dictionary_compact(void);
+static void method_cache_flush(void);
+static void method_cache_flush_selector(uint16_t selector_id);
+static void method_cache_flush_live_sources_from(uint16_t source_index);
+static uint16_t send_site_allocate(uint32_t instruction_count);
+static void send_site_release(uint16_t base, uint32_t instruction_count);
+static uint16_t compiled_method_send_site_base(const struct recorz_mvp_heap_object *compiled_method);
+static uint16_t live_method_send_site_base(const struct recorz_mvp_live_method_source *source_record);
+static uint16_t compiled_block_send_site_base(struct recorz_mvp_compiled_block *block);
+static uint16_t class_method_descriptor_handle_at(const struct recorz_mvp_heap_object *class_object, uint32_t index);
 static struct recorz_mvp_value small_integer_value(int32_t integer);
 static struct recorz_mvp_value boolean_value(uint8_t condition);
 static struct recorz_mvp_value object_value(uint16_t handle);
 static struct recorz_mvp_value string_value(const char *text);
 static uint16_t heap_allocate_seeded_class(uint8_t kind);
-static uint16_t heap_allocate_seeded_class_run(uint8_t kind, uint16_t count);
 static uint8_t heap_handle_is_live(uint16_t handle);
 static void forget_live_string_literals(uint16_t class_handle, uint16_t selector_id, uint8_t argument_count);
 static void append_text_checked(
@@ -1111,10 +1437,97 @@ static const char *opcode_name(uint8_t opcode) {
             return "jumpIfFalse";
         case RECORZ_MVP_OP_PUSH_BLOCK_LITERAL:
             return "pushBlockLiteral";
+        case RECORZ_MVP_OP_RETURN_FIELD:
+            return "returnField";
+        case RECORZ_MVP_OP_STORE_FIELD_FROM_ARGUMENT:
+            return "storeFieldFromArgument";
+        case RECORZ_MVP_OP_STORE_LEXICAL_FROM_ARGUMENT:
+            return "storeLexicalFromArgument";
+        case RECORZ_MVP_OP_PUSH_SMALL_INTEGER_SEND:
+            return "pushSmallIntegerSend";
+        case RECORZ_MVP_OP_SEND_ADD:
+            return "sendAdd";
+        case RECORZ_MVP_OP_SEND_SUBTRACT:
+            return "sendSubtract";
+        case RECORZ_MVP_OP_SEND_MULTIPLY:
+            return "sendMultiply";
+        case RECORZ_MVP_OP_SEND_LESS_THAN:
+            return "sendLessThan";
+        case RECORZ_MVP_OP_SEND_GREATER_THAN:
+            return "sendGreaterThan";
+        case RECORZ_MVP_OP_SEND_LESS_EQUAL:
+            return "sendLessEqual";
+        case RECORZ_MVP_OP_SEND_GREATER_EQUAL:
+            return "sendGreaterEqual";
+        case RECORZ_MVP_OP_SEND_EQUAL:
+            return "sendEqual";
+        case RECORZ_MVP_OP_SEND_NOT_EQUAL:
+            return "sendNotEqual";
+        case RECORZ_MVP_OP_SEND_INTEGER_DIVIDE:
+            return "sendIntegerDivide";
+        case RECORZ_MVP_OP_SEND_MODULO:
+            return "sendModulo";
+        case RECORZ_MVP_OP_SEND_BIT_AND:
+            return "sendBitAnd";
+        case RECORZ_MVP_OP_SEND_BIT_OR:
+            return "sendBitOr";
+        case RECORZ_MVP_OP_SEND_BIT_XOR:
+            return "sendBitXor";
+        case RECORZ_MVP_OP_SEND_BIT_SHIFT:
+            return "sendBitShift";
+        case RECORZ_MVP_OP_SEND_MAX:
+            return "sendMax";
+        case RECORZ_MVP_OP_SEND_MIN:
+            return "sendMin";
     }
     return "unknown";
 }
 
+/* Indexed by opcode - RECORZ_MVP_OP_SEND_ADD; each special send takes one argument. */
+static const uint16_t special_send_selectors[RECORZ_MVP_OP_SEND_MIN - RECORZ_MVP_OP_SEND_ADD + 1U] = {
+    RECORZ_MVP_SELECTOR_ADD,
+    RECORZ_MVP_SELECTOR_SUBTRACT,
+    RECORZ_MVP_SELECTOR_MULTIPLY,
+    RECORZ_MVP_SELECTOR_LESS_THAN,
+    RECORZ_MVP_SELECTOR_GREATER_THAN,
+    RECORZ_MVP_SELECTOR_LESS_EQUAL,
+    RECORZ_MVP_SELECTOR_GREATER_EQUAL,
+    RECORZ_MVP_SELECTOR_EQUAL,
+    RECORZ_MVP_SELECTOR_NOT_EQUAL,
+    RECORZ_MVP_SELECTOR_INTEGER_DIVIDE,
+    RECORZ_MVP_SELECTOR_MODULO,
+    RECORZ_MVP_SELECTOR_BIT_AND,
+    RECORZ_MVP_SELECTOR_BIT_OR,
+    RECORZ_MVP_SELECTOR_BIT_XOR,
+    RECORZ_MVP_SELECTOR_BIT_SHIFT,
+    RECORZ_MVP_SELECTOR_MAX,
+    RECORZ_MVP_SELECTOR_MIN,
+};
+
+static uint8_t opcode_is_special_send(uint8_t opcode) {
+    return (uint8_t)(opcode >= RECORZ_MVP_OP_SEND_ADD && opcode <= RECORZ_MVP_OP_SEND_MIN);
+}
+
+static uint16_t special_send_selector(uint8_t opcode) {
+    return special_send_selectors[opcode - RECORZ_MVP_OP_SEND_ADD];
+}
+
+static uint8_t special_send_opcode_for_selector(uint16_t selector, uint16_t argument_count) {
+    uint8_t opcode;
+
+    if (argument_count != 1U) {
+        return 0U;
+    }
+    for (opcode = RECORZ_MVP_OP_SEND_ADD; opcode <= RECORZ_MVP_OP_SEND_MIN; ++opcode) {
+        if (special_send_selector(opcode) == selector) {
+            return opcode;
+        }
+    }
+    return 0U;
+}
+
+static const char *dynamic_selector_name(uint16_t selector);
+
 static const char *selector_name(uint16_t selector) {
     switch (selector) {
         case RECORZ_MVP_SELECTOR_SHOW:
@@ -1233,6 +1646,34 @@ static const char *selector_name(uint16_t selector) {
             return "isReadOnlyDetailTarget";
         case RECORZ_MVP_SELECTOR_RESTORE_ON_TOOL:
             return "restoreOn:tool:";
+        case RECORZ_MVP_SELECTOR_GARBAGE_COLLECT:
+            return "garbageCollect";
+        case RECORZ_MVP_SELECTOR_AT_PUT:
+            return "at:put:";
+        case RECORZ_MVP_SELECTOR_NEW_ARG:
+            return "new:";
+        case RECORZ_MVP_SELECTOR_LESS_EQUAL:
+            return "<=";
+        case RECORZ_MVP_SELECTOR_GREATER_EQUAL:
+            return ">=";
+        case RECORZ_MVP_SELECTOR_NOT_EQUAL:
+            return "~=";
+        case RECORZ_MVP_SELECTOR_INTEGER_DIVIDE:
+            return "//";
+        case RECORZ_MVP_SELECTOR_MODULO:
+            return "\\\\";
+        case RECORZ_MVP_SELECTOR_BIT_AND:
+            return "bitAnd:";
+        case RECORZ_MVP_SELECTOR_BIT_OR:
+            return "bitOr:";
+        case RECORZ_MVP_SELECTOR_BIT_XOR:
+            return "bitXor:";
+        case RECORZ_MVP_SELECTOR_BIT_SHIFT:
+            return "bitShift:";
+        case RECORZ_MVP_SELECTOR_MAX:
+            return "max:";
+        case RECORZ_MVP_SELECTOR_MIN:
+            return "min:";
         case RECORZ_MVP_SELECTOR_BROWSE_PROTOCOLS_FOR_CLASS_NAMED:
             return "browseProtocolsForClassNamed:";
         case RECORZ_MVP_SELECTOR_BROWSE_PROTOCOL_OF_CLASS_NAMED:
@@ -1956,7 +2397,7 @@ static const char *selector_name(uint16_t selector) {
         case RECORZ_MVP_SELECTOR_STEP_OVER:
             return "stepOver";
     }
-    return "unknown";
+    return dynamic_selector_name(selector);
 }
 
 static const char *object_kind_name(uint8_t kind) {
@@ -2045,29 +2486,37 @@ static const char *object_kind_name(uint8_t kind) {
             return "WorkspaceEditorModel";
         case RECORZ_MVP_OBJECT_WORKSPACE_DEBUGGER_MODEL:
             return "WorkspaceDebuggerModel";
+        case RECORZ_MVP_OBJECT_ARRAY:
+            return "Array";
+        case RECORZ_MVP_OBJECT_BYTE_ARRAY:
+            return "ByteArray";
+        case RECORZ_MVP_OBJECT_WORD_ARRAY:
+            return "WordArray";
+        case RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER:
+            return "LargePositiveInteger";
     }
     return "UnknownObject";
 }
 
 static void panic_put_value(struct recorz_mvp_value value) {
-    if (value.kind == RECORZ_MVP_VALUE_NIL) {
+    if (value_is_nil(value)) {
         machine_puts("nil");
         return;
     }
-    if (value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (value_is_small_integer(value)) {
         machine_puts("smallInteger(");
-        panic_put_i32(value.integer);
+        panic_put_i32(value_integer(value));
         machine_putc(')');
         return;
     }
-    if (value.kind == RECORZ_MVP_VALUE_STRING) {
+    if (value_is_string(value)) {
         machine_puts("string(");
-        panic_put_string_sample(value.string);
+        panic_put_string_sample(value_string(value));
         machine_putc(')');
         return;
     }
-    if (value.kind == RECORZ_MVP_VALUE_OBJECT) {
-        uint16_t handle = (uint16_t)value.integer;
+    if (value_is_object(value)) {
+        uint16_t handle = value_handle(value);
 
         machine_puts("object#");
         panic_put_u32((uint32_t)handle);
@@ -2081,7 +2530,7 @@ static void panic_put_value(struct recorz_mvp_value value) {
         return;
     }
     machine_puts("value(kind=");
-    panic_put_u32((uint32_t)value.kind);
+    panic_put_u32((uint32_t)value_kind(value));
     machine_putc(')');
 }
 
@@ -2105,6 +2554,11 @@ static void remember_send_context(
     }
 }
 
+static void forget_send_context(void) {
+    panic_phase = "execute";
+    panic_have_send = 0U;
+}
+
 static uint16_t read_u16_le(const uint8_t *bytes) {
     return (uint16_t)bytes[0] | (uint16_t)((uint16_t)bytes[1] << 8U);
 }
@@ -2155,11 +2609,23 @@ static uint8_t source_char_is_identifier_char(char ch) {
 }
 
 static uint8_t source_char_is_binary_selector(char ch) {
-    return (uint8_t)(ch == '+' || ch == '-' || ch == '*' || ch == '=' || ch == '<' || ch == '>');
+    return (uint8_t)(ch == '+' || ch == '-' || ch == '*' || ch == '=' || ch == '<' || ch == '>' ||
+                     ch == '~' || ch == '/' || ch == '\\');
 }
 
 static uint8_t source_char_is_live_binary_selector(char ch) {
-    return (uint8_t)(source_char_is_binary_selector(ch) || ch == '/' || ch == '%');
+    return (uint8_t)(source_char_is_binary_selector(ch) || ch == '%');
+}
+
+/* A trailing '-' is left for the argument so "3--4" still reads as 3 - -4. */
+static const char *source_parse_binary_selector(const char *cursor, char selector[3]) {
+    selector[0] = *cursor++;
+    selector[1] = '\0';
+    if (source_char_is_binary_selector(*cursor) && *cursor != '-') {
+        selector[1] = *cursor++;
+        selector[2] = '\0';
+    }
+    return cursor;
 }
 
 static uint8_t source_names_equal(const char *left, const char *right) {
@@ -2385,6 +2851,7 @@ static uint16_t allocate_source_context_object(
     struct recorz_mvp_value receiver,
     const char *detail_text
 );
+static uint16_t context_handle_reify(uint16_t context_handle);
 static void source_append_binding(
     int16_t lexical_environment_index,
     const char *name,
@@ -2400,6 +2867,12 @@ static struct recorz_mvp_source_eval_result source_execute_block_closure(
     const struct recorz_mvp_value arguments[],
     uint16_t sender_context_handle
 );
+static struct recorz_mvp_source_eval_result execute_block_closure(
+    const struct recorz_mvp_heap_object *object,
+    uint16_t argument_count,
+    const struct recorz_mvp_value arguments[],
+    uint16_t sender_context_handle
+);
 static struct recorz_mvp_source_eval_result source_execute_inline_block_source(
     struct recorz_mvp_source_method_context *context,
     const char *source
@@ -2428,6 +2901,21 @@ static void execute_live_source_method_with_sender(
     const char *source,
     uint16_t sender_context_handle
 );
+static void execute_live_method_with_sender(
+    const struct recorz_mvp_heap_object *class_object,
+    struct recorz_mvp_value receiver,
+    uint16_t argument_count,
+    const struct recorz_mvp_value arguments[],
+    const struct recorz_mvp_live_method_source *source_record,
+    uint16_t sender_context_handle
+);
+static void compile_live_method_program(struct recorz_mvp_live_method_source *source_record);
+static void rebuild_live_method_programs(void);
+static uint8_t source_send_needs_failure_context(
+    struct recorz_mvp_value receiver,
+    uint16_t selector_id,
+    uint16_t argument_count
+);
 static void perform_send_with_sender(
     struct recorz_mvp_value receiver,
     uint16_t selector,
@@ -2436,6 +2924,22 @@ static void perform_send_with_sender(
     uint16_t sender_context_handle,
     const char *text
 );
+static const struct recorz_mvp_method_cache_entry *send_site_entry(
+    uint16_t site_index,
+    struct recorz_mvp_value receiver,
+    uint16_t selector,
+    uint16_t send_argument_count
+);
+static void dispatch_method_cache_entry(
+    const struct recorz_mvp_heap_object *object,
+    const struct recorz_mvp_method_cache_entry *cache_entry,
+    uint16_t selector,
+    uint16_t argument_count,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    uint16_t sender_context_handle,
+    const char *text
+);
 static void perform_send(
     struct recorz_mvp_value receiver,
     uint16_t selector,
@@ -2825,19 +3329,91 @@ static uint8_t display_source_root_id_for_selector(
     return 0U;
 }
 
-static uint16_t source_selector_id_for_name(const char *name) {
+static uint16_t last_selector_id(void) {
+    return (uint16_t)(MAX_SELECTOR_ID + dynamic_selector_count);
+}
+
+static const char *dynamic_selector_name(uint16_t selector) {
+    struct recorz_mvp_value name_value;
+
+    if (selector <= MAX_SELECTOR_ID || selector > last_selector_id() || selector_handles_by_id[selector] == 0U) {
+        return "unknown";
+    }
+    name_value = heap_get_field(heap_object(selector_handles_by_id[selector]), SELECTOR_FIELD_NAME);
+    if (!value_is_string(name_value) || value_string(name_value) == 0) {
+        machine_panic("dynamic selector name is not a string");
+    }
+    return value_string(name_value);
+}
+
+static uint32_t selector_table_slot_for_name(const char *name) {
+    return text_hash(name) & (SELECTOR_TABLE_SIZE - 1U);
+}
+
+static void selector_table_insert(uint16_t selector) {
+    uint32_t slot = selector_table_slot_for_name(selector_name(selector));
+    uint32_t probe_count;
+
+    for (probe_count = 0U; probe_count < SELECTOR_TABLE_SIZE; ++probe_count) {
+        if (selector_table[slot] == 0U) {
+            selector_table[slot] = selector;
+            return;
+        }
+        slot = (slot + 1U) & (SELECTOR_TABLE_SIZE - 1U);
+    }
+    machine_panic("selector table overflow");
+}
+
+static void initialize_selector_table(void) {
+    uint32_t slot;
     uint16_t selector;
 
-    for (selector = RECORZ_MVP_SELECTOR_SHOW;
-         selector <= MAX_SELECTOR_ID;
-         ++selector) {
-        if (source_names_equal(name, selector_name(selector))) {
-            return selector;
+    for (slot = 0U; slot < SELECTOR_TABLE_SIZE; ++slot) {
+        selector_table[slot] = 0U;
+    }
+    for (selector = RECORZ_MVP_SELECTOR_SHOW; selector <= last_selector_id(); ++selector) {
+        if (selector > MAX_SELECTOR_ID && selector_handles_by_id[selector] == 0U) {
+            continue;
+        }
+        selector_table_insert(selector);
+    }
+}
+
+static uint16_t source_selector_id_for_name(const char *name) {
+    uint32_t slot = selector_table_slot_for_name(name);
+
+    while (selector_table[slot] != 0U) {
+        if (source_names_equal(name, selector_name(selector_table[slot]))) {
+            return selector_table[slot];
         }
+        slot = (slot + 1U) & (SELECTOR_TABLE_SIZE - 1U);
     }
     return 0U;
 }
 
+static uint16_t source_selector_id_intern(const char *name) {
+    uint16_t selector = source_selector_id_for_name(name);
+    uint16_t handle;
+
+    if (selector != 0U) {
+        return selector;
+    }
+    if (name == 0 || *name == '\0') {
+        machine_panic("selector name is empty");
+    }
+    if (dynamic_selector_count >= DYNAMIC_SELECTOR_LIMIT) {
+        machine_panic("dynamic selector table is full");
+    }
+    selector = (uint16_t)(MAX_SELECTOR_ID + dynamic_selector_count + 1U);
+    handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_SELECTOR);
+    heap_set_field(handle, SELECTOR_FIELD_SELECTOR_ID, small_integer_value((int32_t)selector));
+    heap_set_field(handle, SELECTOR_FIELD_NAME, string_value(runtime_string_intern_copy(name)));
+    selector_handles_by_id[selector] = handle;
+    ++dynamic_selector_count;
+    selector_table_insert(selector);
+    return selector;
+}
+
 static const char *source_skip_statement_space(const char *cursor) {
     while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\n') {
         ++cursor;
@@ -3145,7 +3721,7 @@ static uint16_t allocate_placeholder_live_source_compiled_method(void) {
 
     instruction_words[0] = encode_compiled_method_word(COMPILED_METHOD_OP_PUSH_NIL, 0U, 0U);
     instruction_words[1] = encode_compiled_method_word(COMPILED_METHOD_OP_RETURN_TOP, 0U, 0U);
-    return allocate_compiled_method_from_words(instruction_words, 2U);
+    return allocate_compiled_method_from_words(instruction_words, 2U, 0, 0U);
 }
 
 static struct recorz_mvp_source_eval_result source_eval_value_result(struct recorz_mvp_value value) {
@@ -3164,6 +3740,14 @@ static struct recorz_mvp_source_eval_result source_eval_return_result(struct rec
     return result;
 }
 
+/* A block return still looking for its home unwinds the evaluator like a '^' of its own. */
+static struct recorz_mvp_source_eval_result source_eval_send_result(struct recorz_mvp_value value) {
+    if (block_return_home_context_index >= 0) {
+        return source_eval_return_result(value);
+    }
+    return source_eval_value_result(value);
+}
+
 static struct recorz_mvp_source_lexical_environment *source_lexical_environment_at(int16_t lexical_environment_index) {
     if (lexical_environment_index < 0 ||
         lexical_environment_index >= (int16_t)SOURCE_EVAL_ENV_LIMIT ||
@@ -3194,8 +3778,8 @@ static int16_t source_allocate_lexical_environment(int16_t parent_index) {
             environment->binding_count = 0U;
             environment->parent_index = parent_index;
             for (binding_index = 0U; binding_index < SOURCE_EVAL_BINDING_LIMIT; ++binding_index) {
-                environment->bindings[binding_index].name[0] = '\0';
-                environment->bindings[binding_index].value = nil_value();
+                environment->name_ids[binding_index] = 0U;
+                environment->values[binding_index] = nil_value();
             }
             return (int16_t)env_index;
         }
@@ -3247,7 +3831,7 @@ static uint8_t source_block_state_references_home_context(int16_t home_context_i
             continue;
         }
         home_context_value = object->fields[BLOCK_CLOSURE_FIELD_LEXICAL1];
-        if (home_context_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
+        if (value_is_small_integer(home_context_value) &&
             (int16_t)small_integer_i32(
                 home_context_value,
                 "block closure home context state is not a small integer"
@@ -3269,7 +3853,7 @@ static uint8_t source_block_state_references_lexical_environment(int16_t lexical
             continue;
         }
         lexical_environment_value = object->fields[BLOCK_CLOSURE_FIELD_LEXICAL0];
-        if (lexical_environment_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
+        if (value_is_small_integer(lexical_environment_value) &&
             (int16_t)small_integer_i32(
                 lexical_environment_value,
                 "block closure lexical environment state is not a small integer"
@@ -3327,8 +3911,8 @@ static void source_release_single_lexical_environment_if_unused(int16_t lexical_
     environment->binding_count = 0U;
     environment->parent_index = -1;
     for (binding_index = 0U; binding_index < SOURCE_EVAL_BINDING_LIMIT; ++binding_index) {
-        environment->bindings[binding_index].name[0] = '\0';
-        environment->bindings[binding_index].value = nil_value();
+        environment->name_ids[binding_index] = 0U;
+        environment->values[binding_index] = nil_value();
     }
 }
 
@@ -3373,8 +3957,10 @@ static uint16_t allocate_source_context_object(
     struct recorz_mvp_value receiver,
     const char *detail_text
 ) {
-    uint16_t handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_CONTEXT);
+    uint16_t handle;
 
+    sender_context_handle = context_handle_reify(sender_context_handle);
+    handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_CONTEXT);
     heap_set_field(
         handle,
         CONTEXT_FIELD_SENDER,
@@ -3394,31 +3980,198 @@ static uint16_t allocate_source_context_object(
     return handle;
 }
 
+static uint16_t activation_frame_context(
+    uint16_t sender_context_handle,
+    struct recorz_mvp_value receiver,
+    const char *detail_text
+) {
+    struct recorz_mvp_activation_frame *frame;
+
+    if (activation_frame_count >= ACTIVATION_FRAME_LIMIT) {
+        return allocate_source_context_object(sender_context_handle, receiver, detail_text);
+    }
+    frame = &activation_frames[activation_frame_count];
+    frame->context_handle = 0U;
+    frame->sender_context_handle = sender_context_handle;
+    frame->receiver = receiver;
+    frame->detail = detail_text == 0 ? nil_value() : string_value(detail_text);
+    return (uint16_t)(ACTIVATION_FRAME_HANDLE_TAG | activation_frame_count++);
+}
+
+static struct recorz_mvp_activation_frame *activation_frame_for_handle(uint16_t context_handle) {
+    uint16_t frame_index = (uint16_t)(context_handle & ~ACTIVATION_FRAME_HANDLE_TAG);
+
+    if (frame_index >= activation_frame_count) {
+        machine_panic("activation frame handle is stale");
+    }
+    return &activation_frames[frame_index];
+}
+
+/* Materializes the frame's Context, and its senders' first, so the heap sender chain matches the native one. */
+static uint16_t context_handle_reify(uint16_t context_handle) {
+    struct recorz_mvp_activation_frame *frame;
+    uint16_t reified_handle;
+
+    if ((context_handle & ACTIVATION_FRAME_HANDLE_TAG) == 0U) {
+        return context_handle;
+    }
+    frame = activation_frame_for_handle(context_handle);
+    if (frame->context_handle == 0U) {
+        reified_handle = allocate_source_context_object(
+            frame->sender_context_handle,
+            frame->receiver,
+            value_is_string(frame->detail) ? value_string(frame->detail) : 0
+        );
+        frame = activation_frame_for_handle(context_handle);
+        frame->context_handle = reified_handle;
+    }
+    return frame->context_handle;
+}
+
+static const char *source_binding_name(uint16_t name_id) {
+    if (name_id == 0U || name_id > source_binding_name_count) {
+        machine_panic("source binding name id is invalid");
+    }
+    return source_binding_name_pool + source_binding_name_offsets[name_id - 1U];
+}
+
+static void source_binding_name_index_insert(uint16_t name_id) {
+    uint32_t slot = text_hash(source_binding_name(name_id)) & (SOURCE_BINDING_NAME_INDEX_SIZE - 1U);
+
+    while (source_binding_name_index[slot] != 0U) {
+        slot = (slot + 1U) & (SOURCE_BINDING_NAME_INDEX_SIZE - 1U);
+    }
+    source_binding_name_index[slot] = name_id;
+}
+
+static uint16_t source_binding_name_id(const char *name) {
+    uint32_t slot;
+
+    if (name == 0 || name[0] == '\0') {
+        return 0U;
+    }
+    slot = text_hash(name) & (SOURCE_BINDING_NAME_INDEX_SIZE - 1U);
+    while (source_binding_name_index[slot] != 0U) {
+        if (source_names_equal(source_binding_name(source_binding_name_index[slot]), name)) {
+            return source_binding_name_index[slot];
+        }
+        slot = (slot + 1U) & (SOURCE_BINDING_NAME_INDEX_SIZE - 1U);
+    }
+    return 0U;
+}
+
+/* Names are only referenced from live environments, so a full table is rebuilt from those and renumbered. */
+static void source_binding_names_compact(void) {
+    static uint16_t renumbered_ids[SOURCE_BINDING_NAME_LIMIT + 1U];
+    static char compacted_pool[SOURCE_BINDING_NAME_POOL_LIMIT];
+    uint16_t compacted_count = 0U;
+    uint16_t compacted_used = 0U;
+    uint16_t env_index;
+    uint16_t binding_index;
+    uint32_t index;
+
+    for (index = 0U; index <= SOURCE_BINDING_NAME_LIMIT; ++index) {
+        renumbered_ids[index] = 0U;
+    }
+    for (env_index = 0U; env_index < SOURCE_EVAL_ENV_LIMIT; ++env_index) {
+        struct recorz_mvp_source_lexical_environment *environment = &source_eval_environments[env_index];
+
+        if (!environment->in_use) {
+            continue;
+        }
+        for (binding_index = 0U; binding_index < environment->binding_count; ++binding_index) {
+            uint16_t name_id = environment->name_ids[binding_index];
+
+            if (renumbered_ids[name_id] == 0U) {
+                const char *name = source_binding_name(name_id);
+                uint32_t char_index = 0U;
+
+                do {
+                    compacted_pool[compacted_used + char_index] = name[char_index];
+                } while (name[char_index++] != '\0');
+                source_binding_name_offsets[compacted_count] = compacted_used;
+                compacted_used = (uint16_t)(compacted_used + char_index);
+                renumbered_ids[name_id] = ++compacted_count;
+            }
+            environment->name_ids[binding_index] = renumbered_ids[name_id];
+        }
+    }
+    for (index = 0U; index < compacted_used; ++index) {
+        source_binding_name_pool[index] = compacted_pool[index];
+    }
+    source_binding_name_count = compacted_count;
+    source_binding_name_pool_used = compacted_used;
+    for (index = 0U; index < SOURCE_BINDING_NAME_INDEX_SIZE; ++index) {
+        source_binding_name_index[index] = 0U;
+    }
+    for (index = 1U; index <= compacted_count; ++index) {
+        source_binding_name_index_insert((uint16_t)index);
+    }
+}
+
+static uint16_t source_binding_name_intern(const char *name) {
+    uint16_t name_id = source_binding_name_id(name);
+    uint32_t length = 0U;
+    uint32_t char_index;
+
+    if (name_id != 0U) {
+        return name_id;
+    }
+    while (name[length] != '\0') {
+        ++length;
+    }
+    if (source_binding_name_count >= SOURCE_BINDING_NAME_LIMIT ||
+        source_binding_name_pool_used + length + 1U > SOURCE_BINDING_NAME_POOL_LIMIT) {
+        source_binding_names_compact();
+        if (source_binding_name_count >= SOURCE_BINDING_NAME_LIMIT ||
+            source_binding_name_pool_used + length + 1U > SOURCE_BINDING_NAME_POOL_LIMIT) {
+            machine_panic("source binding name table overflow");
+        }
+    }
+    for (char_index = 0U; char_index <= length; ++char_index) {
+        source_binding_name_pool[source_binding_name_pool_used + char_index] = name[char_index];
+    }
+    source_binding_name_offsets[source_binding_name_count] = source_binding_name_pool_used;
+    source_binding_name_pool_used = (uint16_t)(source_binding_name_pool_used + length + 1U);
+    name_id = ++source_binding_name_count;
+    source_binding_name_index_insert(name_id);
+    return name_id;
+}
+
+static int16_t source_environment_binding_index(
+    const struct recorz_mvp_source_lexical_environment *environment,
+    uint16_t name_id
+) {
+    uint16_t binding_index;
+
+    for (binding_index = 0U; binding_index < environment->binding_count; ++binding_index) {
+        if (environment->name_ids[binding_index] == name_id) {
+            return (int16_t)binding_index;
+        }
+    }
+    return -1;
+}
+
 static void source_append_binding(
     int16_t lexical_environment_index,
     const char *name,
     struct recorz_mvp_value value
 ) {
     struct recorz_mvp_source_lexical_environment *environment = source_lexical_environment_at(lexical_environment_index);
-    uint16_t binding_index;
+    uint16_t name_id;
 
     if (name == 0 || name[0] == '\0') {
         machine_panic("source lexical binding name is empty");
     }
-    for (binding_index = 0U; binding_index < environment->binding_count; ++binding_index) {
-        if (source_names_equal(environment->bindings[binding_index].name, name)) {
-            machine_panic("source lexical binding is duplicated");
-        }
-    }
     if (environment->binding_count >= SOURCE_EVAL_BINDING_LIMIT) {
         machine_panic("source lexical binding limit exceeded");
     }
-    source_copy_identifier(
-        environment->bindings[environment->binding_count].name,
-        sizeof(environment->bindings[environment->binding_count].name),
-        name
-    );
-    environment->bindings[environment->binding_count].value = value;
+    name_id = source_binding_name_intern(name);
+    if (source_environment_binding_index(environment, name_id) >= 0) {
+        machine_panic("source lexical binding is duplicated");
+    }
+    environment->name_ids[environment->binding_count] = name_id;
+    environment->values[environment->binding_count] = value;
     ++environment->binding_count;
 }
 
@@ -3426,15 +4179,18 @@ static struct recorz_mvp_value *source_lookup_binding_cell(
     int16_t lexical_environment_index,
     const char *name
 ) {
+    uint16_t name_id = source_binding_name_id(name);
+
+    if (name_id == 0U) {
+        return 0;
+    }
     while (lexical_environment_index >= 0) {
         struct recorz_mvp_source_lexical_environment *environment =
             source_lexical_environment_at(lexical_environment_index);
-        uint16_t binding_index;
+        int16_t binding_index = source_environment_binding_index(environment, name_id);
 
-        for (binding_index = 0U; binding_index < environment->binding_count; ++binding_index) {
-            if (source_names_equal(environment->bindings[binding_index].name, name)) {
-                return &environment->bindings[binding_index].value;
-            }
+        if (binding_index >= 0) {
+            return &environment->values[binding_index];
         }
         lexical_environment_index = environment->parent_index;
     }
@@ -3546,9 +4302,10 @@ static const char *workspace_compile_binary_expression_push(
     const char *cursor,
     struct recorz_mvp_workspace_source_program *program
 ) {
-    char selector_buffer[2];
+    char selector_buffer[3];
     const char *parsed_cursor;
     uint16_t selector_id;
+    uint8_t special_opcode;
 
     parsed_cursor = workspace_compile_operand_push(cursor, program);
     if (parsed_cursor == 0) {
@@ -3556,17 +4313,16 @@ static const char *workspace_compile_binary_expression_push(
     }
     cursor = source_skip_statement_space(parsed_cursor);
     while (source_char_is_binary_selector(*cursor)) {
-        selector_buffer[0] = *cursor++;
-        selector_buffer[1] = '\0';
+        cursor = source_parse_binary_selector(cursor, selector_buffer);
         cursor = workspace_compile_operand_push(cursor, program);
         if (cursor == 0) {
             machine_panic("Workspace binary send is missing an argument");
         }
-        selector_id = source_selector_id_for_name(selector_buffer);
-        if (selector_id == 0U) {
-            machine_panic("Workspace source statement uses an unknown binary selector");
-        }
-        if (!workspace_source_append_instruction(program, RECORZ_MVP_OP_SEND, selector_id, 1U)) {
+        selector_id = source_selector_id_intern(selector_buffer);
+        special_opcode = special_send_opcode_for_selector(selector_id, 1U);
+        if (!(special_opcode != 0U
+                  ? workspace_source_append_instruction(program, special_opcode, 0U, 0U)
+                  : workspace_source_append_instruction(program, RECORZ_MVP_OP_SEND, selector_id, 1U))) {
             machine_panic("Workspace source exceeds instruction capacity");
         }
         cursor = source_skip_statement_space(cursor);
@@ -3741,10 +4497,7 @@ static const char *workspace_compile_operand_push(
         if (*after_selector == ':') {
             break;
         }
-        selector_id = source_selector_id_for_name(identifier);
-        if (selector_id == 0U) {
-            machine_panic("Workspace source statement uses an unknown unary selector");
-        }
+        selector_id = source_selector_id_intern(identifier);
         if (!workspace_source_append_instruction(program, RECORZ_MVP_OP_SEND, selector_id, 0U)) {
             machine_panic("Workspace source exceeds instruction capacity");
         }
@@ -3764,6 +4517,7 @@ static const char *workspace_compile_expression_push(
     uint16_t argument_count = 0U;
     uint32_t selector_length = 0U;
     uint16_t selector_id;
+    uint8_t special_opcode;
 
     parsed_cursor = workspace_compile_binary_expression_push(cursor, program);
     if (parsed_cursor == 0) {
@@ -3818,11 +4572,11 @@ static const char *workspace_compile_expression_push(
             selector_buffer[selector_length] = '\0';
         }
     } while (*part_cursor == ':');
-    selector_id = source_selector_id_for_name(selector_buffer);
-    if (selector_id == 0U) {
-        machine_panic("Workspace source statement uses an unknown selector");
-    }
-    if (!workspace_source_append_instruction(program, RECORZ_MVP_OP_SEND, selector_id, argument_count)) {
+    selector_id = source_selector_id_intern(selector_buffer);
+    special_opcode = special_send_opcode_for_selector(selector_id, argument_count);
+    if (!(special_opcode != 0U
+              ? workspace_source_append_instruction(program, special_opcode, 0U, 0U)
+              : workspace_source_append_instruction(program, RECORZ_MVP_OP_SEND, selector_id, argument_count))) {
         machine_panic("Workspace source exceeds instruction capacity");
     }
     return cursor;
@@ -4171,10 +4925,10 @@ static struct recorz_mvp_heap_object *workspace_visible_origin_object_or_null(vo
         return 0;
     }
     origin_value = heap_get_field(tool_object, WORKSPACE_TOOL_FIELD_VISIBLE_ORIGIN);
-    if (origin_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(origin_value)) {
         return 0;
     }
-    origin_handle = (uint16_t)origin_value.integer;
+    origin_handle = value_handle(origin_value);
     if (!heap_handle_is_live(origin_handle)) {
         return 0;
     }
@@ -4184,20 +4938,22 @@ static struct recorz_mvp_heap_object *workspace_visible_origin_object_or_null(vo
 static void vm_panic_hook(const char *message) {
     uint32_t dump_count;
     uint32_t slot;
+    uint32_t pc;
+    struct recorz_mvp_instruction instruction;
 
     (void)message;
     machine_puts("vm: phase=");
     machine_puts(panic_phase);
     machine_puts("\n");
-    if (panic_have_instruction) {
+    if (current_execution_instruction(&pc, &instruction)) {
         machine_puts("vm: pc=");
-        panic_put_u32(panic_pc);
+        panic_put_u32(pc);
         machine_puts(" opcode=");
-        machine_puts(opcode_name(panic_instruction.opcode));
+        machine_puts(opcode_name(instruction.opcode));
         machine_puts(" operand_a=");
-        panic_put_u32((uint32_t)panic_instruction.operand_a);
+        panic_put_u32((uint32_t)instruction.operand_a);
         machine_puts(" operand_b=");
-        panic_put_u32((uint32_t)panic_instruction.operand_b);
+        panic_put_u32((uint32_t)instruction.operand_b);
         machine_puts("\n");
     }
     if (panic_have_send) {
@@ -4245,11 +5001,63 @@ static void vm_panic_hook(const char *message) {
 }
 
 static struct recorz_mvp_value nil_value(void) {
-    return (struct recorz_mvp_value){RECORZ_MVP_VALUE_NIL, 0, 0};
+    return (struct recorz_mvp_value){0U};
 }
 
 static struct recorz_mvp_value object_value(uint16_t handle) {
-    return (struct recorz_mvp_value){RECORZ_MVP_VALUE_OBJECT, (int32_t)handle, 0};
+    return (struct recorz_mvp_value){(uintptr_t)handle << 2U};
+}
+
+static uint8_t value_is_nil(struct recorz_mvp_value value) {
+    return (uint8_t)(value.bits == 0U);
+}
+
+static uint8_t value_is_object(struct recorz_mvp_value value) {
+    return (uint8_t)((value.bits & VALUE_TAG_MASK) == 0U && value.bits != 0U);
+}
+
+static uint8_t value_is_string(struct recorz_mvp_value value) {
+    return (uint8_t)((value.bits & VALUE_TAG_MASK) == VALUE_TAG_STRING);
+}
+
+static uint8_t value_is_small_integer(struct recorz_mvp_value value) {
+    return (uint8_t)(value.bits & 1U);
+}
+
+static uint8_t value_kind(struct recorz_mvp_value value) {
+    if (value_is_small_integer(value)) {
+        return RECORZ_MVP_VALUE_SMALL_INTEGER;
+    }
+    if (value_is_string(value)) {
+        return RECORZ_MVP_VALUE_STRING;
+    }
+    return value.bits == 0U ? RECORZ_MVP_VALUE_NIL : RECORZ_MVP_VALUE_OBJECT;
+}
+
+static uint16_t value_handle(struct recorz_mvp_value value) {
+    return (uint16_t)(value.bits >> 2U);
+}
+
+static int32_t value_small_integer(struct recorz_mvp_value value) {
+    return (int32_t)((intptr_t)value.bits >> 1);
+}
+
+/* The integer payload of a SmallInteger or the handle of an object; zero for nil and strings. */
+static int32_t value_integer(struct recorz_mvp_value value) {
+    if (value_is_small_integer(value)) {
+        return value_small_integer(value);
+    }
+    if ((value.bits & VALUE_TAG_MASK) == 0U) {
+        return (int32_t)value_handle(value);
+    }
+    return 0;
+}
+
+static const char *value_string(struct recorz_mvp_value value) {
+    if (!value_is_string(value) || value.bits == VALUE_TAG_STRING) {
+        return 0;
+    }
+    return (const char *)((uintptr_t)heap + (uintptr_t)((intptr_t)value.bits >> 2));
 }
 
 static struct recorz_mvp_value global_value(uint8_t global_id) {
@@ -4444,45 +5252,80 @@ static struct recorz_mvp_value seed_root_value(uint32_t root_id) {
 }
 
 static struct recorz_mvp_value string_value(const char *text) {
-    return (struct recorz_mvp_value){RECORZ_MVP_VALUE_STRING, 0, text};
+    intptr_t displacement;
+
+    if (text == 0) {
+        return (struct recorz_mvp_value){VALUE_TAG_STRING};
+    }
+    displacement = (intptr_t)((uintptr_t)text - (uintptr_t)heap);
+    if (displacement == 0 || ((intptr_t)((uintptr_t)displacement << 2U) >> 2) != displacement) {
+        machine_panic("string is outside the value displacement range");
+    }
+    return (struct recorz_mvp_value){((uintptr_t)displacement << 2U) | VALUE_TAG_STRING};
 }
 
 static struct recorz_mvp_value small_integer_value(int32_t integer) {
-    return (struct recorz_mvp_value){RECORZ_MVP_VALUE_SMALL_INTEGER, integer, 0};
+    if (integer < SMALL_INTEGER_MIN || integer > SMALL_INTEGER_MAX) {
+        machine_panic("small integer is out of range");
+    }
+    return (struct recorz_mvp_value){((uintptr_t)(intptr_t)integer << 1U) | 1U};
 }
 
 static uint8_t condition_value_is_true(struct recorz_mvp_value value) {
-    if (value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(value)) {
         machine_panic("conditional branch expects a boolean object");
     }
-    if ((uint16_t)value.integer == global_handles[RECORZ_MVP_GLOBAL_TRUE]) {
+    if (value.bits == object_value(global_handles[RECORZ_MVP_GLOBAL_TRUE]).bits) {
         return 1U;
     }
-    if ((uint16_t)value.integer == global_handles[RECORZ_MVP_GLOBAL_FALSE]) {
+    if (value.bits == object_value(global_handles[RECORZ_MVP_GLOBAL_FALSE]).bits) {
         return 0U;
     }
     machine_panic("conditional branch expects true or false");
     return 0U;
 }
 
-static uint8_t value_equals(struct recorz_mvp_value left, struct recorz_mvp_value right) {
-    if (left.kind != right.kind) {
-        return 0U;
-    }
-    switch (left.kind) {
-        case RECORZ_MVP_VALUE_NIL:
-            return 1U;
-        case RECORZ_MVP_VALUE_SMALL_INTEGER:
-        case RECORZ_MVP_VALUE_OBJECT:
-            return (uint8_t)(left.integer == right.integer);
-        case RECORZ_MVP_VALUE_STRING:
-            if (left.string == 0 || right.string == 0) {
-                return (uint8_t)(left.string == right.string);
-            }
-            return source_names_equal(left.string, right.string);
-    }
-    machine_panic("unsupported value kind in equality check");
-    return 0U;
+static uint8_t value_is_large_positive_integer(struct recorz_mvp_value value) {
+    return (uint8_t)(
+        value_is_object(value) &&
+        heap_object_for_value(value)->kind == RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER
+    );
+}
+
+static uint8_t value_is_integer(struct recorz_mvp_value value) {
+    return (uint8_t)(value_is_small_integer(value) || value_is_large_positive_integer(value));
+}
+
+/* LargePositiveInteger keeps its magnitude as four 16-bit SmallInteger digits, least significant first. */
+static uint64_t large_positive_integer_magnitude(const struct recorz_mvp_heap_object *object) {
+    uint64_t magnitude = 0U;
+    uint8_t digit_index = LARGE_POSITIVE_INTEGER_DIGIT_COUNT;
+
+    while (digit_index > 0U) {
+        --digit_index;
+        magnitude = (magnitude << 16U) | small_integer_u32(
+            heap_get_field(object, (uint8_t)(LARGE_POSITIVE_INTEGER_FIELD_DIGIT0 + digit_index)),
+            "LargePositiveInteger digit is not a small integer"
+        );
+    }
+    return magnitude;
+}
+
+static uint8_t value_equals(struct recorz_mvp_value left, struct recorz_mvp_value right) {
+    if (left.bits == right.bits) {
+        return 1U;
+    }
+    if (value_is_large_positive_integer(left) && value_is_large_positive_integer(right)) {
+        return (uint8_t)(
+            large_positive_integer_magnitude(heap_object_for_value(left)) ==
+            large_positive_integer_magnitude(heap_object_for_value(right))
+        );
+    }
+    if (!value_is_string(left) || !value_is_string(right) ||
+        value_string(left) == 0 || value_string(right) == 0) {
+        return 0U;
+    }
+    return source_names_equal(value_string(left), value_string(right));
 }
 
 static void render_small_integer(int32_t value) {
@@ -4572,6 +5415,33 @@ static void append_memory_report_stat(
     append_memory_report_text(buffer, offset, "\n");
 }
 
+static void snapshot_note_object_write(uint16_t handle) {
+    uint16_t slot = (uint16_t)(handle - 1U);
+
+    snapshot_dirty_bits[slot >> 3U] |= (uint8_t)(1U << (slot & 7U));
+}
+
+static uint8_t snapshot_object_is_dirty(uint16_t handle) {
+    uint16_t slot = (uint16_t)(handle - 1U);
+
+    return (uint8_t)((snapshot_dirty_bits[slot >> 3U] & (uint8_t)(1U << (slot & 7U))) != 0U);
+}
+
+static void snapshot_note_live_method_source_write(uint32_t source_index, uint32_t pool_offset) {
+    if (source_index < snapshot_dirty_live_method_source_index) {
+        snapshot_dirty_live_method_source_index = source_index;
+    }
+    if (pool_offset < snapshot_dirty_live_method_source_pool_offset) {
+        snapshot_dirty_live_method_source_pool_offset = pool_offset;
+    }
+}
+
+static void snapshot_note_compiled_method_body_write(uint32_t word_offset) {
+    if (word_offset < snapshot_dirty_compiled_method_body_word) {
+        snapshot_dirty_compiled_method_body_word = word_offset;
+    }
+}
+
 static uint8_t heap_handle_is_live(uint16_t handle) {
     return (uint8_t)(handle != 0U && handle <= heap_size && heap[handle - 1U].kind != 0U);
 }
@@ -4584,12 +5454,17 @@ static void heap_reset_slot(uint16_t handle) {
         machine_panic("heap slot handle is out of range");
     }
     object = &heap[handle - 1U];
+    snapshot_note_object_write(handle);
     object->kind = 0U;
     object->field_count = 0U;
+    compiled_method_decoded_offsets[handle - 1U] = 0U;
     object->class_handle = 0U;
     for (field_index = 0U; field_index < OBJECT_FIELD_LIMIT; ++field_index) {
         object->fields[field_index] = nil_value();
     }
+    if (handle < heap_free_hint) {
+        heap_free_hint = handle;
+    }
 }
 
 static uint8_t gc_mark_bit_is_set(uint16_t handle) {
@@ -4612,34 +5487,142 @@ static void gc_clear_mark_bits(void) {
     }
 }
 
-static void gc_push_temp_root(uint16_t handle) {
-    if (gc_temp_root_count >= GC_TEMP_ROOT_LIMIT) {
-        machine_panic("garbage collector temporary root stack overflow");
+static uint8_t gc_handle_is_young(uint16_t handle) {
+    uint16_t slot = (uint16_t)(handle - 1U);
+
+    return (uint8_t)((gc_young_bits[slot >> 3U] & (uint8_t)(1U << (slot & 7U))) != 0U);
+}
+
+static uint8_t gc_handle_is_remembered(uint16_t handle) {
+    uint16_t slot = (uint16_t)(handle - 1U);
+
+    return (uint8_t)((gc_remembered_bits[slot >> 3U] & (uint8_t)(1U << (slot & 7U))) != 0U);
+}
+
+static void gc_note_young_allocation(uint16_t handle) {
+    uint16_t slot = (uint16_t)(handle - 1U);
+
+    if (gc_nursery_count >= GC_NURSERY_LIMIT) {
+        gc_nursery_overflowed = 1U;
+        return;
+    }
+    gc_young_bits[slot >> 3U] |= (uint8_t)(1U << (slot & 7U));
+    gc_nursery_handles[gc_nursery_count++] = handle;
+}
+
+static void gc_remember_young_reference(uint16_t owner_handle, uint16_t referenced_handle) {
+    uint16_t slot = (uint16_t)(owner_handle - 1U);
+
+    if (referenced_handle == 0U ||
+        referenced_handle > HEAP_LIMIT ||
+        !gc_handle_is_young(referenced_handle) ||
+        gc_handle_is_young(owner_handle) ||
+        gc_handle_is_remembered(owner_handle)) {
+        return;
+    }
+    if (gc_remembered_count >= GC_REMEMBERED_SET_LIMIT) {
+        gc_remembered_set_overflowed = 1U;
+        return;
+    }
+    gc_remembered_bits[slot >> 3U] |= (uint8_t)(1U << (slot & 7U));
+    gc_remembered_handles[gc_remembered_count++] = owner_handle;
+}
+
+static void gc_reset_generations(void) {
+    uint16_t index;
+
+    for (index = 0U; index < gc_nursery_count; ++index) {
+        uint16_t slot = (uint16_t)(gc_nursery_handles[index] - 1U);
+
+        gc_young_bits[slot >> 3U] &= (uint8_t)~(1U << (slot & 7U));
+    }
+    for (index = 0U; index < gc_remembered_count; ++index) {
+        uint16_t slot = (uint16_t)(gc_remembered_handles[index] - 1U);
+
+        gc_remembered_bits[slot >> 3U] &= (uint8_t)~(1U << (slot & 7U));
     }
-    gc_temp_roots[gc_temp_root_count++] = handle;
+    gc_nursery_count = 0U;
+    gc_nursery_safepoint_count = 0U;
+    gc_nursery_overflowed = 0U;
+    gc_remembered_count = 0U;
+    gc_remembered_set_overflowed = 0U;
+    gc_allocated_since_collection_count = 0U;
+}
+
+static void gc_push_root_frame(struct recorz_mvp_gc_root_frame *frame) {
+    frame->previous = gc_root_frames;
+    gc_root_frames = frame;
+}
+
+static void gc_root_values(
+    struct recorz_mvp_gc_root_frame *frame,
+    const struct recorz_mvp_value *values,
+    uint32_t count
+) {
+    frame->values = values;
+    frame->fixed_value_count = count;
+    frame->value_count = &frame->fixed_value_count;
+    frame->handles = 0;
+    frame->handle_count = 0U;
+    gc_push_root_frame(frame);
+}
+
+static void gc_root_value_stack(
+    struct recorz_mvp_gc_root_frame *frame,
+    const struct recorz_mvp_value *values,
+    const uint32_t *count
+) {
+    frame->values = values;
+    frame->fixed_value_count = 0U;
+    frame->value_count = count;
+    frame->handles = 0;
+    frame->handle_count = 0U;
+    gc_push_root_frame(frame);
+}
+
+static void gc_root_handles(struct recorz_mvp_gc_root_frame *frame, const uint16_t *handles, uint32_t count) {
+    frame->values = 0;
+    frame->fixed_value_count = 0U;
+    frame->value_count = &frame->fixed_value_count;
+    frame->handles = handles;
+    frame->handle_count = count;
+    gc_push_root_frame(frame);
 }
 
-static void gc_pop_temp_root(void) {
-    if (gc_temp_root_count == 0U) {
-        machine_panic("garbage collector temporary root stack underflow");
+static void gc_root_source_method_context(
+    struct recorz_mvp_gc_root_frame *frame,
+    const struct recorz_mvp_source_method_context *context
+) {
+    gc_root_values(frame, &context->receiver, 1U);
+    frame->handles = &context->current_context_handle;
+    frame->handle_count = 1U;
+}
+
+/* Drops the frame along with any frames pushed after it. */
+static void gc_unroot(struct recorz_mvp_gc_root_frame *frame) {
+    while (gc_root_frames != frame) {
+        if (gc_root_frames == 0) {
+            machine_panic("garbage collector root frame is not registered");
+        }
+        gc_root_frames = gc_root_frames->previous;
     }
-    --gc_temp_root_count;
-    gc_temp_roots[gc_temp_root_count] = 0U;
+    gc_root_frames = frame->previous;
 }
 
 static void gc_mark_handle_if_live(uint16_t handle);
+static uint8_t heap_object_is_indexable_header(const struct recorz_mvp_heap_object *object);
+static void gc_mark_indexable_body_if_live(const struct recorz_mvp_heap_object *object);
+static uint16_t gc_collect_inside_primitive(void);
 
 static void gc_mark_value_if_live(struct recorz_mvp_value value) {
-    if (value.kind == RECORZ_MVP_VALUE_OBJECT) {
-        gc_mark_handle_if_live((uint16_t)value.integer);
+    if (value_is_object(value)) {
+        gc_mark_handle_if_live(value_handle(value));
     }
 }
 
 static void gc_mark_class_method_table_if_live(const struct recorz_mvp_heap_object *class_object) {
-    struct recorz_mvp_value method_start_value;
     uint32_t method_count;
-    uint16_t start_handle;
-    uint16_t method_offset;
+    uint32_t method_index;
 
     if (class_object->kind != RECORZ_MVP_OBJECT_CLASS) {
         return;
@@ -4648,31 +5631,14 @@ static void gc_mark_class_method_table_if_live(const struct recorz_mvp_heap_obje
         heap_get_field(class_object, CLASS_FIELD_METHOD_COUNT),
         "GC class method count is not a small integer"
     );
-    if (method_count == 0U) {
-        return;
-    }
-    method_start_value = heap_get_field(class_object, CLASS_FIELD_METHOD_START);
-    if (method_start_value.kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("GC class method start is not a method descriptor");
-    }
-    start_handle = (uint16_t)method_start_value.integer;
-    if (start_handle == 0U || (uint32_t)start_handle + method_count - 1U > heap_size) {
-        machine_panic("GC class method range is out of range");
-    }
-    for (method_offset = 0U; method_offset < method_count; ++method_offset) {
-        gc_mark_handle_if_live((uint16_t)(start_handle + method_offset));
+    for (method_index = 0U; method_index < method_count; ++method_index) {
+        gc_mark_handle_if_live(class_method_descriptor_handle_at(class_object, method_index));
     }
 }
 
-static void gc_mark_handle_if_live(uint16_t handle) {
-    const struct recorz_mvp_heap_object *object;
+static void gc_mark_object_references(const struct recorz_mvp_heap_object *object) {
     uint8_t field_index;
 
-    if (!heap_handle_is_live(handle) || gc_mark_bit_is_set(handle)) {
-        return;
-    }
-    gc_set_mark_bit(handle);
-    object = &heap[handle - 1U];
     if (object->class_handle != 0U) {
         gc_mark_handle_if_live(object->class_handle);
     }
@@ -4680,40 +5646,52 @@ static void gc_mark_handle_if_live(uint16_t handle) {
     for (field_index = 0U; field_index < object->field_count; ++field_index) {
         gc_mark_value_if_live(object->fields[field_index]);
     }
+    if (heap_object_is_indexable_header(object)) {
+        gc_mark_indexable_body_if_live(object);
+    }
 }
 
-static void gc_mark_conservative_stack_roots(void) {
-    uintptr_t marker = 0U;
-    uintptr_t start = (uintptr_t)&marker;
-    uintptr_t end = gc_stack_base_address;
-    uintptr_t scan;
-    uintptr_t heap_start = (uintptr_t)heap;
-    uintptr_t heap_end = (uintptr_t)(heap + heap_size);
-    uintptr_t object_size = (uintptr_t)sizeof(struct recorz_mvp_heap_object);
-
-    if (gc_stack_base_address == 0U) {
+static void gc_mark_handle_if_live(uint16_t handle) {
+    if (!heap_handle_is_live(handle) || gc_mark_bit_is_set(handle)) {
         return;
     }
-    if (start > end) {
-        uintptr_t swap = start;
-
-        start = end;
-        end = swap;
+    if (gc_minor_collection_active && !gc_handle_is_young(handle)) {
+        return;
+    }
+    gc_set_mark_bit(handle);
+    ++gc_pause_work;
+    if (gc_incremental_phase == GC_INCREMENTAL_MARK) {
+        if (gc_grey_count >= GC_GREY_STACK_LIMIT) {
+            gc_grey_stack_overflowed = 1U;
+            return;
+        }
+        gc_grey_stack[gc_grey_count++] = handle;
+        return;
     }
-    start &= ~((uintptr_t)sizeof(uintptr_t) - 1U);
-    end &= ~((uintptr_t)sizeof(uintptr_t) - 1U);
-    for (scan = start; scan <= end; scan += sizeof(uintptr_t)) {
-        uintptr_t raw = *(const uintptr_t *)scan;
+    gc_mark_object_references(&heap[handle - 1U]);
+}
+
+static void gc_mark_remembered_references(void) {
+    uint16_t index;
 
-        if (raw >= 1U && raw <= (uintptr_t)heap_size) {
-            gc_mark_handle_if_live((uint16_t)raw);
+    for (index = 0U; index < gc_remembered_count; ++index) {
+        if (heap_handle_is_live(gc_remembered_handles[index])) {
+            gc_mark_object_references(&heap[gc_remembered_handles[index] - 1U]);
         }
-        if (raw >= heap_start && raw < heap_end && object_size != 0U) {
-            uintptr_t offset = raw - heap_start;
+    }
+}
 
-            if ((offset % object_size) == 0U) {
-                gc_mark_handle_if_live((uint16_t)(offset / object_size) + 1U);
-            }
+static void gc_mark_root_frames(void) {
+    const struct recorz_mvp_gc_root_frame *frame;
+
+    for (frame = gc_root_frames; frame != 0; frame = frame->previous) {
+        uint32_t index;
+
+        for (index = 0U; index < *frame->value_count; ++index) {
+            gc_mark_value_if_live(frame->values[index]);
+        }
+        for (index = 0U; index < frame->handle_count; ++index) {
+            gc_mark_handle_if_live(frame->handles[index]);
         }
     }
 }
@@ -4737,7 +5715,7 @@ static void gc_mark_roots(void) {
         gc_mark_handle_if_live(class_handles_by_kind[handle]);
         gc_mark_handle_if_live(class_descriptor_handles_by_kind[handle]);
     }
-    for (handle = RECORZ_MVP_SELECTOR_SHOW; handle <= MAX_SELECTOR_ID; ++handle) {
+    for (handle = RECORZ_MVP_SELECTOR_SHOW; handle <= last_selector_id(); ++handle) {
         gc_mark_handle_if_live(selector_handles_by_id[handle]);
     }
     gc_mark_handle_if_live(default_form_handle);
@@ -4750,6 +5728,7 @@ static void gc_mark_roots(void) {
     gc_mark_handle_if_live(transcript_behavior_handle);
     gc_mark_handle_if_live(transcript_font_handle);
     gc_mark_handle_if_live(startup_hook_receiver_handle);
+    gc_mark_handle_if_live(snapshot_restored_startup_hook_receiver_handle);
     for (index = 0U; index < 128U; ++index) {
         gc_mark_handle_if_live(glyph_bitmap_handles[index]);
     }
@@ -4771,7 +5750,7 @@ static void gc_mark_roots(void) {
             uint16_t binding_index;
 
             for (binding_index = 0U; binding_index < source_eval_environments[index].binding_count; ++binding_index) {
-                gc_mark_value_if_live(source_eval_environments[index].bindings[binding_index].value);
+                gc_mark_value_if_live(source_eval_environments[index].values[binding_index]);
             }
         }
     }
@@ -4784,8 +5763,9 @@ static void gc_mark_roots(void) {
             }
         }
     }
-    for (index = 0U; index < gc_temp_root_count; ++index) {
-        gc_mark_handle_if_live(gc_temp_roots[index]);
+    for (index = 0U; index < activation_frame_count; ++index) {
+        gc_mark_handle_if_live(activation_frames[index].context_handle);
+        gc_mark_value_if_live(activation_frames[index].receiver);
     }
     for (index = 0U; index < SCHEDULED_PROCESS_LIMIT; ++index) {
         if (!scheduled_processes[index].in_use) {
@@ -4822,7 +5802,21 @@ static void gc_mark_roots(void) {
             gc_mark_value_if_live(scheduled_activation_records[index].stack[stack_value_index]);
         }
     }
-    gc_mark_conservative_stack_roots();
+    gc_mark_root_frames();
+    if (gc_minor_collection_active) {
+        gc_mark_remembered_references();
+    }
+}
+
+static uint16_t gc_finish_sweep(uint16_t reclaimed) {
+    while (heap_size != 0U && !heap_handle_is_live(heap_size)) {
+        --heap_size;
+    }
+    if (reclaimed > heap_live_count) {
+        machine_panic("garbage collector reclaimed more objects than are live");
+    }
+    heap_live_count = (uint16_t)(heap_live_count - reclaimed);
+    return reclaimed;
 }
 
 static uint16_t gc_sweep_unmarked_slots(void) {
@@ -4830,20 +5824,38 @@ static uint16_t gc_sweep_unmarked_slots(void) {
     uint16_t reclaimed = 0U;
 
     for (handle = 1U; handle <= heap_size; ++handle) {
+        ++gc_pause_work;
         if (!heap_handle_is_live(handle) || gc_mark_bit_is_set(handle)) {
             continue;
         }
         heap_reset_slot(handle);
         ++reclaimed;
     }
-    while (heap_size != 0U && !heap_handle_is_live(heap_size)) {
-        --heap_size;
-    }
-    if (reclaimed > heap_live_count) {
-        machine_panic("garbage collector reclaimed more objects than are live");
+    return gc_finish_sweep(reclaimed);
+}
+
+static uint16_t gc_sweep_unmarked_young_slots(uint8_t *method_state_reclaimed) {
+    uint16_t index;
+    uint16_t reclaimed = 0U;
+
+    for (index = 0U; index < gc_nursery_count; ++index) {
+        uint16_t handle = gc_nursery_handles[index];
+        uint8_t kind;
+
+        ++gc_pause_work;
+        if (!heap_handle_is_live(handle) || gc_mark_bit_is_set(handle)) {
+            continue;
+        }
+        kind = heap[handle - 1U].kind;
+        if (kind == RECORZ_MVP_OBJECT_CLASS ||
+            kind == RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR ||
+            kind == RECORZ_MVP_OBJECT_COMPILED_METHOD) {
+            *method_state_reclaimed = 1U;
+        }
+        heap_reset_slot(handle);
+        ++reclaimed;
     }
-    heap_live_count = (uint16_t)(heap_live_count - reclaimed);
-    return reclaimed;
+    return gc_finish_sweep(reclaimed);
 }
 
 static uint16_t gc_release_unused_source_state(void) {
@@ -4864,45 +5876,309 @@ static uint16_t gc_release_unused_source_state(void) {
     return released;
 }
 
+static void gc_pause_begin(void) {
+    gc_pause_work = 0U;
+}
+
+static void gc_pause_end(void) {
+    gc_last_pause_work = gc_pause_work;
+    if (gc_pause_work > gc_max_pause_work) {
+        gc_max_pause_work = gc_pause_work;
+    }
+}
+
+static void gc_incremental_cancel(void) {
+    gc_incremental_phase = GC_INCREMENTAL_IDLE;
+    gc_grey_count = 0U;
+    gc_grey_stack_overflowed = 0U;
+}
+
+static uint16_t gc_record_full_collection(uint16_t reclaimed) {
+    initialize_runtime_caches();
+    gc_reset_generations();
+    gc_promoted_since_full_count = 0U;
+    gc_last_reclaimed_count = reclaimed;
+    gc_total_reclaimed_count += reclaimed;
+    ++gc_collection_count;
+    return reclaimed;
+}
+
+static uint16_t gc_complete_collection(uint16_t reclaimed) {
+    if (gc_release_unused_source_state() != 0U) {
+        gc_clear_mark_bits();
+        gc_mark_roots();
+        reclaimed = (uint16_t)(reclaimed + gc_sweep_unmarked_slots());
+    }
+    runtime_string_compact_live_references();
+    compiled_method_body_compact();
+    method_dictionary_compact();
+    return gc_record_full_collection(reclaimed);
+}
+
 static uint16_t gc_collect_now(void) {
     uint16_t reclaimed;
 
+    gc_incremental_cancel();
+    gc_pause_begin();
+    gc_clear_mark_bits();
+    gc_mark_roots();
+    reclaimed = gc_complete_collection(gc_sweep_unmarked_slots());
+    gc_pause_end();
+    return reclaimed;
+}
+
+static uint16_t gc_collect_young_now(void) {
+    uint16_t reclaimed;
+    uint8_t method_state_reclaimed = 0U;
+
+    gc_pause_begin();
+    gc_minor_collection_active = 1U;
     gc_clear_mark_bits();
     gc_mark_roots();
-    reclaimed = gc_sweep_unmarked_slots();
+    reclaimed = gc_sweep_unmarked_young_slots(&method_state_reclaimed);
     if (gc_release_unused_source_state() != 0U) {
         gc_clear_mark_bits();
         gc_mark_roots();
-        reclaimed = (uint16_t)(reclaimed + gc_sweep_unmarked_slots());
+        reclaimed = (uint16_t)(reclaimed + gc_sweep_unmarked_young_slots(&method_state_reclaimed));
     }
-    runtime_string_compact_live_references();
-    initialize_runtime_caches();
+    gc_minor_collection_active = 0U;
+    if (method_state_reclaimed) {
+        initialize_runtime_caches();
+    }
+    gc_promoted_since_full_count += (uint32_t)(gc_nursery_count - reclaimed);
+    gc_reset_generations();
     gc_last_reclaimed_count = reclaimed;
     gc_total_reclaimed_count += reclaimed;
     ++gc_collection_count;
+    ++gc_minor_collection_count;
+    gc_pause_end();
     return reclaimed;
 }
 
-static void gc_collect_preserving_value(struct recorz_mvp_value value) {
-    if (value.kind == RECORZ_MVP_VALUE_OBJECT) {
-        gc_push_temp_root((uint16_t)value.integer);
-        (void)gc_collect_now();
-        gc_pop_temp_root();
+/* Collections that run while C frames further out may still hold string or method body pointers
+   only sweep heap slots; the pools wait for the next do-it boundary to compact them. */
+static uint16_t gc_collect_without_compaction(void) {
+    uint16_t reclaimed;
+
+    gc_incremental_cancel();
+    gc_pause_begin();
+    gc_clear_mark_bits();
+    gc_mark_roots();
+    reclaimed = gc_record_full_collection(gc_sweep_unmarked_slots());
+    gc_pause_end();
+    return reclaimed;
+}
+
+static uint8_t gc_young_collection_is_sufficient(void) {
+    return (uint8_t)(gc_nursery_overflowed == 0U &&
+                     gc_remembered_set_overflowed == 0U &&
+                     gc_promoted_since_full_count < (HEAP_LIMIT / 4U) &&
+                     runtime_string_pool_offset < (RUNTIME_STRING_POOL_LIMIT / 4U) &&
+                     compiled_method_body_words_used < (COMPILED_METHOD_BODY_WORD_LIMIT / 2U) &&
+                     method_dictionary_slots_used < (METHOD_DICTIONARY_SLOT_LIMIT / 2U));
+}
+
+static uint8_t gc_collection_can_wait_for_idle(void) {
+    return (uint8_t)(gc_input_session_depth != 0U &&
+                     heap_live_count < (HEAP_LIMIT / 2U) &&
+                     runtime_string_pool_offset < (RUNTIME_STRING_POOL_LIMIT / 2U) &&
+                     compiled_method_body_words_used < (COMPILED_METHOD_BODY_WORD_LIMIT / 2U) &&
+                     method_dictionary_slots_used < (METHOD_DICTIONARY_SLOT_LIMIT / 2U));
+}
+
+static void gc_incremental_start(void) {
+    if (gc_incremental_phase != GC_INCREMENTAL_IDLE) {
+        return;
+    }
+    gc_pause_begin();
+    gc_clear_mark_bits();
+    gc_grey_count = 0U;
+    gc_grey_stack_overflowed = 0U;
+    gc_incremental_phase = GC_INCREMENTAL_MARK;
+    gc_mark_roots();
+    gc_pause_end();
+}
+
+/* Steps taken at a scheduler yield run inside the primitive that resumed the process, so a cycle
+   that ends there leaves the pools for the next do-it boundary to compact. */
+static void gc_incremental_step(uint8_t inside_primitive) {
+    uint16_t budget;
+
+    if (gc_incremental_phase == GC_INCREMENTAL_IDLE) {
+        return;
+    }
+    gc_pause_begin();
+    ++gc_incremental_step_count;
+    if (gc_incremental_phase == GC_INCREMENTAL_MARK) {
+        for (budget = GC_INCREMENTAL_MARK_BUDGET; budget != 0U && gc_grey_count != 0U; --budget) {
+            uint16_t handle = gc_grey_stack[--gc_grey_count];
+
+            if (heap_handle_is_live(handle)) {
+                gc_mark_object_references(&heap[handle - 1U]);
+            }
+        }
+        if (gc_grey_stack_overflowed) {
+            gc_pause_end();
+            if (inside_primitive) {
+                (void)gc_collect_inside_primitive();
+            } else {
+                (void)gc_collect_now();
+            }
+            return;
+        }
+        if (gc_grey_count == 0U) {
+            gc_incremental_phase = GC_INCREMENTAL_SWEEP;
+            gc_mark_roots();
+            gc_incremental_sweep_cursor = 1U;
+            gc_incremental_reclaimed = 0U;
+        }
+        gc_pause_end();
+        return;
+    }
+    for (budget = GC_INCREMENTAL_SWEEP_BUDGET;
+         budget != 0U && gc_incremental_sweep_cursor <= heap_size;
+         --budget, ++gc_incremental_sweep_cursor) {
+        uint16_t handle = gc_incremental_sweep_cursor;
+        uint8_t kind;
+
+        ++gc_pause_work;
+        if (!heap_handle_is_live(handle) || gc_mark_bit_is_set(handle)) {
+            continue;
+        }
+        kind = heap[handle - 1U].kind;
+        heap_reset_slot(handle);
+        --heap_live_count;
+        ++gc_incremental_reclaimed;
+        if (kind == RECORZ_MVP_OBJECT_CLASS ||
+            kind == RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR ||
+            kind == RECORZ_MVP_OBJECT_COMPILED_METHOD) {
+            initialize_runtime_caches();
+        }
+    }
+    if (gc_incremental_sweep_cursor > heap_size) {
+        gc_incremental_phase = GC_INCREMENTAL_IDLE;
+        (void)gc_finish_sweep(0U);
+        if (inside_primitive) {
+            (void)gc_record_full_collection(gc_incremental_reclaimed);
+        } else {
+            (void)gc_complete_collection(gc_incremental_reclaimed);
+        }
+    }
+    gc_pause_end();
+}
+
+static void gc_collect_now_or_when_idle(void) {
+    if (gc_collection_can_wait_for_idle()) {
+        gc_incremental_start();
         return;
     }
     (void)gc_collect_now();
 }
 
+static void gc_collect_preserving_value(struct recorz_mvp_value value) {
+    struct recorz_mvp_gc_root_frame root_frame;
+
+    if (gc_incremental_phase != GC_INCREMENTAL_IDLE && gc_collection_can_wait_for_idle()) {
+        return;
+    }
+    gc_root_values(&root_frame, &value, 1U);
+    if (gc_incremental_phase == GC_INCREMENTAL_IDLE && gc_young_collection_is_sufficient()) {
+        (void)gc_collect_young_now();
+    } else {
+        gc_collect_now_or_when_idle();
+    }
+    gc_unroot(&root_frame);
+}
+
 static uint8_t gc_collection_allowed_for_current_phase(void) {
     return (uint8_t)(gc_bootstrap_file_in_active == 0U);
 }
 
+static uint8_t gc_occupancy_exceeds_trigger(uint32_t used, uint32_t limit) {
+    return (uint8_t)((used * 100U) >= (limit * GC_OCCUPANCY_TRIGGER_PERCENT));
+}
+
+/* Between bytecodes every live value sits in a rooted interpreter stack or activation, so sends and
+   backward jumps collect once the allocation trigger trips rather than letting a long do-it run
+   the heap out before it reaches its end. Inside an editor session a full collection is left to an
+   incremental cycle for as long as the heap has headroom. */
+static void gc_bytecode_safepoint(void) {
+    gc_nursery_safepoint_count = gc_nursery_count;
+    if (gc_allocated_since_collection_count < GC_ALLOCATION_TRIGGER ||
+        !gc_collection_allowed_for_current_phase()) {
+        return;
+    }
+    if (gc_incremental_phase == GC_INCREMENTAL_IDLE && gc_young_collection_is_sufficient()) {
+        (void)gc_collect_young_now();
+    } else if (gc_collection_can_wait_for_idle()) {
+        gc_incremental_start();
+    } else {
+        (void)gc_collect_without_compaction();
+    }
+}
+
+/* Interactive entry points only collect once enough has been allocated or a pool is filling up,
+   so a do-it on a large live heap does not pay for a mark and sweep it has no use for. */
+static uint8_t gc_collection_is_due(void) {
+    if (!gc_collection_allowed_for_current_phase()) {
+        return 0U;
+    }
+    return (uint8_t)(gc_incremental_phase != GC_INCREMENTAL_IDLE ||
+                     gc_allocated_since_collection_count >= GC_ALLOCATION_TRIGGER ||
+                     gc_nursery_overflowed != 0U ||
+                     gc_remembered_set_overflowed != 0U ||
+                     gc_occupancy_exceeds_trigger(heap_live_count, HEAP_LIMIT) ||
+                     gc_occupancy_exceeds_trigger(runtime_string_pool_offset, RUNTIME_STRING_POOL_LIMIT) ||
+                     gc_occupancy_exceeds_trigger(compiled_method_body_words_used, COMPILED_METHOD_BODY_WORD_LIMIT) ||
+                     gc_occupancy_exceeds_trigger(method_dictionary_slots_used, METHOD_DICTIONARY_SLOT_LIMIT));
+}
+
+/* A full heap or a checkpoint save can be reached inside a primitive whose fresh objects only live
+   in C locals, so the objects allocated since the last bytecode safepoint stay as roots and the pools
+   are left uncompacted. Without a complete nursery there is no way to tell which objects those are. */
+static uint16_t gc_collect_inside_primitive(void) {
+    uint16_t index;
+    uint16_t reclaimed;
+
+    if (!gc_collection_allowed_for_current_phase() || gc_nursery_overflowed) {
+        return 0U;
+    }
+    gc_incremental_cancel();
+    gc_pause_begin();
+    gc_clear_mark_bits();
+    gc_mark_roots();
+    for (index = gc_nursery_safepoint_count; index < gc_nursery_count; ++index) {
+        gc_mark_handle_if_live(gc_nursery_handles[index]);
+    }
+    reclaimed = gc_record_full_collection(gc_sweep_unmarked_slots());
+    gc_pause_end();
+    return reclaimed;
+}
+
+static char wait_for_input_byte_collecting_garbage(void) {
+    char ch;
+
+    while (!machine_try_getc(&ch)) {
+        if (gc_collection_allowed_for_current_phase()) {
+            gc_incremental_step(0U);
+        }
+    }
+    return ch;
+}
+
 static uint16_t heap_find_free_run(uint16_t count) {
-    uint16_t handle = 1U;
+    uint16_t handle;
 
     if (count == 0U) {
         machine_panic("heap allocation run count is zero");
     }
+    if (heap_free_hint == 0U || heap_free_hint > heap_size) {
+        heap_free_hint = (uint16_t)(heap_size + 1U);
+    }
+    while (heap_free_hint <= heap_size && heap_handle_is_live(heap_free_hint)) {
+        ++heap_free_hint;
+    }
+    handle = heap_free_hint;
     while (handle <= heap_size) {
         uint16_t start_handle = handle;
         uint16_t run_length = 0U;
@@ -4936,13 +6212,24 @@ static void heap_initialize_allocated_slot(uint16_t handle, uint8_t kind) {
     }
     heap_reset_slot(handle);
     heap[handle - 1U].kind = kind;
+    if (handle == heap_free_hint) {
+        heap_free_hint = (uint16_t)(handle + 1U);
+    }
     ++heap_live_count;
+    ++gc_allocated_since_collection_count;
+    gc_note_young_allocation(handle);
+    if (gc_incremental_phase != GC_INCREMENTAL_IDLE) {
+        gc_set_mark_bit(handle);
+    }
 }
 
 static uint16_t heap_allocate_run(uint8_t kind, uint16_t count) {
     uint16_t start_handle = heap_find_free_run(count);
     uint16_t offset;
 
+    if (start_handle == 0U && gc_collect_inside_primitive() != 0U) {
+        start_handle = heap_find_free_run(count);
+    }
     if (start_handle == 0U) {
         machine_panic("object heap overflow");
     }
@@ -4956,30 +6243,562 @@ static uint16_t heap_allocate(uint8_t kind) {
     return heap_allocate_run(kind, 1U);
 }
 
-static uint16_t heap_allocate_seeded_class_run(uint8_t kind, uint16_t count) {
-    uint16_t start_handle = heap_allocate_run(kind, count);
-    uint16_t offset;
+static uint16_t heap_allocate_seeded_class(uint8_t kind) {
+    uint16_t handle = heap_allocate(kind);
 
     if (kind <= MAX_OBJECT_KIND && class_handles_by_kind[kind] != 0U) {
-        for (offset = 0U; offset < count; ++offset) {
-            heap_set_class((uint16_t)(start_handle + offset), class_handles_by_kind[kind]);
-        }
+        heap_set_class(handle, class_handles_by_kind[kind]);
     }
-    return start_handle;
+    return handle;
 }
 
-static uint16_t heap_allocate_seeded_class(uint8_t kind) {
-    uint16_t handle = heap_allocate(kind);
+static uint8_t object_kind_is_indexable(uint32_t kind) {
+    return (uint8_t)(kind == RECORZ_MVP_OBJECT_ARRAY ||
+                     kind == RECORZ_MVP_OBJECT_BYTE_ARRAY ||
+                     kind == RECORZ_MVP_OBJECT_WORD_ARRAY);
+}
 
-    if (kind <= MAX_OBJECT_KIND && class_handles_by_kind[kind] != 0U) {
-        heap_set_class(handle, class_handles_by_kind[kind]);
+/* An indexable object is a run of slots: the header carries the class and the element count, and
+   each following body slot has no class and packs its elements into OBJECT_FIELD_LIMIT values.
+   WordArray splits each unsigned 32-bit word into two 16-bit halves, low half first. */
+static uint8_t heap_object_is_indexable_header(const struct recorz_mvp_heap_object *object) {
+    return (uint8_t)(object_kind_is_indexable(object->kind) && object->class_handle != 0U);
+}
+
+static uint8_t heap_object_is_indexable_body(const struct recorz_mvp_heap_object *object) {
+    return (uint8_t)(object_kind_is_indexable(object->kind) && object->class_handle == 0U);
+}
+
+static uint32_t indexable_elements_per_body_slot(uint8_t kind) {
+    if (kind == RECORZ_MVP_OBJECT_BYTE_ARRAY) {
+        return OBJECT_FIELD_LIMIT * INDEXABLE_BYTES_PER_FIELD;
+    }
+    if (kind == RECORZ_MVP_OBJECT_WORD_ARRAY) {
+        return OBJECT_FIELD_LIMIT / INDEXABLE_FIELDS_PER_WORD;
+    }
+    return OBJECT_FIELD_LIMIT;
+}
+
+static uint32_t indexable_size(const struct recorz_mvp_heap_object *object) {
+    return small_integer_u32(heap_get_field(object, INDEXABLE_FIELD_SIZE), "indexable object size is not a small integer");
+}
+
+static uint16_t indexable_body_slot_count(uint8_t kind, uint32_t size) {
+    uint32_t per_slot = indexable_elements_per_body_slot(kind);
+
+    return (uint16_t)((size + per_slot - 1U) / per_slot);
+}
+
+static void gc_mark_indexable_body_if_live(const struct recorz_mvp_heap_object *object) {
+    uint16_t handle = heap_handle_for_object(object);
+    uint16_t body_count = indexable_body_slot_count(object->kind, indexable_size(object));
+    uint16_t offset;
+
+    for (offset = 1U; offset <= body_count; ++offset) {
+        gc_mark_handle_if_live((uint16_t)(handle + offset));
+    }
+}
+
+static uint16_t indexable_allocate(const struct recorz_mvp_heap_object *class_object, uint8_t kind, uint32_t size) {
+    struct recorz_mvp_value fill = kind == RECORZ_MVP_OBJECT_ARRAY ? nil_value() : small_integer_value(0);
+    uint16_t class_handle = heap_handle_for_object(class_object);
+    uint16_t body_count;
+    uint16_t handle;
+    uint16_t offset;
+    uint8_t field_index;
+
+    if (!object_kind_is_indexable(kind)) {
+        machine_panic("indexable allocation expects an indexable class");
+    }
+    if (size > (uint32_t)(HEAP_LIMIT - 1U) * indexable_elements_per_body_slot(kind)) {
+        machine_panic("indexable object size exceeds heap capacity");
+    }
+    body_count = indexable_body_slot_count(kind, size);
+    handle = heap_allocate_run(kind, (uint16_t)(body_count + 1U));
+    heap_set_class(handle, class_handle);
+    heap_set_field(handle, INDEXABLE_FIELD_SIZE, small_integer_value((int32_t)size));
+    for (offset = 1U; offset <= body_count; ++offset) {
+        for (field_index = 0U; field_index < OBJECT_FIELD_LIMIT; ++field_index) {
+            heap_set_field((uint16_t)(handle + offset), field_index, fill);
+        }
     }
     return handle;
 }
 
+static uint16_t indexable_element_location(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value index_value,
+    uint8_t *field_index,
+    uint8_t *byte_shift
+) {
+    uint32_t per_slot = indexable_elements_per_body_slot(object->kind);
+    uint32_t element;
+    uint32_t slot_element;
+
+    if (!value_is_small_integer(index_value)) {
+        machine_panic("indexable object index is not a small integer");
+    }
+    if (value_integer(index_value) <= 0 || (uint32_t)value_integer(index_value) > indexable_size(object)) {
+        machine_panic("indexable object index is out of range");
+    }
+    element = (uint32_t)value_integer(index_value) - 1U;
+    slot_element = element % per_slot;
+    if (object->kind == RECORZ_MVP_OBJECT_BYTE_ARRAY) {
+        *field_index = (uint8_t)(slot_element / INDEXABLE_BYTES_PER_FIELD);
+        *byte_shift = (uint8_t)((slot_element % INDEXABLE_BYTES_PER_FIELD) * 8U);
+    } else if (object->kind == RECORZ_MVP_OBJECT_WORD_ARRAY) {
+        *field_index = (uint8_t)(slot_element * INDEXABLE_FIELDS_PER_WORD);
+        *byte_shift = 0U;
+    } else {
+        *field_index = (uint8_t)slot_element;
+        *byte_shift = 0U;
+    }
+    return (uint16_t)(heap_handle_for_object(object) + 1U + (element / per_slot));
+}
+
+static struct recorz_mvp_value indexable_at(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value index_value
+) {
+    uint8_t field_index;
+    uint8_t byte_shift;
+    uint16_t body_handle = indexable_element_location(object, index_value, &field_index, &byte_shift);
+    struct recorz_mvp_value value = heap_get_field(heap_object(body_handle), field_index);
+    struct recorz_mvp_integer word;
+
+    if (object->kind == RECORZ_MVP_OBJECT_BYTE_ARRAY) {
+        return small_integer_value((int32_t)(((uint32_t)value_small_integer(value) >> byte_shift) & 0xFFU));
+    }
+    if (object->kind == RECORZ_MVP_OBJECT_WORD_ARRAY) {
+        word.negative = 0U;
+        word.magnitude = ((uint64_t)(uint32_t)value_small_integer(
+            heap_get_field(heap_object(body_handle), (uint8_t)(field_index + 1U))
+        ) << 16U) | (uint32_t)value_small_integer(value);
+        if (!integer_value(&word, &value)) {
+            machine_panic("WordArray element cannot be answered as an integer");
+        }
+    }
+    return value;
+}
+
+static void indexable_at_put(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value index_value,
+    struct recorz_mvp_value value
+) {
+    uint8_t field_index;
+    uint8_t byte_shift;
+    uint16_t body_handle = indexable_element_location(object, index_value, &field_index, &byte_shift);
+    struct recorz_mvp_integer word;
+    uint32_t packed;
+
+    if (object->kind == RECORZ_MVP_OBJECT_ARRAY) {
+        heap_set_field(body_handle, field_index, value);
+        return;
+    }
+    if (object->kind == RECORZ_MVP_OBJECT_WORD_ARRAY) {
+        if (!integer_from_value(value, &word)) {
+            machine_panic("WordArray element is not an integer");
+        }
+        if (word.negative || word.magnitude > 0xFFFFFFFFULL) {
+            machine_panic("WordArray element is out of word range");
+        }
+        heap_set_field(body_handle, field_index, small_integer_value((int32_t)(word.magnitude & 0xFFFFU)));
+        heap_set_field(body_handle, (uint8_t)(field_index + 1U), small_integer_value((int32_t)(word.magnitude >> 16U)));
+        return;
+    }
+    if (!value_is_small_integer(value)) {
+        machine_panic("indexable object element is not a small integer");
+    }
+    if (value_integer(value) < 0 || value_integer(value) > 0xFF) {
+        machine_panic("ByteArray element is out of byte range");
+    }
+    packed = (uint32_t)value_integer(heap_get_field(heap_object(body_handle), field_index));
+    packed &= ~(0xFFU << byte_shift);
+    packed |= (uint32_t)value_small_integer(value) << byte_shift;
+    heap_set_field(body_handle, field_index, small_integer_value((int32_t)packed));
+}
+
+static uint8_t small_integer_special_send(
+    uint8_t opcode,
+    struct recorz_mvp_value receiver,
+    struct recorz_mvp_value argument,
+    struct recorz_mvp_value *result
+) {
+    int32_t left;
+    int32_t right;
+    int32_t answer;
+    int64_t product;
+
+    if (!value_is_small_integer(receiver) || !value_is_small_integer(argument)) {
+        return 0U;
+    }
+    left = value_small_integer(receiver);
+    right = value_small_integer(argument);
+    switch (opcode) {
+        case RECORZ_MVP_OP_SEND_ADD:
+            answer = left + right;
+            break;
+        case RECORZ_MVP_OP_SEND_SUBTRACT:
+            answer = left - right;
+            break;
+        case RECORZ_MVP_OP_SEND_MULTIPLY:
+            product = (int64_t)left * right;
+            if (product < SMALL_INTEGER_MIN || product > SMALL_INTEGER_MAX) {
+                return 0U;
+            }
+            answer = (int32_t)product;
+            break;
+        case RECORZ_MVP_OP_SEND_LESS_THAN:
+            *result = boolean_value(left < right);
+            return 1U;
+        case RECORZ_MVP_OP_SEND_GREATER_THAN:
+            *result = boolean_value(left > right);
+            return 1U;
+        case RECORZ_MVP_OP_SEND_LESS_EQUAL:
+            *result = boolean_value(left <= right);
+            return 1U;
+        case RECORZ_MVP_OP_SEND_GREATER_EQUAL:
+            *result = boolean_value(left >= right);
+            return 1U;
+        case RECORZ_MVP_OP_SEND_EQUAL:
+            *result = boolean_value(left == right);
+            return 1U;
+        case RECORZ_MVP_OP_SEND_NOT_EQUAL:
+            *result = boolean_value(left != right);
+            return 1U;
+        case RECORZ_MVP_OP_SEND_INTEGER_DIVIDE:
+            if (right == 0) {
+                return 0U;
+            }
+            answer = left / right;
+            if (left % right != 0 && ((left < 0) != (right < 0))) {
+                --answer;
+            }
+            break;
+        case RECORZ_MVP_OP_SEND_MODULO:
+            if (right == 0) {
+                return 0U;
+            }
+            answer = left % right;
+            if (answer != 0 && ((answer < 0) != (right < 0))) {
+                answer += right;
+            }
+            break;
+        case RECORZ_MVP_OP_SEND_BIT_AND:
+            answer = left & right;
+            break;
+        case RECORZ_MVP_OP_SEND_BIT_OR:
+            answer = left | right;
+            break;
+        case RECORZ_MVP_OP_SEND_BIT_XOR:
+            answer = left ^ right;
+            break;
+        case RECORZ_MVP_OP_SEND_BIT_SHIFT:
+            if (right < 0) {
+                answer = left >> (right < -31 ? 31 : -right);
+            } else if (right > 30 || left > (SMALL_INTEGER_MAX >> right) || left < (SMALL_INTEGER_MIN >> right)) {
+                return 0U;
+            } else {
+                answer = (int32_t)((uint32_t)left << right);
+            }
+            break;
+        case RECORZ_MVP_OP_SEND_MAX:
+            *result = left >= right ? receiver : argument;
+            return 1U;
+        case RECORZ_MVP_OP_SEND_MIN:
+            *result = left <= right ? receiver : argument;
+            return 1U;
+        default:
+            return 0U;
+    }
+    if (answer < SMALL_INTEGER_MIN || answer > SMALL_INTEGER_MAX) {
+        return 0U;
+    }
+    *result = small_integer_value(answer);
+    return 1U;
+}
+
+static uint8_t integer_from_value(struct recorz_mvp_value value, struct recorz_mvp_integer *integer) {
+    if (value_is_small_integer(value)) {
+        int32_t small_integer = value_small_integer(value);
+
+        integer->negative = (uint8_t)(small_integer < 0);
+        integer->magnitude = (uint64_t)(small_integer < 0 ? -(int64_t)small_integer : (int64_t)small_integer);
+        return 1U;
+    }
+    if (value_is_large_positive_integer(value)) {
+        integer->negative = 0U;
+        integer->magnitude = large_positive_integer_magnitude(heap_object_for_value(value));
+        return 1U;
+    }
+    return 0U;
+}
+
+/* Results in SmallInteger range are always answered as SmallIntegers; there is no LargeNegativeInteger. */
+static uint8_t integer_value(const struct recorz_mvp_integer *integer, struct recorz_mvp_value *value) {
+    uint64_t magnitude = integer->magnitude;
+    uint16_t handle;
+    uint8_t digit_index;
+
+    if (integer->negative) {
+        if (magnitude > (uint64_t)(-(int64_t)SMALL_INTEGER_MIN)) {
+            return 0U;
+        }
+        *value = small_integer_value((int32_t)-(int64_t)magnitude);
+        return 1U;
+    }
+    if (magnitude <= (uint64_t)SMALL_INTEGER_MAX) {
+        *value = small_integer_value((int32_t)magnitude);
+        return 1U;
+    }
+    handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER);
+    for (digit_index = 0U; digit_index < LARGE_POSITIVE_INTEGER_DIGIT_COUNT; ++digit_index) {
+        heap_set_field(
+            handle,
+            (uint8_t)(LARGE_POSITIVE_INTEGER_FIELD_DIGIT0 + digit_index),
+            small_integer_value((int32_t)(magnitude & 0xFFFFU))
+        );
+        magnitude >>= 16U;
+    }
+    *value = object_value(handle);
+    return 1U;
+}
+
+static int8_t integer_compare(const struct recorz_mvp_integer *left, const struct recorz_mvp_integer *right) {
+    int8_t order;
+
+    if (left->negative != right->negative) {
+        return (int8_t)(left->negative ? -1 : 1);
+    }
+    order = (int8_t)(left->magnitude < right->magnitude ? -1 : (left->magnitude > right->magnitude ? 1 : 0));
+    return (int8_t)(left->negative ? -order : order);
+}
+
+static uint8_t integer_add(
+    const struct recorz_mvp_integer *left,
+    const struct recorz_mvp_integer *right,
+    struct recorz_mvp_integer *sum
+) {
+    if (left->negative == right->negative) {
+        sum->magnitude = left->magnitude + right->magnitude;
+        if (sum->magnitude < left->magnitude) {
+            return 0U;
+        }
+        sum->negative = left->negative;
+    } else if (left->magnitude >= right->magnitude) {
+        sum->magnitude = left->magnitude - right->magnitude;
+        sum->negative = left->negative;
+    } else {
+        sum->magnitude = right->magnitude - left->magnitude;
+        sum->negative = right->negative;
+    }
+    if (sum->magnitude == 0U) {
+        sum->negative = 0U;
+    }
+    return 1U;
+}
+
+/* The 64-bit helpers stick to 32x32 multiplies and single-bit shifts so RV32 needs no libgcc support. */
+static uint8_t integer_magnitude_multiply(uint64_t left, uint64_t right, uint64_t *product) {
+    uint32_t left_high = (uint32_t)(left >> 32U);
+    uint32_t left_low = (uint32_t)left;
+    uint32_t right_high = (uint32_t)(right >> 32U);
+    uint32_t right_low = (uint32_t)right;
+    uint64_t cross;
+    uint64_t low;
+
+    if (left_high != 0U && right_high != 0U) {
+        return 0U;
+    }
+    cross = (uint64_t)left_high * right_low + (uint64_t)left_low * right_high;
+    if ((cross >> 32U) != 0U) {
+        return 0U;
+    }
+    low = (uint64_t)left_low * right_low;
+    *product = low + (cross << 32U);
+    return (uint8_t)(*product >= low);
+}
+
+static uint64_t integer_magnitude_divide(uint64_t dividend, uint64_t divisor, uint64_t *remainder) {
+    uint64_t quotient = 0U;
+    uint64_t rest = 0U;
+    uint8_t bit_index;
+
+    for (bit_index = 0U; bit_index < 64U; ++bit_index) {
+        uint8_t carry = (uint8_t)(rest >> 63U);
+
+        rest = (rest << 1U) | (dividend >> 63U);
+        dividend <<= 1U;
+        quotient <<= 1U;
+        if (carry || rest >= divisor) {
+            rest -= divisor;
+            quotient |= 1U;
+        }
+    }
+    *remainder = rest;
+    return quotient;
+}
+
+/* The slow path behind the special send opcodes: SmallInteger overflow promotes to
+   LargePositiveInteger, and mixed SmallInteger/LargePositiveInteger operands are accepted.
+   Answers a failure message, or 0 once *result holds the answer. */
+static const char *integer_special_send(
+    uint8_t opcode,
+    struct recorz_mvp_value receiver,
+    struct recorz_mvp_value argument,
+    struct recorz_mvp_value *result
+) {
+    struct recorz_mvp_integer left;
+    struct recorz_mvp_integer right;
+    struct recorz_mvp_integer answer;
+    struct recorz_mvp_integer remainder;
+    int8_t order;
+    int32_t shift;
+
+    if (small_integer_special_send(opcode, receiver, argument, result)) {
+        return 0;
+    }
+    if (opcode == RECORZ_MVP_OP_SEND_EQUAL || opcode == RECORZ_MVP_OP_SEND_NOT_EQUAL) {
+        *result = boolean_value((uint8_t)(value_equals(receiver, argument) != (opcode == RECORZ_MVP_OP_SEND_NOT_EQUAL)));
+        return 0;
+    }
+    if (!integer_from_value(receiver, &left)) {
+        return "integer operation expects an integer receiver";
+    }
+    if (!integer_from_value(argument, &right)) {
+        if (opcode >= RECORZ_MVP_OP_SEND_LESS_THAN && opcode <= RECORZ_MVP_OP_SEND_GREATER_EQUAL) {
+            return "comparison expects integer operands";
+        }
+        return "integer operation expects an integer argument";
+    }
+    switch (opcode) {
+        case RECORZ_MVP_OP_SEND_SUBTRACT:
+            right.negative = (uint8_t)(!right.negative && right.magnitude != 0U);
+            /* fall through */
+        case RECORZ_MVP_OP_SEND_ADD:
+            if (!integer_add(&left, &right, &answer)) {
+                return "integer arithmetic overflow";
+            }
+            break;
+        case RECORZ_MVP_OP_SEND_MULTIPLY:
+            if (!integer_magnitude_multiply(left.magnitude, right.magnitude, &answer.magnitude)) {
+                return "integer arithmetic overflow";
+            }
+            answer.negative = (uint8_t)(left.negative != right.negative && answer.magnitude != 0U);
+            break;
+        case RECORZ_MVP_OP_SEND_LESS_THAN:
+        case RECORZ_MVP_OP_SEND_GREATER_THAN:
+        case RECORZ_MVP_OP_SEND_LESS_EQUAL:
+        case RECORZ_MVP_OP_SEND_GREATER_EQUAL:
+            order = integer_compare(&left, &right);
+            *result = boolean_value((uint8_t)(
+                opcode == RECORZ_MVP_OP_SEND_LESS_THAN ? order < 0 :
+                opcode == RECORZ_MVP_OP_SEND_GREATER_THAN ? order > 0 :
+                opcode == RECORZ_MVP_OP_SEND_LESS_EQUAL ? order <= 0 :
+                order >= 0
+            ));
+            return 0;
+        case RECORZ_MVP_OP_SEND_MAX:
+        case RECORZ_MVP_OP_SEND_MIN:
+            order = integer_compare(&left, &right);
+            *result = (opcode == RECORZ_MVP_OP_SEND_MAX ? order >= 0 : order <= 0) ? receiver : argument;
+            return 0;
+        case RECORZ_MVP_OP_SEND_INTEGER_DIVIDE:
+        case RECORZ_MVP_OP_SEND_MODULO:
+            if (right.magnitude == 0U) {
+                return "integer division by zero";
+            }
+            answer.magnitude = integer_magnitude_divide(left.magnitude, right.magnitude, &remainder.magnitude);
+            answer.negative = (uint8_t)(left.negative != right.negative);
+            if (answer.negative && remainder.magnitude != 0U) {
+                answer.magnitude += 1U;
+                remainder.magnitude = right.magnitude - remainder.magnitude;
+            }
+            remainder.negative = (uint8_t)(right.negative && remainder.magnitude != 0U);
+            if (opcode == RECORZ_MVP_OP_SEND_MODULO) {
+                answer = remainder;
+            } else if (answer.magnitude == 0U) {
+                answer.negative = 0U;
+            }
+            break;
+        case RECORZ_MVP_OP_SEND_BIT_AND:
+        case RECORZ_MVP_OP_SEND_BIT_OR:
+        case RECORZ_MVP_OP_SEND_BIT_XOR:
+            if (left.negative || right.negative) {
+                return "bit operation expects non-negative integers";
+            }
+            answer.negative = 0U;
+            answer.magnitude = opcode == RECORZ_MVP_OP_SEND_BIT_AND ? (left.magnitude & right.magnitude) :
+                               opcode == RECORZ_MVP_OP_SEND_BIT_OR ? (left.magnitude | right.magnitude) :
+                               (left.magnitude ^ right.magnitude);
+            break;
+        case RECORZ_MVP_OP_SEND_BIT_SHIFT:
+            if (!value_is_small_integer(argument)) {
+                return "bitShift: expects a small integer count";
+            }
+            answer = left;
+            for (shift = value_small_integer(argument); shift > 0; --shift) {
+                if (answer.negative || (answer.magnitude >> 63U) != 0U) {
+                    return "integer arithmetic overflow";
+                }
+                answer.magnitude <<= 1U;
+            }
+            for (; shift < 0 && answer.magnitude != 0U; ++shift) {
+                answer.magnitude >>= 1U;
+            }
+            break;
+        default:
+            return "unsupported integer selector";
+    }
+    if (!integer_value(&answer, result)) {
+        return "integer arithmetic overflow";
+    }
+    return 0;
+}
+
+static void render_large_positive_integer(const struct recorz_mvp_heap_object *object) {
+    char scratch[PRINT_BUFFER_SIZE];
+    uint32_t digits[LARGE_POSITIVE_INTEGER_DIGIT_COUNT];
+    uint32_t index = 0U;
+    uint32_t out_index = 0U;
+    uint8_t digit_index;
+    uint8_t nonzero;
+
+    for (digit_index = 0U; digit_index < LARGE_POSITIVE_INTEGER_DIGIT_COUNT; ++digit_index) {
+        digits[digit_index] = small_integer_u32(
+            heap_get_field(object, (uint8_t)(LARGE_POSITIVE_INTEGER_FIELD_DIGIT0 + digit_index)),
+            "LargePositiveInteger digit is not a small integer"
+        );
+    }
+    do {
+        uint32_t remainder = 0U;
+
+        nonzero = 0U;
+        digit_index = LARGE_POSITIVE_INTEGER_DIGIT_COUNT;
+        while (digit_index > 0U) {
+            uint32_t current;
+
+            --digit_index;
+            current = (remainder << 16U) | digits[digit_index];
+            digits[digit_index] = current / 10U;
+            remainder = current % 10U;
+            nonzero = (uint8_t)(nonzero || digits[digit_index] != 0U);
+        }
+        scratch[index++] = (char)('0' + remainder);
+    } while (nonzero && index < PRINT_BUFFER_SIZE - 1U);
+    while (index > 0U) {
+        print_buffer[out_index++] = scratch[--index];
+    }
+    print_buffer[out_index] = '\0';
+}
+
+/* Program literals are shared as-is so every closure from one literal site keys the same compiled block;
+   source-evaluated literals get a private copy because their text alone does not identify the site. */
 static uint16_t allocate_block_closure_from_source(
     const char *source_text,
-    struct recorz_mvp_value home_receiver
+    struct recorz_mvp_value home_receiver,
+    uint8_t copy_source
 ) {
     uint16_t handle;
 
@@ -4990,7 +6809,7 @@ static uint16_t allocate_block_closure_from_source(
     heap_set_field(
         handle,
         BLOCK_CLOSURE_FIELD_SOURCE,
-        string_value(runtime_string_intern_copy(source_text))
+        string_value(copy_source ? runtime_string_allocate_copy(source_text) : source_text)
     );
     heap_set_field(handle, BLOCK_CLOSURE_FIELD_HOME_RECEIVER, home_receiver);
     heap_set_field(handle, BLOCK_CLOSURE_FIELD_LEXICAL0, small_integer_value(-1));
@@ -5026,13 +6845,13 @@ static uint8_t source_block_state_for_handle(
     if (block_object->kind != RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
         return 0U;
     }
-    lexical_environment_index = block_object->fields[BLOCK_CLOSURE_FIELD_LEXICAL0].kind == RECORZ_MVP_VALUE_SMALL_INTEGER
+    lexical_environment_index = value_is_small_integer(block_object->fields[BLOCK_CLOSURE_FIELD_LEXICAL0])
         ? (int16_t)small_integer_i32(
               block_object->fields[BLOCK_CLOSURE_FIELD_LEXICAL0],
               "block closure lexical environment state is not a small integer"
           )
         : -1;
-    home_context_index = block_object->fields[BLOCK_CLOSURE_FIELD_LEXICAL1].kind == RECORZ_MVP_VALUE_SMALL_INTEGER
+    home_context_index = value_is_small_integer(block_object->fields[BLOCK_CLOSURE_FIELD_LEXICAL1])
         ? (int16_t)small_integer_i32(
               block_object->fields[BLOCK_CLOSURE_FIELD_LEXICAL1],
               "block closure home context state is not a small integer"
@@ -5060,7 +6879,7 @@ static uint8_t source_block_state_for_handle(
     }
     if (state_out->defining_class == 0) {
         home_receiver = heap_get_field(block_object, BLOCK_CLOSURE_FIELD_HOME_RECEIVER);
-        if (home_receiver.kind == RECORZ_MVP_VALUE_OBJECT) {
+        if (value_is_object(home_receiver)) {
             state_out->defining_class = class_object_for_heap_object(heap_object_for_value(home_receiver));
         } else {
             state_out->defining_class = class_object_for_kind(RECORZ_MVP_OBJECT_OBJECT);
@@ -5079,10 +6898,10 @@ static struct recorz_mvp_heap_object *heap_object(uint16_t handle) {
 static const struct recorz_mvp_heap_object *heap_object_for_value(struct recorz_mvp_value value) {
     const struct recorz_mvp_heap_object *object;
 
-    if (value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(value)) {
         machine_panic("receiver is not a heap object");
     }
-    object = (const struct recorz_mvp_heap_object *)heap_object((uint16_t)value.integer);
+    object = (const struct recorz_mvp_heap_object *)heap_object(value_handle(value));
     if (object->kind == 0U) {
         machine_panic("receiver is not a live heap object");
     }
@@ -5095,10 +6914,17 @@ static void heap_set_field(uint16_t handle, uint8_t index, struct recorz_mvp_val
     if (index >= OBJECT_FIELD_LIMIT) {
         machine_panic("field index out of range");
     }
+    snapshot_note_object_write(handle);
     if (object->field_count <= index) {
         object->field_count = (uint8_t)(index + 1U);
     }
     object->fields[index] = value;
+    if (value_is_object(value)) {
+        gc_remember_young_reference(handle, value_handle(value));
+        if (gc_incremental_phase == GC_INCREMENTAL_MARK) {
+            gc_mark_handle_if_live(value_handle(value));
+        }
+    }
 }
 
 static struct recorz_mvp_value heap_get_field(const struct recorz_mvp_heap_object *object, uint8_t index) {
@@ -5111,7 +6937,12 @@ static struct recorz_mvp_value heap_get_field(const struct recorz_mvp_heap_objec
 static void heap_set_class(uint16_t handle, uint16_t class_handle) {
     struct recorz_mvp_heap_object *object = heap_object(handle);
 
+    snapshot_note_object_write(handle);
     object->class_handle = class_handle;
+    gc_remember_young_reference(handle, class_handle);
+    if (gc_incremental_phase == GC_INCREMENTAL_MARK) {
+        gc_mark_handle_if_live(class_handle);
+    }
 }
 
 static const struct recorz_mvp_heap_object *class_object_for_heap_object(const struct recorz_mvp_heap_object *object) {
@@ -5184,7 +7015,7 @@ static uint16_t selector_object_selector_id(const struct recorz_mvp_heap_object
 static const struct recorz_mvp_heap_object *method_descriptor_selector_object(const struct recorz_mvp_heap_object *method_object) {
     struct recorz_mvp_value selector_value = heap_get_field(method_object, METHOD_FIELD_SELECTOR);
 
-    if (selector_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(selector_value)) {
         machine_panic("method descriptor selector is not a selector object");
     }
     return heap_object_for_value(selector_value);
@@ -5211,7 +7042,7 @@ static uint32_t method_descriptor_primitive_kind(const struct recorz_mvp_heap_ob
 static const struct recorz_mvp_heap_object *method_descriptor_entry_object(const struct recorz_mvp_heap_object *method_object) {
     struct recorz_mvp_value entry_value = heap_get_field(method_object, METHOD_FIELD_ENTRY);
 
-    if (entry_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(entry_value)) {
         machine_panic("method descriptor entry is not a method entry object");
     }
     return heap_object_for_value(entry_value);
@@ -5222,7 +7053,7 @@ static struct recorz_mvp_heap_object *mutable_method_descriptor_entry_object(con
 }
 
 static uint16_t selector_object_handle(uint16_t selector) {
-    if (selector == 0U || selector > MAX_SELECTOR_ID ||
+    if (selector == 0U || selector > last_selector_id() ||
         selector_handles_by_id[selector] == 0U) {
         machine_panic("selector handle is not installed");
     }
@@ -5246,55 +7077,179 @@ static struct recorz_mvp_value method_entry_implementation_value(const struct re
     return heap_get_field(entry_object, METHOD_ENTRY_FIELD_IMPLEMENTATION);
 }
 
-static uint32_t compiled_method_instruction_word(
-    const struct recorz_mvp_heap_object *compiled_method,
-    uint8_t index
-) {
+static uint8_t compiled_method_has_body(const struct recorz_mvp_heap_object *compiled_method) {
     if (compiled_method->kind != RECORZ_MVP_OBJECT_COMPILED_METHOD) {
         machine_panic("method entry implementation is not a compiled method");
     }
-    return small_integer_u32(
-        heap_get_field(compiled_method, index),
-        "compiled method instruction is not a small integer"
-    );
+    return (uint8_t)(compiled_method->field_count == OBJECT_FIELD_LIMIT &&
+                     value_is_nil(compiled_method->fields[0]));
 }
 
-static uint16_t compiled_method_lexical_count(const struct recorz_mvp_heap_object *compiled_method) {
-    uint8_t instruction_index;
-    uint16_t lexical_count = 0U;
+static uint32_t compiled_method_body_offset(const struct recorz_mvp_heap_object *compiled_method) {
+    uint32_t body_offset = small_integer_u32(
+        heap_get_field(compiled_method, COMPILED_METHOD_BODY_FIELD_OFFSET),
+        "compiled method body offset is not a small integer"
+    );
 
-    if (compiled_method->kind != RECORZ_MVP_OBJECT_COMPILED_METHOD) {
-        machine_panic("method entry implementation is not a compiled method");
+    if (body_offset >= compiled_method_body_words_used ||
+        body_offset + 1U + (compiled_method_body_words[body_offset] & 0xFFFFU) > compiled_method_body_words_used) {
+        machine_panic("compiled method body offset is out of range");
     }
-    for (instruction_index = 0U; instruction_index < compiled_method->field_count; ++instruction_index) {
-        uint32_t instruction = compiled_method_instruction_word(compiled_method, instruction_index);
-        uint8_t opcode = compiled_method_instruction_opcode(instruction);
-        uint16_t lexical_index;
+    return body_offset;
+}
 
-        if (opcode != COMPILED_METHOD_OP_PUSH_LEXICAL &&
-            opcode != COMPILED_METHOD_OP_STORE_LEXICAL) {
-            continue;
-        }
-        lexical_index = compiled_method_instruction_operand_b(opcode, instruction);
-        if ((uint16_t)(lexical_index + 1U) > lexical_count) {
-            lexical_count = (uint16_t)(lexical_index + 1U);
-        }
+static uint16_t compiled_method_instruction_count(const struct recorz_mvp_heap_object *compiled_method) {
+    if (!compiled_method_has_body(compiled_method)) {
+        return compiled_method->field_count;
     }
-    return lexical_count;
+    return (uint16_t)small_integer_u32(
+        heap_get_field(compiled_method, COMPILED_METHOD_BODY_FIELD_INSTRUCTION_COUNT),
+        "compiled method instruction count is not a small integer"
+    );
 }
 
-static uint8_t compiled_method_instruction_opcode(uint32_t instruction) {
-    return (uint8_t)(instruction & 0xFFU);
+static uint16_t compiled_method_literal_count(const struct recorz_mvp_heap_object *compiled_method) {
+    if (!compiled_method_has_body(compiled_method)) {
+        return 0U;
+    }
+    return (uint16_t)small_integer_u32(
+        heap_get_field(compiled_method, COMPILED_METHOD_BODY_FIELD_LITERAL_COUNT),
+        "compiled method literal count is not a small integer"
+    );
 }
 
-static uint16_t compiled_method_instruction_operand_a(uint8_t opcode, uint32_t instruction) {
-    if (opcode == COMPILED_METHOD_OP_SEND) {
-        return (uint16_t)((instruction >> 8U) & 0xFFFFU);
+static uint32_t compiled_method_instruction_word(
+    const struct recorz_mvp_heap_object *compiled_method,
+    uint16_t index
+) {
+    if (!compiled_method_has_body(compiled_method)) {
+        return small_integer_u32(
+            heap_get_field(compiled_method, (uint8_t)index),
+            "compiled method instruction is not a small integer"
+        );
     }
-    return (uint16_t)((instruction >> 8U) & 0xFFU);
+    if (index >= compiled_method_instruction_count(compiled_method)) {
+        machine_panic("compiled method instruction index is out of range");
+    }
+    return compiled_method_body_words[compiled_method_body_offset(compiled_method) + 1U + index];
 }
 
-static uint16_t compiled_method_instruction_operand_b(uint8_t opcode, uint32_t instruction) {
+static uint32_t compiled_method_literal_word(
+    const struct recorz_mvp_heap_object *compiled_method,
+    uint16_t index
+) {
+    if (index >= compiled_method_literal_count(compiled_method)) {
+        machine_panic("compiled method literal index is out of range");
+    }
+    return compiled_method_body_words[
+        compiled_method_body_offset(compiled_method) + 1U +
+        compiled_method_instruction_count(compiled_method) + index
+    ];
+}
+
+static void compiled_method_body_compact(void) {
+    uint32_t read_offset = 0U;
+    uint32_t write_offset = 0U;
+    uint16_t handle;
+
+    snapshot_note_compiled_method_body_write(0U);
+    while (read_offset < compiled_method_body_words_used) {
+        compiled_method_body_words[read_offset] &= 0xFFFFU;
+        read_offset += 1U + compiled_method_body_words[read_offset];
+    }
+    for (handle = 1U; handle <= heap_size; ++handle) {
+        const struct recorz_mvp_heap_object *object;
+
+        if (!heap_handle_is_live(handle)) {
+            continue;
+        }
+        object = heap_object(handle);
+        if (object->kind == RECORZ_MVP_OBJECT_COMPILED_METHOD && compiled_method_has_body(object)) {
+            compiled_method_body_words[compiled_method_body_offset(object)] |= 0x10000U;
+        }
+    }
+    read_offset = 0U;
+    while (read_offset < compiled_method_body_words_used) {
+        uint32_t body_word_count = compiled_method_body_words[read_offset] & 0xFFFFU;
+
+        if ((compiled_method_body_words[read_offset] >> 16U) != 0U) {
+            compiled_method_body_words[read_offset] = body_word_count | ((write_offset + 1U) << 16U);
+            write_offset += 1U + body_word_count;
+        }
+        read_offset += 1U + body_word_count;
+    }
+    for (handle = 1U; handle <= heap_size; ++handle) {
+        const struct recorz_mvp_heap_object *object;
+
+        if (!heap_handle_is_live(handle)) {
+            continue;
+        }
+        object = heap_object(handle);
+        if (object->kind == RECORZ_MVP_OBJECT_COMPILED_METHOD && compiled_method_has_body(object)) {
+            heap_set_field(
+                handle,
+                COMPILED_METHOD_BODY_FIELD_OFFSET,
+                small_integer_value(
+                    (int32_t)((compiled_method_body_words[compiled_method_body_offset(object)] >> 16U) - 1U)
+                )
+            );
+        }
+    }
+    read_offset = 0U;
+    write_offset = 0U;
+    while (read_offset < compiled_method_body_words_used) {
+        uint32_t header = compiled_method_body_words[read_offset];
+        uint32_t body_word_count = header & 0xFFFFU;
+        uint32_t word_index;
+
+        if ((header >> 16U) != 0U) {
+            compiled_method_body_words[write_offset] = body_word_count;
+            for (word_index = 1U; word_index <= body_word_count; ++word_index) {
+                compiled_method_body_words[write_offset + word_index] =
+                    compiled_method_body_words[read_offset + word_index];
+            }
+            write_offset += 1U + body_word_count;
+        }
+        read_offset += 1U + body_word_count;
+    }
+    compiled_method_body_words_used = write_offset;
+}
+
+static uint16_t compiled_method_lexical_count(const struct recorz_mvp_heap_object *compiled_method) {
+    uint16_t instruction_count = compiled_method_instruction_count(compiled_method);
+    uint16_t instruction_index;
+    uint16_t lexical_count = 0U;
+
+    for (instruction_index = 0U; instruction_index < instruction_count; ++instruction_index) {
+        uint32_t instruction = compiled_method_instruction_word(compiled_method, instruction_index);
+        uint8_t opcode = compiled_method_instruction_opcode(instruction);
+        uint16_t lexical_index;
+
+        if (opcode != COMPILED_METHOD_OP_PUSH_LEXICAL &&
+            opcode != COMPILED_METHOD_OP_STORE_LEXICAL &&
+            opcode != COMPILED_METHOD_OP_STORE_LEXICAL_FROM_ARGUMENT) {
+            continue;
+        }
+        lexical_index = compiled_method_instruction_operand_b(opcode, instruction);
+        if ((uint16_t)(lexical_index + 1U) > lexical_count) {
+            lexical_count = (uint16_t)(lexical_index + 1U);
+        }
+    }
+    return lexical_count;
+}
+
+static uint8_t compiled_method_instruction_opcode(uint32_t instruction) {
+    return (uint8_t)(instruction & 0xFFU);
+}
+
+static uint16_t compiled_method_instruction_operand_a(uint8_t opcode, uint32_t instruction) {
+    if (opcode == COMPILED_METHOD_OP_SEND) {
+        return (uint16_t)((instruction >> 8U) & 0xFFFFU);
+    }
+    return (uint16_t)((instruction >> 8U) & 0xFFU);
+}
+
+static uint16_t compiled_method_instruction_operand_b(uint8_t opcode, uint32_t instruction) {
     if (opcode == COMPILED_METHOD_OP_SEND) {
         return (uint16_t)((instruction >> 24U) & 0xFFU);
     }
@@ -5308,16 +7263,202 @@ static uint32_t class_method_count(const struct recorz_mvp_heap_object *class_ob
     );
 }
 
-static const struct recorz_mvp_heap_object *class_method_start_object(const struct recorz_mvp_heap_object *class_object) {
-    struct recorz_mvp_value method_start = heap_get_field(class_object, CLASS_FIELD_METHOD_START);
+static uint32_t method_dictionary_entry_limit(uint32_t capacity) {
+    return capacity - (capacity >> 2U);
+}
 
-    if (method_start.kind == RECORZ_MVP_VALUE_NIL) {
-        return 0;
+static uint32_t method_dictionary_slot_count(uint32_t capacity) {
+    return METHOD_DICTIONARY_HEADER_SLOTS + capacity + (method_dictionary_entry_limit(capacity) * 2U);
+}
+
+static uint32_t method_dictionary_capacity_for(uint32_t method_count) {
+    uint32_t capacity = METHOD_DICTIONARY_MIN_CAPACITY;
+
+    while (method_dictionary_entry_limit(capacity) < method_count) {
+        capacity <<= 1U;
+    }
+    return capacity;
+}
+
+static uint32_t method_dictionary_probe_start(uint16_t selector, uint32_t capacity) {
+    return (((uint32_t)selector * 2654435761U) >> 16U) & (capacity - 1U);
+}
+
+static uint32_t class_method_dictionary_offset(const struct recorz_mvp_heap_object *class_object) {
+    struct recorz_mvp_value dictionary_value = heap_get_field(class_object, CLASS_FIELD_METHOD_START);
+    uint32_t offset;
+
+    if (!value_is_small_integer(dictionary_value) || value_integer(dictionary_value) < 0) {
+        machine_panic("class method dictionary is not a pool offset");
+    }
+    offset = (uint32_t)value_integer(dictionary_value);
+    if (offset + METHOD_DICTIONARY_HEADER_SLOTS > method_dictionary_slots_used ||
+        offset + method_dictionary_slot_count(method_dictionary_slots[offset]) > method_dictionary_slots_used) {
+        machine_panic("class method dictionary is out of range");
+    }
+    return offset;
+}
+
+static uint32_t method_dictionary_entry_offset(uint32_t dictionary_offset, uint32_t index) {
+    return dictionary_offset + METHOD_DICTIONARY_HEADER_SLOTS + method_dictionary_slots[dictionary_offset] + (index * 2U);
+}
+
+static uint16_t class_method_descriptor_handle_at(const struct recorz_mvp_heap_object *class_object, uint32_t index) {
+    if (index >= class_method_count(class_object)) {
+        machine_panic("class method index is out of range");
+    }
+    return method_dictionary_slots[method_dictionary_entry_offset(class_method_dictionary_offset(class_object), index) + 1U];
+}
+
+static const struct recorz_mvp_heap_object *class_method_descriptor_at(
+    const struct recorz_mvp_heap_object *class_object,
+    uint32_t index
+) {
+    const struct recorz_mvp_heap_object *method_object =
+        (const struct recorz_mvp_heap_object *)heap_object(class_method_descriptor_handle_at(class_object, index));
+
+    if (method_object->kind != RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR) {
+        machine_panic("class method dictionary contains a non-method descriptor");
+    }
+    return method_object;
+}
+
+static uint16_t class_method_lookup_handle(const struct recorz_mvp_heap_object *class_object, uint16_t selector) {
+    uint32_t dictionary_offset;
+    uint32_t capacity;
+    uint32_t slot;
+    uint32_t probe_count;
+
+    if (class_method_count(class_object) == 0U) {
+        return 0U;
+    }
+    dictionary_offset = class_method_dictionary_offset(class_object);
+    capacity = method_dictionary_slots[dictionary_offset];
+    slot = method_dictionary_probe_start(selector, capacity);
+    for (probe_count = 0U; probe_count < capacity; ++probe_count) {
+        uint16_t entry_number = method_dictionary_slots[dictionary_offset + METHOD_DICTIONARY_HEADER_SLOTS + slot];
+        uint32_t entry_offset;
+
+        if (entry_number == 0U) {
+            return 0U;
+        }
+        entry_offset = method_dictionary_entry_offset(dictionary_offset, (uint32_t)entry_number - 1U);
+        if (method_dictionary_slots[entry_offset] == selector) {
+            return method_dictionary_slots[entry_offset + 1U];
+        }
+        slot = (slot + 1U) & (capacity - 1U);
+    }
+    return 0U;
+}
+
+static void method_dictionary_compact(void) {
+    uint32_t read_offset = 0U;
+    uint32_t write_offset = 0U;
+
+    while (read_offset < method_dictionary_slots_used) {
+        uint32_t slot_count = method_dictionary_slot_count(method_dictionary_slots[read_offset]);
+        uint16_t owner_handle = method_dictionary_slots[read_offset + 1U];
+        struct recorz_mvp_value dictionary_value;
+        uint32_t slot_index;
+
+        if (!heap_handle_is_live(owner_handle) || heap_object(owner_handle)->kind != RECORZ_MVP_OBJECT_CLASS) {
+            read_offset += slot_count;
+            continue;
+        }
+        dictionary_value = heap_get_field(heap_object(owner_handle), CLASS_FIELD_METHOD_START);
+        if (!value_is_small_integer(dictionary_value) ||
+            (uint32_t)value_integer(dictionary_value) != read_offset) {
+            read_offset += slot_count;
+            continue;
+        }
+        if (write_offset != read_offset) {
+            for (slot_index = 0U; slot_index < slot_count; ++slot_index) {
+                method_dictionary_slots[write_offset + slot_index] = method_dictionary_slots[read_offset + slot_index];
+            }
+            heap_set_field(owner_handle, CLASS_FIELD_METHOD_START, small_integer_value((int32_t)write_offset));
+        }
+        write_offset += slot_count;
+        read_offset += slot_count;
+    }
+    method_dictionary_slots_used = (uint16_t)write_offset;
+}
+
+static uint32_t method_dictionary_allocate(uint16_t class_handle, uint32_t capacity) {
+    uint32_t slot_count = method_dictionary_slot_count(capacity);
+    uint32_t dictionary_offset;
+    uint32_t slot_index;
+
+    if (method_dictionary_slots_used + slot_count > METHOD_DICTIONARY_SLOT_LIMIT) {
+        method_dictionary_compact();
+    }
+    if (method_dictionary_slots_used + slot_count > METHOD_DICTIONARY_SLOT_LIMIT) {
+        machine_panic("method dictionary pool overflow");
+    }
+    dictionary_offset = method_dictionary_slots_used;
+    method_dictionary_slots[dictionary_offset] = (uint16_t)capacity;
+    method_dictionary_slots[dictionary_offset + 1U] = class_handle;
+    for (slot_index = METHOD_DICTIONARY_HEADER_SLOTS; slot_index < slot_count; ++slot_index) {
+        method_dictionary_slots[dictionary_offset + slot_index] = 0U;
+    }
+    method_dictionary_slots_used = (uint16_t)(method_dictionary_slots_used + slot_count);
+    return dictionary_offset;
+}
+
+static void method_dictionary_store_entry(
+    uint32_t dictionary_offset,
+    uint32_t index,
+    uint16_t selector,
+    uint16_t descriptor_handle
+) {
+    uint32_t capacity = method_dictionary_slots[dictionary_offset];
+    uint32_t entry_offset = method_dictionary_entry_offset(dictionary_offset, index);
+    uint32_t slot = method_dictionary_probe_start(selector, capacity);
+
+    method_dictionary_slots[entry_offset] = selector;
+    method_dictionary_slots[entry_offset + 1U] = descriptor_handle;
+    while (method_dictionary_slots[dictionary_offset + METHOD_DICTIONARY_HEADER_SLOTS + slot] != 0U) {
+        slot = (slot + 1U) & (capacity - 1U);
+    }
+    method_dictionary_slots[dictionary_offset + METHOD_DICTIONARY_HEADER_SLOTS + slot] = (uint16_t)(index + 1U);
+}
+
+static void class_method_dictionary_add(uint16_t class_handle, uint16_t selector, uint16_t descriptor_handle) {
+    const struct recorz_mvp_heap_object *class_object = (const struct recorz_mvp_heap_object *)heap_object(class_handle);
+    uint32_t method_count = class_method_count(class_object);
+    uint32_t dictionary_offset;
+
+    if (method_count == 0U) {
+        dictionary_offset = method_dictionary_allocate(class_handle, METHOD_DICTIONARY_MIN_CAPACITY);
+    } else {
+        dictionary_offset = class_method_dictionary_offset(class_object);
+        if (method_count >= method_dictionary_entry_limit(method_dictionary_slots[dictionary_offset])) {
+            uint32_t grown_offset = method_dictionary_allocate(
+                class_handle,
+                method_dictionary_slots[dictionary_offset] << 1U
+            );
+            uint32_t method_index;
+
+            dictionary_offset = class_method_dictionary_offset(class_object);
+            for (method_index = 0U; method_index < method_count; ++method_index) {
+                uint32_t entry_offset = method_dictionary_entry_offset(dictionary_offset, method_index);
+
+                method_dictionary_store_entry(
+                    grown_offset,
+                    method_index,
+                    method_dictionary_slots[entry_offset],
+                    method_dictionary_slots[entry_offset + 1U]
+                );
+            }
+            dictionary_offset = grown_offset;
+        }
     }
-    if (method_start.kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("class method start is not a method descriptor");
+    method_dictionary_store_entry(dictionary_offset, method_count, selector, descriptor_handle);
+    gc_remember_young_reference(class_handle, descriptor_handle);
+    if (gc_incremental_phase == GC_INCREMENTAL_MARK) {
+        gc_mark_handle_if_live(descriptor_handle);
     }
-    return heap_object_for_value(method_start);
+    heap_set_field(class_handle, CLASS_FIELD_METHOD_START, small_integer_value((int32_t)dictionary_offset));
+    heap_set_field(class_handle, CLASS_FIELD_METHOD_COUNT, small_integer_value((int32_t)(method_count + 1U)));
 }
 
 static const struct recorz_mvp_heap_object *class_superclass_object_or_null(
@@ -5325,10 +7466,10 @@ static const struct recorz_mvp_heap_object *class_superclass_object_or_null(
 ) {
     struct recorz_mvp_value superclass_value = heap_get_field(class_object, CLASS_FIELD_SUPERCLASS);
 
-    if (superclass_value.kind == RECORZ_MVP_VALUE_NIL) {
+    if (value_is_nil(superclass_value)) {
         return 0;
     }
-    if (superclass_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(superclass_value)) {
         machine_panic("class superclass is not a class object");
     }
     {
@@ -5382,6 +7523,10 @@ static const struct recorz_mvp_heap_object *ensure_dedicated_metaclass_for_class
     } else {
         metaclass_handle = heap_handle_for_object(metaclass_object);
     }
+    if (!value_is_object(heap_get_field(metaclass_object, CLASS_FIELD_SUPERCLASS)) ||
+        value_handle(heap_get_field(metaclass_object, CLASS_FIELD_SUPERCLASS)) != metaclass_superclass_handle) {
+        method_cache_flush();
+    }
     heap_set_field(
         metaclass_handle,
         CLASS_FIELD_SUPERCLASS,
@@ -5395,45 +7540,33 @@ static const struct recorz_mvp_heap_object *lookup_builtin_method_descriptor(
     uint16_t selector,
     uint16_t argument_count
 ) {
-    const struct recorz_mvp_heap_object *selector_object;
     const struct recorz_mvp_heap_object *lookup_class = class_object;
     uint32_t lookup_depth = 0U;
 
-    if (selector == 0U || selector > MAX_SELECTOR_ID) {
+    if (selector == 0U || selector > last_selector_id()) {
         machine_panic("selector id is out of range");
     }
     if (selector_handles_by_id[selector] == 0U) {
         return 0;
     }
-    selector_object = (const struct recorz_mvp_heap_object *)heap_object(selector_handles_by_id[selector]);
-
     while (lookup_class != 0) {
-        const struct recorz_mvp_heap_object *method_object = class_method_start_object(lookup_class);
-        uint32_t method_count = class_method_count(lookup_class);
-        uint32_t method_index;
+        uint16_t method_handle;
 
         if (lookup_depth++ >= HEAP_LIMIT) {
             machine_panic("class superclass chain is invalid");
         }
-        if (method_count != 0U) {
-            if (method_object == 0) {
-                machine_panic("class with methods is missing a method start");
-            }
-            for (method_index = 0U; method_index < method_count; ++method_index) {
-                const struct recorz_mvp_heap_object *candidate = (const struct recorz_mvp_heap_object *)heap_object(
-                    (uint16_t)(heap_handle_for_object(method_object) + method_index)
-                );
+        method_handle = class_method_lookup_handle(lookup_class, selector);
+        if (method_handle != 0U) {
+            const struct recorz_mvp_heap_object *candidate =
+                (const struct recorz_mvp_heap_object *)heap_object(method_handle);
 
-                if (candidate->kind != RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR) {
-                    machine_panic("class method range contains a non-method descriptor");
-                }
-                if (method_descriptor_selector_object(candidate) == selector_object) {
-                    if (method_descriptor_argument_count(candidate) != argument_count) {
-                        machine_panic("selector argument count does not match method descriptor");
-                    }
-                    return candidate;
-                }
+            if (candidate->kind != RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR) {
+                machine_panic("class method dictionary contains a non-method descriptor");
+            }
+            if (method_descriptor_argument_count(candidate) != argument_count) {
+                machine_panic("selector argument count does not match method descriptor");
             }
+            return candidate;
         }
         lookup_class = class_superclass_object_or_null(lookup_class);
     }
@@ -5764,6 +7897,15 @@ static struct recorz_mvp_value perform_send_and_pop_result(
     return stack[--stack_size];
 }
 
+static uint8_t inline_condition_value_is_true(struct recorz_mvp_value value) {
+    if (value_is_object(value) &&
+        value.bits != object_value(global_handles[RECORZ_MVP_GLOBAL_TRUE]).bits &&
+        value.bits != object_value(global_handles[RECORZ_MVP_GLOBAL_FALSE]).bits) {
+        value = perform_send_and_pop_result(value, source_selector_id_intern("mustBeBoolean"), 0U, 0, 0);
+    }
+    return condition_value_is_true(value);
+}
+
 static void test_runner_reset_state(const struct recorz_mvp_heap_object *test_runner_object) {
     uint16_t test_runner_handle = heap_handle_for_object(test_runner_object);
 
@@ -5817,8 +7959,8 @@ static uint8_t selector_name_has_test_prefix(const char *name) {
 }
 
 static uint8_t test_runner_result_is_pass(struct recorz_mvp_value value) {
-    return value.kind == RECORZ_MVP_VALUE_OBJECT &&
-           (uint16_t)value.integer == global_handles[RECORZ_MVP_GLOBAL_TRUE];
+    return value_is_object(value) &&
+           value_handle(value) == global_handles[RECORZ_MVP_GLOBAL_TRUE];
 }
 
 static void test_runner_write_result_line(
@@ -5878,7 +8020,6 @@ static void test_runner_run_class(
     const struct recorz_mvp_heap_object *class_object,
     const char *class_name
 ) {
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     uint32_t method_index;
     uint32_t passed_count;
@@ -5889,11 +8030,9 @@ static void test_runner_run_class(
     passed_count = 0U;
     failed_count = 0U;
     total_count = 0U;
-    if (method_start_object != 0) {
+    if (method_count != 0U) {
         for (method_index = 0U; method_index < method_count; ++method_index) {
-            const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-                (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-            );
+            const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
             const char *selector_text = selector_name(method_descriptor_selector(method_object));
             struct recorz_mvp_value test_instance;
             struct recorz_mvp_value test_result;
@@ -5940,7 +8079,6 @@ static void test_runner_accumulate_class(
     const struct recorz_mvp_heap_object *class_object,
     const char *class_name
 ) {
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     uint32_t method_index;
     uint32_t passed_count = test_runner_counter_value(
@@ -5959,13 +8097,11 @@ static void test_runner_accumulate_class(
         "TestRunner total counter is invalid"
     );
 
-    if (method_start_object == 0) {
+    if (method_count == 0U) {
         return;
     }
     for (method_index = 0U; method_index < method_count; ++method_index) {
-        const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-            (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-        );
+        const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
         const char *selector_text = selector_name(method_descriptor_selector(method_object));
         struct recorz_mvp_value test_instance;
         struct recorz_mvp_value test_result;
@@ -6070,8 +8206,8 @@ static void workspace_remember_input_monitor_view(
     );
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     uint32_t cursor_index =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? text_length(source_value.string)
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? text_length(value_string(source_value))
             : 0U;
     uint32_t top_line = 0U;
     uint32_t saved_view_kind = WORKSPACE_VIEW_NONE;
@@ -6083,10 +8219,10 @@ static void workspace_remember_input_monitor_view(
     saved_target_name[0] = '\0';
     saved_status[0] = '\0';
     saved_feedback[0] = '\0';
-    if (prior_view_kind_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
-        (uint32_t)prior_view_kind_value.integer == WORKSPACE_VIEW_INPUT_MONITOR) {
+    if (value_is_small_integer(prior_view_kind_value) &&
+        (uint32_t)value_integer(prior_view_kind_value) == WORKSPACE_VIEW_INPUT_MONITOR) {
         workspace_parse_input_monitor_state(
-            prior_target_name_value.kind == RECORZ_MVP_VALUE_STRING ? prior_target_name_value.string : 0,
+            value_is_string(prior_target_name_value) ? value_string(prior_target_name_value) : 0,
             &cursor_index,
             &top_line,
             &saved_view_kind,
@@ -6100,17 +8236,17 @@ static void workspace_remember_input_monitor_view(
         workspace_input_monitor_set_status(saved_status);
         workspace_input_monitor_set_feedback_text(saved_feedback);
     } else {
-        if (prior_view_kind_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
-            prior_view_kind_value.integer >= 0) {
-            saved_view_kind = (uint32_t)prior_view_kind_value.integer;
+        if (value_is_small_integer(prior_view_kind_value) &&
+            value_integer(prior_view_kind_value) >= 0) {
+            saved_view_kind = (uint32_t)value_integer(prior_view_kind_value);
         }
-        if (prior_target_name_value.kind == RECORZ_MVP_VALUE_STRING &&
-            prior_target_name_value.string != 0) {
+        if (value_is_string(prior_target_name_value) &&
+            value_string(prior_target_name_value) != 0) {
             append_text_checked(
                 saved_target_name,
                 sizeof(saved_target_name),
                 &saved_target_offset,
-                prior_target_name_value.string
+                value_string(prior_target_name_value)
             );
         }
         if (saved_view_kind == WORKSPACE_VIEW_METHOD ||
@@ -6199,25 +8335,25 @@ static struct recorz_mvp_value workspace_current_source_value(
         return nil_value();
     }
     source_value = heap_get_field(workspace_object, field_index);
-    if (source_value.kind == RECORZ_MVP_VALUE_STRING &&
-        source_value.string != 0 &&
-        source_value.string[0] != '\0') {
+    if (value_is_string(source_value) &&
+        value_string(source_value) != 0 &&
+        value_string(source_value)[0] != '\0') {
         return source_value;
     }
     if (workspace_object->field_count <= workspace_current_view_kind_field_index(workspace_object)) {
         return source_value;
     }
     view_kind_value = heap_get_field(workspace_object, workspace_current_view_kind_field_index(workspace_object));
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         return source_value;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_REGENERATED_BOOT_SOURCE) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_REGENERATED_BOOT_SOURCE) {
         return string_value(regenerated_boot_source_text(workspace_object));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_REGENERATED_KERNEL_SOURCE) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_REGENERATED_KERNEL_SOURCE) {
         return string_value(regenerated_kernel_source_text());
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_REGENERATED_FILE_IN_SOURCE) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_REGENERATED_FILE_IN_SOURCE) {
         return string_value(regenerated_file_in_source_text());
     }
     return source_value;
@@ -6264,12 +8400,12 @@ static void workspace_prepare_editor_current_source_for_session(
         return;
     }
     source_value = workspace_current_source_value(workspace_object);
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string == workspace_editor_source_buffer) {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value) == workspace_editor_source_buffer) {
         return;
     }
-    workspace_remember_editor_current_source(workspace_object, source_value.string);
+    workspace_remember_editor_current_source(workspace_object, value_string(source_value));
 }
 
 static const struct recorz_mvp_heap_object *workspace_target_class_for_file_in(
@@ -6282,50 +8418,50 @@ static const struct recorz_mvp_heap_object *workspace_target_class_for_file_in(
         return 0;
     }
     view_kind_value = heap_get_field(workspace_object, workspace_current_view_kind_field_index(workspace_object));
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         return 0;
     }
     if (workspace_object->field_count <= workspace_current_target_name_field_index(workspace_object)) {
         return 0;
     }
     target_name_value = heap_get_field(workspace_object, workspace_current_target_name_field_index(workspace_object));
-    if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-        target_name_value.string == 0 ||
-        target_name_value.string[0] == '\0') {
+    if (!value_is_string(target_name_value) ||
+        value_string(target_name_value) == 0 ||
+        value_string(target_name_value)[0] == '\0') {
         return 0;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS) {
-        return lookup_class_by_name(target_name_value.string);
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS) {
+        return lookup_class_by_name(value_string(target_name_value));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_SOURCE) {
-        return lookup_class_by_name(target_name_value.string);
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_SOURCE) {
+        return lookup_class_by_name(value_string(target_name_value));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_METHODS) {
-        return lookup_class_by_name(target_name_value.string);
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_METHODS) {
+        return lookup_class_by_name(value_string(target_name_value));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_METHOD) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_METHOD) {
         char class_name[METHOD_SOURCE_NAME_LIMIT];
         char selector_name[METHOD_SOURCE_NAME_LIMIT];
 
-        if (!workspace_parse_method_target_name(target_name_value.string, class_name, sizeof(class_name), selector_name, sizeof(selector_name))) {
+        if (!workspace_parse_method_target_name(value_string(target_name_value), class_name, sizeof(class_name), selector_name, sizeof(selector_name))) {
             machine_panic("Workspace method target is invalid");
         }
         return lookup_class_by_name(class_name);
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_METHODS) {
-        const struct recorz_mvp_heap_object *class_object = lookup_class_by_name(target_name_value.string);
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_METHODS) {
+        const struct recorz_mvp_heap_object *class_object = lookup_class_by_name(value_string(target_name_value));
 
         if (class_object == 0) {
             return 0;
         }
         return ensure_dedicated_metaclass_for_class(class_object, class_superclass_object_or_null(class_object));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_METHOD) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_METHOD) {
         char class_name[METHOD_SOURCE_NAME_LIMIT];
         char selector_name[METHOD_SOURCE_NAME_LIMIT];
         const struct recorz_mvp_heap_object *class_object;
 
-        if (!workspace_parse_method_target_name(target_name_value.string, class_name, sizeof(class_name), selector_name, sizeof(selector_name))) {
+        if (!workspace_parse_method_target_name(value_string(target_name_value), class_name, sizeof(class_name), selector_name, sizeof(selector_name))) {
             machine_panic("Workspace class-side method target is invalid");
         }
         class_object = lookup_class_by_name(class_name);
@@ -6334,15 +8470,15 @@ static const struct recorz_mvp_heap_object *workspace_target_class_for_file_in(
         }
         return ensure_dedicated_metaclass_for_class(class_object, class_superclass_object_or_null(class_object));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PROTOCOLS) {
-        return lookup_class_by_name(target_name_value.string);
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOLS) {
+        return lookup_class_by_name(value_string(target_name_value));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PROTOCOL) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOL) {
         char class_name[METHOD_SOURCE_NAME_LIMIT];
         char protocol_name[METHOD_SOURCE_NAME_LIMIT];
 
         if (!workspace_parse_protocol_target_name(
-                target_name_value.string,
+                value_string(target_name_value),
                 class_name,
                 sizeof(class_name),
                 protocol_name,
@@ -6351,21 +8487,21 @@ static const struct recorz_mvp_heap_object *workspace_target_class_for_file_in(
         }
         return lookup_class_by_name(class_name);
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
-        const struct recorz_mvp_heap_object *class_object = lookup_class_by_name(target_name_value.string);
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
+        const struct recorz_mvp_heap_object *class_object = lookup_class_by_name(value_string(target_name_value));
 
         if (class_object == 0) {
             return 0;
         }
         return ensure_dedicated_metaclass_for_class(class_object, class_superclass_object_or_null(class_object));
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOL) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOL) {
         char class_name[METHOD_SOURCE_NAME_LIMIT];
         char protocol_name[METHOD_SOURCE_NAME_LIMIT];
         const struct recorz_mvp_heap_object *class_object;
 
         if (!workspace_parse_protocol_target_name(
-                target_name_value.string,
+                value_string(target_name_value),
                 class_name,
                 sizeof(class_name),
                 protocol_name,
@@ -6903,6 +9039,7 @@ static uint8_t workspace_enter_debugger_for_runtime_failure(
     uint16_t session_handle;
     uint32_t view_kind;
 
+    sender_context_handle = context_handle_reify(sender_context_handle);
     if (sender_context_handle == 0U || !heap_handle_is_live(sender_context_handle)) {
         return 0U;
     }
@@ -6918,9 +9055,9 @@ static uint8_t workspace_enter_debugger_for_runtime_failure(
         workspace_object,
         workspace_current_target_name_field_index(workspace_object)
     );
-    if (target_name_value.kind == RECORZ_MVP_VALUE_STRING &&
-        target_name_value.string != 0 &&
-        source_names_equal(target_name_value.string, "DEBUGGER")) {
+    if (value_is_string(target_name_value) &&
+        value_string(target_name_value) != 0 &&
+        source_names_equal(value_string(target_name_value), "DEBUGGER")) {
         return 0U;
     }
     active_process_handle = named_object_handle_for_name("BootActiveProcess");
@@ -7272,7 +9409,7 @@ static uint8_t workspace_input_monitor_sync_state_from_image(
     saved_status[0] = '\0';
     saved_feedback[0] = '\0';
     workspace_parse_input_monitor_state(
-        target_name_value.kind == RECORZ_MVP_VALUE_STRING ? target_name_value.string : 0,
+        value_is_string(target_name_value) ? value_string(target_name_value) : 0,
         &parsed_cursor_index,
         &parsed_top_line,
         &saved_view_kind,
@@ -7355,11 +9492,11 @@ static const char *workspace_text_for_value(
     if (buffer != 0 && buffer_size != 0U) {
         buffer[0] = '\0';
     }
-    if (value.kind == RECORZ_MVP_VALUE_NIL) {
+    if (value_is_nil(value)) {
         return "nil";
     }
-    if (value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER ||
-        value.kind == RECORZ_MVP_VALUE_STRING) {
+    if (value_is_small_integer(value) ||
+        value_is_string(value)) {
         printed_value = perform_send_and_pop_result(
             value,
             RECORZ_MVP_SELECTOR_PRINT_STRING,
@@ -7367,17 +9504,17 @@ static const char *workspace_text_for_value(
             0,
             0
         );
-        if (printed_value.kind != RECORZ_MVP_VALUE_STRING || printed_value.string == 0) {
+        if (!value_is_string(printed_value) || value_string(printed_value) == 0) {
             machine_panic("Workspace printString did not return a string");
         }
         if (buffer != 0 && buffer_size != 0U) {
-            append_text_checked(buffer, buffer_size, &offset, printed_value.string);
+            append_text_checked(buffer, buffer_size, &offset, value_string(printed_value));
             return buffer;
         }
-        return printed_value.string;
+        return value_string(printed_value);
     }
-    if (value.kind == RECORZ_MVP_VALUE_OBJECT) {
-        named_object_name = workspace_named_object_name_for_handle((uint16_t)value.integer);
+    if (value_is_object(value)) {
+        named_object_name = workspace_named_object_name_for_handle(value_handle(value));
         if (named_object_name != 0) {
             return named_object_name;
         }
@@ -8123,10 +10260,10 @@ static const char *workspace_session_current_text_for_selector(uint16_t selector
         0,
         0
     );
-    if (result.kind != RECORZ_MVP_VALUE_STRING || result.string == 0) {
+    if (!value_is_string(result) || value_string(result) == 0) {
         return 0;
     }
-    return result.string;
+    return value_string(result);
 }
 
 static uint32_t workspace_session_small_integer_for_selector(uint16_t selector, const char *message) {
@@ -8255,8 +10392,8 @@ static uint8_t workspace_redraw_image_session_source_editor(
     const struct recorz_mvp_heap_object *form = default_form_object();
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *source =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
     const char *header = workspace_session_current_text_for_selector(
         RECORZ_MVP_SELECTOR_CURRENT_HEADER_TEXT
@@ -8393,8 +10530,8 @@ static const char *workspace_browser_list_items_visible_text(
                 arguments,
                 0
             );
-            if (items_value.kind == RECORZ_MVP_VALUE_STRING && items_value.string != 0) {
-                append_text_checked(buffer, buffer_size, &offset, items_value.string);
+            if (value_is_string(items_value) && value_string(items_value) != 0) {
+                append_text_checked(buffer, buffer_size, &offset, value_string(items_value));
                 return buffer;
             }
         }
@@ -8722,8 +10859,8 @@ static const char *workspace_visible_contents_text(
     if (line_count == 0U || column_count == 0U) {
         return buffer;
     }
-    if (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0) {
-        source = source_value.string;
+    if (value_is_string(source_value) && value_string(source_value) != 0) {
+        source = value_string(source_value);
     }
     while (*source != '\0' && lines_emitted < line_count) {
         char ch = *source++;
@@ -9132,7 +11269,6 @@ static void workspace_render_method_list_browser(
     const char *side_label
 ) {
     const struct recorz_mvp_heap_object *form = default_form_object();
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     uint32_t method_index;
     uint32_t list_offset = 0U;
@@ -9170,13 +11306,8 @@ static void workspace_render_method_list_browser(
             "NO METHODS"
         );
     } else {
-        if (method_start_object == 0) {
-            machine_panic("Workspace method list is missing a method start");
-        }
         for (method_index = 0U; method_index < method_count; ++method_index) {
-            const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-                (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-            );
+            const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
             const struct recorz_mvp_live_method_source *source_record;
             char line[METHOD_SOURCE_LINE_LIMIT];
             uint32_t line_offset = 0U;
@@ -9234,18 +11365,15 @@ static uint32_t workspace_protocol_method_count(
     const struct recorz_mvp_heap_object *class_object,
     const char *protocol_name
 ) {
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     uint32_t method_index;
     uint32_t count = 0U;
 
-    if (method_count == 0U || method_start_object == 0) {
+    if (method_count == 0U) {
         return 0U;
     }
     for (method_index = 0U; method_index < method_count; ++method_index) {
-        const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-            (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-        );
+        const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
 
         if (source_names_equal(workspace_protocol_name_for_method(class_object, method_object), protocol_name)) {
             ++count;
@@ -9256,7 +11384,6 @@ static uint32_t workspace_protocol_method_count(
 
 static uint8_t workspace_protocol_seen_earlier(
     const struct recorz_mvp_heap_object *class_object,
-    const struct recorz_mvp_heap_object *method_start_object,
     uint32_t method_index,
     const char *protocol_name
 ) {
@@ -9264,9 +11391,7 @@ static uint8_t workspace_protocol_seen_earlier(
 
     for (previous_index = 0U; previous_index < method_index; ++previous_index) {
         const struct recorz_mvp_heap_object *previous_method_object =
-            (const struct recorz_mvp_heap_object *)heap_object(
-                (uint16_t)(heap_handle_for_object(method_start_object) + previous_index)
-            );
+            class_method_descriptor_at(class_object, previous_index);
 
         if (source_names_equal(
                 workspace_protocol_name_for_method(class_object, previous_method_object),
@@ -9280,21 +11405,18 @@ static uint8_t workspace_protocol_seen_earlier(
 static uint32_t workspace_protocol_count(
     const struct recorz_mvp_heap_object *class_object
 ) {
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     uint32_t method_index;
     uint32_t count = 0U;
 
-    if (method_count == 0U || method_start_object == 0) {
+    if (method_count == 0U) {
         return 0U;
     }
     for (method_index = 0U; method_index < method_count; ++method_index) {
-        const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-            (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-        );
+        const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
         const char *protocol_name = workspace_protocol_name_for_method(class_object, method_object);
 
-        if (!workspace_protocol_seen_earlier(class_object, method_start_object, method_index, protocol_name)) {
+        if (!workspace_protocol_seen_earlier(class_object, method_index, protocol_name)) {
             ++count;
         }
     }
@@ -9308,7 +11430,6 @@ static void workspace_render_protocol_list_browser(
     const char *side_label
 ) {
     const struct recorz_mvp_heap_object *form = default_form_object();
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     uint32_t protocol_count = workspace_protocol_count(class_object);
     uint32_t method_index;
@@ -9347,18 +11468,13 @@ static void workspace_render_protocol_list_browser(
             "NO METHODS"
         );
     } else {
-        if (method_start_object == 0) {
-            machine_panic("Workspace protocol list is missing a method start");
-        }
         for (method_index = 0U; method_index < method_count; ++method_index) {
-            const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-                (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-            );
+            const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
             const char *protocol_name = workspace_protocol_name_for_method(class_object, method_object);
             char line[METHOD_SOURCE_LINE_LIMIT];
             uint32_t line_offset = 0U;
 
-            if (workspace_protocol_seen_earlier(class_object, method_start_object, method_index, protocol_name)) {
+            if (workspace_protocol_seen_earlier(class_object, method_index, protocol_name)) {
                 continue;
             }
             append_text_checked(line, sizeof(line), &line_offset, protocol_name);
@@ -9391,7 +11507,6 @@ static void workspace_render_protocol_method_list_browser(
     const char *protocol_name
 ) {
     const struct recorz_mvp_heap_object *form = default_form_object();
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     uint32_t protocol_method_count = workspace_protocol_method_count(class_object, protocol_name);
     uint32_t method_index;
@@ -9437,13 +11552,8 @@ static void workspace_render_protocol_method_list_browser(
             "NO METHODS"
         );
     } else {
-        if (method_start_object == 0) {
-            machine_panic("Workspace protocol browser is missing a method start");
-        }
         for (method_index = 0U; method_index < method_count; ++method_index) {
-            const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-                (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-            );
+            const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
 
             if (!source_names_equal(
                     workspace_protocol_name_for_method(class_object, method_object),
@@ -9502,8 +11612,8 @@ static void workspace_render_method_browser(
     workspace_surface_copy_source_viewport(
         workspace_surface_source_buffer,
         sizeof(workspace_surface_source_buffer),
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "NO SOURCE BUFFER",
         0U,
         0U,
@@ -9545,8 +11655,8 @@ static void workspace_render_class_source_browser(
     workspace_surface_copy_source_viewport(
         workspace_surface_source_buffer,
         sizeof(workspace_surface_source_buffer),
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "NO SOURCE BUFFER",
         0U,
         0U,
@@ -9588,8 +11698,8 @@ static void workspace_render_package_source_browser(
     workspace_surface_copy_source_viewport(
         workspace_surface_source_buffer,
         sizeof(workspace_surface_source_buffer),
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "NO SOURCE BUFFER",
         0U,
         0U,
@@ -9631,8 +11741,8 @@ static void workspace_render_regenerated_source_browser(
     workspace_surface_copy_source_viewport(
         workspace_surface_source_buffer,
         sizeof(workspace_surface_source_buffer),
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "NO SOURCE BUFFER",
         0U,
         0U,
@@ -9682,14 +11792,14 @@ static void workspace_render_input_monitor_browser_mode(
     saved_target_name[0] = '\0';
     compact_status[0] = '\0';
     if (workspace_parse_input_monitor_state(
-            heap_get_field(
+            value_is_string(heap_get_field(
                 workspace_object,
                 workspace_current_target_name_field_index(workspace_object)
-            ).kind == RECORZ_MVP_VALUE_STRING
-                ? heap_get_field(
+            ))
+                ? value_string(heap_get_field(
                       workspace_object,
                       workspace_current_target_name_field_index(workspace_object)
-                  ).string
+                  ))
                 : 0,
             &saved_cursor_index,
             &saved_top_line,
@@ -9730,7 +11840,7 @@ static void workspace_render_input_monitor_browser_mode(
     visible_line_capacity = workspace_surface_visible_line_capacity_for_view_height(WORKSPACE_SOURCE_VIEW_HEIGHT);
     top_line = workspace_input_monitor_top_line(workspace_object);
     workspace_input_monitor_cursor_line_and_column(
-        source_value.kind == RECORZ_MVP_VALUE_STRING ? source_value.string : 0,
+        value_is_string(source_value) ? value_string(source_value) : 0,
         cursor_index,
         &cursor_line,
         &cursor_column
@@ -9859,7 +11969,7 @@ static void workspace_render_input_monitor_browser_mode(
     workspace_surface_copy_source_viewport(
         workspace_surface_editor_buffer,
         sizeof(workspace_surface_editor_buffer),
-        source_value.kind == RECORZ_MVP_VALUE_STRING ? source_value.string : "",
+        value_is_string(source_value) ? value_string(source_value) : "",
         top_line,
         0U,
         visible_line_capacity,
@@ -10004,9 +12114,9 @@ static void workspace_bind_input_monitor_buffer(
     uint32_t length = 0U;
     uint16_t workspace_handle = heap_handle_for_object(workspace_object);
 
-    if (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0) {
-        while (source_value.string[length] != '\0' && length + 1U < sizeof(workspace_input_monitor_buffer)) {
-            workspace_input_monitor_buffer[length] = source_value.string[length];
+    if (value_is_string(source_value) && value_string(source_value) != 0) {
+        while (value_string(source_value)[length] != '\0' && length + 1U < sizeof(workspace_input_monitor_buffer)) {
+            workspace_input_monitor_buffer[length] = value_string(source_value)[length];
             ++length;
         }
     }
@@ -10247,7 +12357,7 @@ static void workspace_store_input_monitor_state(
     saved_status[0] = '\0';
     saved_feedback[0] = '\0';
     workspace_parse_input_monitor_state(
-        target_name_value.kind == RECORZ_MVP_VALUE_STRING ? target_name_value.string : 0,
+        value_is_string(target_name_value) ? value_string(target_name_value) : 0,
         &parsed_cursor_index,
         &parsed_top_line,
         &saved_view_kind,
@@ -10276,14 +12386,14 @@ static uint32_t workspace_input_monitor_cursor_index(
         workspace_current_target_name_field_index(workspace_object)
     );
     uint32_t source_length =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? text_length(source_value.string)
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? text_length(value_string(source_value))
             : 0U;
     uint32_t cursor_index = source_length;
     uint32_t top_line = 0U;
 
     if (workspace_parse_input_monitor_state(
-            target_name_value.kind == RECORZ_MVP_VALUE_STRING ? target_name_value.string : 0,
+            value_is_string(target_name_value) ? value_string(target_name_value) : 0,
             &cursor_index,
             &top_line,
             0,
@@ -10310,7 +12420,7 @@ static uint32_t workspace_input_monitor_top_line(
     uint32_t top_line = 0U;
 
     if (workspace_parse_input_monitor_state(
-            target_name_value.kind == RECORZ_MVP_VALUE_STRING ? target_name_value.string : 0,
+            value_is_string(target_name_value) ? value_string(target_name_value) : 0,
             &cursor_index,
             &top_line,
             0,
@@ -10375,40 +12485,40 @@ static uint32_t workspace_cursor_index_value(void) {
     struct recorz_mvp_heap_object *cursor_object = workspace_cursor_object();
     struct recorz_mvp_value value = heap_get_field(cursor_object, TEXT_CURSOR_FIELD_INDEX);
 
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || value.integer < 0) {
+    if (!value_is_small_integer(value) || value_integer(value) < 0) {
         return 0U;
     }
-    return (uint32_t)value.integer;
+    return (uint32_t)value_integer(value);
 }
 
 static uint32_t workspace_cursor_line_value(void) {
     struct recorz_mvp_heap_object *cursor_object = workspace_cursor_object();
     struct recorz_mvp_value value = heap_get_field(cursor_object, TEXT_CURSOR_FIELD_LINE);
 
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || value.integer < 0) {
+    if (!value_is_small_integer(value) || value_integer(value) < 0) {
         return 0U;
     }
-    return (uint32_t)value.integer;
+    return (uint32_t)value_integer(value);
 }
 
 static uint32_t workspace_cursor_column_value(void) {
     struct recorz_mvp_heap_object *cursor_object = workspace_cursor_object();
     struct recorz_mvp_value value = heap_get_field(cursor_object, TEXT_CURSOR_FIELD_COLUMN);
 
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || value.integer < 0) {
+    if (!value_is_small_integer(value) || value_integer(value) < 0) {
         return 0U;
     }
-    return (uint32_t)value.integer;
+    return (uint32_t)value_integer(value);
 }
 
 static uint32_t workspace_cursor_cached_top_line_value(void) {
     struct recorz_mvp_heap_object *cursor_object = workspace_cursor_object();
     struct recorz_mvp_value value = heap_get_field(cursor_object, TEXT_CURSOR_FIELD_TOP_LINE);
 
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || value.integer < 0) {
+    if (!value_is_small_integer(value) || value_integer(value) < 0) {
         return 0U;
     }
-    return (uint32_t)value.integer;
+    return (uint32_t)value_integer(value);
 }
 
 static uint32_t workspace_visible_origin_top_line_value(void) {
@@ -10419,10 +12529,10 @@ static uint32_t workspace_visible_origin_top_line_value(void) {
         return workspace_cursor_cached_top_line_value();
     }
     value = heap_get_field(origin_object, WORKSPACE_VISIBLE_ORIGIN_FIELD_TOP_LINE);
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || value.integer < 0) {
+    if (!value_is_small_integer(value) || value_integer(value) < 0) {
         return workspace_cursor_cached_top_line_value();
     }
-    return (uint32_t)value.integer;
+    return (uint32_t)value_integer(value);
 }
 
 static uint32_t workspace_visible_origin_left_column_value(void) {
@@ -10433,10 +12543,10 @@ static uint32_t workspace_visible_origin_left_column_value(void) {
         return 0U;
     }
     value = heap_get_field(origin_object, WORKSPACE_VISIBLE_ORIGIN_FIELD_LEFT_COLUMN);
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || value.integer < 0) {
+    if (!value_is_small_integer(value) || value_integer(value) < 0) {
         return 0U;
     }
-    return (uint32_t)value.integer;
+    return (uint32_t)value_integer(value);
 }
 
 static uint32_t workspace_cursor_top_line_value(void) {
@@ -10464,7 +12574,7 @@ static void workspace_capture_input_monitor_cursor_visual_state(
     uint32_t cursor_index = workspace_input_monitor_cursor_index(workspace_object);
 
     workspace_input_monitor_cursor_line_and_column(
-        source_value.kind == RECORZ_MVP_VALUE_STRING ? source_value.string : 0,
+        value_is_string(source_value) ? value_string(source_value) : 0,
         cursor_index,
         cursor_line_out,
         cursor_column_out
@@ -10481,8 +12591,8 @@ static void workspace_sync_input_monitor_text_state(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *text =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
     uint32_t text_length_value = text_length(text);
     uint32_t line = 0U;
@@ -10532,7 +12642,7 @@ static void workspace_bind_input_monitor_cursor_state(
     status_text[0] = '\0';
     feedback_text[0] = '\0';
     if (!workspace_parse_input_monitor_state(
-            target_name_value.kind == RECORZ_MVP_VALUE_STRING ? target_name_value.string : 0,
+            value_is_string(target_name_value) ? value_string(target_name_value) : 0,
             &cursor_index,
             &top_line,
             &saved_view_kind,
@@ -10542,14 +12652,14 @@ static void workspace_bind_input_monitor_cursor_state(
             sizeof(status_text),
             feedback_text,
             sizeof(feedback_text))) {
-        if (heap_get_field(
+        if (value_is_small_integer(heap_get_field(
                 workspace_object,
                 workspace_current_view_kind_field_index(workspace_object)
-            ).kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
-            (uint32_t)heap_get_field(
+            )) &&
+            (uint32_t)value_integer(heap_get_field(
                 workspace_object,
                 workspace_current_view_kind_field_index(workspace_object)
-            ).integer == WORKSPACE_VIEW_INPUT_MONITOR &&
+            )) == WORKSPACE_VIEW_INPUT_MONITOR &&
             (saved_view_kind == WORKSPACE_VIEW_METHOD ||
              saved_view_kind == WORKSPACE_VIEW_CLASS_METHOD ||
              saved_view_kind == WORKSPACE_VIEW_CLASS_SOURCE ||
@@ -10596,7 +12706,7 @@ static uint8_t workspace_input_monitor_accept_context(
         target_name_out[0] = '\0';
     }
     if (!workspace_parse_input_monitor_state(
-            target_name_value.kind == RECORZ_MVP_VALUE_STRING ? target_name_value.string : 0,
+            value_is_string(target_name_value) ? value_string(target_name_value) : 0,
             &cursor_index,
             &top_line,
             &saved_view_kind,
@@ -10647,8 +12757,8 @@ static void workspace_move_input_monitor_cursor_right(
     uint32_t cursor_index = workspace_input_monitor_cursor_index(workspace_object);
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     uint32_t length =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? text_length(source_value.string)
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? text_length(value_string(source_value))
             : 0U;
 
     if (cursor_index < length) {
@@ -10661,7 +12771,7 @@ static void workspace_move_input_monitor_cursor_up(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *text =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0) ? source_value.string : "";
+        (value_is_string(source_value) && value_string(source_value) != 0) ? value_string(source_value) : "";
     uint32_t cursor_index = workspace_input_monitor_cursor_index(workspace_object);
     uint32_t line_start = workspace_input_monitor_line_start(text, cursor_index);
     uint32_t column = cursor_index - line_start;
@@ -10686,7 +12796,7 @@ static void workspace_move_input_monitor_cursor_down(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *text =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0) ? source_value.string : "";
+        (value_is_string(source_value) && value_string(source_value) != 0) ? value_string(source_value) : "";
     uint32_t cursor_index = workspace_input_monitor_cursor_index(workspace_object);
     uint32_t line_start = workspace_input_monitor_line_start(text, cursor_index);
     uint32_t line_end = workspace_input_monitor_line_end(text, cursor_index);
@@ -10748,8 +12858,8 @@ static void workspace_move_cursor_right_in_current_source(
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     uint32_t cursor_index = workspace_cursor_index_value();
     uint32_t length =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? text_length(source_value.string)
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? text_length(value_string(source_value))
             : 0U;
 
     if (cursor_index >= length) {
@@ -10763,8 +12873,8 @@ static void workspace_move_cursor_to_line_start_in_current_source(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *text =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
 
     workspace_sync_workspace_cursor_index(
@@ -10778,8 +12888,8 @@ static void workspace_move_cursor_to_line_end_in_current_source(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *text =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
 
     workspace_sync_workspace_cursor_index(
@@ -10793,8 +12903,8 @@ static void workspace_move_cursor_up_in_current_source(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *text =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
     uint32_t cursor_index = workspace_cursor_index_value();
     uint32_t line_start = workspace_input_monitor_line_start(text, cursor_index);
@@ -10820,8 +12930,8 @@ static void workspace_move_cursor_down_in_current_source(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *text =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
     uint32_t cursor_index = workspace_cursor_index_value();
     uint32_t line_start = workspace_input_monitor_line_start(text, cursor_index);
@@ -10849,8 +12959,8 @@ static void workspace_insert_code_point_in_current_source(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *source =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
     uint32_t length = text_length(source);
     uint32_t cursor_index = workspace_cursor_index_value();
@@ -10895,8 +13005,8 @@ static void workspace_delete_backward_in_current_source(
 ) {
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *source =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
     uint32_t length = text_length(source);
     uint32_t cursor_index = workspace_cursor_index_value();
@@ -11095,10 +13205,10 @@ static uint32_t workspace_current_view_kind_value(
         workspace_current_view_kind_field_index(workspace_object)
     );
 
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || view_kind_value.integer < 0) {
+    if (!value_is_small_integer(view_kind_value) || value_integer(view_kind_value) < 0) {
         return WORKSPACE_VIEW_NONE;
     }
-    return (uint32_t)view_kind_value.integer;
+    return (uint32_t)value_integer(view_kind_value);
 }
 
 static uint8_t workspace_current_source_is_editor_target(
@@ -11120,9 +13230,9 @@ static void workspace_tool_print_current_in_place(
     struct recorz_mvp_value result;
     char rendered_value[METHOD_SOURCE_CHUNK_LIMIT];
 
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         workspace_input_monitor_set_status("BUFFER EMPTY");
         return;
     }
@@ -11133,7 +13243,7 @@ static void workspace_tool_print_current_in_place(
     workspace_input_monitor_clear_feedback();
     workspace_input_monitor_set_status("PRINT RUNNING");
     workspace_input_monitor_capture_enabled = 1U;
-    chunk_source = workspace_normalize_do_it_source(source_value.string);
+    chunk_source = workspace_normalize_do_it_source(value_string(source_value));
     workspace_remember_source(workspace_object, chunk_source);
     result = workspace_evaluate_source(workspace_source_for_evaluation(chunk_source));
     workspace_input_monitor_capture_enabled = 0U;
@@ -11158,55 +13268,55 @@ static void workspace_accept_current_in_place(
     char selector_name_text[METHOD_SOURCE_NAME_LIMIT];
 
     source_value = workspace_current_source_value(object);
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         machine_panic("Workspace acceptCurrent has no current source");
     }
     if (object->field_count <= workspace_current_view_kind_field_index(object)) {
         machine_panic("Workspace acceptCurrent has no current browser target");
     }
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         machine_panic("Workspace acceptCurrent requires a browser target");
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PACKAGE_SOURCE) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE_SOURCE) {
         if (object->field_count <= workspace_current_target_name_field_index(object)) {
             machine_panic("Workspace acceptCurrent is missing the current package target");
         }
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace acceptCurrent is missing the current package target");
         }
-        file_in_chunk_stream_source(source_value.string);
+        file_in_chunk_stream_source(value_string(source_value));
         workspace_remember_editor_current_source(
             object,
-            file_out_package_source_by_name(target_name_value.string)
+            file_out_package_source_by_name(value_string(target_name_value))
         );
-    } else if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_SOURCE) {
+    } else if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_SOURCE) {
         if (object->field_count <= workspace_current_target_name_field_index(object)) {
             machine_panic("Workspace acceptCurrent is missing the current class target");
         }
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace acceptCurrent is missing the current class target");
         }
-        class_object = lookup_class_by_name(target_name_value.string);
+        class_object = lookup_class_by_name(value_string(target_name_value));
         if (class_object == 0) {
             machine_panic("Workspace acceptCurrent could not resolve the current class");
         }
-        file_in_class_source_on_existing_class(source_value.string, class_object);
+        file_in_class_source_on_existing_class(value_string(source_value), class_object);
         workspace_remember_editor_current_source(
             object,
-            file_out_class_source_by_name(target_name_value.string)
+            file_out_class_source_by_name(value_string(target_name_value))
         );
     } else {
-        if ((uint32_t)view_kind_value.integer != WORKSPACE_VIEW_METHOD &&
-            (uint32_t)view_kind_value.integer != WORKSPACE_VIEW_CLASS_METHOD) {
+        if ((uint32_t)value_integer(view_kind_value) != WORKSPACE_VIEW_METHOD &&
+            (uint32_t)value_integer(view_kind_value) != WORKSPACE_VIEW_CLASS_METHOD) {
             machine_panic("Workspace acceptCurrent requires a method, class, or package source browser target");
         }
         class_object = workspace_target_class_for_file_in(object);
@@ -11217,24 +13327,24 @@ static void workspace_accept_current_in_place(
             machine_panic("Workspace acceptCurrent is missing the current method target");
         }
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace acceptCurrent is missing the current method target");
         }
         if (!workspace_parse_method_target_name(
-                target_name_value.string,
+                value_string(target_name_value),
                 class_name,
                 sizeof(class_name),
                 selector_name_text,
                 sizeof(selector_name_text))) {
             machine_panic("Workspace acceptCurrent current method target is invalid");
         }
-        install_method_source_on_class(class_object, source_value.string);
+        install_method_source_on_class(class_object, value_string(source_value));
     }
     refreshed_source = workspace_source_text_for_browser_target(
-        (uint32_t)view_kind_value.integer,
-        target_name_value.string
+        (uint32_t)value_integer(view_kind_value),
+        value_string(target_name_value)
     );
     if (refreshed_source != 0) {
         workspace_remember_editor_current_source(object, refreshed_source);
@@ -11377,21 +13487,21 @@ static void workspace_revert_current_in_place(
     char normalized_target_name[METHOD_SOURCE_NAME_LIMIT];
 
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         machine_panic("Workspace revertCurrent requires a source browser target");
     }
     if (object->field_count <= workspace_current_target_name_field_index(object)) {
         machine_panic("Workspace revertCurrent is missing the current browser target");
     }
     target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-    if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-        target_name_value.string == 0 ||
-        target_name_value.string[0] == '\0') {
+    if (!value_is_string(target_name_value) ||
+        value_string(target_name_value) == 0 ||
+        value_string(target_name_value)[0] == '\0') {
         machine_panic("Workspace revertCurrent is missing the current browser target");
     }
     if (!workspace_resolve_source_browser_target(
-            (uint32_t)view_kind_value.integer,
-            target_name_value.string,
+            (uint32_t)value_integer(view_kind_value),
+            value_string(target_name_value),
             &normalized_view_kind,
             normalized_target_name,
             sizeof(normalized_target_name),
@@ -11423,47 +13533,47 @@ static void workspace_run_current_tests_in_place(
         global_handles[RECORZ_MVP_GLOBAL_TEST_RUNNER]
     );
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         machine_panic("Workspace runCurrentTests requires a browser target");
     }
     if (object->field_count <= workspace_current_target_name_field_index(object)) {
         machine_panic("Workspace runCurrentTests is missing the current browser target");
     }
     target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PACKAGE ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PACKAGE_SOURCE) {
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE_SOURCE) {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace runCurrentTests is missing the current package target");
         }
-        test_runner_run_package(test_runner_object, target_name_value.string);
+        test_runner_run_package(test_runner_object, value_string(target_name_value));
         workspace_input_monitor_set_status("TESTS COMPLETE");
         return;
     }
-    if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-        target_name_value.string == 0 ||
-        target_name_value.string[0] == '\0') {
+    if (!value_is_string(target_name_value) ||
+        value_string(target_name_value) == 0 ||
+        value_string(target_name_value)[0] == '\0') {
         machine_panic("Workspace runCurrentTests is missing the current class target");
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_SOURCE ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_METHODS ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_METHODS ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PROTOCOLS ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
-        class_object = lookup_class_by_name(target_name_value.string);
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_SOURCE ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_METHODS ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_METHODS ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOLS ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
+        class_object = lookup_class_by_name(value_string(target_name_value));
         if (class_object == 0) {
             machine_panic("Workspace runCurrentTests could not resolve the target class");
         }
-        test_runner_run_class(test_runner_object, class_object, target_name_value.string);
+        test_runner_run_class(test_runner_object, class_object, value_string(target_name_value));
         workspace_input_monitor_set_status("TESTS COMPLETE");
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_METHOD ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_METHOD) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_METHOD ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_METHOD) {
         if (!workspace_parse_method_target_name(
-                target_name_value.string,
+                value_string(target_name_value),
                 class_name,
                 sizeof(class_name),
                 selector_name_text,
@@ -11478,10 +13588,10 @@ static void workspace_run_current_tests_in_place(
         workspace_input_monitor_set_status("TESTS COMPLETE");
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PROTOCOL ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOL) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOL ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOL) {
         if (!workspace_parse_protocol_target_name(
-                target_name_value.string,
+                value_string(target_name_value),
                 class_name,
                 sizeof(class_name),
                 protocol_name,
@@ -11600,20 +13710,31 @@ static void workspace_accept_input_monitor_buffer(
     workspace_input_monitor_set_status("INSTALL COMPLETE");
 }
 
-static void workspace_save_and_reopen_in_place(
+/* The reopen hook belongs to the saved image only; once a checkpoint has been stored the running
+   session gets its own startup hook back. */
+static void workspace_checkpoint_reopening_workspace(
     const struct recorz_mvp_heap_object *workspace_object
 ) {
+    if (!snapshot_restores_startup_hook) {
+        snapshot_restored_startup_hook_receiver_handle = startup_hook_receiver_handle;
+        snapshot_restored_startup_hook_selector_id = startup_hook_selector_id;
+        snapshot_restores_startup_hook = 1U;
+    }
     startup_hook_receiver_handle = heap_handle_for_object(workspace_object);
     startup_hook_selector_id = RECORZ_MVP_SELECTOR_REOPEN;
-    emit_live_snapshot();
+    emit_live_snapshot(SNAPSHOT_SAVE_AND_CONTINUE);
+}
+
+static void workspace_save_and_reopen_in_place(
+    const struct recorz_mvp_heap_object *workspace_object
+) {
+    workspace_checkpoint_reopening_workspace(workspace_object);
 }
 
 static void workspace_save_recovery_snapshot_in_place(
     const struct recorz_mvp_heap_object *workspace_object
 ) {
-    startup_hook_receiver_handle = heap_handle_for_object(workspace_object);
-    startup_hook_selector_id = RECORZ_MVP_SELECTOR_REOPEN;
-    emit_live_snapshot();
+    workspace_checkpoint_reopening_workspace(workspace_object);
 }
 
 static void workspace_run_input_monitor_tests(
@@ -11758,13 +13879,15 @@ static void workspace_view_regenerated_source_from_input_monitor(
         nil_value()
     );
     workspace_render_regenerated_source_browser(workspace_object, source_name);
+    ++gc_input_session_depth;
     while (1) {
-        char ch = machine_wait_getc();
+        char ch = wait_for_input_byte_collecting_garbage();
 
         if (ch == 0x0f || ch == 0x04) {
             break;
         }
     }
+    --gc_input_session_depth;
     heap_set_field(
         workspace_handle,
         workspace_current_view_kind_field_index(workspace_object),
@@ -11909,8 +14032,8 @@ static uint8_t workspace_overlay_image_session_editor_cursor_move(
     const struct recorz_mvp_heap_object *form = default_form_object();
     struct recorz_mvp_value source_value = workspace_current_source_value(workspace_object);
     const char *source =
-        (source_value.kind == RECORZ_MVP_VALUE_STRING && source_value.string != 0)
-            ? source_value.string
+        (value_is_string(source_value) && value_string(source_value) != 0)
+            ? value_string(source_value)
             : "";
     uint32_t top_line = workspace_visible_origin_top_line_value();
     uint32_t left_column = workspace_visible_origin_left_column_value();
@@ -12041,8 +14164,9 @@ static void workspace_run_interactive_image_session(
         machine_panic("Workspace interactive session requires BootWorkspaceSession");
     }
     workspace_count_session_render_code(render_code);
+    ++gc_input_session_depth;
     while (1) {
-        char ch = machine_wait_getc();
+        char ch = wait_for_input_byte_collecting_garbage();
         uint32_t old_cursor_line = 0U;
         uint32_t old_cursor_column = 0U;
         uint32_t old_top_line = 0U;
@@ -12123,6 +14247,7 @@ static void workspace_run_interactive_image_session(
             machine_panic("Workspace interactive session requires BootWorkspaceSession");
         }
     }
+    --gc_input_session_depth;
 }
 
 static void workspace_run_interactive_input_monitor(
@@ -12138,8 +14263,9 @@ static void workspace_run_interactive_views(
     if (!workspace_view_router_redraw_from_image()) {
         machine_panic("Workspace interactive views requires BootViewRouter");
     }
+    ++gc_input_session_depth;
     while (1) {
-        char ch = machine_wait_getc();
+        char ch = wait_for_input_byte_collecting_garbage();
 
         if (workspace_view_router_handle_byte_from_image(ch)) {
             continue;
@@ -12148,6 +14274,7 @@ static void workspace_run_interactive_views(
             break;
         }
     }
+    --gc_input_session_depth;
 }
 
 static void workspace_edit_package_in_place(
@@ -12180,43 +14307,43 @@ static void workspace_edit_current_in_place(
     char normalized_target_name[METHOD_SOURCE_NAME_LIMIT];
 
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         machine_panic("Workspace editCurrent requires a browser target");
     }
     if (object->field_count <= workspace_current_target_name_field_index(object)) {
         machine_panic("Workspace editCurrent is missing the current browser target");
     }
     target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PACKAGE ||
-        (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PACKAGE_SOURCE) {
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE ||
+        (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE_SOURCE) {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace editCurrent is missing the current package target");
         }
-        workspace_set_browser_return_context(WORKSPACE_VIEW_PACKAGE, target_name_value.string);
-        source = file_out_package_source_by_name(target_name_value.string);
+        workspace_set_browser_return_context(WORKSPACE_VIEW_PACKAGE, value_string(target_name_value));
+        source = file_out_package_source_by_name(value_string(target_name_value));
         workspace_remember_editor_current_source(object, source);
         workspace_remember_source(object, source);
-        workspace_remember_view(object, WORKSPACE_VIEW_PACKAGE_SOURCE, target_name_value.string);
+        workspace_remember_view(object, WORKSPACE_VIEW_PACKAGE_SOURCE, value_string(target_name_value));
         workspace_run_interactive_input_monitor(object);
         return;
     }
-    if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-        target_name_value.string == 0 ||
-        target_name_value.string[0] == '\0') {
+    if (!value_is_string(target_name_value) ||
+        value_string(target_name_value) == 0 ||
+        value_string(target_name_value)[0] == '\0') {
         machine_panic("Workspace editCurrent is missing the current browser target");
     }
     if (!workspace_resolve_source_browser_target(
-            (uint32_t)view_kind_value.integer,
-            target_name_value.string,
+            (uint32_t)value_integer(view_kind_value),
+            value_string(target_name_value),
             &normalized_view_kind,
             normalized_target_name,
             sizeof(normalized_target_name),
             &source)) {
         machine_panic("Workspace editCurrent requires a class, method, protocol, or package browser target");
     }
-    workspace_set_browser_return_context((uint32_t)view_kind_value.integer, target_name_value.string);
+    workspace_set_browser_return_context((uint32_t)value_integer(view_kind_value), value_string(target_name_value));
     workspace_remember_editor_current_source(object, source);
     workspace_remember_source(object, source);
     workspace_remember_view(object, normalized_view_kind, normalized_target_name);
@@ -12442,7 +14569,7 @@ static struct recorz_mvp_value workspace_process_context_value_for_named_object(
     struct recorz_mvp_value process_context_value = heap_get_field(object, PROCESS_FIELD_CONTEXT);
     uint16_t debug_context_handle;
 
-    if (process_context_value.kind != RECORZ_MVP_VALUE_NIL ||
+    if (!value_is_nil(process_context_value) ||
         object_name == 0 ||
         !source_names_equal(object_name, "BootActiveProcess")) {
         return process_context_value;
@@ -12557,10 +14684,10 @@ static const char *workspace_process_labels_visible_text(uint32_t first_index, u
         process_object = heap_object(binding->object_handle);
         label_value = heap_get_field(process_object, PROCESS_FIELD_LABEL);
         label_text = binding->name;
-        if (label_value.kind == RECORZ_MVP_VALUE_STRING &&
-            label_value.string != 0 &&
-            label_value.string[0] != '\0') {
-            label_text = label_value.string;
+        if (value_is_string(label_value) &&
+            value_string(label_value) != 0 &&
+            value_string(label_value)[0] != '\0') {
+            label_text = value_string(label_value);
         }
         if (offset != 0U) {
             append_text_checked(
@@ -12613,7 +14740,7 @@ static const struct recorz_mvp_heap_object *workspace_context_stack_context_for_
     named_object = heap_object(object_handle);
     if (workspace_object_is_process_like(named_object)) {
         process_context_value = workspace_process_context_value_for_named_object(object_name, named_object);
-        if (process_context_value.kind == RECORZ_MVP_VALUE_NIL) {
+        if (value_is_nil(process_context_value)) {
             workspace_surface_append_line(
                 buffer,
                 buffer_size,
@@ -12622,7 +14749,7 @@ static const struct recorz_mvp_heap_object *workspace_context_stack_context_for_
             );
             return 0;
         }
-        if (process_context_value.kind != RECORZ_MVP_VALUE_OBJECT || process_context_value.integer == 0) {
+        if (!value_is_object(process_context_value) || value_integer(process_context_value) == 0) {
             workspace_surface_append_line(
                 buffer,
                 buffer_size,
@@ -12631,7 +14758,7 @@ static const struct recorz_mvp_heap_object *workspace_context_stack_context_for_
             );
             return 0;
         }
-        context_object = heap_object((uint16_t)process_context_value.integer);
+        context_object = heap_object(value_handle(process_context_value));
         if (context_object->kind != RECORZ_MVP_OBJECT_CONTEXT) {
             workspace_surface_append_line(
                 buffer,
@@ -12668,13 +14795,13 @@ static uint32_t workspace_context_stack_frame_count_for_context_object(
         if (frame_count >= 32U) {
             break;
         }
-        if (sender_value.kind == RECORZ_MVP_VALUE_NIL) {
+        if (value_is_nil(sender_value)) {
             break;
         }
-        if (sender_value.kind != RECORZ_MVP_VALUE_OBJECT || sender_value.integer == 0) {
+        if (!value_is_object(sender_value) || value_integer(sender_value) == 0) {
             break;
         }
-        sender_context_object = heap_object((uint16_t)sender_value.integer);
+        sender_context_object = heap_object(value_handle(sender_value));
         if (sender_context_object->kind != RECORZ_MVP_OBJECT_CONTEXT) {
             break;
         }
@@ -12725,7 +14852,7 @@ static const struct recorz_mvp_heap_object *workspace_context_stack_frame_object
     }
     while (current_frame < frame_index) {
         sender_value = heap_get_field(context_object, CONTEXT_FIELD_SENDER);
-        if (sender_value.kind == RECORZ_MVP_VALUE_NIL) {
+        if (value_is_nil(sender_value)) {
             workspace_surface_append_line(
                 buffer,
                 buffer_size,
@@ -12734,7 +14861,7 @@ static const struct recorz_mvp_heap_object *workspace_context_stack_frame_object
             );
             return 0;
         }
-        if (sender_value.kind != RECORZ_MVP_VALUE_OBJECT || sender_value.integer == 0) {
+        if (!value_is_object(sender_value) || value_integer(sender_value) == 0) {
             workspace_surface_append_line(
                 buffer,
                 buffer_size,
@@ -12743,7 +14870,7 @@ static const struct recorz_mvp_heap_object *workspace_context_stack_frame_object
             );
             return 0;
         }
-        sender_context_object = heap_object((uint16_t)sender_value.integer);
+        sender_context_object = heap_object(value_handle(sender_value));
         if (sender_context_object->kind != RECORZ_MVP_OBJECT_CONTEXT) {
             workspace_surface_append_line(
                 buffer,
@@ -12901,7 +15028,7 @@ static const char *workspace_context_stack_frame_detail_text_for_named_object(
             sizeof(rendered_value)
         )
     );
-    if (sender_value.kind == RECORZ_MVP_VALUE_NIL) {
+    if (value_is_nil(sender_value)) {
         workspace_surface_append_label_text(
             workspace_context_stack_buffer,
             sizeof(workspace_context_stack_buffer),
@@ -12911,7 +15038,7 @@ static const char *workspace_context_stack_frame_detail_text_for_named_object(
         );
         return workspace_context_stack_buffer;
     }
-    if (sender_value.kind != RECORZ_MVP_VALUE_OBJECT || sender_value.integer == 0) {
+    if (!value_is_object(sender_value) || value_integer(sender_value) == 0) {
         workspace_surface_append_line(
             workspace_context_stack_buffer,
             sizeof(workspace_context_stack_buffer),
@@ -12920,7 +15047,7 @@ static const char *workspace_context_stack_frame_detail_text_for_named_object(
         );
         return workspace_context_stack_buffer;
     }
-    sender_context_object = heap_object((uint16_t)sender_value.integer);
+    sender_context_object = heap_object(value_handle(sender_value));
     if (sender_context_object->kind != RECORZ_MVP_OBJECT_CONTEXT) {
         workspace_surface_append_line(
             workspace_context_stack_buffer,
@@ -12996,9 +15123,9 @@ static const char *workspace_value_detail_text_for_value(
             role_name
         );
     }
-    if (value.kind == RECORZ_MVP_VALUE_OBJECT) {
+    if (value_is_object(value)) {
         const struct recorz_mvp_heap_object *object = heap_object_for_value(value);
-        const char *object_name = workspace_named_object_name_for_handle((uint16_t)value.integer);
+        const char *object_name = workspace_named_object_name_for_handle(value_handle(value));
 
         if (object->kind == RECORZ_MVP_OBJECT_CONTEXT) {
             workspace_surface_append_label_text(
@@ -13070,7 +15197,7 @@ static const char *workspace_value_detail_text_for_value(
             return buffer;
         }
     }
-    if (value.kind == RECORZ_MVP_VALUE_NIL) {
+    if (value_is_nil(value)) {
         workspace_surface_append_label_text(
             buffer,
             buffer_size,
@@ -13087,7 +15214,7 @@ static const char *workspace_value_detail_text_for_value(
         );
         return buffer;
     }
-    if (value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (value_is_small_integer(value)) {
         workspace_surface_append_label_text(
             buffer,
             buffer_size,
@@ -13104,7 +15231,7 @@ static const char *workspace_value_detail_text_for_value(
         );
         return buffer;
     }
-    if (value.kind == RECORZ_MVP_VALUE_STRING) {
+    if (value_is_string(value)) {
         workspace_surface_append_label_text(
             buffer,
             buffer_size,
@@ -13117,14 +15244,14 @@ static const char *workspace_value_detail_text_for_value(
             buffer_size,
             &offset,
             "VALUE",
-            value.string == 0 ? "" : value.string
+            value_string(value) == 0 ? "" : value_string(value)
         );
         workspace_surface_append_label_integer(
             buffer,
             buffer_size,
             &offset,
             "SIZE",
-            text_length(value.string == 0 ? "" : value.string)
+            text_length(value_string(value) == 0 ? "" : value_string(value))
         );
         return buffer;
     }
@@ -13524,7 +15651,7 @@ static const char *workspace_context_stack_text_for_named_object(const char *obj
             &offset,
             ""
         );
-        if (process_context_value.kind == RECORZ_MVP_VALUE_NIL) {
+        if (value_is_nil(process_context_value)) {
             workspace_surface_append_line(
                 workspace_object_detail_buffer,
                 sizeof(workspace_object_detail_buffer),
@@ -13533,7 +15660,7 @@ static const char *workspace_context_stack_text_for_named_object(const char *obj
             );
             return workspace_object_detail_buffer;
         }
-        if (process_context_value.kind != RECORZ_MVP_VALUE_OBJECT || process_context_value.integer == 0) {
+        if (!value_is_object(process_context_value) || value_integer(process_context_value) == 0) {
             workspace_surface_append_line(
                 workspace_object_detail_buffer,
                 sizeof(workspace_object_detail_buffer),
@@ -13549,7 +15676,7 @@ static const char *workspace_context_stack_text_for_named_object(const char *obj
             );
             return workspace_object_detail_buffer;
         }
-        context_object = heap_object((uint16_t)process_context_value.integer);
+        context_object = heap_object(value_handle(process_context_value));
         if (context_object->kind != RECORZ_MVP_OBJECT_CONTEXT) {
             workspace_surface_append_line(
                 workspace_object_detail_buffer,
@@ -13663,7 +15790,7 @@ static const char *workspace_context_stack_text_for_named_object(const char *obj
                 sizeof(rendered_value)
             )
         );
-        if (sender_value.kind == RECORZ_MVP_VALUE_NIL) {
+        if (value_is_nil(sender_value)) {
             workspace_surface_append_label_text(
                 workspace_object_detail_buffer,
                 sizeof(workspace_object_detail_buffer),
@@ -13673,7 +15800,7 @@ static const char *workspace_context_stack_text_for_named_object(const char *obj
             );
             break;
         }
-        if (sender_value.kind != RECORZ_MVP_VALUE_OBJECT || sender_value.integer == 0) {
+        if (!value_is_object(sender_value) || value_integer(sender_value) == 0) {
             workspace_surface_append_line(
                 workspace_object_detail_buffer,
                 sizeof(workspace_object_detail_buffer),
@@ -13689,7 +15816,7 @@ static const char *workspace_context_stack_text_for_named_object(const char *obj
             );
             break;
         }
-        sender_context_object = heap_object((uint16_t)sender_value.integer);
+        sender_context_object = heap_object(value_handle(sender_value));
         if (sender_context_object->kind != RECORZ_MVP_OBJECT_CONTEXT) {
             workspace_surface_append_line(
                 workspace_object_detail_buffer,
@@ -13781,19 +15908,27 @@ static void validate_compiled_method(
     uint32_t argument_count
 ) {
     uint8_t discovered_stack_depth[COMPILED_METHOD_MAX_INSTRUCTIONS];
-    uint8_t pending_instruction_indices[COMPILED_METHOD_MAX_INSTRUCTIONS];
-    uint8_t pending_count = 0U;
+    uint16_t pending_instruction_indices[COMPILED_METHOD_MAX_INSTRUCTIONS];
+    uint16_t pending_count = 0U;
     uint8_t saw_return = 0U;
-    uint8_t instruction_count;
-    uint8_t instruction_index;
+    uint16_t instruction_count;
+    uint16_t literal_count;
+    uint16_t instruction_index;
 
     if (compiled_method->kind != RECORZ_MVP_OBJECT_COMPILED_METHOD) {
         machine_panic("compiled method entry implementation is not a compiled method");
     }
-    if (compiled_method->field_count == 0U || compiled_method->field_count > COMPILED_METHOD_MAX_INSTRUCTIONS) {
+    instruction_count = compiled_method_instruction_count(compiled_method);
+    literal_count = compiled_method_literal_count(compiled_method);
+    if (instruction_count == 0U || instruction_count > COMPILED_METHOD_MAX_INSTRUCTIONS) {
         machine_panic("compiled method field count is invalid");
     }
-    instruction_count = compiled_method->field_count;
+    if (literal_count > COMPILED_METHOD_MAX_LITERALS) {
+        machine_panic("compiled method literal count is invalid");
+    }
+    if (compiled_method_has_body(compiled_method)) {
+        (void)compiled_method_body_offset(compiled_method);
+    }
     for (instruction_index = 0U; instruction_index < instruction_count; ++instruction_index) {
         discovered_stack_depth[instruction_index] = 0xFFU;
     }
@@ -13859,6 +15994,12 @@ static void validate_compiled_method(
             case COMPILED_METHOD_OP_PUSH_SMALL_INTEGER:
                 next_depth = (uint8_t)(stack_depth + 1U);
                 break;
+            case COMPILED_METHOD_OP_PUSH_LITERAL:
+                if (operand_b >= literal_count) {
+                    machine_panic("compiled method pushLiteral index is out of range");
+                }
+                next_depth = (uint8_t)(stack_depth + 1U);
+                break;
             case COMPILED_METHOD_OP_PUSH_STRING_LITERAL:
                 if (operand_b == 0U || operand_b > LIVE_STRING_LITERAL_LIMIT) {
                     machine_panic("compiled method pushStringLiteral slot is out of range");
@@ -13883,6 +16024,24 @@ static void validate_compiled_method(
                 }
                 next_depth = (uint8_t)(stack_depth - 1U);
                 break;
+            case COMPILED_METHOD_OP_STORE_FIELD_FROM_ARGUMENT:
+                if (operand_a >= OBJECT_FIELD_LIMIT) {
+                    machine_panic("compiled method storeFieldFromArgument field index is out of range");
+                }
+                if (operand_b >= argument_count) {
+                    machine_panic("compiled method storeFieldFromArgument argument index is out of range");
+                }
+                next_depth = stack_depth;
+                break;
+            case COMPILED_METHOD_OP_STORE_LEXICAL_FROM_ARGUMENT:
+                if (operand_a >= argument_count) {
+                    machine_panic("compiled method storeLexicalFromArgument argument index is out of range");
+                }
+                if (operand_b >= LEXICAL_LIMIT) {
+                    machine_panic("compiled method storeLexicalFromArgument lexical index is out of range");
+                }
+                next_depth = stack_depth;
+                break;
             case COMPILED_METHOD_OP_POP:
                 if (stack_depth == 0U) {
                     machine_panic("compiled method pop stack underflow");
@@ -13891,7 +16050,7 @@ static void validate_compiled_method(
                 break;
             case COMPILED_METHOD_OP_SEND:
                 if (operand_a < RECORZ_MVP_SELECTOR_SHOW ||
-                    operand_a > MAX_SELECTOR_ID) {
+                    operand_a > last_selector_id()) {
                     machine_panic("compiled method send selector is out of range");
                 }
                 send_count = operand_b;
@@ -13910,7 +16069,7 @@ static void validate_compiled_method(
                 }
                 if (discovered_stack_depth[target_pc] == 0xFFU) {
                     discovered_stack_depth[target_pc] = stack_depth;
-                    pending_instruction_indices[pending_count++] = (uint8_t)target_pc;
+                    pending_instruction_indices[pending_count++] = target_pc;
                 } else if (discovered_stack_depth[target_pc] != stack_depth) {
                     machine_panic("compiled method jump stack depth mismatch");
                 }
@@ -13927,7 +16086,7 @@ static void validate_compiled_method(
                 next_depth = (uint8_t)(stack_depth - 1U);
                 if (discovered_stack_depth[target_pc] == 0xFFU) {
                     discovered_stack_depth[target_pc] = next_depth;
-                    pending_instruction_indices[pending_count++] = (uint8_t)target_pc;
+                    pending_instruction_indices[pending_count++] = target_pc;
                 } else if (discovered_stack_depth[target_pc] != next_depth) {
                     machine_panic("compiled method conditional jump stack depth mismatch");
                 }
@@ -13941,15 +16100,28 @@ static void validate_compiled_method(
             case COMPILED_METHOD_OP_RETURN_RECEIVER:
                 saw_return = 1U;
                 continue;
+            case COMPILED_METHOD_OP_RETURN_FIELD:
+                if (operand_a >= OBJECT_FIELD_LIMIT) {
+                    machine_panic("compiled method returnField index is out of range");
+                }
+                saw_return = 1U;
+                continue;
             default:
-                machine_panic("compiled method opcode is unknown");
+                if (!opcode_is_special_send(opcode)) {
+                    machine_panic("compiled method opcode is unknown");
+                }
+                if (stack_depth < 2U) {
+                    machine_panic("compiled method send stack underflow");
+                }
+                next_depth = (uint8_t)(stack_depth - 1U);
+                break;
         }
-        if ((uint8_t)(instruction_index + 1U) >= instruction_count) {
+        if ((uint16_t)(instruction_index + 1U) >= instruction_count) {
             machine_panic("compiled method falls through without returning");
         }
         if (discovered_stack_depth[instruction_index + 1U] == 0xFFU) {
             discovered_stack_depth[instruction_index + 1U] = next_depth;
-            pending_instruction_indices[pending_count++] = (uint8_t)(instruction_index + 1U);
+            pending_instruction_indices[pending_count++] = (uint16_t)(instruction_index + 1U);
         } else if (discovered_stack_depth[instruction_index + 1U] != next_depth) {
             machine_panic("compiled method control flow stack depth mismatch");
         }
@@ -13963,10 +16135,10 @@ static void validate_class_superclass(const struct recorz_mvp_heap_object *class
     struct recorz_mvp_value superclass_value = heap_get_field(class_object, CLASS_FIELD_SUPERCLASS);
     const struct recorz_mvp_heap_object *superclass_object;
 
-    if (superclass_value.kind == RECORZ_MVP_VALUE_NIL) {
+    if (value_is_nil(superclass_value)) {
         return;
     }
-    if (superclass_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(superclass_value)) {
         machine_panic("class superclass is not a class object");
     }
     superclass_object = heap_object_for_value(superclass_value);
@@ -13979,40 +16151,41 @@ static void validate_class_method_table(
     const struct recorz_mvp_heap_object *class_object,
     uint8_t require_seeded_entry_ids
 ) {
-    struct recorz_mvp_value method_start_value;
     uint32_t method_count;
     uint32_t method_offset;
     uint32_t class_kind;
-    uint16_t start_handle;
+    uint32_t dictionary_offset;
+    uint32_t capacity;
 
     if (class_object->field_count <= CLASS_FIELD_METHOD_COUNT) {
         machine_panic("class descriptor is missing method table fields");
     }
-    method_start_value = heap_get_field(class_object, CLASS_FIELD_METHOD_START);
     method_count = small_integer_u32(
         heap_get_field(class_object, CLASS_FIELD_METHOD_COUNT),
         "class method count is not a small integer"
     );
     if (method_count == 0U) {
-        if (method_start_value.kind != RECORZ_MVP_VALUE_NIL) {
-            machine_panic("class with zero methods has a method start");
+        if (!value_is_nil(heap_get_field(class_object, CLASS_FIELD_METHOD_START))) {
+            machine_panic("class with zero methods has a method dictionary");
         }
         return;
     }
-    if (method_start_value.kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("class method start is not a method descriptor");
+    dictionary_offset = class_method_dictionary_offset(class_object);
+    capacity = method_dictionary_slots[dictionary_offset];
+    if (capacity < METHOD_DICTIONARY_MIN_CAPACITY || (capacity & (capacity - 1U)) != 0U) {
+        machine_panic("class method dictionary capacity is invalid");
     }
-    start_handle = (uint16_t)method_start_value.integer;
-    if (start_handle == 0U || start_handle > heap_size) {
-        machine_panic("class method start is out of range");
+    if (method_dictionary_slots[dictionary_offset + 1U] != heap_handle_for_object(class_object)) {
+        machine_panic("class method dictionary belongs to another class");
     }
-    if ((uint32_t)start_handle + method_count - 1U > heap_size) {
-        machine_panic("class method range is out of range");
+    if (method_count > method_dictionary_entry_limit(capacity)) {
+        machine_panic("class method count exceeds method dictionary capacity");
     }
     class_kind = class_instance_kind(class_object);
     for (method_offset = 0U; method_offset < method_count; ++method_offset) {
-        const struct recorz_mvp_heap_object *method_object =
-            (const struct recorz_mvp_heap_object *)heap_object((uint16_t)(start_handle + method_offset));
+        uint32_t entry_offset = method_dictionary_entry_offset(dictionary_offset, method_offset);
+        uint16_t method_handle = method_dictionary_slots[entry_offset + 1U];
+        const struct recorz_mvp_heap_object *method_object;
         const struct recorz_mvp_heap_object *entry_object;
         const struct recorz_mvp_heap_object *implementation_object;
         struct recorz_mvp_value implementation_value;
@@ -14022,20 +16195,28 @@ static void validate_class_method_table(
         uint32_t entry;
         uint32_t primitive_binding_id;
 
+        if (method_handle == 0U || method_handle > heap_size) {
+            machine_panic("class method dictionary entry is out of range");
+        }
+        method_object = (const struct recorz_mvp_heap_object *)heap_object(method_handle);
         if (method_object->kind != RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR) {
-            machine_panic("class method range contains a non-method descriptor");
+            machine_panic("class method dictionary contains a non-method descriptor");
         }
         if (method_object->field_count <= METHOD_FIELD_ENTRY) {
             machine_panic("method descriptor is missing required fields");
         }
         selector = method_descriptor_selector(method_object);
+        if (selector != method_dictionary_slots[entry_offset] ||
+            class_method_lookup_handle(class_object, (uint16_t)selector) == 0U) {
+            machine_panic("class method dictionary index does not match method descriptor");
+        }
         argument_count = method_descriptor_argument_count(method_object);
         primitive_kind = method_descriptor_primitive_kind(method_object);
         entry_object = method_descriptor_entry_object(method_object);
         entry = method_entry_execution_id(entry_object);
         implementation_value = method_entry_implementation_value(entry_object);
         if (selector < RECORZ_MVP_SELECTOR_SHOW ||
-            selector > MAX_SELECTOR_ID) {
+            selector > last_selector_id()) {
             machine_panic("method descriptor selector is out of range");
         }
         if (argument_count > MAX_SEND_ARGS) {
@@ -14050,14 +16231,14 @@ static void validate_class_method_table(
         if (require_seeded_entry_ids && entry >= RECORZ_MVP_METHOD_ENTRY_COUNT) {
             machine_panic("method entry execution id is out of range");
         }
-        if (implementation_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER) {
-            primitive_binding_id = (uint32_t)implementation_value.integer;
+        if (value_is_small_integer(implementation_value)) {
+            primitive_binding_id = (uint32_t)value_integer(implementation_value);
             if (primitive_binding_id == 0U || primitive_binding_id >= RECORZ_MVP_PRIMITIVE_COUNT) {
                 machine_panic("primitive method entry binding id is out of range");
             }
             continue;
         }
-        if (implementation_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+        if (!value_is_object(implementation_value)) {
             machine_panic("method entry implementation object is missing");
         }
         implementation_object = heap_object_for_value(implementation_value);
@@ -14065,6 +16246,59 @@ static void validate_class_method_table(
     }
 }
 
+static void initialize_class_method_dictionaries_from_seed_runs(void) {
+    uint16_t handle;
+
+    for (handle = 1U; handle <= heap_size; ++handle) {
+        const struct recorz_mvp_heap_object *class_object = (const struct recorz_mvp_heap_object *)heap_object(handle);
+        const struct recorz_mvp_heap_object *first_method;
+        struct recorz_mvp_value method_start_value;
+        uint32_t method_count;
+        uint32_t method_index;
+        uint32_t dictionary_offset;
+        uint16_t start_handle;
+
+        if (class_object->kind != RECORZ_MVP_OBJECT_CLASS) {
+            continue;
+        }
+        if (class_object->field_count <= CLASS_FIELD_METHOD_COUNT) {
+            machine_panic("class descriptor is missing method table fields");
+        }
+        method_count = small_integer_u32(
+            heap_get_field(class_object, CLASS_FIELD_METHOD_COUNT),
+            "class method count is not a small integer"
+        );
+        if (method_count == 0U) {
+            continue;
+        }
+        method_start_value = heap_get_field(class_object, CLASS_FIELD_METHOD_START);
+        if (!value_is_object(method_start_value)) {
+            machine_panic("class method start is not a method descriptor");
+        }
+        start_handle = value_handle(method_start_value);
+        if (start_handle == 0U || start_handle > heap_size || method_count > (uint32_t)heap_size - start_handle + 1U) {
+            machine_panic("class method range is out of range");
+        }
+        first_method = heap_object(start_handle);
+        dictionary_offset = method_dictionary_allocate(handle, method_dictionary_capacity_for(method_count));
+        for (method_index = 0U; method_index < method_count; ++method_index) {
+            uint16_t method_handle = (uint16_t)(start_handle + method_index);
+
+            if (first_method[method_index].kind != RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR) {
+                machine_panic("class method range contains a non-method descriptor");
+            }
+            method_dictionary_store_entry(
+                dictionary_offset,
+                method_index,
+                method_descriptor_selector(&first_method[method_index]),
+                method_handle
+            );
+            gc_remember_young_reference(handle, method_handle);
+        }
+        heap_set_field(handle, CLASS_FIELD_METHOD_START, small_integer_value((int32_t)dictionary_offset));
+    }
+}
+
 static void validate_heap_class_graph(uint16_t object_count, uint8_t require_seeded_entry_ids) {
     uint16_t handle;
 
@@ -14073,7 +16307,7 @@ static void validate_heap_class_graph(uint16_t object_count, uint8_t require_see
         const struct recorz_mvp_heap_object *class_object;
         const struct recorz_mvp_heap_object *metaclass_object;
 
-        if (object->kind == 0U) {
+        if (object->kind == 0U || heap_object_is_indexable_body(object)) {
             continue;
         }
         class_object = class_object_for_heap_object(object);
@@ -14135,9 +16369,10 @@ static void initialize_selector_handle_cache(void) {
     uint16_t handle;
     uint16_t selector_id;
 
-    for (selector_id = 0U; selector_id <= MAX_SELECTOR_ID; ++selector_id) {
+    for (selector_id = 0U; selector_id <= MAX_SELECTOR_ID + DYNAMIC_SELECTOR_LIMIT; ++selector_id) {
         selector_handles_by_id[selector_id] = 0U;
     }
+    dynamic_selector_count = 0U;
     for (handle = 1U; handle <= heap_size; ++handle) {
         const struct recorz_mvp_heap_object *object = (const struct recorz_mvp_heap_object *)heap_object(handle);
 
@@ -14145,16 +16380,24 @@ static void initialize_selector_handle_cache(void) {
             continue;
         }
         selector_id = (uint16_t)selector_object_selector_id(object);
+        if (selector_id == 0U || selector_id > MAX_SELECTOR_ID + DYNAMIC_SELECTOR_LIMIT) {
+            machine_panic("selector object id is out of range");
+        }
         if (selector_handles_by_id[selector_id] != 0U) {
             machine_panic("seed contains duplicate selector objects");
         }
         selector_handles_by_id[selector_id] = handle;
+        if (selector_id > last_selector_id()) {
+            dynamic_selector_count = (uint16_t)(selector_id - MAX_SELECTOR_ID);
+        }
     }
+    initialize_selector_table();
 }
 
 static void initialize_runtime_caches(void) {
     initialize_class_handle_cache();
     initialize_selector_handle_cache();
+    method_cache_flush();
 }
 
 static void reset_runtime_state(void) {
@@ -14192,14 +16435,32 @@ static void reset_runtime_state(void) {
     transcript_font_handle = 0U;
     startup_hook_receiver_handle = 0U;
     startup_hook_selector_id = 0U;
+    snapshot_restored_startup_hook_receiver_handle = 0U;
+    snapshot_restored_startup_hook_selector_id = 0U;
+    snapshot_restores_startup_hook = 0U;
     cursor_x = 0U;
     cursor_y = 0U;
     live_method_source_pool_used = 0U;
     live_method_source_pool[0] = '\0';
+    live_method_program_instructions_used = 0U;
+    live_method_program_literals_used = 0U;
+    live_method_program_lexical_names_used = 0U;
+    live_method_program_activation_depth = 0U;
+    compiled_block_count = 0U;
+    compiled_block_instructions_used = 0U;
+    compiled_block_literals_used = 0U;
+    compiled_block_lexical_names_used = 0U;
+    compiled_block_activation_depth = 0U;
+    compiled_block_index_rebuild();
+    block_return_home_context_index = -1;
+    activation_frame_count = 0U;
+    compiled_method_body_words_used = 0U;
+    method_dictionary_slots_used = 0U;
     live_package_do_it_source_pool_used = 0U;
     live_package_do_it_source_pool[0] = '\0';
     runtime_string_pool_offset = 0U;
     runtime_string_pool[0] = '\0';
+    runtime_string_index_clear();
     snapshot_string_pool[0] = '\0';
     booted_from_snapshot = 0U;
     scheduled_runnable_head = 0xFFFFU;
@@ -14208,15 +16469,39 @@ static void reset_runtime_state(void) {
     scheduled_yield_requested = 0U;
     scheduled_suspend_requested = 0U;
     scheduled_terminate_requested = 0U;
+    scheduled_snapshot_save_mode = 0U;
     scheduled_debug_mode = RECORZ_MVP_SCHEDULER_DEBUG_NONE;
     scheduled_debug_target_process_index = -1;
     scheduled_debug_start_depth = 0U;
     gc_collection_count = 0U;
+    method_cache_hit_count = 0U;
+    method_cache_miss_count = 0U;
+    send_site_hit_count = 0U;
+    send_site_miss_count = 0U;
     gc_last_reclaimed_count = 0U;
     gc_total_reclaimed_count = 0U;
-    gc_stack_base_address = 0U;
-    gc_temp_root_count = 0U;
+    gc_nursery_count = 0U;
+    gc_nursery_safepoint_count = 0U;
+    gc_nursery_overflowed = 0U;
+    gc_remembered_count = 0U;
+    gc_remembered_set_overflowed = 0U;
+    gc_minor_collection_active = 0U;
+    gc_minor_collection_count = 0U;
+    gc_promoted_since_full_count = 0U;
+    gc_allocated_since_collection_count = 0U;
+    heap_free_hint = 1U;
+    gc_grey_count = 0U;
+    gc_grey_stack_overflowed = 0U;
+    gc_incremental_phase = GC_INCREMENTAL_IDLE;
+    gc_incremental_sweep_cursor = 0U;
+    gc_incremental_reclaimed = 0U;
+    gc_incremental_step_count = 0U;
+    gc_pause_work = 0U;
+    gc_last_pause_work = 0U;
+    gc_max_pause_work = 0U;
+    gc_root_frames = 0;
     gc_bootstrap_file_in_active = 0U;
+    decoded_instructions_reset();
     for (global_index = 0U; global_index <= MAX_GLOBAL_ID; ++global_index) {
         global_handles[global_index] = 0U;
     }
@@ -14227,9 +16512,8 @@ static void reset_runtime_state(void) {
     }
     for (handle_index = 0U; handle_index < sizeof(gc_mark_bits); ++handle_index) {
         gc_mark_bits[handle_index] = 0U;
-    }
-    for (handle_index = 0U; handle_index < GC_TEMP_ROOT_LIMIT; ++handle_index) {
-        gc_temp_roots[handle_index] = 0U;
+        gc_young_bits[handle_index] = 0U;
+        gc_remembered_bits[handle_index] = 0U;
     }
     for (dynamic_index = 0U; dynamic_index < DYNAMIC_CLASS_LIMIT; ++dynamic_index) {
         uint8_t ivar_index;
@@ -14265,6 +16549,15 @@ static void reset_runtime_state(void) {
         live_method_sources[named_index].protocol_name[0] = '\0';
         live_method_sources[named_index].source_offset = 0U;
         live_method_sources[named_index].source_length = 0U;
+        live_method_sources[named_index].execution_kind = 0U;
+        live_method_sources[named_index].program_has_block_literal = 0U;
+        live_method_sources[named_index].program_lexical_count = 0U;
+        live_method_sources[named_index].program_instruction_offset = 0U;
+        live_method_sources[named_index].program_instruction_count = 0U;
+        live_method_sources[named_index].program_literal_offset = 0U;
+        live_method_sources[named_index].program_literal_count = 0U;
+        live_method_sources[named_index].program_lexical_name_offset = 0U;
+        live_method_sources[named_index].send_site_base = 0U;
     }
     for (named_index = 0U; named_index < LIVE_PACKAGE_DO_IT_SOURCE_LIMIT; ++named_index) {
         live_package_do_it_sources[named_index].package_name[0] = '\0';
@@ -14304,17 +16597,17 @@ static void reset_runtime_state(void) {
 }
 
 static uint32_t small_integer_u32(struct recorz_mvp_value value, const char *message) {
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER || value.integer < 0) {
+    if (!value_is_small_integer(value) || value_small_integer(value) < 0) {
         machine_panic(message);
     }
-    return (uint32_t)value.integer;
+    return (uint32_t)value_small_integer(value);
 }
 
 static int32_t small_integer_i32(struct recorz_mvp_value value, const char *message) {
-    if (value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(value)) {
         machine_panic(message);
     }
-    return value.integer;
+    return value_small_integer(value);
 }
 
 static const struct recorz_mvp_heap_object *transcript_layout_object(void) {
@@ -14334,7 +16627,7 @@ static const struct recorz_mvp_heap_object *transcript_layout_reference_object(
     struct recorz_mvp_value reference_value = heap_get_field(transcript_layout_object(), field_index);
     const struct recorz_mvp_heap_object *reference_object;
 
-    if (reference_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(reference_value)) {
         machine_panic(message);
     }
     reference_object = heap_object_for_value(reference_value);
@@ -14564,7 +16857,7 @@ static const struct recorz_mvp_heap_object *transcript_font_reference_object(
     struct recorz_mvp_value reference_value = heap_get_field(transcript_font_object(), field_index);
     const struct recorz_mvp_heap_object *reference_object;
 
-    if (reference_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(reference_value)) {
         machine_panic(message);
     }
     reference_object = heap_object_for_value(reference_value);
@@ -14593,7 +16886,7 @@ static const struct recorz_mvp_heap_object *text_style_object_for_value(
 ) {
     const struct recorz_mvp_heap_object *style_object;
 
-    if (value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(value)) {
         machine_panic(message);
     }
     style_object = heap_object_for_value(value);
@@ -14665,7 +16958,7 @@ static const struct recorz_mvp_heap_object *transcript_vertical_metrics_object(v
     );
     const struct recorz_mvp_heap_object *vertical_metrics_object;
 
-    if (vertical_metrics_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(vertical_metrics_value)) {
         machine_panic("text metrics verticalMetrics is not a text vertical metrics object");
     }
     vertical_metrics_object = heap_object_for_value(vertical_metrics_value);
@@ -14690,8 +16983,8 @@ static const struct recorz_mvp_heap_object *transcript_behavior_object(void) {
 static void validate_transcript_font_glyphs_reference(void) {
     struct recorz_mvp_value glyphs_value = heap_get_field(transcript_font_object(), FONT_FIELD_GLYPHS);
 
-    if (glyphs_value.kind != RECORZ_MVP_VALUE_OBJECT ||
-        (uint16_t)glyphs_value.integer != global_handles[RECORZ_MVP_GLOBAL_GLYPHS]) {
+    if (!value_is_object(glyphs_value) ||
+        value_handle(glyphs_value) != global_handles[RECORZ_MVP_GLOBAL_GLYPHS]) {
         machine_panic("transcript font glyphs does not point at Glyphs");
     }
 }
@@ -14924,10 +17217,10 @@ static struct recorz_mvp_heap_object *mutable_bitmap_for_form(const struct recor
     struct recorz_mvp_value bits_value = heap_get_field(form, FORM_FIELD_BITS);
     struct recorz_mvp_heap_object *bitmap;
 
-    if (bits_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(bits_value)) {
         machine_panic("form bits is not a heap object");
     }
-    bitmap = heap_object((uint16_t)bits_value.integer);
+    bitmap = heap_object(value_handle(bits_value));
     if (bitmap->kind != RECORZ_MVP_OBJECT_BITMAP) {
         machine_panic("form bits is not a bitmap");
     }
@@ -15511,10 +17804,10 @@ static void require_bitblt_copy_operands_at(
     const struct recorz_mvp_heap_object **source_bitmap,
     const struct recorz_mvp_heap_object **dest_form
 ) {
-    if (arguments[source_index].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[source_index])) {
         machine_panic("BitBlt copy expects a bitmap source");
     }
-    if (arguments[dest_index].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[dest_index])) {
         machine_panic("BitBlt copy expects a form destination");
     }
     *source_bitmap = heap_object_for_value(arguments[source_index]);
@@ -15625,7 +17918,7 @@ static uint8_t form_has_image_side_styled_text_override(const struct recorz_mvp_
     );
     return (uint8_t)(
         source_record != 0 &&
-        source_text_requires_live_evaluator(live_method_source_text(source_record))
+        source_record->execution_kind != RECORZ_MVP_LIVE_METHOD_EXECUTION_COMPILED
     );
 }
 
@@ -15833,10 +18126,10 @@ static struct recorz_mvp_value allocate_form_from_bits_value(struct recorz_mvp_v
 static uint8_t form_can_be_display(const struct recorz_mvp_heap_object *form) {
     struct recorz_mvp_value bits_value = heap_get_field(form, FORM_FIELD_BITS);
 
-    if (bits_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(bits_value)) {
         return 0U;
     }
-    return (uint8_t)((uint16_t)bits_value.integer == framebuffer_bitmap_handle);
+    return (uint8_t)(value_handle(bits_value) == framebuffer_bitmap_handle);
 }
 
 static const struct recorz_mvp_heap_object *cursor_bitmap_object(const struct recorz_mvp_heap_object *cursor) {
@@ -15844,7 +18137,7 @@ static const struct recorz_mvp_heap_object *cursor_bitmap_object(const struct re
     const struct recorz_mvp_heap_object *bitmap;
     uint32_t storage_kind;
 
-    if (bits_value.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(bits_value)) {
         machine_panic("Cursor bits must be a bitmap object");
     }
     bitmap = heap_object_for_value(bits_value);
@@ -15949,6 +18242,13 @@ static void initialize_roots(const struct recorz_mvp_seed *seed) {
         }
         heap_set_class(seeded_handles[seed_index], seed_handle_at(seed, seed_object->class_index));
     }
+    if (seed->compiled_method_body_word_count > COMPILED_METHOD_BODY_WORD_LIMIT) {
+        machine_panic("seed compiled method bodies exceed pool capacity");
+    }
+    for (seed_index = 0U; seed_index < seed->compiled_method_body_word_count; ++seed_index) {
+        compiled_method_body_words[seed_index] = seed->compiled_method_body_words[seed_index];
+    }
+    compiled_method_body_words_used = seed->compiled_method_body_word_count;
     for (seed_index = 0U; seed_index < seed->object_count; ++seed_index) {
         const struct recorz_mvp_seed_object *seed_object = &seed->objects[seed_index];
         uint8_t field_index;
@@ -15960,6 +18260,7 @@ static void initialize_roots(const struct recorz_mvp_seed *seed) {
             );
         }
     }
+    initialize_class_method_dictionaries_from_seed_runs();
     validate_heap_class_graph(heap_size, 1U);
     initialize_runtime_caches();
 
@@ -15982,8 +18283,8 @@ static void initialize_roots(const struct recorz_mvp_seed *seed) {
     transcript_style_handle = seed_handle_at(seed, seed->root_object_indices[RECORZ_MVP_SEED_ROOT_TRANSCRIPT_STYLE]);
     transcript_metrics_handle = seed_handle_at(seed, seed->root_object_indices[RECORZ_MVP_SEED_ROOT_TRANSCRIPT_METRICS]);
     transcript_font_handle = seed_handle_at(seed, seed->root_object_indices[RECORZ_MVP_SEED_ROOT_TRANSCRIPT_FONT]);
-    if (heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS).kind != RECORZ_MVP_VALUE_OBJECT ||
-        (uint16_t)heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS).integer != framebuffer_bitmap_handle) {
+    if (!value_is_object(heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS)) ||
+        value_handle(heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS)) != framebuffer_bitmap_handle) {
         machine_panic("seed default form does not point at the framebuffer bitmap");
     }
 
@@ -16001,14 +18302,14 @@ static void initialize_roots(const struct recorz_mvp_seed *seed) {
         if (fallback_bitmap->kind != RECORZ_MVP_OBJECT_BITMAP) {
             machine_panic("text behavior fallback bitmap is not a bitmap");
         }
-        glyph_fallback_handle = (uint16_t)fallback_value.integer;
+        glyph_fallback_handle = value_handle(fallback_value);
     }
-    if (heap_get_field(transcript_font_object(), FONT_FIELD_METRICS).kind != RECORZ_MVP_VALUE_OBJECT ||
-        (uint16_t)heap_get_field(transcript_font_object(), FONT_FIELD_METRICS).integer != transcript_metrics_handle) {
+    if (!value_is_object(heap_get_field(transcript_font_object(), FONT_FIELD_METRICS)) ||
+        value_handle(heap_get_field(transcript_font_object(), FONT_FIELD_METRICS)) != transcript_metrics_handle) {
         machine_panic("transcript font does not point at transcript metrics");
     }
-    if (heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR).kind != RECORZ_MVP_VALUE_OBJECT ||
-        (uint16_t)heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR).integer != transcript_behavior_handle) {
+    if (!value_is_object(heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR)) ||
+        value_handle(heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR)) != transcript_behavior_handle) {
         machine_panic("transcript font does not point at transcript behavior");
     }
     if (transcript_font_u32(FONT_FIELD_POINT_SIZE, "transcript font point size is not a small integer") == 0U) {
@@ -16038,6 +18339,15 @@ static uint32_t text_length(const char *text) {
     return length;
 }
 
+static uint32_t text_hash(const char *text) {
+    uint32_t hash = 2166136261U;
+
+    while (*text != '\0') {
+        hash = (hash ^ (uint8_t)*text++) * 16777619U;
+    }
+    return hash;
+}
+
 static uint8_t runtime_string_pool_contains(const char *text, uint32_t *offset_out) {
     uint32_t offset;
 
@@ -16061,8 +18371,8 @@ static void runtime_string_mark_live_value(
 ) {
     uint32_t offset;
 
-    if (value.kind != RECORZ_MVP_VALUE_STRING ||
-        !runtime_string_pool_contains(value.string, &offset)) {
+    if (!value_is_string(value) ||
+        !runtime_string_pool_contains(value_string(value), &offset)) {
         return;
     }
     live_starts[offset >> 3U] |= (uint8_t)(1U << (offset & 7U));
@@ -16081,8 +18391,8 @@ static void runtime_string_rewrite_live_value(
     const char *old_text,
     const char *new_text
 ) {
-    if (value->kind == RECORZ_MVP_VALUE_STRING && value->string == old_text) {
-        value->string = new_text;
+    if (value_is_string(*value) && value_string(*value) == old_text) {
+        *value = string_value(new_text);
     }
 }
 
@@ -16090,6 +18400,7 @@ static void runtime_string_rewrite_references(const char *old_text, const char *
     uint32_t stack_index;
     uint16_t handle;
     uint16_t literal_index;
+    uint16_t block_index;
     uint16_t env_index;
     uint16_t home_index;
 
@@ -16113,13 +18424,30 @@ static void runtime_string_rewrite_references(const char *old_text, const char *
             live_string_literals[literal_index].text = new_text;
         }
     }
+    for (literal_index = 0U; literal_index < live_method_program_literals_used; ++literal_index) {
+        if (live_method_program_literals[literal_index].kind == RECORZ_MVP_LITERAL_STRING &&
+            live_method_program_literals[literal_index].string == old_text) {
+            live_method_program_literals[literal_index].string = new_text;
+        }
+    }
+    for (literal_index = 0U; literal_index < compiled_block_literals_used; ++literal_index) {
+        if (compiled_block_literals[literal_index].kind == RECORZ_MVP_LITERAL_STRING &&
+            compiled_block_literals[literal_index].string == old_text) {
+            compiled_block_literals[literal_index].string = new_text;
+        }
+    }
+    for (block_index = 0U; block_index < compiled_block_count; ++block_index) {
+        if (compiled_blocks[block_index].source == old_text) {
+            compiled_blocks[block_index].source = new_text;
+        }
+    }
     for (env_index = 0U; env_index < SOURCE_EVAL_ENV_LIMIT; ++env_index) {
         if (source_eval_environments[env_index].in_use) {
             uint16_t binding_index;
 
             for (binding_index = 0U; binding_index < source_eval_environments[env_index].binding_count; ++binding_index) {
                 runtime_string_rewrite_live_value(
-                    &source_eval_environments[env_index].bindings[binding_index].value,
+                    &source_eval_environments[env_index].values[binding_index],
                     old_text,
                     new_text
                 );
@@ -16135,17 +18463,58 @@ static void runtime_string_rewrite_references(const char *old_text, const char *
             );
         }
     }
+    for (home_index = 0U; home_index < activation_frame_count; ++home_index) {
+        runtime_string_rewrite_live_value(&activation_frames[home_index].receiver, old_text, new_text);
+        runtime_string_rewrite_live_value(&activation_frames[home_index].detail, old_text, new_text);
+    }
 }
 
-static void runtime_string_compact_live_references(void) {
-    uint8_t live_starts[(RUNTIME_STRING_POOL_LIMIT + 7U) / 8U];
-    uint32_t write_offset = 0U;
-    uint32_t read_offset;
-    uint32_t live_starts_index;
-    uint32_t stack_index;
-    uint16_t handle;
-    uint16_t literal_index;
-    uint16_t env_index;
+static void runtime_string_index_clear(void) {
+    uint32_t slot;
+
+    for (slot = 0U; slot < RUNTIME_STRING_INDEX_SIZE; ++slot) {
+        runtime_string_index[slot] = 0U;
+    }
+    runtime_string_index_count = 0U;
+    runtime_string_index_overflowed = 0U;
+}
+
+/* Slots hold pool offset + 1; once the index fills, interning falls back to scanning the pool. */
+static void runtime_string_index_insert(uint32_t offset) {
+    uint32_t slot;
+
+    if (runtime_string_index_count >= RUNTIME_STRING_INDEX_SIZE - RUNTIME_STRING_INDEX_SIZE / 4U) {
+        runtime_string_index_overflowed = 1U;
+        return;
+    }
+    slot = text_hash(runtime_string_pool + offset) & (RUNTIME_STRING_INDEX_SIZE - 1U);
+    while (runtime_string_index[slot] != 0U) {
+        slot = (slot + 1U) & (RUNTIME_STRING_INDEX_SIZE - 1U);
+    }
+    runtime_string_index[slot] = offset + 1U;
+    ++runtime_string_index_count;
+}
+
+static void runtime_string_index_rebuild(void) {
+    uint32_t offset = 0U;
+
+    runtime_string_index_clear();
+    while (offset < runtime_string_pool_offset) {
+        runtime_string_index_insert(offset);
+        offset += text_length(runtime_string_pool + offset) + 1U;
+    }
+}
+
+static void runtime_string_compact_live_references(void) {
+    uint8_t live_starts[(RUNTIME_STRING_POOL_LIMIT + 7U) / 8U];
+    uint32_t write_offset = 0U;
+    uint32_t read_offset;
+    uint32_t live_starts_index;
+    uint32_t stack_index;
+    uint16_t handle;
+    uint16_t literal_index;
+    uint16_t block_index;
+    uint16_t env_index;
     uint16_t home_index;
 
     for (live_starts_index = 0U; live_starts_index < sizeof(live_starts); ++live_starts_index) {
@@ -16175,13 +18544,33 @@ static void runtime_string_compact_live_references(void) {
             );
         }
     }
+    for (literal_index = 0U; literal_index < live_method_program_literals_used; ++literal_index) {
+        if (live_method_program_literals[literal_index].kind == RECORZ_MVP_LITERAL_STRING &&
+            live_method_program_literals[literal_index].string != 0) {
+            runtime_string_mark_live_value(
+                string_value(live_method_program_literals[literal_index].string),
+                live_starts,
+                sizeof(live_starts)
+            );
+        }
+    }
+    for (literal_index = 0U; literal_index < compiled_block_literals_used; ++literal_index) {
+        if (compiled_block_literals[literal_index].kind == RECORZ_MVP_LITERAL_STRING &&
+            compiled_block_literals[literal_index].string != 0) {
+            runtime_string_mark_live_value(
+                string_value(compiled_block_literals[literal_index].string),
+                live_starts,
+                sizeof(live_starts)
+            );
+        }
+    }
     for (env_index = 0U; env_index < SOURCE_EVAL_ENV_LIMIT; ++env_index) {
         if (source_eval_environments[env_index].in_use) {
             uint16_t binding_index;
 
             for (binding_index = 0U; binding_index < source_eval_environments[env_index].binding_count; ++binding_index) {
                 runtime_string_mark_live_value(
-                    source_eval_environments[env_index].bindings[binding_index].value,
+                    source_eval_environments[env_index].values[binding_index],
                     live_starts,
                     sizeof(live_starts)
                 );
@@ -16197,6 +18586,21 @@ static void runtime_string_compact_live_references(void) {
             );
         }
     }
+    for (home_index = 0U; home_index < activation_frame_count; ++home_index) {
+        runtime_string_mark_live_value(activation_frames[home_index].receiver, live_starts, sizeof(live_starts));
+        runtime_string_mark_live_value(activation_frames[home_index].detail, live_starts, sizeof(live_starts));
+    }
+    /* Compiled blocks do not keep their source alive; once no closure or literal holds it, drop the block. */
+    for (block_index = 0U; block_index < compiled_block_count; ++block_index) {
+        uint32_t source_offset;
+
+        if (compiled_blocks[block_index].state != RECORZ_MVP_COMPILED_BLOCK_FREE &&
+            runtime_string_pool_contains(compiled_blocks[block_index].source, &source_offset) &&
+            !runtime_string_live_start_is_marked(live_starts, source_offset)) {
+            compiled_blocks[block_index].state = RECORZ_MVP_COMPILED_BLOCK_FREE;
+            compiled_blocks[block_index].source = 0;
+        }
+    }
 
     read_offset = 0U;
     while (read_offset < runtime_string_pool_offset) {
@@ -16222,6 +18626,8 @@ static void runtime_string_compact_live_references(void) {
     if (runtime_string_pool_offset < RUNTIME_STRING_POOL_LIMIT) {
         runtime_string_pool[runtime_string_pool_offset] = '\0';
     }
+    runtime_string_index_rebuild();
+    compiled_block_index_rebuild();
 }
 
 static const char *runtime_string_allocate_copy(const char *text) {
@@ -16248,17 +18654,14 @@ static const char *runtime_string_allocate_copy(const char *text) {
     }
     runtime_string_pool[start + length] = '\0';
     runtime_string_pool_offset += length + 1U;
+    runtime_string_index_insert(start);
     return runtime_string_pool + start;
 }
 
-static const char *runtime_string_intern_copy(const char *text) {
-    uint32_t length;
+static const char *runtime_string_find_by_scan(const char *text) {
+    uint32_t length = text_length(text);
     uint32_t offset = 0U;
 
-    if (text == 0) {
-        machine_panic("runtime string source is null");
-    }
-    length = text_length(text);
     while (offset < runtime_string_pool_offset) {
         const char *candidate = runtime_string_pool + offset;
         uint32_t candidate_length = text_length(candidate);
@@ -16279,6 +18682,37 @@ static const char *runtime_string_intern_copy(const char *text) {
         }
         offset += candidate_length + 1U;
     }
+    return 0;
+}
+
+static const char *runtime_string_find(const char *text) {
+    uint32_t slot;
+
+    if (runtime_string_index_overflowed) {
+        return runtime_string_find_by_scan(text);
+    }
+    slot = text_hash(text) & (RUNTIME_STRING_INDEX_SIZE - 1U);
+    while (runtime_string_index[slot] != 0U) {
+        const char *candidate = runtime_string_pool + runtime_string_index[slot] - 1U;
+
+        if (source_names_equal(candidate, text)) {
+            return candidate;
+        }
+        slot = (slot + 1U) & (RUNTIME_STRING_INDEX_SIZE - 1U);
+    }
+    return 0;
+}
+
+static const char *runtime_string_intern_copy(const char *text) {
+    const char *existing;
+
+    if (text == 0) {
+        machine_panic("runtime string source is null");
+    }
+    existing = runtime_string_find(text);
+    if (existing != 0) {
+        return existing;
+    }
     return runtime_string_allocate_copy(text);
 }
 
@@ -16321,6 +18755,9 @@ static void repack_live_method_source_pool(void) {
         uint32_t char_index;
 
         if (source_length == 0U) {
+            if (source_offset != 0U) {
+                snapshot_note_live_method_source_write(source_index, write_offset);
+            }
             source_record->source_offset = 0U;
             continue;
         }
@@ -16330,6 +18767,9 @@ static void repack_live_method_source_pool(void) {
         if (write_offset + source_length + 1U > LIVE_METHOD_SOURCE_POOL_LIMIT) {
             machine_panic("live method source pool overflow");
         }
+        if (source_offset != write_offset) {
+            snapshot_note_live_method_source_write(source_index, write_offset);
+        }
         for (char_index = 0U; char_index <= source_length; ++char_index) {
             live_method_source_pool[write_offset + char_index] =
                 live_method_source_pool[source_offset + char_index];
@@ -16473,6 +18913,7 @@ static void forget_live_method_source(
             source_record->argument_count != argument_count) {
             continue;
         }
+        snapshot_note_live_method_source_write(source_index, source_record->source_offset);
         for (move_index = source_index + 1U; move_index < live_method_source_count; ++move_index) {
             live_method_sources[move_index - 1U].class_handle = live_method_sources[move_index].class_handle;
             live_method_sources[move_index - 1U].selector_id = live_method_sources[move_index].selector_id;
@@ -16484,9 +18925,27 @@ static void forget_live_method_source(
             );
             live_method_sources[move_index - 1U].source_offset = live_method_sources[move_index].source_offset;
             live_method_sources[move_index - 1U].source_length = live_method_sources[move_index].source_length;
+            live_method_sources[move_index - 1U].execution_kind =
+                live_method_sources[move_index].execution_kind;
+            live_method_sources[move_index - 1U].program_has_block_literal =
+                live_method_sources[move_index].program_has_block_literal;
+            live_method_sources[move_index - 1U].program_lexical_count =
+                live_method_sources[move_index].program_lexical_count;
+            live_method_sources[move_index - 1U].program_instruction_offset =
+                live_method_sources[move_index].program_instruction_offset;
+            live_method_sources[move_index - 1U].program_instruction_count =
+                live_method_sources[move_index].program_instruction_count;
+            live_method_sources[move_index - 1U].program_literal_offset =
+                live_method_sources[move_index].program_literal_offset;
+            live_method_sources[move_index - 1U].program_literal_count =
+                live_method_sources[move_index].program_literal_count;
+            live_method_sources[move_index - 1U].program_lexical_name_offset =
+                live_method_sources[move_index].program_lexical_name_offset;
         }
         --live_method_source_count;
         repack_live_method_source_pool();
+        method_cache_flush_live_sources_from(source_index);
+        method_cache_flush_selector(selector_id);
         return;
     }
 }
@@ -16524,6 +18983,7 @@ static void remember_live_method_source(
     if (live_method_source_pool_used + length + 1U > LIVE_METHOD_SOURCE_POOL_LIMIT) {
         machine_panic("live method source pool overflow");
     }
+    snapshot_note_live_method_source_write(live_method_source_count, live_method_source_pool_used);
     source_record = &live_method_sources[live_method_source_count++];
     source_record->class_handle = class_handle;
     source_record->selector_id = selector_id;
@@ -16537,6 +18997,8 @@ static void remember_live_method_source(
         live_method_source_pool[start++] = *source++;
     }
     live_method_source_pool[start] = '\0';
+    compile_live_method_program(source_record);
+    method_cache_flush_selector(selector_id);
 }
 
 static void remember_live_package_do_it_source(const char *package_name, const char *source) {
@@ -16655,10 +19117,10 @@ static uint32_t current_live_string_literal_byte_count(void) {
 }
 
 static uint32_t snapshot_string_storage_size(struct recorz_mvp_value value) {
-    if (value.kind != RECORZ_MVP_VALUE_STRING || value.string == 0) {
+    if (!value_is_string(value) || value_string(value) == 0) {
         return 0U;
     }
-    return text_length(value.string) + 1U;
+    return text_length(value_string(value)) + 1U;
 }
 
 static uint16_t current_scheduled_process_source_count(void) {
@@ -16718,13 +19180,13 @@ static uint32_t current_snapshot_string_byte_count(void) {
             continue;
         }
         string_byte_count += snapshot_string_storage_size(record->receiver);
-        for (value_index = 0U; value_index < MAX_SEND_ARGS; ++value_index) {
+        for (value_index = 0U; value_index < record->argument_count; ++value_index) {
             string_byte_count += snapshot_string_storage_size(record->arguments[value_index]);
         }
-        for (value_index = 0U; value_index < STACK_LIMIT; ++value_index) {
+        for (value_index = 0U; value_index < record->stack_size; ++value_index) {
             string_byte_count += snapshot_string_storage_size(record->stack[value_index]);
         }
-        for (value_index = 0U; value_index < LEXICAL_LIMIT; ++value_index) {
+        for (value_index = 0U; value_index < record->lexical_count; ++value_index) {
             string_byte_count += snapshot_string_storage_size(record->lexical[value_index]);
         }
     }
@@ -16735,32 +19197,110 @@ static uint32_t current_snapshot_live_method_source_byte_count(void) {
     return live_method_source_pool_used;
 }
 
-static uint32_t snapshot_total_size(
-    uint32_t string_byte_count,
-    uint32_t live_method_source_byte_count,
-    uint32_t live_string_literal_byte_count,
-    uint16_t live_string_literal_count,
-    uint16_t scheduled_process_source_count,
-    uint16_t scheduled_activation_count,
-    uint16_t scheduled_process_count
-) {
-    return SNAPSHOT_HEADER_SIZE +
-           (heap_size * SNAPSHOT_OBJECT_SIZE) +
-           (MAX_GLOBAL_ID * 2U) +
-           (RECORZ_MVP_SEED_ROOT_TRANSCRIPT_FONT * 2U) +
-           (128U * 2U) +
-           ((uint32_t)dynamic_class_count * SNAPSHOT_DYNAMIC_CLASS_RECORD_SIZE) +
-           ((uint32_t)package_count * SNAPSHOT_PACKAGE_RECORD_SIZE) +
-           ((uint32_t)named_object_count * SNAPSHOT_NAMED_OBJECT_RECORD_SIZE) +
-           ((uint32_t)live_method_source_count * SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SIZE) +
-           live_method_source_byte_count +
-           ((uint32_t)live_string_literal_count * SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE) +
-           live_string_literal_byte_count +
-           ((uint32_t)scheduled_process_source_count * SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_SIZE) +
-           ((uint32_t)scheduled_activation_count * SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_SIZE) +
-           ((uint32_t)scheduled_process_count * SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE) +
-           ((uint32_t)mono_bitmap_count * MONO_BITMAP_MAX_HEIGHT * 4U) +
-           string_byte_count;
+static uint32_t snapshot_text_size(const char *text, uint32_t limit) {
+    uint32_t length = 0U;
+
+    while (length + 1U < limit && text[length] != '\0') {
+        ++length;
+    }
+    return length + 1U;
+}
+
+static uint32_t snapshot_dynamic_class_record_size(const struct recorz_mvp_dynamic_class_definition *definition) {
+    uint32_t size = SNAPSHOT_DYNAMIC_CLASS_RECORD_PREFIX_SIZE +
+                    snapshot_text_size(definition->class_name, METHOD_SOURCE_NAME_LIMIT) +
+                    snapshot_text_size(definition->package_name, METHOD_SOURCE_NAME_LIMIT) +
+                    snapshot_text_size(definition->class_comment, CLASS_COMMENT_LIMIT);
+    uint8_t ivar_index;
+
+    for (ivar_index = 0U; ivar_index < definition->instance_variable_count; ++ivar_index) {
+        size += snapshot_text_size(definition->instance_variable_names[ivar_index], METHOD_SOURCE_NAME_LIMIT);
+    }
+    return size;
+}
+
+static uint32_t snapshot_scheduled_activation_record_size(const struct recorz_mvp_scheduled_activation_record *record) {
+    return SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_PREFIX_SIZE +
+           ((1U + record->argument_count + record->stack_size + record->lexical_count) * SNAPSHOT_VALUE_SIZE);
+}
+
+/* Raw size of a section as snapshot_write_section lays it out from element `first`; every section
+   except the string section, whose size is only known once the values have been encoded. */
+static uint32_t snapshot_section_size(uint8_t section, uint32_t first) {
+    uint32_t size = 0U;
+    uint32_t index;
+
+    switch (section) {
+        case SNAPSHOT_SECTION_OBJECTS:
+            return (heap_size - first) * SNAPSHOT_OBJECT_SIZE;
+        case SNAPSHOT_SECTION_ROOTS:
+            return SNAPSHOT_ROOTS_SECTION_SIZE;
+        case SNAPSHOT_SECTION_DYNAMIC_CLASSES:
+            for (index = 0U; index < dynamic_class_count; ++index) {
+                size += snapshot_dynamic_class_record_size(&dynamic_classes[index]);
+            }
+            break;
+        case SNAPSHOT_SECTION_PACKAGES:
+            for (index = 0U; index < package_count; ++index) {
+                size += snapshot_text_size(live_packages[index].package_name, METHOD_SOURCE_NAME_LIMIT) +
+                        snapshot_text_size(live_packages[index].package_comment, PACKAGE_COMMENT_LIMIT);
+            }
+            break;
+        case SNAPSHOT_SECTION_NAMED_OBJECTS:
+            for (index = 0U; index < named_object_count; ++index) {
+                size += SNAPSHOT_NAMED_OBJECT_RECORD_PREFIX_SIZE +
+                        snapshot_text_size(named_objects[index].name, METHOD_SOURCE_NAME_LIMIT);
+            }
+            break;
+        case SNAPSHOT_SECTION_LIVE_METHOD_SOURCES:
+            for (index = first; index < live_method_source_count; ++index) {
+                size += SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_PREFIX_SIZE +
+                        snapshot_text_size(live_method_sources[index].protocol_name, METHOD_SOURCE_NAME_LIMIT) +
+                        SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SUFFIX_SIZE;
+            }
+            break;
+        case SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL:
+            return live_method_source_pool_used - first;
+        case SNAPSHOT_SECTION_LIVE_STRING_LITERALS:
+            return ((uint32_t)current_live_string_literal_count() * SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE) +
+                   current_live_string_literal_byte_count();
+        case SNAPSHOT_SECTION_MONO_BITMAPS:
+            return (uint32_t)mono_bitmap_count * MONO_BITMAP_MAX_HEIGHT * 4U;
+        case SNAPSHOT_SECTION_COMPILED_METHOD_BODIES:
+            return (compiled_method_body_words_used - first) * 4U;
+        case SNAPSHOT_SECTION_METHOD_DICTIONARIES:
+            return (uint32_t)method_dictionary_slots_used * 2U;
+        case SNAPSHOT_SECTION_SCHEDULED_PROCESS_SOURCES:
+            for (index = 0U; index < SCHEDULED_PROCESS_SOURCE_LIMIT; ++index) {
+                if (scheduled_process_sources[index].in_use) {
+                    size += SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_PREFIX_SIZE +
+                            snapshot_text_size(scheduled_process_sources[index].source, SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT);
+                }
+            }
+            break;
+        case SNAPSHOT_SECTION_SCHEDULED_ACTIVATIONS:
+            for (index = 0U; index < SCHEDULED_ACTIVATION_LIMIT; ++index) {
+                if (scheduled_activation_records[index].in_use) {
+                    size += snapshot_scheduled_activation_record_size(&scheduled_activation_records[index]);
+                }
+            }
+            break;
+        case SNAPSHOT_SECTION_SCHEDULED_PROCESSES:
+            return (uint32_t)current_scheduled_process_count() * SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE;
+    }
+    return size;
+}
+
+static uint32_t snapshot_measure_sections(uint32_t lengths[SNAPSHOT_SECTION_COUNT], uint32_t string_byte_count) {
+    uint32_t total_size = SNAPSHOT_PAYLOAD_OFFSET;
+    uint8_t section;
+
+    for (section = 0U; section < SNAPSHOT_SECTION_STRINGS; ++section) {
+        lengths[section] = snapshot_section_size(section, 0U);
+        total_size += lengths[section];
+    }
+    lengths[SNAPSHOT_SECTION_STRINGS] = string_byte_count;
+    return total_size + string_byte_count;
 }
 
 static const char *kernel_memory_report_text(void) {
@@ -16768,20 +19308,9 @@ static const char *kernel_memory_report_text(void) {
     uint32_t offset = 0U;
     uint32_t snapshot_string_bytes = current_snapshot_string_byte_count();
     uint32_t live_method_source_bytes = current_snapshot_live_method_source_byte_count();
-    uint32_t live_string_literal_bytes = current_live_string_literal_byte_count();
     uint16_t live_string_literal_count = current_live_string_literal_count();
-    uint16_t scheduled_process_source_count = current_scheduled_process_source_count();
-    uint16_t scheduled_activation_count = current_scheduled_activation_count();
-    uint16_t scheduled_process_count = current_scheduled_process_count();
-    uint32_t snapshot_size = snapshot_total_size(
-        snapshot_string_bytes,
-        live_method_source_bytes,
-        live_string_literal_bytes,
-        live_string_literal_count,
-        scheduled_process_source_count,
-        scheduled_activation_count,
-        scheduled_process_count
-    );
+    uint32_t snapshot_lengths[SNAPSHOT_SECTION_COUNT];
+    uint32_t snapshot_size = snapshot_measure_sections(snapshot_lengths, snapshot_string_bytes);
 
     buffer[0] = '\0';
     append_memory_report_text(buffer, &offset, "MEMORY\n");
@@ -16818,9 +19347,35 @@ static const char *kernel_memory_report_text(void) {
     );
     append_memory_report_line(buffer, &offset, "SNAP", snapshot_size, SNAPSHOT_BUFFER_LIMIT);
     append_memory_report_line(buffer, &offset, "MONO", mono_bitmap_count, MONO_BITMAP_LIMIT);
+    append_memory_report_line(
+        buffer,
+        &offset,
+        "CMBW",
+        compiled_method_body_words_used,
+        COMPILED_METHOD_BODY_WORD_LIMIT
+    );
+    append_memory_report_line(
+        buffer,
+        &offset,
+        "MDIC",
+        method_dictionary_slots_used,
+        METHOD_DICTIONARY_SLOT_LIMIT
+    );
+    append_memory_report_line(buffer, &offset, "RSIX", runtime_string_index_count, RUNTIME_STRING_INDEX_SIZE);
+    append_memory_report_line(buffer, &offset, "SITE", send_sites_used, SEND_SITE_LIMIT);
+    append_memory_report_line(buffer, &offset, "DSEL", dynamic_selector_count, DYNAMIC_SELECTOR_LIMIT);
+    append_memory_report_line(buffer, &offset, "NURS", gc_nursery_count, GC_NURSERY_LIMIT);
     append_memory_report_stat(buffer, &offset, "GCC", gc_collection_count);
+    append_memory_report_stat(buffer, &offset, "GCM", gc_minor_collection_count);
     append_memory_report_stat(buffer, &offset, "GCR", gc_last_reclaimed_count);
     append_memory_report_stat(buffer, &offset, "GCT", gc_total_reclaimed_count);
+    append_memory_report_stat(buffer, &offset, "GCP", gc_last_pause_work);
+    append_memory_report_stat(buffer, &offset, "GCX", gc_max_pause_work);
+    append_memory_report_stat(buffer, &offset, "GCI", gc_incremental_step_count);
+    append_memory_report_stat(buffer, &offset, "MCH", method_cache_hit_count);
+    append_memory_report_stat(buffer, &offset, "MCM", method_cache_miss_count);
+    append_memory_report_stat(buffer, &offset, "ICH", send_site_hit_count);
+    append_memory_report_stat(buffer, &offset, "ICM", send_site_miss_count);
     return runtime_string_allocate_copy(buffer);
 }
 
@@ -16872,76 +19427,64 @@ static const char *workspace_runtime_metadata_text(void) {
     return runtime_string_allocate_copy(buffer);
 }
 
+/* A snapshot value is the in-memory tagged word narrowed to 32 bits, so object records match the
+   RV32 heap layout byte for byte. Only string words differ: they carry the string's offset in the
+   string section plus one, keeping the null string distinct. */
 static void snapshot_encode_value(
     uint8_t *slot,
     struct recorz_mvp_value value,
-    uint8_t *string_section,
-    uint32_t string_section_size,
-    uint32_t *string_offset
+    struct recorz_mvp_snapshot_string_writer *strings
 ) {
+    const char *text;
+    uint32_t length;
+    uint32_t offset;
     uint32_t index;
 
-    slot[0] = value.kind;
-    slot[1] = 0U;
-    write_u16_le(slot + 2U, 0U);
-    write_u32_le(slot + 4U, (uint32_t)value.integer);
-    if (value.kind != RECORZ_MVP_VALUE_STRING) {
+    if (!value_is_string(value)) {
+        write_u32_le(slot, (uint32_t)value.bits);
         return;
     }
-    if (value.string == 0) {
+    text = value_string(value);
+    if (text == 0) {
         machine_panic("snapshot cannot encode a null string");
     }
-    {
-        uint32_t length = text_length(value.string);
+    length = text_length(text);
+    if (strings->used + length + 1U > strings->limit) {
+        machine_panic("snapshot string section overflow");
+    }
+    offset = strings->base + strings->used;
+    for (index = 0U; index < length; ++index) {
+        strings->bytes[strings->used + index] = (uint8_t)text[index];
+    }
+    strings->bytes[strings->used + length] = 0U;
+    strings->used += length + 1U;
+    write_u32_le(slot, ((offset + 1U) << 2U) | VALUE_TAG_STRING);
+}
 
-        if (length > 65535U) {
-            machine_panic("snapshot string exceeds maximum encodable length");
-        }
-        if (*string_offset + length + 1U > string_section_size) {
-            machine_panic("snapshot string section overflow");
-        }
-        write_u16_le(slot + 2U, (uint16_t)length);
-        write_u32_le(slot + 4U, *string_offset);
-        for (index = 0U; index < length; ++index) {
-            string_section[*string_offset + index] = (uint8_t)value.string[index];
+/* The string section must already be in snapshot_string_pool and heap_size set to the object count. */
+static struct recorz_mvp_value snapshot_relocate_value(uint32_t word, uint32_t string_byte_count) {
+    if ((word & 1U) != 0U) {
+        return (struct recorz_mvp_value){(uintptr_t)(intptr_t)(int32_t)word};
+    }
+    if ((word & VALUE_TAG_MASK) == VALUE_TAG_STRING) {
+        uint32_t offset = (word >> 2U) - 1U;
+
+        if (offset >= string_byte_count) {
+            machine_panic("snapshot string value is out of range");
         }
-        string_section[*string_offset + length] = 0U;
-        *string_offset += length + 1U;
+        return string_value(snapshot_string_pool + offset);
+    }
+    if ((word >> 2U) > heap_size) {
+        machine_panic("snapshot object reference is out of range");
     }
+    return (struct recorz_mvp_value){(uintptr_t)word};
 }
 
 static struct recorz_mvp_value snapshot_decode_value(
     const uint8_t *slot,
     uint32_t string_byte_count
 ) {
-    uint8_t kind = slot[0];
-    uint16_t aux = read_u16_le(slot + 2U);
-    int32_t value = (int32_t)read_u32_le(slot + 4U);
-
-    switch (kind) {
-        case RECORZ_MVP_VALUE_NIL:
-            return nil_value();
-        case RECORZ_MVP_VALUE_OBJECT:
-            if (value <= 0 || (uint32_t)value > heap_size) {
-                machine_panic("snapshot object reference is out of range");
-            }
-            return object_value((uint16_t)value);
-        case RECORZ_MVP_VALUE_SMALL_INTEGER:
-            return small_integer_value(value);
-        case RECORZ_MVP_VALUE_STRING: {
-            uint32_t offset = (uint32_t)value;
-
-            if (offset + aux >= string_byte_count) {
-                machine_panic("snapshot string value is out of range");
-            }
-            if (snapshot_string_pool[offset + aux] != '\0') {
-                machine_panic("snapshot string value is not terminated");
-            }
-            return string_value(snapshot_string_pool + offset);
-        }
-    }
-    machine_panic("snapshot value kind is unknown");
-    return nil_value();
+    return snapshot_relocate_value(read_u32_le(slot), string_byte_count);
 }
 
 static void emit_snapshot_hex_byte(uint8_t value) {
@@ -16951,987 +19494,1904 @@ static void emit_snapshot_hex_byte(uint8_t value) {
     machine_putc(digits[value & 0x0FU]);
 }
 
-static void emit_live_snapshot(void) {
-    uint32_t string_byte_count;
-    uint32_t live_method_source_byte_count;
-    uint32_t live_string_literal_byte_count;
-    uint16_t live_string_literal_count;
-    uint16_t scheduled_process_source_count;
-    uint16_t scheduled_activation_count;
-    uint16_t scheduled_process_count;
-    uint16_t handle;
-    uint16_t dynamic_index;
-    uint16_t package_index;
-    uint16_t named_index;
-    uint16_t live_method_index;
-    uint16_t literal_index;
-    uint16_t source_index;
-    uint16_t activation_index;
-    uint16_t process_index;
-    uint16_t value_index;
-    uint32_t row;
-    uint32_t total_size;
-    uint32_t offset;
-    uint32_t string_offset = 0U;
-    uint8_t *string_section;
+static uint32_t snapshot_sector_count(uint32_t size) {
+    return (size + MACHINE_BLOCK_SECTOR_SIZE - 1U) / MACHINE_BLOCK_SECTOR_SIZE;
+}
 
-    (void)gc_collect_now();
-    string_byte_count = current_snapshot_string_byte_count();
-    live_method_source_byte_count = current_snapshot_live_method_source_byte_count();
-    live_string_literal_byte_count = current_live_string_literal_byte_count();
-    live_string_literal_count = current_live_string_literal_count();
-    scheduled_process_source_count = current_scheduled_process_source_count();
-    scheduled_activation_count = current_scheduled_activation_count();
-    scheduled_process_count = current_scheduled_process_count();
-    if (scheduled_active_process_index >= 0) {
-        machine_panic("snapshot cannot capture an active scheduled process");
+static uint32_t snapshot_checksum(const uint8_t *bytes, uint32_t size) {
+    uint32_t hash = 2166136261U;
+    uint32_t index;
+
+    for (index = 0U; index < size; ++index) {
+        hash = (hash ^ bytes[index]) * 16777619U;
     }
-    total_size = snapshot_total_size(
-        string_byte_count,
-        live_method_source_byte_count,
-        live_string_literal_byte_count,
-        live_string_literal_count,
-        scheduled_process_source_count,
-        scheduled_activation_count,
-        scheduled_process_count
-    );
-    if (total_size > SNAPSHOT_BUFFER_LIMIT) {
-        machine_panic("snapshot exceeds buffer capacity");
+    return hash;
+}
+
+static uint8_t snapshot_section_is_fingerprinted(uint8_t section) {
+    return (uint8_t)(section != SNAPSHOT_SECTION_OBJECTS &&
+                     section != SNAPSHOT_SECTION_LIVE_METHOD_SOURCES &&
+                     section != SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL &&
+                     section != SNAPSHOT_SECTION_COMPILED_METHOD_BODIES &&
+                     section != SNAPSHOT_SECTION_STRINGS);
+}
+
+static uint32_t snapshot_section_raw_size(const uint8_t *image, uint8_t section) {
+    return read_u32_le(image + SNAPSHOT_DIRECTORY_OFFSET + ((uint32_t)section * SNAPSHOT_DIRECTORY_ENTRY_SIZE));
+}
+
+static uint32_t snapshot_section_stored_size(const uint8_t *image, uint8_t section) {
+    return read_u32_le(image + SNAPSHOT_DIRECTORY_OFFSET + ((uint32_t)section * SNAPSHOT_DIRECTORY_ENTRY_SIZE) + 4U);
+}
+
+static void snapshot_write_directory_entry(uint8_t *image, uint8_t section, uint32_t raw_size, uint32_t stored_size) {
+    uint8_t *entry = image + SNAPSHOT_DIRECTORY_OFFSET + ((uint32_t)section * SNAPSHOT_DIRECTORY_ENTRY_SIZE);
+
+    write_u32_le(entry, raw_size);
+    write_u32_le(entry + 4U, stored_size);
+}
+
+static void snapshot_section_lengths(const uint8_t *image, uint32_t lengths[SNAPSHOT_SECTION_COUNT]) {
+    uint8_t section;
+
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        lengths[section] = snapshot_section_raw_size(image, section);
     }
-    offset = 0U;
-    snapshot_buffer[offset++] = SNAPSHOT_MAGIC_0;
-    snapshot_buffer[offset++] = SNAPSHOT_MAGIC_1;
-    snapshot_buffer[offset++] = SNAPSHOT_MAGIC_2;
-    snapshot_buffer[offset++] = SNAPSHOT_MAGIC_3;
-    write_u16_le(snapshot_buffer + offset, SNAPSHOT_VERSION);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, heap_size);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, dynamic_class_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, package_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, named_object_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, mono_bitmap_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, next_dynamic_method_entry_execution_id);
-    offset += 2U;
-    write_u32_le(snapshot_buffer + offset, string_byte_count);
-    offset += 4U;
-    write_u16_le(snapshot_buffer + offset, (uint16_t)cursor_x);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, (uint16_t)cursor_y);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, startup_hook_receiver_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, startup_hook_selector_id);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, live_method_source_count);
-    offset += 2U;
-    write_u32_le(snapshot_buffer + offset, live_method_source_byte_count);
-    offset += 4U;
-    write_u16_le(snapshot_buffer + offset, live_string_literal_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, (uint16_t)live_string_literal_byte_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, active_display_form_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, active_cursor_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, active_cursor_visible != 0U ? 1U : 0U);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, (uint16_t)active_cursor_screen_x);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, (uint16_t)active_cursor_screen_y);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, scheduled_process_source_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, scheduled_activation_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, scheduled_process_count);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, scheduled_runnable_head);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, 0U);
-    offset += 2U;
-    write_u32_le(snapshot_buffer + offset, total_size);
-    offset += 4U;
-    string_section = snapshot_buffer + (total_size - string_byte_count);
+}
 
-    for (handle = 1U; handle <= heap_size; ++handle) {
-        const struct recorz_mvp_heap_object *object = (const struct recorz_mvp_heap_object *)heap_object(handle);
-        uint8_t field_index;
+/* The directory must account for every stored byte, and the expanded image must fit the load buffer
+   so any one section can be inflated into it. */
+static void snapshot_validate_directory(const uint8_t *image, uint32_t size) {
+    uint32_t stored_total = SNAPSHOT_PAYLOAD_OFFSET;
+    uint32_t raw_total = SNAPSHOT_PAYLOAD_OFFSET;
+    uint8_t section;
 
-        snapshot_buffer[offset++] = object->kind;
-        snapshot_buffer[offset++] = object->field_count;
-        write_u16_le(snapshot_buffer + offset, object->class_handle);
-        offset += 2U;
-        for (field_index = 0U; field_index < OBJECT_FIELD_LIMIT; ++field_index) {
-            snapshot_encode_value(
-                snapshot_buffer + offset,
-                object->fields[field_index],
-                string_section,
-                string_byte_count,
-                &string_offset
-            );
-            offset += SNAPSHOT_VALUE_SIZE;
+    if (size < SNAPSHOT_PAYLOAD_OFFSET) {
+        machine_panic("snapshot is too small");
+    }
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        uint32_t raw_size = snapshot_section_raw_size(image, section);
+        uint32_t stored_size = snapshot_section_stored_size(image, section);
+
+        if (stored_size > raw_size || raw_size > SNAPSHOT_BUFFER_LIMIT) {
+            machine_panic("snapshot section directory is invalid");
         }
+        stored_total += stored_size;
+        raw_total += raw_size;
     }
-    for (handle = RECORZ_MVP_GLOBAL_TRANSCRIPT; handle <= MAX_GLOBAL_ID; ++handle) {
-        write_u16_le(snapshot_buffer + offset, global_handles[handle]);
-        offset += 2U;
+    if (stored_total != size || raw_total > SNAPSHOT_BUFFER_LIMIT) {
+        machine_panic("snapshot section directory is invalid");
     }
-    write_u16_le(snapshot_buffer + offset, default_form_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, framebuffer_bitmap_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, transcript_behavior_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, transcript_layout_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, transcript_style_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, transcript_metrics_handle);
-    offset += 2U;
-    write_u16_le(snapshot_buffer + offset, transcript_font_handle);
-    offset += 2U;
-    for (handle = 0U; handle < 128U; ++handle) {
-        write_u16_le(snapshot_buffer + offset, glyph_bitmap_handles[handle]);
-        offset += 2U;
+}
+
+static uint32_t snapshot_lz_length_byte_count(uint32_t length) {
+    return length < 15U ? 0U : ((length - 15U) / 255U) + 1U;
+}
+
+static uint32_t snapshot_lz_put_length(uint8_t *out, uint32_t offset, uint32_t length) {
+    if (length < 15U) {
+        return offset;
     }
-    for (dynamic_index = 0U; dynamic_index < dynamic_class_count; ++dynamic_index) {
-        const struct recorz_mvp_dynamic_class_definition *definition = &dynamic_classes[dynamic_index];
-        uint8_t ivar_index;
-        uint32_t name_index;
-
-        write_u16_le(snapshot_buffer + offset, definition->class_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, definition->superclass_handle);
-        offset += 2U;
-        snapshot_buffer[offset++] = definition->instance_variable_count;
-        snapshot_buffer[offset++] = 0U;
-        snapshot_buffer[offset++] = 0U;
-        snapshot_buffer[offset++] = 0U;
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            snapshot_buffer[offset++] = (uint8_t)definition->class_name[name_index];
-        }
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            snapshot_buffer[offset++] = (uint8_t)definition->package_name[name_index];
-        }
-        for (name_index = 0U; name_index < CLASS_COMMENT_LIMIT; ++name_index) {
-            snapshot_buffer[offset++] = (uint8_t)definition->class_comment[name_index];
-        }
-        for (ivar_index = 0U; ivar_index < DYNAMIC_CLASS_IVAR_LIMIT; ++ivar_index) {
-            for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-                snapshot_buffer[offset++] =
-                    (uint8_t)definition->instance_variable_names[ivar_index][name_index];
-            }
-        }
+    length -= 15U;
+    while (length >= 255U) {
+        out[offset++] = 255U;
+        length -= 255U;
     }
-    for (package_index = 0U; package_index < package_count; ++package_index) {
-        uint32_t name_index;
+    out[offset++] = (uint8_t)length;
+    return offset;
+}
 
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            snapshot_buffer[offset++] = (uint8_t)live_packages[package_index].package_name[name_index];
-        }
-        for (name_index = 0U; name_index < PACKAGE_COMMENT_LIMIT; ++name_index) {
-            snapshot_buffer[offset++] = (uint8_t)live_packages[package_index].package_comment[name_index];
-        }
-    }
-    for (named_index = 0U; named_index < named_object_count; ++named_index) {
-        uint32_t name_index;
+/* Appends one sequence and returns the new output size, or 0 when the output would no longer be
+   smaller than `limit`. A zero match length writes the closing literal-only sequence. */
+static uint32_t snapshot_lz_put_sequence(
+    uint8_t *out,
+    uint32_t offset,
+    uint32_t limit,
+    const uint8_t *literals,
+    uint32_t literal_count,
+    uint32_t match_offset,
+    uint32_t match_length
+) {
+    uint32_t match_code = match_length == 0U ? 0U : match_length - SNAPSHOT_LZ_MIN_MATCH;
+    uint32_t needed = 1U + snapshot_lz_length_byte_count(literal_count) + literal_count;
+    uint32_t index;
 
-        write_u16_le(snapshot_buffer + offset, named_objects[named_index].object_handle);
-        offset += 2U;
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            snapshot_buffer[offset++] = (uint8_t)named_objects[named_index].name[name_index];
-        }
+    if (match_length != 0U) {
+        needed += 2U + snapshot_lz_length_byte_count(match_code);
     }
-    for (live_method_index = 0U; live_method_index < live_method_source_count; ++live_method_index) {
-        const struct recorz_mvp_live_method_source *source_record = &live_method_sources[live_method_index];
-        uint32_t name_index;
-
-        write_u16_le(snapshot_buffer + offset, source_record->class_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, source_record->selector_id);
-        offset += 2U;
-        snapshot_buffer[offset++] = source_record->argument_count;
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            snapshot_buffer[offset++] = (uint8_t)source_record->protocol_name[name_index];
-        }
-        write_u32_le(snapshot_buffer + offset, source_record->source_offset);
-        offset += 4U;
-        write_u32_le(snapshot_buffer + offset, source_record->source_length);
-        offset += 4U;
+    if (needed >= limit - offset) {
+        return 0U;
     }
-    for (row = 0U; row < live_method_source_byte_count; ++row) {
-        snapshot_buffer[offset++] = (uint8_t)live_method_source_pool[row];
+    out[offset++] = (uint8_t)(((literal_count < 15U ? literal_count : 15U) << 4U) | (match_code < 15U ? match_code : 15U));
+    offset = snapshot_lz_put_length(out, offset, literal_count);
+    for (index = 0U; index < literal_count; ++index) {
+        out[offset++] = literals[index];
     }
-    for (literal_index = 0U; literal_index < LIVE_STRING_LITERAL_LIMIT; ++literal_index) {
-        const struct recorz_mvp_live_string_literal *literal_record = &live_string_literals[literal_index];
-        uint32_t text_index;
-        uint32_t text_length_value;
-
-        if (literal_record->text == 0) {
-            continue;
-        }
-        write_u16_le(snapshot_buffer + offset, (uint16_t)(literal_index + 1U));
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, literal_record->class_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, literal_record->selector_id);
+    if (match_length != 0U) {
+        write_u16_le(out + offset, (uint16_t)match_offset);
         offset += 2U;
-        snapshot_buffer[offset++] = literal_record->argument_count;
-        text_length_value = text_length(literal_record->text);
-        write_u16_le(snapshot_buffer + offset, (uint16_t)text_length_value);
-        offset += 2U;
-        for (text_index = 0U; text_index <= text_length_value; ++text_index) {
-            snapshot_buffer[offset++] = (uint8_t)literal_record->text[text_index];
-        }
+        offset = snapshot_lz_put_length(out, offset, match_code);
     }
-    for (handle = 0U; handle < mono_bitmap_count; ++handle) {
-        for (row = 0U; row < MONO_BITMAP_MAX_HEIGHT; ++row) {
-            write_u32_le(snapshot_buffer + offset, mono_bitmap_pool[handle][row]);
-            offset += 4U;
-        }
+    return offset;
+}
+
+/* LZ4-style block: each sequence is a token holding 4-bit literal and match lengths (15 means more
+   length bytes follow), the literals, then a 16-bit back offset; the last sequence has literals only.
+   Returns 0 when the block would not be smaller than `limit`. */
+static uint32_t snapshot_lz_compress(const uint8_t *in, uint32_t size, uint8_t *out, uint32_t limit) {
+    uint32_t anchor = 0U;
+    uint32_t position = 0U;
+    uint32_t offset = 0U;
+    uint32_t index;
+
+    for (index = 0U; index < (1U << SNAPSHOT_LZ_HASH_BITS); ++index) {
+        snapshot_lz_table[index] = 0U;
     }
-    for (source_index = 0U; source_index < SCHEDULED_PROCESS_SOURCE_LIMIT; ++source_index) {
-        uint32_t source_length_value;
-        uint32_t source_offset;
+    while (position + SNAPSHOT_LZ_MIN_MATCH <= size) {
+        uint32_t word = read_u32_le(in + position);
+        uint32_t hash = (word * 2654435761U) >> (32U - SNAPSHOT_LZ_HASH_BITS);
+        uint32_t candidate = snapshot_lz_table[hash];
+        uint32_t length;
 
-        if (!scheduled_process_sources[source_index].in_use) {
+        snapshot_lz_table[hash] = position + 1U;
+        if (candidate == 0U || position - (candidate - 1U) > SNAPSHOT_LZ_MAX_OFFSET ||
+            read_u32_le(in + candidate - 1U) != word) {
+            ++position;
             continue;
         }
-        source_length_value = text_length(scheduled_process_sources[source_index].source);
-        if (source_length_value + 1U > SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT) {
-            machine_panic("scheduled process source exceeds snapshot capacity");
+        --candidate;
+        length = SNAPSHOT_LZ_MIN_MATCH;
+        while (position + length < size && in[candidate + length] == in[position + length]) {
+            ++length;
         }
-        write_u16_le(snapshot_buffer + offset, source_index);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, (uint16_t)source_length_value);
-        offset += 2U;
-        for (source_offset = 0U; source_offset < SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT; ++source_offset) {
-            snapshot_buffer[offset++] =
-                (uint8_t)scheduled_process_sources[source_index].source[source_offset];
+        offset = snapshot_lz_put_sequence(out, offset, limit, in + anchor, position - anchor, position - candidate, length);
+        if (offset == 0U) {
+            return 0U;
         }
+        position += length;
+        anchor = position;
     }
-    for (activation_index = 0U; activation_index < SCHEDULED_ACTIVATION_LIMIT; ++activation_index) {
-        const struct recorz_mvp_scheduled_activation_record *record = &scheduled_activation_records[activation_index];
+    return snapshot_lz_put_sequence(out, offset, limit, in + anchor, size - anchor, 0U, 0U);
+}
 
-        if (!record->in_use) {
-            continue;
+static uint8_t snapshot_lz_get_length(const uint8_t *in, uint32_t size, uint32_t *input, uint32_t *length) {
+    uint8_t extra;
+
+    if (*length != 15U) {
+        return 1U;
+    }
+    do {
+        if (*input >= size) {
+            return 0U;
         }
-        if (record->shared_lexical_environment_index >= 0) {
-            machine_panic("snapshot cannot capture a scheduled activation with shared lexical state");
+        extra = in[(*input)++];
+        *length += extra;
+    } while (extra == 255U);
+    return 1U;
+}
+
+static uint8_t snapshot_lz_decompress(const uint8_t *in, uint32_t size, uint8_t *out, uint32_t expected) {
+    uint32_t input = 0U;
+    uint32_t output = 0U;
+
+    while (input < size) {
+        uint8_t token = in[input++];
+        uint32_t length = (uint32_t)token >> 4U;
+        uint32_t match_offset;
+
+        if (!snapshot_lz_get_length(in, size, &input, &length) || length > size - input || length > expected - output) {
+            return 0U;
         }
-        write_u16_le(snapshot_buffer + offset, activation_index);
-        offset += 2U;
-        snapshot_buffer[offset++] = record->kind;
-        snapshot_buffer[offset++] = record->argument_count;
-        snapshot_buffer[offset++] = record->lexical_count;
-        snapshot_buffer[offset++] = 0U;
-        write_u16_le(snapshot_buffer + offset, record->context_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, record->sender_context_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, record->compiled_method_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, record->selector_id);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, record->source_slot);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, (uint16_t)record->shared_lexical_environment_index);
-        offset += 2U;
-        write_u32_le(snapshot_buffer + offset, record->pc);
-        offset += 4U;
-        write_u32_le(snapshot_buffer + offset, record->stack_size);
-        offset += 4U;
-        snapshot_encode_value(
-            snapshot_buffer + offset,
-            record->receiver,
-            string_section,
-            string_byte_count,
-            &string_offset
-        );
-        offset += SNAPSHOT_VALUE_SIZE;
-        for (value_index = 0U; value_index < MAX_SEND_ARGS; ++value_index) {
-            snapshot_encode_value(
-                snapshot_buffer + offset,
-                record->arguments[value_index],
-                string_section,
-                string_byte_count,
-                &string_offset
-            );
-            offset += SNAPSHOT_VALUE_SIZE;
+        while (length-- > 0U) {
+            out[output++] = in[input++];
         }
-        for (value_index = 0U; value_index < STACK_LIMIT; ++value_index) {
-            snapshot_encode_value(
-                snapshot_buffer + offset,
-                record->stack[value_index],
-                string_section,
-                string_byte_count,
-                &string_offset
-            );
-            offset += SNAPSHOT_VALUE_SIZE;
+        if (input == size) {
+            break;
         }
-        for (value_index = 0U; value_index < LEXICAL_LIMIT; ++value_index) {
-            snapshot_encode_value(
-                snapshot_buffer + offset,
-                record->lexical[value_index],
-                string_section,
-                string_byte_count,
-                &string_offset
-            );
-            offset += SNAPSHOT_VALUE_SIZE;
+        if (size - input < 2U) {
+            return 0U;
         }
-    }
-    for (process_index = 0U; process_index < SCHEDULED_PROCESS_LIMIT; ++process_index) {
-        const struct recorz_mvp_scheduled_process_runtime *process_runtime = &scheduled_processes[process_index];
-
-        if (!process_runtime->in_use) {
-            continue;
+        match_offset = read_u16_le(in + input);
+        input += 2U;
+        length = token & 15U;
+        if (!snapshot_lz_get_length(in, size, &input, &length)) {
+            return 0U;
         }
-        write_u16_le(snapshot_buffer + offset, process_index);
-        offset += 2U;
-        snapshot_buffer[offset++] = process_runtime->state;
-        snapshot_buffer[offset++] = 0U;
-        write_u16_le(snapshot_buffer + offset, process_runtime->process_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, process_runtime->current_context_handle);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, process_runtime->source_slot);
-        offset += 2U;
-        write_u16_le(snapshot_buffer + offset, process_runtime->next_runnable_index);
-        offset += 2U;
-    }
-    if (string_offset != string_byte_count || offset != total_size - string_byte_count) {
-        machine_panic("snapshot encoding size mismatch");
-    }
-
-    machine_puts("recorz-snapshot-profile ");
-    machine_puts(SNAPSHOT_COMPATIBILITY_PROFILE);
-    machine_putc('\n');
-    machine_puts("recorz-snapshot-begin ");
-    panic_put_u32(total_size);
-    machine_putc('\n');
-    for (offset = 0U; offset < total_size; offset += 32U) {
-        uint32_t chunk_size = total_size - offset;
-        uint32_t chunk_index;
-
-        if (chunk_size > 32U) {
-            chunk_size = 32U;
+        length += SNAPSHOT_LZ_MIN_MATCH;
+        if (match_offset == 0U || match_offset > output || length > expected - output) {
+            return 0U;
         }
-        machine_puts("recorz-snapshot-data ");
-        for (chunk_index = 0U; chunk_index < chunk_size; ++chunk_index) {
-            emit_snapshot_hex_byte(snapshot_buffer[offset + chunk_index]);
+        while (length-- > 0U) {
+            out[output] = out[output - match_offset];
+            ++output;
         }
-        machine_putc('\n');
     }
-    machine_puts("recorz-snapshot-end\n");
-    machine_puts("recorz qemu-riscv32 mvp: snapshot saved, shutting down\n");
-    machine_shutdown();
+    return (uint8_t)(output == expected);
 }
 
-static void load_snapshot_state(const uint8_t *blob, uint32_t size) {
-    uint16_t object_count;
-    uint16_t dynamic_count;
-    uint16_t saved_package_count;
-    uint16_t saved_named_object_count;
-    uint16_t saved_live_method_source_count;
-    uint32_t saved_live_method_source_byte_count;
-    uint16_t saved_live_string_literal_count;
-    uint16_t saved_live_string_literal_byte_count;
-    uint16_t saved_mono_bitmap_count;
-    uint16_t saved_next_dynamic_method_entry_execution_id;
-    uint32_t string_byte_count;
-    uint16_t saved_cursor_x;
-    uint16_t saved_cursor_y;
-    uint16_t saved_startup_hook_receiver_handle;
-    uint16_t saved_startup_hook_selector_id;
-    uint32_t expected_size;
-    uint16_t saved_active_display_form_handle;
-    uint16_t saved_active_cursor_handle;
-    uint16_t saved_active_cursor_visible;
-    uint16_t saved_active_cursor_x;
-    uint16_t saved_active_cursor_y;
-    uint16_t saved_scheduled_process_source_count;
-    uint16_t saved_scheduled_activation_count;
-    uint16_t saved_scheduled_process_count;
-    uint16_t saved_scheduled_runnable_head;
-    uint32_t string_section_offset;
-    uint32_t offset;
-    uint16_t handle;
-    uint16_t dynamic_index;
-    uint16_t named_index;
-    uint16_t source_index;
-    uint16_t activation_index;
-    uint16_t process_index;
-    uint16_t value_index;
-    uint32_t row;
+/* Returns the raw bytes of one section, inflating a compressed payload into `scratch`. */
+static const uint8_t *snapshot_section_payload(const uint8_t *image, uint8_t section, uint8_t *scratch) {
+    uint32_t offset = SNAPSHOT_PAYLOAD_OFFSET;
+    uint32_t raw_size = snapshot_section_raw_size(image, section);
+    uint32_t stored_size = snapshot_section_stored_size(image, section);
+    uint8_t index;
 
-    if (size < SNAPSHOT_HEADER_SIZE) {
-        machine_panic("snapshot is too small");
-    }
-    if (blob[0] != SNAPSHOT_MAGIC_0 || blob[1] != SNAPSHOT_MAGIC_1 ||
-        blob[2] != SNAPSHOT_MAGIC_2 || blob[3] != SNAPSHOT_MAGIC_3) {
-        machine_panic("snapshot magic mismatch");
-    }
-    if (read_u16_le(blob + 4U) != SNAPSHOT_VERSION) {
-        machine_panic(
-            "snapshot version mismatch: expected RV32MVP1 snapshot v10; "
-            "stale dev snapshot, use dev-reset or dev-restore"
-        );
-    }
-    object_count = read_u16_le(blob + 6U);
-    dynamic_count = read_u16_le(blob + 8U);
-    saved_package_count = read_u16_le(blob + 10U);
-    saved_named_object_count = read_u16_le(blob + 12U);
-    saved_mono_bitmap_count = read_u16_le(blob + 14U);
-    saved_next_dynamic_method_entry_execution_id = read_u16_le(blob + 16U);
-    string_byte_count = read_u32_le(blob + 18U);
-    saved_cursor_x = read_u16_le(blob + 22U);
-    saved_cursor_y = read_u16_le(blob + 24U);
-    saved_startup_hook_receiver_handle = read_u16_le(blob + 26U);
-    saved_startup_hook_selector_id = read_u16_le(blob + 28U);
-    saved_live_method_source_count = read_u16_le(blob + 30U);
-    saved_live_method_source_byte_count = read_u32_le(blob + 32U);
-    saved_live_string_literal_count = read_u16_le(blob + 36U);
-    saved_live_string_literal_byte_count = read_u16_le(blob + 38U);
-    saved_active_display_form_handle = read_u16_le(blob + 40U);
-    saved_active_cursor_handle = read_u16_le(blob + 42U);
-    saved_active_cursor_visible = read_u16_le(blob + 44U);
-    saved_active_cursor_x = read_u16_le(blob + 46U);
-    saved_active_cursor_y = read_u16_le(blob + 48U);
-    saved_scheduled_process_source_count = read_u16_le(blob + 50U);
-    saved_scheduled_activation_count = read_u16_le(blob + 52U);
-    saved_scheduled_process_count = read_u16_le(blob + 54U);
-    saved_scheduled_runnable_head = read_u16_le(blob + 56U);
-    expected_size = read_u32_le(blob + 60U);
-    if (object_count == 0U || object_count > HEAP_LIMIT) {
-        machine_panic("snapshot object count exceeds heap capacity");
-    }
-    if (dynamic_count > DYNAMIC_CLASS_LIMIT) {
-        machine_panic("snapshot dynamic class count exceeds capacity");
+    for (index = 0U; index < section; ++index) {
+        offset += snapshot_section_stored_size(image, index);
     }
-    if (saved_package_count > PACKAGE_LIMIT) {
-        machine_panic("snapshot package count exceeds capacity");
-    }
-    if (saved_named_object_count > NAMED_OBJECT_LIMIT) {
-        machine_panic("snapshot named object count exceeds capacity");
-    }
-    if (saved_live_method_source_count > LIVE_METHOD_SOURCE_LIMIT) {
-        machine_panic("snapshot live method source count exceeds capacity");
+    if (stored_size == raw_size) {
+        return image + offset;
     }
-    if (saved_live_method_source_byte_count > LIVE_METHOD_SOURCE_POOL_LIMIT) {
-        machine_panic("snapshot live method source pool exceeds capacity");
+    if (!snapshot_lz_decompress(image + offset, stored_size, scratch, raw_size)) {
+        machine_panic("snapshot section payload is invalid");
     }
-    if (saved_live_string_literal_count > LIVE_STRING_LITERAL_LIMIT) {
-        machine_panic("snapshot live string literal count exceeds capacity");
+    return scratch;
+}
+
+/* Places the raw bytes of one section at `destination`, inflating straight into it when compressed. */
+static void snapshot_section_copy(const uint8_t *image, uint8_t section, uint8_t *destination) {
+    const uint8_t *payload = snapshot_section_payload(image, section, destination);
+    uint32_t raw_size = snapshot_section_raw_size(image, section);
+    uint32_t index;
+
+    if (payload != destination) {
+        for (index = 0U; index < raw_size; ++index) {
+            destination[index] = payload[index];
+        }
     }
-    if (saved_mono_bitmap_count > MONO_BITMAP_LIMIT) {
-        machine_panic("snapshot mono bitmap count exceeds capacity");
+}
+
+/* Compresses each section of a freshly written image in place, keeping a section raw whenever the
+   compressed form would not be smaller, and returns the stored size. */
+static uint32_t snapshot_compress_image(uint8_t *image) {
+    uint32_t raw_offset = SNAPSHOT_PAYLOAD_OFFSET;
+    uint32_t stored_offset = SNAPSHOT_PAYLOAD_OFFSET;
+    uint32_t index;
+    uint8_t section;
+
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        uint32_t raw_size = snapshot_section_raw_size(image, section);
+        uint32_t stored_size = raw_size == 0U
+                                   ? 0U
+                                   : snapshot_lz_compress(
+                                         image + raw_offset,
+                                         raw_size,
+                                         snapshot_replay_buffer + stored_offset,
+                                         raw_size
+                                     );
+
+        if (stored_size == 0U) {
+            stored_size = raw_size;
+            for (index = 0U; index < raw_size; ++index) {
+                snapshot_replay_buffer[stored_offset + index] = image[raw_offset + index];
+            }
+        }
+        snapshot_write_directory_entry(image, section, raw_size, stored_size);
+        raw_offset += raw_size;
+        stored_offset += stored_size;
     }
-    if (saved_scheduled_process_source_count > SCHEDULED_PROCESS_SOURCE_LIMIT) {
-        machine_panic("snapshot scheduled process source count exceeds capacity");
+    for (index = SNAPSHOT_PAYLOAD_OFFSET; index < stored_offset; ++index) {
+        image[index] = snapshot_replay_buffer[index];
     }
-    if (saved_scheduled_activation_count > SCHEDULED_ACTIVATION_LIMIT) {
-        machine_panic("snapshot scheduled activation count exceeds capacity");
+    write_u32_le(image + SNAPSHOT_TOTAL_SIZE_OFFSET, stored_offset);
+    return stored_offset;
+}
+
+/* Rewrites the image in snapshot_buffer with every section stored raw, the form delta records are
+   applied to, and returns its size. */
+static uint32_t snapshot_expand_image(uint32_t size) {
+    uint32_t offset = SNAPSHOT_PAYLOAD_OFFSET;
+    uint32_t index;
+    uint8_t section;
+
+    snapshot_validate_directory(snapshot_buffer, size);
+    for (index = 0U; index < SNAPSHOT_PAYLOAD_OFFSET; ++index) {
+        snapshot_replay_buffer[index] = snapshot_buffer[index];
     }
-    if (saved_scheduled_process_count > SCHEDULED_PROCESS_LIMIT) {
-        machine_panic("snapshot scheduled process count exceeds capacity");
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        uint32_t raw_size = snapshot_section_raw_size(snapshot_buffer, section);
+
+        snapshot_section_copy(snapshot_buffer, section, snapshot_replay_buffer + offset);
+        snapshot_write_directory_entry(snapshot_replay_buffer, section, raw_size, raw_size);
+        offset += raw_size;
     }
-    if (saved_scheduled_runnable_head != 0xFFFFU && saved_scheduled_runnable_head >= SCHEDULED_PROCESS_LIMIT) {
-        machine_panic("snapshot scheduled runnable head is out of range");
+    write_u32_le(snapshot_replay_buffer + SNAPSHOT_TOTAL_SIZE_OFFSET, offset);
+    for (index = 0U; index < offset; ++index) {
+        snapshot_buffer[index] = snapshot_replay_buffer[index];
     }
-    if (string_byte_count > SNAPSHOT_STRING_LIMIT) {
-        machine_panic("snapshot string section exceeds capacity");
+    return offset;
+}
+
+static void snapshot_clear_write_barrier(void) {
+    uint32_t index;
+
+    for (index = 0U; index < sizeof(snapshot_dirty_bits); ++index) {
+        snapshot_dirty_bits[index] = 0U;
     }
-    if (expected_size != size) {
-        machine_panic("snapshot size mismatch");
+    snapshot_dirty_live_method_source_index = snapshot_image_live_method_source_count;
+    snapshot_dirty_live_method_source_pool_offset = snapshot_image_lengths[SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL];
+    snapshot_dirty_compiled_method_body_word = snapshot_image_lengths[SNAPSHOT_SECTION_COMPILED_METHOD_BODIES] / 4U;
+}
+
+/* Remembers the layout of the image the block device now holds, so the next save can append only the
+   objects, pool tails and tables that changed since. */
+static void snapshot_track_image(const uint8_t *image) {
+    uint8_t section;
+
+    snapshot_section_lengths(image, snapshot_image_lengths);
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        snapshot_image_fingerprints[section] =
+            snapshot_section_is_fingerprinted(section)
+                ? snapshot_checksum(
+                      snapshot_section_payload(image, section, snapshot_replay_buffer),
+                      snapshot_image_lengths[section]
+                  )
+                : 0U;
     }
-    string_section_offset = SNAPSHOT_HEADER_SIZE +
-                            ((uint32_t)object_count * SNAPSHOT_OBJECT_SIZE) +
-                            (MAX_GLOBAL_ID * 2U) +
-                            (RECORZ_MVP_SEED_ROOT_TRANSCRIPT_FONT * 2U) +
-                            (128U * 2U) +
-                            ((uint32_t)dynamic_count * SNAPSHOT_DYNAMIC_CLASS_RECORD_SIZE) +
-                            ((uint32_t)saved_package_count * SNAPSHOT_PACKAGE_RECORD_SIZE) +
-                            ((uint32_t)saved_named_object_count * SNAPSHOT_NAMED_OBJECT_RECORD_SIZE) +
-                            ((uint32_t)saved_live_method_source_count * SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SIZE) +
-                            saved_live_method_source_byte_count +
-                            ((uint32_t)saved_live_string_literal_count * SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE) +
-                            saved_live_string_literal_byte_count +
-                            ((uint32_t)saved_mono_bitmap_count * MONO_BITMAP_MAX_HEIGHT * 4U) +
-                            ((uint32_t)saved_scheduled_process_source_count * SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_SIZE) +
-                            ((uint32_t)saved_scheduled_activation_count * SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_SIZE) +
-                            ((uint32_t)saved_scheduled_process_count * SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE);
-    if (string_section_offset + string_byte_count != size) {
-        machine_panic("snapshot string section size mismatch");
-    }
-
-    reset_runtime_state();
-    for (row = 0U; row < string_byte_count; ++row) {
-        snapshot_string_pool[row] = (char)blob[string_section_offset + row];
-    }
-    if (string_byte_count < SNAPSHOT_STRING_LIMIT) {
-        snapshot_string_pool[string_byte_count] = '\0';
-    }
-    for (handle = 1U; handle <= object_count; ++handle) {
-        uint8_t kind = blob[SNAPSHOT_HEADER_SIZE + ((uint32_t)(handle - 1U) * SNAPSHOT_OBJECT_SIZE)];
+    snapshot_image_live_method_source_count = read_u16_le(image + 30U);
+    snapshot_clear_write_barrier();
+}
 
-        if (heap_size >= HEAP_LIMIT) {
-            machine_panic("snapshot object count exceeds heap capacity");
-        }
-        ++heap_size;
-        if (heap_size > heap_high_water_mark) {
-            heap_high_water_mark = heap_size;
-        }
-        heap_reset_slot(heap_size);
-        heap[heap_size - 1U].kind = kind;
-        if (kind != 0U) {
-            ++heap_live_count;
-        }
-    }
-    offset = SNAPSHOT_HEADER_SIZE;
-    for (handle = 1U; handle <= object_count; ++handle) {
-        struct recorz_mvp_heap_object *object = heap_object(handle);
-        uint8_t field_index;
+static void snapshot_write_header(
+    uint8_t *header,
+    uint32_t string_byte_count,
+    uint32_t live_method_source_byte_count,
+    uint32_t live_string_literal_byte_count,
+    uint16_t live_string_literal_count,
+    uint16_t scheduled_process_source_count,
+    uint16_t scheduled_activation_count,
+    uint16_t scheduled_process_count,
+    uint32_t total_size
+) {
+    uint32_t offset = 0U;
 
-        object->kind = blob[offset++];
-        object->field_count = blob[offset++];
-        object->class_handle = read_u16_le(blob + offset);
-        offset += 2U;
-        if (object->kind == 0U) {
-            if (object->field_count != 0U || object->class_handle != 0U) {
-                machine_panic("snapshot free slot has unexpected metadata");
-            }
-        } else {
-            if (object->field_count > OBJECT_FIELD_LIMIT) {
-                machine_panic("snapshot field count exceeds object field capacity");
-            }
-            if (object->class_handle == 0U || object->class_handle > object_count) {
-                machine_panic("snapshot class handle is out of range");
-            }
-        }
-        for (field_index = 0U; field_index < OBJECT_FIELD_LIMIT; ++field_index) {
-            object->fields[field_index] = snapshot_decode_value(blob + offset, string_byte_count);
-            offset += SNAPSHOT_VALUE_SIZE;
-        }
-    }
-    for (handle = RECORZ_MVP_GLOBAL_TRANSCRIPT; handle <= MAX_GLOBAL_ID; ++handle) {
-        global_handles[handle] = read_u16_le(blob + offset);
-        if (!heap_handle_is_live(global_handles[handle])) {
-            machine_panic("snapshot global handle is out of range");
-        }
-        offset += 2U;
-    }
-    default_form_handle = read_u16_le(blob + offset);
+    header[offset++] = SNAPSHOT_MAGIC_0;
+    header[offset++] = SNAPSHOT_MAGIC_1;
+    header[offset++] = SNAPSHOT_MAGIC_2;
+    header[offset++] = SNAPSHOT_MAGIC_3;
+    write_u16_le(header + offset, SNAPSHOT_VERSION);
     offset += 2U;
-    framebuffer_bitmap_handle = read_u16_le(blob + offset);
+    write_u16_le(header + offset, heap_size);
     offset += 2U;
-    transcript_behavior_handle = read_u16_le(blob + offset);
+    write_u16_le(header + offset, dynamic_class_count);
     offset += 2U;
-    transcript_layout_handle = read_u16_le(blob + offset);
+    write_u16_le(header + offset, package_count);
     offset += 2U;
-    transcript_style_handle = read_u16_le(blob + offset);
+    write_u16_le(header + offset, named_object_count);
     offset += 2U;
-    transcript_metrics_handle = read_u16_le(blob + offset);
+    write_u16_le(header + offset, mono_bitmap_count);
     offset += 2U;
-    transcript_font_handle = read_u16_le(blob + offset);
+    write_u16_le(header + offset, next_dynamic_method_entry_execution_id);
     offset += 2U;
-    if (!heap_handle_is_live(default_form_handle) ||
-        !heap_handle_is_live(framebuffer_bitmap_handle) ||
-        !heap_handle_is_live(transcript_behavior_handle) ||
-        !heap_handle_is_live(transcript_layout_handle) ||
-        !heap_handle_is_live(transcript_style_handle) ||
-        !heap_handle_is_live(transcript_metrics_handle) ||
-        !heap_handle_is_live(transcript_font_handle)) {
-        machine_panic("snapshot root handle is out of range");
+    write_u32_le(header + offset, string_byte_count);
+    offset += 4U;
+    write_u16_le(header + offset, (uint16_t)cursor_x);
+    offset += 2U;
+    write_u16_le(header + offset, (uint16_t)cursor_y);
+    offset += 2U;
+    write_u16_le(header + offset, startup_hook_receiver_handle);
+    offset += 2U;
+    write_u16_le(header + offset, startup_hook_selector_id);
+    offset += 2U;
+    write_u16_le(header + offset, live_method_source_count);
+    offset += 2U;
+    write_u32_le(header + offset, live_method_source_byte_count);
+    offset += 4U;
+    write_u16_le(header + offset, live_string_literal_count);
+    offset += 2U;
+    write_u16_le(header + offset, (uint16_t)live_string_literal_byte_count);
+    offset += 2U;
+    write_u16_le(header + offset, active_display_form_handle);
+    offset += 2U;
+    write_u16_le(header + offset, active_cursor_handle);
+    offset += 2U;
+    write_u16_le(header + offset, active_cursor_visible != 0U ? 1U : 0U);
+    offset += 2U;
+    write_u16_le(header + offset, (uint16_t)active_cursor_screen_x);
+    offset += 2U;
+    write_u16_le(header + offset, (uint16_t)active_cursor_screen_y);
+    offset += 2U;
+    write_u16_le(header + offset, scheduled_process_source_count);
+    offset += 2U;
+    write_u16_le(header + offset, scheduled_activation_count);
+    offset += 2U;
+    write_u16_le(header + offset, scheduled_process_count);
+    offset += 2U;
+    write_u16_le(header + offset, scheduled_runnable_head);
+    offset += 2U;
+    write_u16_le(header + offset, (uint16_t)compiled_method_body_words_used);
+    offset += 2U;
+    write_u32_le(header + offset, total_size);
+    offset += 4U;
+    write_u16_le(header + offset, method_dictionary_slots_used);
+    offset += 2U;
+    write_u16_le(header + offset, 0U);
+}
+
+static void snapshot_write_object(
+    uint8_t *record,
+    uint16_t handle,
+    struct recorz_mvp_snapshot_string_writer *strings
+) {
+    const struct recorz_mvp_heap_object *object = (const struct recorz_mvp_heap_object *)heap_object(handle);
+    uint8_t field_index;
+
+    record[0] = object->kind;
+    record[1] = object->field_count;
+    write_u16_le(record + 2U, object->class_handle);
+    for (field_index = 0U; field_index < OBJECT_FIELD_LIMIT; ++field_index) {
+        snapshot_encode_value(
+            record + 4U + ((uint32_t)field_index * SNAPSHOT_VALUE_SIZE),
+            object->fields[field_index],
+            strings
+        );
     }
-    if (!heap_handle_is_live(saved_active_display_form_handle)) {
-        machine_panic("snapshot active display form handle is out of range");
+}
+
+/* Only the object, live method source, source pool and compiled body sections are ever written from a
+   non-zero first element; the other sections are small enough to rewrite whole when they change. */
+static uint32_t snapshot_write_text(uint8_t *out, const char *text, uint32_t limit) {
+    uint32_t size = snapshot_text_size(text, limit);
+    uint32_t index;
+
+    for (index = 0U; index + 1U < size; ++index) {
+        out[index] = (uint8_t)text[index];
     }
-    if (saved_active_cursor_handle != 0U && !heap_handle_is_live(saved_active_cursor_handle)) {
-        machine_panic("snapshot active cursor handle is out of range");
+    out[size - 1U] = 0U;
+    return size;
+}
+
+static uint32_t snapshot_write_section(
+    uint8_t section,
+    uint8_t *out,
+    uint32_t first,
+    struct recorz_mvp_snapshot_string_writer *strings
+) {
+    uint32_t offset = 0U;
+    uint32_t index;
+    uint32_t row;
+
+    switch (section) {
+        case SNAPSHOT_SECTION_OBJECTS:
+            for (index = first + 1U; index <= heap_size; ++index) {
+                snapshot_write_object(out + offset, (uint16_t)index, strings);
+                offset += SNAPSHOT_OBJECT_SIZE;
+            }
+            break;
+        case SNAPSHOT_SECTION_ROOTS:
+            for (index = RECORZ_MVP_GLOBAL_TRANSCRIPT; index <= MAX_GLOBAL_ID; ++index) {
+                write_u16_le(out + offset, global_handles[index]);
+                offset += 2U;
+            }
+            write_u16_le(out + offset, default_form_handle);
+            offset += 2U;
+            write_u16_le(out + offset, framebuffer_bitmap_handle);
+            offset += 2U;
+            write_u16_le(out + offset, transcript_behavior_handle);
+            offset += 2U;
+            write_u16_le(out + offset, transcript_layout_handle);
+            offset += 2U;
+            write_u16_le(out + offset, transcript_style_handle);
+            offset += 2U;
+            write_u16_le(out + offset, transcript_metrics_handle);
+            offset += 2U;
+            write_u16_le(out + offset, transcript_font_handle);
+            offset += 2U;
+            for (index = 0U; index < 128U; ++index) {
+                write_u16_le(out + offset, glyph_bitmap_handles[index]);
+                offset += 2U;
+            }
+            break;
+        case SNAPSHOT_SECTION_DYNAMIC_CLASSES:
+            for (index = 0U; index < dynamic_class_count; ++index) {
+                const struct recorz_mvp_dynamic_class_definition *definition = &dynamic_classes[index];
+                uint8_t ivar_index;
+
+                write_u16_le(out + offset, definition->class_handle);
+                offset += 2U;
+                write_u16_le(out + offset, definition->superclass_handle);
+                offset += 2U;
+                out[offset++] = definition->instance_variable_count;
+                offset += snapshot_write_text(out + offset, definition->class_name, METHOD_SOURCE_NAME_LIMIT);
+                offset += snapshot_write_text(out + offset, definition->package_name, METHOD_SOURCE_NAME_LIMIT);
+                offset += snapshot_write_text(out + offset, definition->class_comment, CLASS_COMMENT_LIMIT);
+                for (ivar_index = 0U; ivar_index < definition->instance_variable_count; ++ivar_index) {
+                    offset += snapshot_write_text(
+                        out + offset,
+                        definition->instance_variable_names[ivar_index],
+                        METHOD_SOURCE_NAME_LIMIT
+                    );
+                }
+            }
+            break;
+        case SNAPSHOT_SECTION_PACKAGES:
+            for (index = 0U; index < package_count; ++index) {
+                offset += snapshot_write_text(out + offset, live_packages[index].package_name, METHOD_SOURCE_NAME_LIMIT);
+                offset += snapshot_write_text(out + offset, live_packages[index].package_comment, PACKAGE_COMMENT_LIMIT);
+            }
+            break;
+        case SNAPSHOT_SECTION_NAMED_OBJECTS:
+            for (index = 0U; index < named_object_count; ++index) {
+                write_u16_le(out + offset, named_objects[index].object_handle);
+                offset += 2U;
+                offset += snapshot_write_text(out + offset, named_objects[index].name, METHOD_SOURCE_NAME_LIMIT);
+            }
+            break;
+        case SNAPSHOT_SECTION_LIVE_METHOD_SOURCES:
+            for (index = first; index < live_method_source_count; ++index) {
+                const struct recorz_mvp_live_method_source *source_record = &live_method_sources[index];
+
+                write_u16_le(out + offset, source_record->class_handle);
+                offset += 2U;
+                write_u16_le(out + offset, source_record->selector_id);
+                offset += 2U;
+                out[offset++] = source_record->argument_count;
+                offset += snapshot_write_text(out + offset, source_record->protocol_name, METHOD_SOURCE_NAME_LIMIT);
+                write_u32_le(out + offset, source_record->source_offset);
+                offset += 4U;
+                write_u32_le(out + offset, source_record->source_length);
+                offset += 4U;
+            }
+            break;
+        case SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL:
+            for (row = first; row < live_method_source_pool_used; ++row) {
+                out[offset++] = (uint8_t)live_method_source_pool[row];
+            }
+            break;
+        case SNAPSHOT_SECTION_LIVE_STRING_LITERALS:
+            for (index = 0U; index < LIVE_STRING_LITERAL_LIMIT; ++index) {
+                const struct recorz_mvp_live_string_literal *literal_record = &live_string_literals[index];
+                uint32_t text_index;
+                uint32_t text_length_value;
+
+                if (literal_record->text == 0) {
+                    continue;
+                }
+                write_u16_le(out + offset, (uint16_t)(index + 1U));
+                offset += 2U;
+                write_u16_le(out + offset, literal_record->class_handle);
+                offset += 2U;
+                write_u16_le(out + offset, literal_record->selector_id);
+                offset += 2U;
+                out[offset++] = literal_record->argument_count;
+                text_length_value = text_length(literal_record->text);
+                write_u16_le(out + offset, (uint16_t)text_length_value);
+                offset += 2U;
+                for (text_index = 0U; text_index <= text_length_value; ++text_index) {
+                    out[offset++] = (uint8_t)literal_record->text[text_index];
+                }
+            }
+            break;
+        case SNAPSHOT_SECTION_MONO_BITMAPS:
+            for (index = 0U; index < mono_bitmap_count; ++index) {
+                for (row = 0U; row < MONO_BITMAP_MAX_HEIGHT; ++row) {
+                    write_u32_le(out + offset, mono_bitmap_pool[index][row]);
+                    offset += 4U;
+                }
+            }
+            break;
+        case SNAPSHOT_SECTION_COMPILED_METHOD_BODIES:
+            for (index = first; index < compiled_method_body_words_used; ++index) {
+                write_u32_le(out + offset, compiled_method_body_words[index]);
+                offset += 4U;
+            }
+            break;
+        case SNAPSHOT_SECTION_METHOD_DICTIONARIES:
+            for (index = 0U; index < method_dictionary_slots_used; ++index) {
+                write_u16_le(out + offset, method_dictionary_slots[index]);
+                offset += 2U;
+            }
+            break;
+        case SNAPSHOT_SECTION_SCHEDULED_PROCESS_SOURCES:
+            for (index = 0U; index < SCHEDULED_PROCESS_SOURCE_LIMIT; ++index) {
+                uint32_t source_length_value;
+
+                if (!scheduled_process_sources[index].in_use) {
+                    continue;
+                }
+                source_length_value = text_length(scheduled_process_sources[index].source);
+                if (source_length_value + 1U > SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT) {
+                    machine_panic("scheduled process source exceeds snapshot capacity");
+                }
+                write_u16_le(out + offset, (uint16_t)index);
+                offset += 2U;
+                write_u16_le(out + offset, (uint16_t)source_length_value);
+                offset += 2U;
+                offset += snapshot_write_text(
+                    out + offset,
+                    scheduled_process_sources[index].source,
+                    SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT
+                );
+            }
+            break;
+        case SNAPSHOT_SECTION_SCHEDULED_ACTIVATIONS:
+            for (index = 0U; index < SCHEDULED_ACTIVATION_LIMIT; ++index) {
+                const struct recorz_mvp_scheduled_activation_record *record = &scheduled_activation_records[index];
+                uint32_t value_index;
+
+                if (!record->in_use) {
+                    continue;
+                }
+                if (record->shared_lexical_environment_index >= 0) {
+                    machine_panic("snapshot cannot capture a scheduled activation with shared lexical state");
+                }
+                write_u16_le(out + offset, (uint16_t)index);
+                offset += 2U;
+                out[offset++] = record->kind;
+                out[offset++] = record->argument_count;
+                out[offset++] = record->lexical_count;
+                out[offset++] = 0U;
+                write_u16_le(out + offset, record->context_handle);
+                offset += 2U;
+                write_u16_le(out + offset, record->sender_context_handle);
+                offset += 2U;
+                write_u16_le(out + offset, record->compiled_method_handle);
+                offset += 2U;
+                write_u16_le(out + offset, record->selector_id);
+                offset += 2U;
+                write_u16_le(out + offset, record->source_slot);
+                offset += 2U;
+                write_u16_le(out + offset, (uint16_t)record->shared_lexical_environment_index);
+                offset += 2U;
+                write_u32_le(out + offset, record->pc);
+                offset += 4U;
+                write_u32_le(out + offset, record->stack_size);
+                offset += 4U;
+                snapshot_encode_value(out + offset, record->receiver, strings);
+                offset += SNAPSHOT_VALUE_SIZE;
+                for (value_index = 0U; value_index < record->argument_count; ++value_index) {
+                    snapshot_encode_value(out + offset, record->arguments[value_index], strings);
+                    offset += SNAPSHOT_VALUE_SIZE;
+                }
+                for (value_index = 0U; value_index < record->stack_size; ++value_index) {
+                    snapshot_encode_value(out + offset, record->stack[value_index], strings);
+                    offset += SNAPSHOT_VALUE_SIZE;
+                }
+                for (value_index = 0U; value_index < record->lexical_count; ++value_index) {
+                    snapshot_encode_value(out + offset, record->lexical[value_index], strings);
+                    offset += SNAPSHOT_VALUE_SIZE;
+                }
+            }
+            break;
+        case SNAPSHOT_SECTION_SCHEDULED_PROCESSES:
+            for (index = 0U; index < SCHEDULED_PROCESS_LIMIT; ++index) {
+                const struct recorz_mvp_scheduled_process_runtime *process_runtime = &scheduled_processes[index];
+
+                if (!process_runtime->in_use) {
+                    continue;
+                }
+                write_u16_le(out + offset, (uint16_t)index);
+                offset += 2U;
+                out[offset++] = process_runtime->state;
+                out[offset++] = 0U;
+                write_u16_le(out + offset, process_runtime->process_handle);
+                offset += 2U;
+                write_u16_le(out + offset, process_runtime->current_context_handle);
+                offset += 2U;
+                write_u16_le(out + offset, process_runtime->source_slot);
+                offset += 2U;
+                write_u16_le(out + offset, process_runtime->next_runnable_index);
+                offset += 2U;
+            }
+            break;
     }
-    if (saved_active_cursor_visible > 1U) {
-        machine_panic("snapshot active cursor visibility is invalid");
+    return offset;
+}
+
+static uint16_t snapshot_next_generation(void) {
+    if (snapshot_chain_active) {
+        return (uint16_t)(snapshot_chain_generation + 1U);
     }
-    active_display_form_handle = saved_active_display_form_handle;
-    active_cursor_handle = saved_active_cursor_handle;
-    active_cursor_visible = saved_active_cursor_handle == 0U ? 0U : (uint8_t)saved_active_cursor_visible;
-    active_cursor_screen_x = saved_active_cursor_x;
-    active_cursor_screen_y = saved_active_cursor_y;
-    for (handle = 0U; handle < 128U; ++handle) {
-        glyph_bitmap_handles[handle] = read_u16_le(blob + offset);
-        if (glyph_bitmap_handles[handle] != 0U && !heap_handle_is_live(glyph_bitmap_handles[handle])) {
-            machine_panic("snapshot glyph handle is out of range");
-        }
-        offset += 2U;
+    machine_block_read(0U, snapshot_delta_buffer, 1U);
+    if (snapshot_delta_buffer[0] == SNAPSHOT_MAGIC_0 && snapshot_delta_buffer[1] == SNAPSHOT_MAGIC_1 &&
+        snapshot_delta_buffer[2] == SNAPSHOT_MAGIC_2 && snapshot_delta_buffer[3] == SNAPSHOT_MAGIC_3) {
+        return (uint16_t)(read_u16_le(snapshot_delta_buffer + SNAPSHOT_GENERATION_OFFSET) + 1U);
     }
-    dynamic_class_count = dynamic_count;
-    for (dynamic_index = 0U; dynamic_index < dynamic_class_count; ++dynamic_index) {
-        struct recorz_mvp_dynamic_class_definition *definition = &dynamic_classes[dynamic_index];
-        uint8_t ivar_index;
-        uint32_t name_index;
+    return 1U;
+}
 
-        definition->class_handle = read_u16_le(blob + offset);
-        offset += 2U;
-        definition->superclass_handle = read_u16_le(blob + offset);
-        offset += 2U;
-        definition->instance_variable_count = blob[offset++];
-        offset += 3U;
-        if (!heap_handle_is_live(definition->class_handle) ||
-            !heap_handle_is_live(definition->superclass_handle)) {
-            machine_panic("snapshot dynamic class handle is out of range");
-        }
-        if (definition->instance_variable_count > DYNAMIC_CLASS_IVAR_LIMIT) {
-            machine_panic("snapshot dynamic class instance variable count is out of range");
-        }
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            definition->class_name[name_index] = (char)blob[offset++];
+static void store_snapshot_on_block_device(uint32_t size) {
+    uint32_t sector_count = snapshot_sector_count(size);
+    uint32_t offset;
+    uint16_t generation;
+
+    if (sector_count > machine_block_sector_count()) {
+        machine_panic("snapshot exceeds block device capacity");
+    }
+    generation = snapshot_next_generation();
+    write_u16_le(snapshot_buffer + SNAPSHOT_GENERATION_OFFSET, generation);
+    for (offset = size; offset < sector_count * MACHINE_BLOCK_SECTOR_SIZE; ++offset) {
+        snapshot_buffer[offset] = 0U;
+    }
+    machine_block_write(0U, snapshot_buffer, sector_count);
+    snapshot_chain_active = 1U;
+    snapshot_chain_generation = generation;
+    snapshot_chain_sequence = 0U;
+    snapshot_chain_next_sector = sector_count;
+    snapshot_track_image(snapshot_buffer);
+}
+
+static uint32_t snapshot_delta_first_element(uint8_t section) {
+    uint32_t image_count;
+    uint32_t live_count;
+    uint32_t dirty_from;
+
+    switch (section) {
+        case SNAPSHOT_SECTION_OBJECTS:
+            image_count = snapshot_image_lengths[section] / SNAPSHOT_OBJECT_SIZE;
+            return image_count < heap_size ? image_count : heap_size;
+        case SNAPSHOT_SECTION_LIVE_METHOD_SOURCES:
+            image_count = snapshot_image_live_method_source_count;
+            live_count = live_method_source_count;
+            dirty_from = snapshot_dirty_live_method_source_index;
+            break;
+        case SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL:
+            image_count = snapshot_image_lengths[section];
+            live_count = live_method_source_pool_used;
+            dirty_from = snapshot_dirty_live_method_source_pool_offset;
+            break;
+        case SNAPSHOT_SECTION_COMPILED_METHOD_BODIES:
+            image_count = snapshot_image_lengths[section] / 4U;
+            live_count = compiled_method_body_words_used;
+            dirty_from = snapshot_dirty_compiled_method_body_word;
+            break;
+        default:
+            return 0U;
+    }
+    if (live_count < image_count) {
+        image_count = live_count;
+    }
+    return dirty_from < image_count ? dirty_from : image_count;
+}
+
+/* A delta record rewrites the dirty objects in place, keeps the first bytes of every other section
+   from the image already on disk and appends the rest, with any new strings added after the image's
+   string section. Returns 0 when the chain should be consolidated into a fresh base instead. */
+static uint32_t store_snapshot_delta(
+    uint32_t string_byte_count,
+    uint32_t live_method_source_byte_count,
+    uint32_t live_string_literal_byte_count,
+    uint16_t live_string_literal_count,
+    uint16_t scheduled_process_source_count,
+    uint16_t scheduled_activation_count,
+    uint16_t scheduled_process_count
+) {
+    uint8_t *delta = snapshot_delta_buffer;
+    uint8_t *image_header = delta + SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET;
+    uint32_t lengths[SNAPSHOT_SECTION_COUNT];
+    uint32_t fingerprints[SNAPSHOT_SECTION_COUNT];
+    struct recorz_mvp_snapshot_string_writer strings;
+    uint32_t string_area;
+    uint32_t shared_object_count;
+    uint32_t offset;
+    uint32_t total_size;
+    uint32_t sector_count;
+    uint16_t patch_count = 0U;
+    uint16_t handle;
+    uint8_t section;
+
+    if (snapshot_chain_sequence >= SNAPSHOT_DELTA_CHAIN_LIMIT ||
+        string_byte_count + SNAPSHOT_DELTA_HEADER_SIZE > SNAPSHOT_DELTA_LIMIT) {
+        return 0U;
+    }
+    string_area = SNAPSHOT_DELTA_LIMIT - string_byte_count;
+    snapshot_write_header(
+        image_header,
+        0U,
+        live_method_source_byte_count,
+        live_string_literal_byte_count,
+        live_string_literal_count,
+        scheduled_process_source_count,
+        scheduled_activation_count,
+        scheduled_process_count,
+        0U
+    );
+    for (section = 0U; section < SNAPSHOT_SECTION_STRINGS; ++section) {
+        lengths[section] = snapshot_section_size(section, 0U);
+    }
+    strings.bytes = delta + string_area;
+    strings.base = snapshot_image_lengths[SNAPSHOT_SECTION_STRINGS];
+    strings.used = 0U;
+    strings.limit = string_byte_count;
+    shared_object_count = snapshot_delta_first_element(SNAPSHOT_SECTION_OBJECTS);
+    offset = SNAPSHOT_DELTA_HEADER_SIZE;
+    for (handle = 1U; handle <= shared_object_count; ++handle) {
+        if (!snapshot_object_is_dirty(handle)) {
+            continue;
         }
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            definition->package_name[name_index] = (char)blob[offset++];
+        if (offset + SNAPSHOT_DELTA_PATCH_RECORD_SIZE > string_area) {
+            return 0U;
         }
-        for (name_index = 0U; name_index < CLASS_COMMENT_LIMIT; ++name_index) {
-            definition->class_comment[name_index] = (char)blob[offset++];
+        write_u16_le(delta + offset, handle);
+        snapshot_write_object(delta + offset + 2U, handle, &strings);
+        offset += SNAPSHOT_DELTA_PATCH_RECORD_SIZE;
+        ++patch_count;
+    }
+    for (section = 0U; section < SNAPSHOT_SECTION_STRINGS; ++section) {
+        uint32_t first = snapshot_delta_first_element(section);
+        uint32_t kept = lengths[section] - snapshot_section_size(section, first);
+        uint32_t string_mark = strings.used;
+        uint32_t written;
+
+        if (offset + lengths[section] - kept > string_area) {
+            return 0U;
         }
-        for (ivar_index = 0U; ivar_index < DYNAMIC_CLASS_IVAR_LIMIT; ++ivar_index) {
-            for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-                definition->instance_variable_names[ivar_index][name_index] = (char)blob[offset++];
+        written = snapshot_write_section(section, delta + offset, first, &strings);
+        fingerprints[section] = snapshot_image_fingerprints[section];
+        if (snapshot_section_is_fingerprinted(section)) {
+            fingerprints[section] = snapshot_checksum(delta + offset, written);
+            if (written == snapshot_image_lengths[section] &&
+                fingerprints[section] == snapshot_image_fingerprints[section]) {
+                kept = written;
+                written = 0U;
+                strings.used = string_mark;
             }
         }
+        write_u32_le(delta + SNAPSHOT_DELTA_FIRST_OFFSET + ((uint32_t)section * 4U), kept);
+        offset += written;
     }
-    package_count = saved_package_count;
-    for (dynamic_index = 0U; dynamic_index < package_count; ++dynamic_index) {
-        uint32_t name_index;
+    write_u32_le(
+        delta + SNAPSHOT_DELTA_FIRST_OFFSET + (SNAPSHOT_SECTION_STRINGS * 4U),
+        snapshot_image_lengths[SNAPSHOT_SECTION_STRINGS]
+    );
+    for (total_size = 0U; total_size < strings.used; ++total_size) {
+        delta[offset + total_size] = strings.bytes[total_size];
+    }
+    offset += strings.used;
+    lengths[SNAPSHOT_SECTION_STRINGS] = snapshot_image_lengths[SNAPSHOT_SECTION_STRINGS] + strings.used;
+    total_size = SNAPSHOT_PAYLOAD_OFFSET;
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        snapshot_write_directory_entry(image_header, section, lengths[section], lengths[section]);
+        total_size += lengths[section];
+    }
+    if (lengths[SNAPSHOT_SECTION_STRINGS] > SNAPSHOT_STRING_LIMIT || total_size > SNAPSHOT_BUFFER_LIMIT) {
+        return 0U;
+    }
+    sector_count = snapshot_sector_count(offset);
+    if (snapshot_chain_next_sector + sector_count > machine_block_sector_count()) {
+        return 0U;
+    }
+    write_u32_le(image_header + 18U, lengths[SNAPSHOT_SECTION_STRINGS]);
+    write_u32_le(image_header + SNAPSHOT_TOTAL_SIZE_OFFSET, total_size);
+    write_u16_le(image_header + SNAPSHOT_GENERATION_OFFSET, snapshot_chain_generation);
+    delta[0] = SNAPSHOT_MAGIC_0;
+    delta[1] = SNAPSHOT_MAGIC_1;
+    delta[2] = SNAPSHOT_MAGIC_2;
+    delta[3] = SNAPSHOT_DELTA_MAGIC_3;
+    write_u16_le(delta + 4U, SNAPSHOT_VERSION);
+    write_u16_le(delta + 6U, snapshot_chain_generation);
+    write_u16_le(delta + 8U, (uint16_t)(snapshot_chain_sequence + 1U));
+    write_u16_le(delta + 10U, patch_count);
+    write_u32_le(delta + 12U, offset);
+    write_u32_le(
+        delta + SNAPSHOT_DELTA_CHECKSUM_OFFSET,
+        snapshot_checksum(delta + SNAPSHOT_DELTA_FIRST_OFFSET, offset - SNAPSHOT_DELTA_FIRST_OFFSET)
+    );
+    for (total_size = offset; total_size < sector_count * MACHINE_BLOCK_SECTOR_SIZE; ++total_size) {
+        delta[total_size] = 0U;
+    }
+    machine_block_write(snapshot_chain_next_sector, delta, sector_count);
+    snapshot_chain_next_sector += sector_count;
+    ++snapshot_chain_sequence;
+    snapshot_image_live_method_source_count = live_method_source_count;
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        snapshot_image_lengths[section] = lengths[section];
+        snapshot_image_fingerprints[section] = fingerprints[section];
+    }
+    snapshot_clear_write_barrier();
+    return offset;
+}
+
+static uint8_t snapshot_delta_header_matches(const uint8_t *delta, uint16_t sequence) {
+    return (uint8_t)(delta[0] == SNAPSHOT_MAGIC_0 && delta[1] == SNAPSHOT_MAGIC_1 &&
+                     delta[2] == SNAPSHOT_MAGIC_2 && delta[3] == SNAPSHOT_DELTA_MAGIC_3 &&
+                     read_u16_le(delta + 4U) == SNAPSHOT_VERSION &&
+                     read_u16_le(delta + 6U) == snapshot_chain_generation &&
+                     read_u16_le(delta + 8U) == sequence);
+}
+
+/* Consolidates one delta record into the expanded image held in snapshot_buffer and returns the new size. */
+static uint32_t apply_snapshot_delta(const uint8_t *delta, uint32_t delta_size) {
+    const uint8_t *image_header = delta + SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET;
+    uint32_t old_lengths[SNAPSHOT_SECTION_COUNT];
+    uint32_t new_lengths[SNAPSHOT_SECTION_COUNT];
+    uint32_t old_offset = SNAPSHOT_PAYLOAD_OFFSET;
+    uint32_t new_offset = SNAPSHOT_PAYLOAD_OFFSET;
+    uint32_t patch_count = read_u16_le(delta + 10U);
+    uint32_t total_size = read_u32_le(image_header + SNAPSHOT_TOTAL_SIZE_OFFSET);
+    uint32_t cursor = SNAPSHOT_DELTA_HEADER_SIZE + (patch_count * SNAPSHOT_DELTA_PATCH_RECORD_SIZE);
+    uint32_t index;
+    uint8_t section;
 
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            live_packages[dynamic_index].package_name[name_index] = (char)blob[offset++];
-        }
-        for (name_index = 0U; name_index < PACKAGE_COMMENT_LIMIT; ++name_index) {
-            live_packages[dynamic_index].package_comment[name_index] = (char)blob[offset++];
-        }
+    snapshot_section_lengths(snapshot_buffer, old_lengths);
+    snapshot_section_lengths(image_header, new_lengths);
+    if (total_size > SNAPSHOT_BUFFER_LIMIT || new_lengths[SNAPSHOT_SECTION_STRINGS] > SNAPSHOT_STRING_LIMIT) {
+        machine_panic("snapshot delta image exceeds buffer capacity");
     }
-    named_object_count = saved_named_object_count;
-    for (named_index = 0U; named_index < named_object_count; ++named_index) {
-        uint32_t name_index;
+    if (cursor > delta_size) {
+        machine_panic("snapshot delta layout is invalid");
+    }
+    for (index = 0U; index < SNAPSHOT_PAYLOAD_OFFSET; ++index) {
+        snapshot_replay_buffer[index] = image_header[index];
+    }
+    for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+        uint32_t kept = read_u32_le(delta + SNAPSHOT_DELTA_FIRST_OFFSET + ((uint32_t)section * 4U));
+        uint32_t appended;
 
-        named_objects[named_index].object_handle = read_u16_le(blob + offset);
-        offset += 2U;
-        if (!heap_handle_is_live(named_objects[named_index].object_handle)) {
-            machine_panic("snapshot named object handle is out of range");
+        if (kept > old_lengths[section] || kept > new_lengths[section] || new_lengths[section] > total_size ||
+            snapshot_section_stored_size(image_header, section) != new_lengths[section] ||
+            new_offset + new_lengths[section] > total_size ||
+            new_lengths[section] - kept > delta_size - cursor) {
+            machine_panic("snapshot delta layout is invalid");
+        }
+        appended = new_lengths[section] - kept;
+        for (index = 0U; index < kept; ++index) {
+            snapshot_replay_buffer[new_offset + index] = snapshot_buffer[old_offset + index];
         }
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            named_objects[named_index].name[name_index] = (char)blob[offset++];
+        for (index = 0U; index < appended; ++index) {
+            snapshot_replay_buffer[new_offset + kept + index] = delta[cursor + index];
         }
+        cursor += appended;
+        old_offset += old_lengths[section];
+        new_offset += new_lengths[section];
     }
-    live_method_source_count = saved_live_method_source_count;
-    for (named_index = 0U; named_index < live_method_source_count; ++named_index) {
-        uint32_t name_index;
+    if (cursor != delta_size || new_offset != total_size) {
+        machine_panic("snapshot delta layout is invalid");
+    }
+    cursor = SNAPSHOT_DELTA_HEADER_SIZE;
+    for (index = 0U; index < patch_count; ++index) {
+        uint32_t handle = read_u16_le(delta + cursor);
+        uint32_t field_offset;
 
-        live_method_sources[named_index].class_handle = read_u16_le(blob + offset);
-        offset += 2U;
-        live_method_sources[named_index].selector_id = read_u16_le(blob + offset);
-        offset += 2U;
-        live_method_sources[named_index].argument_count = blob[offset++];
-        for (name_index = 0U; name_index < METHOD_SOURCE_NAME_LIMIT; ++name_index) {
-            live_method_sources[named_index].protocol_name[name_index] = (char)blob[offset++];
-        }
-        live_method_sources[named_index].source_offset = read_u32_le(blob + offset);
-        offset += 4U;
-        live_method_sources[named_index].source_length = read_u32_le(blob + offset);
-        offset += 4U;
-        if (!heap_handle_is_live(live_method_sources[named_index].class_handle)) {
-            machine_panic("snapshot live method source class handle is out of range");
+        if (handle == 0U ||
+            handle * SNAPSHOT_OBJECT_SIZE > read_u32_le(delta + SNAPSHOT_DELTA_FIRST_OFFSET)) {
+            machine_panic("snapshot delta object patch is out of range");
         }
-        if (live_method_sources[named_index].source_offset + live_method_sources[named_index].source_length >=
-            saved_live_method_source_byte_count) {
-            machine_panic("snapshot live method source is out of range");
+        for (field_offset = 0U; field_offset < SNAPSHOT_OBJECT_SIZE; ++field_offset) {
+            snapshot_replay_buffer[SNAPSHOT_PAYLOAD_OFFSET + ((handle - 1U) * SNAPSHOT_OBJECT_SIZE) + field_offset] =
+                delta[cursor + 2U + field_offset];
         }
+        cursor += SNAPSHOT_DELTA_PATCH_RECORD_SIZE;
     }
-    live_method_source_pool_used = saved_live_method_source_byte_count;
-    for (row = 0U; row < saved_live_method_source_byte_count; ++row) {
-        live_method_source_pool[row] = (char)blob[offset++];
+    for (index = 0U; index < total_size; ++index) {
+        snapshot_buffer[index] = snapshot_replay_buffer[index];
     }
-    if (saved_live_method_source_byte_count < LIVE_METHOD_SOURCE_POOL_LIMIT) {
-        live_method_source_pool[saved_live_method_source_byte_count] = '\0';
-    }
-    for (named_index = 0U; named_index < live_method_source_count; ++named_index) {
-        const struct recorz_mvp_live_method_source *source_record = &live_method_sources[named_index];
+    return total_size;
+}
 
-        if (live_method_source_pool[source_record->source_offset + source_record->source_length] != '\0') {
-            machine_panic("snapshot live method source is not terminated");
-        }
+static uint32_t read_snapshot_from_block_device(void) {
+    uint32_t capacity = machine_block_sector_count();
+    uint32_t size;
+    uint32_t sector;
+
+    if (capacity == 0U) {
+        return 0U;
     }
-    for (named_index = 0U; named_index < LIVE_STRING_LITERAL_LIMIT; ++named_index) {
-        live_string_literals[named_index].class_handle = 0U;
-        live_string_literals[named_index].selector_id = 0U;
-        live_string_literals[named_index].argument_count = 0U;
-        live_string_literals[named_index].text = 0;
+    machine_block_read(0U, snapshot_buffer, 1U);
+    if (snapshot_buffer[0] != SNAPSHOT_MAGIC_0 || snapshot_buffer[1] != SNAPSHOT_MAGIC_1 ||
+        snapshot_buffer[2] != SNAPSHOT_MAGIC_2 || snapshot_buffer[3] != SNAPSHOT_MAGIC_3) {
+        return 0U;
     }
-    for (named_index = 0U; named_index < saved_live_string_literal_count; ++named_index) {
-        uint16_t slot_id = read_u16_le(blob + offset);
-        uint16_t class_handle = read_u16_le(blob + offset + 2U);
-        uint16_t selector_id = read_u16_le(blob + offset + 4U);
-        uint8_t argument_count = blob[offset + 6U];
-        uint16_t text_length_value = read_u16_le(blob + offset + 7U);
-        char literal_text[METHOD_SOURCE_CHUNK_LIMIT];
-        uint32_t text_index;
+    size = read_u32_le(snapshot_buffer + SNAPSHOT_TOTAL_SIZE_OFFSET);
+    if (size < SNAPSHOT_PAYLOAD_OFFSET || size > SNAPSHOT_BUFFER_LIMIT) {
+        machine_panic("block device snapshot size is invalid");
+    }
+    if (snapshot_sector_count(size) > 1U) {
+        machine_block_read(1U, snapshot_buffer + MACHINE_BLOCK_SECTOR_SIZE, snapshot_sector_count(size) - 1U);
+    }
+    snapshot_chain_generation = read_u16_le(snapshot_buffer + SNAPSHOT_GENERATION_OFFSET);
+    snapshot_chain_sequence = 0U;
+    sector = snapshot_sector_count(size);
+    while (sector < capacity) {
+        uint32_t delta_size;
+        uint32_t delta_sector_count;
 
-        offset += SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE;
-        if (slot_id == 0U || slot_id > LIVE_STRING_LITERAL_LIMIT) {
-            machine_panic("snapshot live string literal slot is out of range");
+        machine_block_read(sector, snapshot_delta_buffer, 1U);
+        if (!snapshot_delta_header_matches(snapshot_delta_buffer, (uint16_t)(snapshot_chain_sequence + 1U))) {
+            break;
         }
-        if (!heap_handle_is_live(class_handle)) {
-            machine_panic("snapshot live string literal class handle is out of range");
+        delta_size = read_u32_le(snapshot_delta_buffer + 12U);
+        delta_sector_count = snapshot_sector_count(delta_size);
+        if (delta_size < SNAPSHOT_DELTA_HEADER_SIZE || delta_size > SNAPSHOT_DELTA_LIMIT ||
+            sector + delta_sector_count > capacity) {
+            break;
         }
-        if (text_length_value + 1U > METHOD_SOURCE_CHUNK_LIMIT) {
-            machine_panic("snapshot live string literal exceeds chunk capacity");
+        if (delta_sector_count > 1U) {
+            machine_block_read(sector + 1U, snapshot_delta_buffer + MACHINE_BLOCK_SECTOR_SIZE, delta_sector_count - 1U);
         }
-        for (text_index = 0U; text_index < text_length_value; ++text_index) {
-            literal_text[text_index] = (char)blob[offset++];
+        if (snapshot_checksum(snapshot_delta_buffer + SNAPSHOT_DELTA_FIRST_OFFSET, delta_size - SNAPSHOT_DELTA_FIRST_OFFSET) !=
+            read_u32_le(snapshot_delta_buffer + SNAPSHOT_DELTA_CHECKSUM_OFFSET)) {
+            break;
         }
-        literal_text[text_length_value] = '\0';
-        if (blob[offset++] != 0U) {
-            machine_panic("snapshot live string literal is not terminated");
+        if (snapshot_chain_sequence == 0U) {
+            size = snapshot_expand_image(size);
         }
-        live_string_literals[slot_id - 1U].class_handle = class_handle;
-        live_string_literals[slot_id - 1U].selector_id = selector_id;
-        live_string_literals[slot_id - 1U].argument_count = argument_count;
-        live_string_literals[slot_id - 1U].text = runtime_string_allocate_copy(literal_text);
+        size = apply_snapshot_delta(snapshot_delta_buffer, delta_size);
+        ++snapshot_chain_sequence;
+        sector += delta_sector_count;
     }
-    mono_bitmap_count = saved_mono_bitmap_count;
-    for (handle = 0U; handle < mono_bitmap_count; ++handle) {
-        for (row = 0U; row < MONO_BITMAP_MAX_HEIGHT; ++row) {
-            mono_bitmap_pool[handle][row] = read_u32_le(blob + offset);
-            offset += 4U;
-        }
+    snapshot_chain_next_sector = sector;
+    snapshot_chain_active = 1U;
+    if (snapshot_chain_sequence != 0U) {
+        machine_puts("recorz qemu-riscv32 mvp: replayed snapshot deltas ");
+        panic_put_u32(snapshot_chain_sequence);
+        machine_putc('\n');
     }
-    for (source_index = 0U; source_index < saved_scheduled_process_source_count; ++source_index) {
-        uint16_t slot_id = read_u16_le(blob + offset);
-        uint16_t source_length_value = read_u16_le(blob + offset + 2U);
-        uint32_t source_offset;
+    return size;
+}
 
-        if (slot_id >= SCHEDULED_PROCESS_SOURCE_LIMIT) {
-            machine_panic("snapshot scheduled process source slot is out of range");
-        }
-        if (source_length_value + 1U > SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT) {
-            machine_panic("snapshot scheduled process source length exceeds capacity");
-        }
-        if (blob[offset + 4U + source_length_value] != 0U) {
-            machine_panic("snapshot scheduled process source is not terminated");
-        }
-        scheduled_process_sources[slot_id].in_use = 1U;
-        for (source_offset = 0U; source_offset < SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT; ++source_offset) {
-            scheduled_process_sources[slot_id].source[source_offset] = (char)blob[offset + 4U + source_offset];
-        }
-        offset += SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_SIZE;
-    }
-    for (activation_index = 0U; activation_index < saved_scheduled_activation_count; ++activation_index) {
-        struct recorz_mvp_scheduled_activation_record *record;
-        uint16_t slot_id = read_u16_le(blob + offset);
+/* A save requested by the running scheduled process is deferred until that process has yielded back to
+   the scheduler, so it is captured as a runnable process parked at an instruction boundary. Saves that
+   reach a block device may keep running as a checkpoint; the UART transport always shuts down. A
+   checkpoint returns into the primitive that asked for it, so it must not compact the pools. */
+static void emit_live_snapshot(uint8_t save_mode) {
+    struct recorz_mvp_snapshot_string_writer strings;
+    uint32_t lengths[SNAPSHOT_SECTION_COUNT];
+    uint32_t string_byte_count;
+    uint32_t live_method_source_byte_count;
+    uint32_t live_string_literal_byte_count;
+    uint16_t live_string_literal_count;
+    uint16_t scheduled_process_source_count;
+    uint16_t scheduled_activation_count;
+    uint16_t scheduled_process_count;
+    uint32_t total_size;
+    uint32_t delta_size = 0U;
+    uint32_t offset;
+    uint8_t section;
 
-        if (slot_id >= SCHEDULED_ACTIVATION_LIMIT) {
-            machine_panic("snapshot scheduled activation slot is out of range");
-        }
-        record = &scheduled_activation_records[slot_id];
-        record->in_use = 1U;
-        record->kind = blob[offset + 2U];
-        record->argument_count = blob[offset + 3U];
-        record->lexical_count = blob[offset + 4U];
-        record->context_handle = read_u16_le(blob + offset + 6U);
-        record->sender_context_handle = read_u16_le(blob + offset + 8U);
-        record->compiled_method_handle = read_u16_le(blob + offset + 10U);
-        record->selector_id = read_u16_le(blob + offset + 12U);
-        record->source_slot = read_u16_le(blob + offset + 14U);
-        record->shared_lexical_environment_index = (int16_t)read_u16_le(blob + offset + 16U);
-        record->pc = read_u32_le(blob + offset + 18U);
-        record->stack_size = read_u32_le(blob + offset + 22U);
-        if (record->kind != RECORZ_MVP_SCHEDULED_ACTIVATION_WORKSPACE_SOURCE &&
-            record->kind != RECORZ_MVP_SCHEDULED_ACTIVATION_COMPILED_METHOD) {
-            machine_panic("snapshot scheduled activation kind is invalid");
-        }
-        if (record->argument_count > MAX_SEND_ARGS) {
-            machine_panic("snapshot scheduled activation argument count exceeds capacity");
-        }
-        if (record->lexical_count > LEXICAL_LIMIT) {
-            machine_panic("snapshot scheduled activation lexical count exceeds capacity");
-        }
-        if (record->stack_size > STACK_LIMIT) {
-            machine_panic("snapshot scheduled activation stack size exceeds capacity");
-        }
-        if (!heap_handle_is_live(record->context_handle)) {
-            machine_panic("snapshot scheduled activation context handle is out of range");
-        }
-        if (record->sender_context_handle != 0U && !heap_handle_is_live(record->sender_context_handle)) {
-            machine_panic("snapshot scheduled activation sender handle is out of range");
-        }
-        if (record->kind == RECORZ_MVP_SCHEDULED_ACTIVATION_COMPILED_METHOD &&
-            !heap_handle_is_live(record->compiled_method_handle)) {
-            machine_panic("snapshot scheduled activation compiled method handle is out of range");
-        }
-        if (record->kind == RECORZ_MVP_SCHEDULED_ACTIVATION_WORKSPACE_SOURCE &&
-            (record->source_slot >= SCHEDULED_PROCESS_SOURCE_LIMIT ||
-             !scheduled_process_sources[record->source_slot].in_use)) {
-            machine_panic("snapshot scheduled activation source slot is out of range");
-        }
-        if (record->shared_lexical_environment_index >= 0) {
-            machine_panic("snapshot scheduled activation shared lexical state is not supported");
-        }
-        offset += 26U;
-        record->receiver = snapshot_decode_value(blob + offset, string_byte_count);
-        offset += SNAPSHOT_VALUE_SIZE;
-        for (value_index = 0U; value_index < MAX_SEND_ARGS; ++value_index) {
-            record->arguments[value_index] = snapshot_decode_value(blob + offset, string_byte_count);
-            offset += SNAPSHOT_VALUE_SIZE;
-        }
-        for (value_index = 0U; value_index < STACK_LIMIT; ++value_index) {
-            record->stack[value_index] = snapshot_decode_value(blob + offset, string_byte_count);
-            offset += SNAPSHOT_VALUE_SIZE;
-        }
-        for (value_index = 0U; value_index < LEXICAL_LIMIT; ++value_index) {
-            record->lexical[value_index] = snapshot_decode_value(blob + offset, string_byte_count);
-            offset += SNAPSHOT_VALUE_SIZE;
-        }
+    if (scheduled_active_process_index >= 0) {
+        scheduled_snapshot_save_mode = save_mode;
+        scheduled_yield_requested = 1U;
+        return;
     }
-    for (process_index = 0U; process_index < saved_scheduled_process_count; ++process_index) {
-        struct recorz_mvp_scheduled_process_runtime *process_runtime;
-        uint16_t slot_id = read_u16_le(blob + offset);
-
-        if (slot_id >= SCHEDULED_PROCESS_LIMIT) {
-            machine_panic("snapshot scheduled process slot is out of range");
-        }
-        process_runtime = &scheduled_processes[slot_id];
-        process_runtime->in_use = 1U;
-        process_runtime->state = blob[offset + 2U];
-        process_runtime->process_handle = read_u16_le(blob + offset + 4U);
-        process_runtime->current_context_handle = read_u16_le(blob + offset + 6U);
-        process_runtime->source_slot = read_u16_le(blob + offset + 8U);
-        process_runtime->next_runnable_index = read_u16_le(blob + offset + 10U);
-        if (!heap_handle_is_live(process_runtime->process_handle)) {
-            machine_panic("snapshot scheduled process handle is out of range");
+    if (save_mode == SNAPSHOT_SAVE_AND_CONTINUE) {
+        (void)gc_collect_inside_primitive();
+    } else {
+        (void)gc_collect_now();
+    }
+    string_byte_count = current_snapshot_string_byte_count();
+    live_method_source_byte_count = current_snapshot_live_method_source_byte_count();
+    live_string_literal_byte_count = current_live_string_literal_byte_count();
+    live_string_literal_count = current_live_string_literal_count();
+    scheduled_process_source_count = current_scheduled_process_source_count();
+    scheduled_activation_count = current_scheduled_activation_count();
+    scheduled_process_count = current_scheduled_process_count();
+    total_size = snapshot_measure_sections(lengths, string_byte_count);
+    if (snapshot_chain_active && machine_block_sector_count() != 0U) {
+        delta_size = store_snapshot_delta(
+            string_byte_count,
+            live_method_source_byte_count,
+            live_string_literal_byte_count,
+            live_string_literal_count,
+            scheduled_process_source_count,
+            scheduled_activation_count,
+            scheduled_process_count
+        );
+    }
+    if (delta_size == 0U) {
+        if (total_size > SNAPSHOT_BUFFER_LIMIT) {
+            machine_panic("snapshot exceeds buffer capacity");
         }
-        if (process_runtime->current_context_handle != 0U &&
-            !heap_handle_is_live(process_runtime->current_context_handle)) {
-            machine_panic("snapshot scheduled process context handle is out of range");
+        snapshot_write_header(
+            snapshot_buffer,
+            string_byte_count,
+            live_method_source_byte_count,
+            live_string_literal_byte_count,
+            live_string_literal_count,
+            scheduled_process_source_count,
+            scheduled_activation_count,
+            scheduled_process_count,
+            total_size
+        );
+        for (section = 0U; section < SNAPSHOT_SECTION_COUNT; ++section) {
+            snapshot_write_directory_entry(snapshot_buffer, section, lengths[section], lengths[section]);
         }
-        if (process_runtime->source_slot >= SCHEDULED_PROCESS_SOURCE_LIMIT ||
-            !scheduled_process_sources[process_runtime->source_slot].in_use) {
-            machine_panic("snapshot scheduled process source slot is out of range");
+        strings.bytes = snapshot_buffer + (total_size - string_byte_count);
+        strings.base = 0U;
+        strings.used = 0U;
+        strings.limit = string_byte_count;
+        offset = SNAPSHOT_PAYLOAD_OFFSET;
+        for (section = 0U; section < SNAPSHOT_SECTION_STRINGS; ++section) {
+            offset += snapshot_write_section(section, snapshot_buffer + offset, 0U, &strings);
         }
-        if (process_runtime->next_runnable_index != 0xFFFFU &&
-            process_runtime->next_runnable_index >= SCHEDULED_PROCESS_LIMIT) {
-            machine_panic("snapshot scheduled process next runnable slot is out of range");
+        if (strings.used != string_byte_count || offset != total_size - string_byte_count) {
+            machine_panic("snapshot encoding size mismatch");
         }
-        offset += SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE;
+        total_size = snapshot_compress_image(snapshot_buffer);
     }
-    if (offset != string_section_offset) {
-        machine_panic("snapshot fixed section size mismatch");
-    }
-    scheduled_runnable_head = saved_scheduled_runnable_head;
-    scheduled_runnable_tail = 0xFFFFU;
-    scheduled_active_process_index = -1;
-    if (scheduled_runnable_head != 0xFFFFU) {
-        uint16_t current_index = scheduled_runnable_head;
-        uint16_t traversed = 0U;
 
-        while (current_index != 0xFFFFU) {
-            if (current_index >= SCHEDULED_PROCESS_LIMIT || !scheduled_processes[current_index].in_use) {
-                machine_panic("snapshot runnable queue contains an invalid process slot");
-            }
-            scheduled_runnable_tail = current_index;
-            current_index = scheduled_processes[current_index].next_runnable_index;
-            if (++traversed > SCHEDULED_PROCESS_LIMIT) {
-                machine_panic("snapshot runnable queue contains a cycle");
-            }
-        }
-    }
-    for (process_index = 0U; process_index < SCHEDULED_PROCESS_LIMIT; ++process_index) {
-        if (scheduled_processes[process_index].in_use) {
-            scheduled_process_sync_object_fields(process_index);
-        }
-    }
-    next_dynamic_method_entry_execution_id = saved_next_dynamic_method_entry_execution_id;
-    cursor_x = saved_cursor_x;
-    cursor_y = saved_cursor_y;
-    startup_hook_receiver_handle = saved_startup_hook_receiver_handle;
-    startup_hook_selector_id = saved_startup_hook_selector_id;
-    validate_heap_class_graph(heap_size, 0U);
-    initialize_runtime_caches();
-    if ((startup_hook_receiver_handle == 0U) != (startup_hook_selector_id == 0U)) {
-        machine_panic("snapshot startup hook is incomplete");
-    }
-        if (startup_hook_receiver_handle != 0U) {
-        if (!heap_handle_is_live(startup_hook_receiver_handle)) {
-            machine_panic("snapshot startup hook receiver is out of range");
+    machine_puts("recorz-snapshot-profile ");
+    machine_puts(SNAPSHOT_COMPATIBILITY_PROFILE);
+    machine_putc('\n');
+    if (machine_block_sector_count() != 0U) {
+        if (delta_size == 0U) {
+            store_snapshot_on_block_device(total_size);
+        }
+        machine_puts("recorz-snapshot-stored ");
+        if (delta_size != 0U) {
+            panic_put_u32(delta_size);
+            machine_puts(" delta ");
+            panic_put_u32(snapshot_chain_sequence);
+        } else {
+            panic_put_u32(total_size);
         }
-        if (startup_hook_selector_id == 0U || startup_hook_selector_id > MAX_SELECTOR_ID) {
-            machine_panic("snapshot startup hook selector is out of range");
+        machine_putc('\n');
+        if (save_mode == SNAPSHOT_SAVE_AND_CONTINUE) {
+            if (snapshot_restores_startup_hook) {
+                startup_hook_receiver_handle = snapshot_restored_startup_hook_receiver_handle;
+                startup_hook_selector_id = snapshot_restored_startup_hook_selector_id;
+                snapshot_restored_startup_hook_receiver_handle = 0U;
+                snapshot_restored_startup_hook_selector_id = 0U;
+                snapshot_restores_startup_hook = 0U;
+            }
+            machine_puts("recorz qemu-riscv32 mvp: snapshot checkpointed\n");
+            return;
         }
+        machine_puts("recorz qemu-riscv32 mvp: snapshot saved, shutting down\n");
+        machine_shutdown();
     }
-    {
-        struct recorz_mvp_value fallback_value =
-            heap_get_field(transcript_behavior_object(), TEXT_BEHAVIOR_FIELD_FALLBACK_BITMAP);
-        const struct recorz_mvp_heap_object *fallback_bitmap = heap_object_for_value(fallback_value);
+    machine_puts("recorz-snapshot-begin ");
+    panic_put_u32(total_size);
+    machine_putc('\n');
+    for (offset = 0U; offset < total_size; offset += 32U) {
+        uint32_t chunk_size = total_size - offset;
+        uint32_t chunk_index;
 
-        if (fallback_bitmap->kind != RECORZ_MVP_OBJECT_BITMAP) {
-            machine_panic("snapshot fallback bitmap is not a bitmap");
+        if (chunk_size > 32U) {
+            chunk_size = 32U;
         }
-        glyph_fallback_handle = (uint16_t)fallback_value.integer;
-    }
-    if (heap_get_field(transcript_font_object(), FONT_FIELD_METRICS).kind != RECORZ_MVP_VALUE_OBJECT ||
-        (uint16_t)heap_get_field(transcript_font_object(), FONT_FIELD_METRICS).integer != transcript_metrics_handle) {
-        machine_panic("snapshot transcript font does not point at transcript metrics");
-    }
-    if (heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR).kind != RECORZ_MVP_VALUE_OBJECT ||
-        (uint16_t)heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR).integer != transcript_behavior_handle) {
-        machine_panic("snapshot transcript font does not point at transcript behavior");
-    }
-    if (transcript_font_u32(FONT_FIELD_POINT_SIZE, "snapshot transcript font point size is not a small integer") == 0U) {
-        machine_panic("snapshot transcript font point size must be non-zero");
-    }
-    validate_transcript_font_glyphs_reference();
-    validate_transcript_text_metrics("snapshot transcript text metrics are inconsistent");
-    if (heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS).kind != RECORZ_MVP_VALUE_OBJECT ||
-        (uint16_t)heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS).integer != framebuffer_bitmap_handle) {
-        machine_panic("snapshot default form does not point at the framebuffer bitmap");
+        machine_puts("recorz-snapshot-data ");
+        for (chunk_index = 0U; chunk_index < chunk_size; ++chunk_index) {
+            emit_snapshot_hex_byte(snapshot_buffer[offset + chunk_index]);
+        }
+        machine_putc('\n');
     }
+    machine_puts("recorz-snapshot-end\n");
+    machine_puts("recorz qemu-riscv32 mvp: snapshot saved, shutting down\n");
+    machine_shutdown();
 }
 
-static void push(struct recorz_mvp_value value) {
-    if (stack_size >= STACK_LIMIT) {
-        machine_panic("bytecode stack overflow");
+static void snapshot_require(uint32_t offset, uint32_t count, uint32_t size) {
+    if (count > size - offset) {
+        machine_panic("snapshot section record is truncated");
     }
-    stack[stack_size++] = value;
 }
 
-static struct recorz_mvp_value pop_value(void) {
-    if (stack_size == 0U) {
-        machine_panic("bytecode stack underflow");
-    }
-    return stack[--stack_size];
-}
+/* Reads one NUL-terminated field into a zero-filled fixed-capacity buffer and returns the offset past it. */
+static uint32_t snapshot_read_text(const uint8_t *bytes, uint32_t size, uint32_t offset, char *text, uint32_t limit) {
+    uint32_t index;
 
-static struct recorz_mvp_value literal_value(const struct recorz_mvp_literal *literal) {
-    if (literal->kind == RECORZ_MVP_LITERAL_STRING) {
-        return string_value(literal->string);
+    for (index = 0U; index < limit; ++index) {
+        text[index] = '\0';
     }
-    if (literal->kind == RECORZ_MVP_LITERAL_SMALL_INTEGER) {
-        return small_integer_value(literal->integer);
+    for (index = 0U;; ++index) {
+        snapshot_require(offset, 1U, size);
+        if (bytes[offset] == 0U) {
+            return offset + 1U;
+        }
+        if (index + 1U >= limit) {
+            machine_panic("snapshot text field exceeds capacity");
+        }
+        text[index] = (char)bytes[offset++];
     }
-    machine_panic("unknown literal kind");
-    return nil_value();
 }
 
-typedef struct recorz_mvp_instruction (*recorz_mvp_instruction_reader)(
-    const void *instruction_source,
-    uint32_t instruction_index
-);
-
-struct recorz_mvp_executable {
+static void load_snapshot_state(const uint8_t *blob, uint32_t size) {
+    uint16_t object_count;
+    uint16_t dynamic_count;
+    uint16_t saved_package_count;
+    uint16_t saved_named_object_count;
+    uint16_t saved_live_method_source_count;
+    uint32_t saved_live_method_source_byte_count;
+    uint16_t saved_live_string_literal_count;
+    uint16_t saved_live_string_literal_byte_count;
+    uint16_t saved_mono_bitmap_count;
+    uint16_t saved_next_dynamic_method_entry_execution_id;
+    uint32_t string_byte_count;
+    uint16_t saved_cursor_x;
+    uint16_t saved_cursor_y;
+    uint16_t saved_startup_hook_receiver_handle;
+    uint16_t saved_startup_hook_selector_id;
+    uint32_t expected_size;
+    uint16_t saved_active_display_form_handle;
+    uint16_t saved_active_cursor_handle;
+    uint16_t saved_active_cursor_visible;
+    uint16_t saved_active_cursor_x;
+    uint16_t saved_active_cursor_y;
+    uint16_t saved_scheduled_process_source_count;
+    uint16_t saved_scheduled_activation_count;
+    uint16_t saved_scheduled_process_count;
+    uint16_t saved_scheduled_runnable_head;
+    uint16_t saved_compiled_method_body_word_count;
+    uint16_t saved_method_dictionary_slot_count;
+    uint32_t lengths[SNAPSHOT_SECTION_COUNT];
+    const uint8_t *section_bytes;
+    uint32_t section_size;
+    uint32_t offset;
+    uint16_t handle;
+    uint16_t dynamic_index;
+    uint16_t named_index;
+    uint16_t source_index;
+    uint16_t activation_index;
+    uint16_t process_index;
+    uint16_t value_index;
+    uint32_t row;
+
+    if (size < SNAPSHOT_PAYLOAD_OFFSET) {
+        machine_panic("snapshot is too small");
+    }
+    if (blob[0] != SNAPSHOT_MAGIC_0 || blob[1] != SNAPSHOT_MAGIC_1 ||
+        blob[2] != SNAPSHOT_MAGIC_2 || blob[3] != SNAPSHOT_MAGIC_3) {
+        machine_panic("snapshot magic mismatch");
+    }
+    if (read_u16_le(blob + 4U) != SNAPSHOT_VERSION) {
+        machine_panic(
+            "snapshot version mismatch: expected RV32MVP1 snapshot v13; "
+            "stale dev snapshot, use dev-reset or dev-restore"
+        );
+    }
+    object_count = read_u16_le(blob + 6U);
+    dynamic_count = read_u16_le(blob + 8U);
+    saved_package_count = read_u16_le(blob + 10U);
+    saved_named_object_count = read_u16_le(blob + 12U);
+    saved_mono_bitmap_count = read_u16_le(blob + 14U);
+    saved_next_dynamic_method_entry_execution_id = read_u16_le(blob + 16U);
+    string_byte_count = read_u32_le(blob + 18U);
+    saved_cursor_x = read_u16_le(blob + 22U);
+    saved_cursor_y = read_u16_le(blob + 24U);
+    saved_startup_hook_receiver_handle = read_u16_le(blob + 26U);
+    saved_startup_hook_selector_id = read_u16_le(blob + 28U);
+    saved_live_method_source_count = read_u16_le(blob + 30U);
+    saved_live_method_source_byte_count = read_u32_le(blob + 32U);
+    saved_live_string_literal_count = read_u16_le(blob + 36U);
+    saved_live_string_literal_byte_count = read_u16_le(blob + 38U);
+    saved_active_display_form_handle = read_u16_le(blob + 40U);
+    saved_active_cursor_handle = read_u16_le(blob + 42U);
+    saved_active_cursor_visible = read_u16_le(blob + 44U);
+    saved_active_cursor_x = read_u16_le(blob + 46U);
+    saved_active_cursor_y = read_u16_le(blob + 48U);
+    saved_scheduled_process_source_count = read_u16_le(blob + 50U);
+    saved_scheduled_activation_count = read_u16_le(blob + 52U);
+    saved_scheduled_process_count = read_u16_le(blob + 54U);
+    saved_scheduled_runnable_head = read_u16_le(blob + 56U);
+    saved_compiled_method_body_word_count = read_u16_le(blob + 58U);
+    expected_size = read_u32_le(blob + SNAPSHOT_TOTAL_SIZE_OFFSET);
+    saved_method_dictionary_slot_count = read_u16_le(blob + 64U);
+    if (object_count == 0U || object_count > HEAP_LIMIT) {
+        machine_panic("snapshot object count exceeds heap capacity");
+    }
+    if (dynamic_count > DYNAMIC_CLASS_LIMIT) {
+        machine_panic("snapshot dynamic class count exceeds capacity");
+    }
+    if (saved_package_count > PACKAGE_LIMIT) {
+        machine_panic("snapshot package count exceeds capacity");
+    }
+    if (saved_named_object_count > NAMED_OBJECT_LIMIT) {
+        machine_panic("snapshot named object count exceeds capacity");
+    }
+    if (saved_live_method_source_count > LIVE_METHOD_SOURCE_LIMIT) {
+        machine_panic("snapshot live method source count exceeds capacity");
+    }
+    if (saved_live_method_source_byte_count > LIVE_METHOD_SOURCE_POOL_LIMIT) {
+        machine_panic("snapshot live method source pool exceeds capacity");
+    }
+    if (saved_live_string_literal_count > LIVE_STRING_LITERAL_LIMIT) {
+        machine_panic("snapshot live string literal count exceeds capacity");
+    }
+    if (saved_mono_bitmap_count > MONO_BITMAP_LIMIT) {
+        machine_panic("snapshot mono bitmap count exceeds capacity");
+    }
+    if (saved_scheduled_process_source_count > SCHEDULED_PROCESS_SOURCE_LIMIT) {
+        machine_panic("snapshot scheduled process source count exceeds capacity");
+    }
+    if (saved_scheduled_activation_count > SCHEDULED_ACTIVATION_LIMIT) {
+        machine_panic("snapshot scheduled activation count exceeds capacity");
+    }
+    if (saved_scheduled_process_count > SCHEDULED_PROCESS_LIMIT) {
+        machine_panic("snapshot scheduled process count exceeds capacity");
+    }
+    if (saved_scheduled_runnable_head != 0xFFFFU && saved_scheduled_runnable_head >= SCHEDULED_PROCESS_LIMIT) {
+        machine_panic("snapshot scheduled runnable head is out of range");
+    }
+    if (saved_compiled_method_body_word_count > COMPILED_METHOD_BODY_WORD_LIMIT) {
+        machine_panic("snapshot compiled method bodies exceed pool capacity");
+    }
+    if (saved_method_dictionary_slot_count > METHOD_DICTIONARY_SLOT_LIMIT) {
+        machine_panic("snapshot method dictionaries exceed pool capacity");
+    }
+    if (string_byte_count > SNAPSHOT_STRING_LIMIT) {
+        machine_panic("snapshot string section exceeds capacity");
+    }
+    if (expected_size != size) {
+        machine_panic("snapshot size mismatch");
+    }
+    snapshot_validate_directory(blob, size);
+    snapshot_section_lengths(blob, lengths);
+    if (lengths[SNAPSHOT_SECTION_OBJECTS] != (uint32_t)object_count * SNAPSHOT_OBJECT_SIZE ||
+        lengths[SNAPSHOT_SECTION_ROOTS] != SNAPSHOT_ROOTS_SECTION_SIZE ||
+        lengths[SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL] != saved_live_method_source_byte_count ||
+        lengths[SNAPSHOT_SECTION_LIVE_STRING_LITERALS] !=
+            ((uint32_t)saved_live_string_literal_count * SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE) +
+                saved_live_string_literal_byte_count ||
+        lengths[SNAPSHOT_SECTION_MONO_BITMAPS] != (uint32_t)saved_mono_bitmap_count * MONO_BITMAP_MAX_HEIGHT * 4U ||
+        lengths[SNAPSHOT_SECTION_COMPILED_METHOD_BODIES] != (uint32_t)saved_compiled_method_body_word_count * 4U ||
+        lengths[SNAPSHOT_SECTION_METHOD_DICTIONARIES] != (uint32_t)saved_method_dictionary_slot_count * 2U ||
+        lengths[SNAPSHOT_SECTION_SCHEDULED_PROCESSES] !=
+            (uint32_t)saved_scheduled_process_count * SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    if (lengths[SNAPSHOT_SECTION_STRINGS] != string_byte_count) {
+        machine_panic("snapshot string section size mismatch");
+    }
+
+    reset_runtime_state();
+    snapshot_section_copy(blob, SNAPSHOT_SECTION_STRINGS, (uint8_t *)snapshot_string_pool);
+    if (string_byte_count < SNAPSHOT_STRING_LIMIT) {
+        snapshot_string_pool[string_byte_count] = '\0';
+    }
+    if (string_byte_count != 0U && snapshot_string_pool[string_byte_count - 1U] != '\0') {
+        machine_panic("snapshot string value is not terminated");
+    }
+    /* On RV32 an object record is a little-endian heap slot, so the section lands in heap[] as is
+       and only its string words need relocating; wider hosts unpack each record first. */
+    if (sizeof(struct recorz_mvp_heap_object) == SNAPSHOT_OBJECT_SIZE) {
+        snapshot_section_copy(blob, SNAPSHOT_SECTION_OBJECTS, (uint8_t *)heap);
+    } else {
+        section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_OBJECTS, snapshot_replay_buffer);
+        offset = 0U;
+        for (handle = 1U; handle <= object_count; ++handle) {
+            struct recorz_mvp_heap_object *object = &heap[handle - 1U];
+            uint8_t field_index;
+
+            object->kind = section_bytes[offset];
+            object->field_count = section_bytes[offset + 1U];
+            object->class_handle = read_u16_le(section_bytes + offset + 2U);
+            offset += 4U;
+            for (field_index = 0U; field_index < OBJECT_FIELD_LIMIT; ++field_index) {
+                object->fields[field_index].bits = read_u32_le(section_bytes + offset);
+                offset += SNAPSHOT_VALUE_SIZE;
+            }
+        }
+    }
+    heap_size = object_count;
+    heap_high_water_mark = object_count;
+    for (handle = 1U; handle <= object_count; ++handle) {
+        struct recorz_mvp_heap_object *object = heap_object(handle);
+        uint8_t field_index;
+
+        if (object->kind == 0U) {
+            if (object->field_count != 0U || object->class_handle != 0U) {
+                machine_panic("snapshot free slot has unexpected metadata");
+            }
+        } else {
+            ++heap_live_count;
+            if (object->field_count > OBJECT_FIELD_LIMIT) {
+                machine_panic("snapshot field count exceeds object field capacity");
+            }
+            if ((object->class_handle == 0U && !heap_object_is_indexable_body(object)) ||
+                object->class_handle > object_count) {
+                machine_panic("snapshot class handle is out of range");
+            }
+        }
+        for (field_index = 0U; field_index < OBJECT_FIELD_LIMIT; ++field_index) {
+            object->fields[field_index] =
+                snapshot_relocate_value((uint32_t)object->fields[field_index].bits, string_byte_count);
+        }
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_ROOTS, snapshot_replay_buffer);
+    offset = 0U;
+    for (handle = RECORZ_MVP_GLOBAL_TRANSCRIPT; handle <= MAX_GLOBAL_ID; ++handle) {
+        global_handles[handle] = read_u16_le(section_bytes + offset);
+        if (!heap_handle_is_live(global_handles[handle])) {
+            machine_panic("snapshot global handle is out of range");
+        }
+        offset += 2U;
+    }
+    default_form_handle = read_u16_le(section_bytes + offset);
+    offset += 2U;
+    framebuffer_bitmap_handle = read_u16_le(section_bytes + offset);
+    offset += 2U;
+    transcript_behavior_handle = read_u16_le(section_bytes + offset);
+    offset += 2U;
+    transcript_layout_handle = read_u16_le(section_bytes + offset);
+    offset += 2U;
+    transcript_style_handle = read_u16_le(section_bytes + offset);
+    offset += 2U;
+    transcript_metrics_handle = read_u16_le(section_bytes + offset);
+    offset += 2U;
+    transcript_font_handle = read_u16_le(section_bytes + offset);
+    offset += 2U;
+    if (!heap_handle_is_live(default_form_handle) ||
+        !heap_handle_is_live(framebuffer_bitmap_handle) ||
+        !heap_handle_is_live(transcript_behavior_handle) ||
+        !heap_handle_is_live(transcript_layout_handle) ||
+        !heap_handle_is_live(transcript_style_handle) ||
+        !heap_handle_is_live(transcript_metrics_handle) ||
+        !heap_handle_is_live(transcript_font_handle)) {
+        machine_panic("snapshot root handle is out of range");
+    }
+    if (!heap_handle_is_live(saved_active_display_form_handle)) {
+        machine_panic("snapshot active display form handle is out of range");
+    }
+    if (saved_active_cursor_handle != 0U && !heap_handle_is_live(saved_active_cursor_handle)) {
+        machine_panic("snapshot active cursor handle is out of range");
+    }
+    if (saved_active_cursor_visible > 1U) {
+        machine_panic("snapshot active cursor visibility is invalid");
+    }
+    active_display_form_handle = saved_active_display_form_handle;
+    active_cursor_handle = saved_active_cursor_handle;
+    active_cursor_visible = saved_active_cursor_handle == 0U ? 0U : (uint8_t)saved_active_cursor_visible;
+    active_cursor_screen_x = saved_active_cursor_x;
+    active_cursor_screen_y = saved_active_cursor_y;
+    for (handle = 0U; handle < 128U; ++handle) {
+        glyph_bitmap_handles[handle] = read_u16_le(section_bytes + offset);
+        if (glyph_bitmap_handles[handle] != 0U && !heap_handle_is_live(glyph_bitmap_handles[handle])) {
+            machine_panic("snapshot glyph handle is out of range");
+        }
+        offset += 2U;
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_DYNAMIC_CLASSES, snapshot_replay_buffer);
+    section_size = lengths[SNAPSHOT_SECTION_DYNAMIC_CLASSES];
+    offset = 0U;
+    dynamic_class_count = dynamic_count;
+    for (dynamic_index = 0U; dynamic_index < dynamic_class_count; ++dynamic_index) {
+        struct recorz_mvp_dynamic_class_definition *definition = &dynamic_classes[dynamic_index];
+        uint8_t ivar_index;
+
+        snapshot_require(offset, SNAPSHOT_DYNAMIC_CLASS_RECORD_PREFIX_SIZE, section_size);
+        definition->class_handle = read_u16_le(section_bytes + offset);
+        offset += 2U;
+        definition->superclass_handle = read_u16_le(section_bytes + offset);
+        offset += 2U;
+        definition->instance_variable_count = section_bytes[offset++];
+        if (!heap_handle_is_live(definition->class_handle) ||
+            !heap_handle_is_live(definition->superclass_handle)) {
+            machine_panic("snapshot dynamic class handle is out of range");
+        }
+        if (definition->instance_variable_count > DYNAMIC_CLASS_IVAR_LIMIT) {
+            machine_panic("snapshot dynamic class instance variable count is out of range");
+        }
+        offset = snapshot_read_text(section_bytes, section_size, offset, definition->class_name, METHOD_SOURCE_NAME_LIMIT);
+        offset = snapshot_read_text(section_bytes, section_size, offset, definition->package_name, METHOD_SOURCE_NAME_LIMIT);
+        offset = snapshot_read_text(section_bytes, section_size, offset, definition->class_comment, CLASS_COMMENT_LIMIT);
+        for (ivar_index = 0U; ivar_index < DYNAMIC_CLASS_IVAR_LIMIT; ++ivar_index) {
+            if (ivar_index < definition->instance_variable_count) {
+                offset = snapshot_read_text(
+                    section_bytes,
+                    section_size,
+                    offset,
+                    definition->instance_variable_names[ivar_index],
+                    METHOD_SOURCE_NAME_LIMIT
+                );
+            } else {
+                definition->instance_variable_names[ivar_index][0] = '\0';
+            }
+        }
+    }
+    if (offset != section_size) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_PACKAGES, snapshot_replay_buffer);
+    section_size = lengths[SNAPSHOT_SECTION_PACKAGES];
+    offset = 0U;
+    package_count = saved_package_count;
+    for (dynamic_index = 0U; dynamic_index < package_count; ++dynamic_index) {
+        offset = snapshot_read_text(
+            section_bytes,
+            section_size,
+            offset,
+            live_packages[dynamic_index].package_name,
+            METHOD_SOURCE_NAME_LIMIT
+        );
+        offset = snapshot_read_text(
+            section_bytes,
+            section_size,
+            offset,
+            live_packages[dynamic_index].package_comment,
+            PACKAGE_COMMENT_LIMIT
+        );
+    }
+    if (offset != section_size) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_NAMED_OBJECTS, snapshot_replay_buffer);
+    section_size = lengths[SNAPSHOT_SECTION_NAMED_OBJECTS];
+    offset = 0U;
+    named_object_count = saved_named_object_count;
+    for (named_index = 0U; named_index < named_object_count; ++named_index) {
+        snapshot_require(offset, SNAPSHOT_NAMED_OBJECT_RECORD_PREFIX_SIZE, section_size);
+        named_objects[named_index].object_handle = read_u16_le(section_bytes + offset);
+        offset += 2U;
+        if (!heap_handle_is_live(named_objects[named_index].object_handle)) {
+            machine_panic("snapshot named object handle is out of range");
+        }
+        offset = snapshot_read_text(
+            section_bytes,
+            section_size,
+            offset,
+            named_objects[named_index].name,
+            METHOD_SOURCE_NAME_LIMIT
+        );
+    }
+    if (offset != section_size) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_LIVE_METHOD_SOURCES, snapshot_replay_buffer);
+    section_size = lengths[SNAPSHOT_SECTION_LIVE_METHOD_SOURCES];
+    offset = 0U;
+    live_method_source_count = saved_live_method_source_count;
+    for (named_index = 0U; named_index < live_method_source_count; ++named_index) {
+        snapshot_require(offset, SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_PREFIX_SIZE, section_size);
+        live_method_sources[named_index].class_handle = read_u16_le(section_bytes + offset);
+        offset += 2U;
+        live_method_sources[named_index].selector_id = read_u16_le(section_bytes + offset);
+        offset += 2U;
+        live_method_sources[named_index].argument_count = section_bytes[offset++];
+        offset = snapshot_read_text(
+            section_bytes,
+            section_size,
+            offset,
+            live_method_sources[named_index].protocol_name,
+            METHOD_SOURCE_NAME_LIMIT
+        );
+        snapshot_require(offset, SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SUFFIX_SIZE, section_size);
+        live_method_sources[named_index].source_offset = read_u32_le(section_bytes + offset);
+        offset += 4U;
+        live_method_sources[named_index].source_length = read_u32_le(section_bytes + offset);
+        offset += 4U;
+        if (!heap_handle_is_live(live_method_sources[named_index].class_handle)) {
+            machine_panic("snapshot live method source class handle is out of range");
+        }
+        if (live_method_sources[named_index].source_offset + live_method_sources[named_index].source_length >=
+            saved_live_method_source_byte_count) {
+            machine_panic("snapshot live method source is out of range");
+        }
+    }
+    if (offset != section_size) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    live_method_source_pool_used = saved_live_method_source_byte_count;
+    snapshot_section_copy(blob, SNAPSHOT_SECTION_LIVE_METHOD_SOURCE_POOL, (uint8_t *)live_method_source_pool);
+    if (saved_live_method_source_byte_count < LIVE_METHOD_SOURCE_POOL_LIMIT) {
+        live_method_source_pool[saved_live_method_source_byte_count] = '\0';
+    }
+    for (named_index = 0U; named_index < live_method_source_count; ++named_index) {
+        const struct recorz_mvp_live_method_source *source_record = &live_method_sources[named_index];
+
+        if (live_method_source_pool[source_record->source_offset + source_record->source_length] != '\0') {
+            machine_panic("snapshot live method source is not terminated");
+        }
+    }
+    for (named_index = 0U; named_index < LIVE_STRING_LITERAL_LIMIT; ++named_index) {
+        live_string_literals[named_index].class_handle = 0U;
+        live_string_literals[named_index].selector_id = 0U;
+        live_string_literals[named_index].argument_count = 0U;
+        live_string_literals[named_index].text = 0;
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_LIVE_STRING_LITERALS, snapshot_replay_buffer);
+    section_size = lengths[SNAPSHOT_SECTION_LIVE_STRING_LITERALS];
+    offset = 0U;
+    for (named_index = 0U; named_index < saved_live_string_literal_count; ++named_index) {
+        uint16_t slot_id;
+        uint16_t class_handle;
+        uint16_t selector_id;
+        uint8_t argument_count;
+        uint16_t text_length_value;
+        char literal_text[METHOD_SOURCE_CHUNK_LIMIT];
+        uint32_t text_index;
+
+        snapshot_require(offset, SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE, section_size);
+        slot_id = read_u16_le(section_bytes + offset);
+        class_handle = read_u16_le(section_bytes + offset + 2U);
+        selector_id = read_u16_le(section_bytes + offset + 4U);
+        argument_count = section_bytes[offset + 6U];
+        text_length_value = read_u16_le(section_bytes + offset + 7U);
+        offset += SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE;
+        if (slot_id == 0U || slot_id > LIVE_STRING_LITERAL_LIMIT) {
+            machine_panic("snapshot live string literal slot is out of range");
+        }
+        if (!heap_handle_is_live(class_handle)) {
+            machine_panic("snapshot live string literal class handle is out of range");
+        }
+        if (text_length_value + 1U > METHOD_SOURCE_CHUNK_LIMIT) {
+            machine_panic("snapshot live string literal exceeds chunk capacity");
+        }
+        snapshot_require(offset, text_length_value + 1U, section_size);
+        for (text_index = 0U; text_index < text_length_value; ++text_index) {
+            literal_text[text_index] = (char)section_bytes[offset++];
+        }
+        literal_text[text_length_value] = '\0';
+        if (section_bytes[offset++] != 0U) {
+            machine_panic("snapshot live string literal is not terminated");
+        }
+        live_string_literals[slot_id - 1U].class_handle = class_handle;
+        live_string_literals[slot_id - 1U].selector_id = selector_id;
+        live_string_literals[slot_id - 1U].argument_count = argument_count;
+        live_string_literals[slot_id - 1U].text = runtime_string_allocate_copy(literal_text);
+    }
+    if (offset != section_size) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_MONO_BITMAPS, snapshot_replay_buffer);
+    offset = 0U;
+    mono_bitmap_count = saved_mono_bitmap_count;
+    for (handle = 0U; handle < mono_bitmap_count; ++handle) {
+        for (row = 0U; row < MONO_BITMAP_MAX_HEIGHT; ++row) {
+            mono_bitmap_pool[handle][row] = read_u32_le(section_bytes + offset);
+            offset += 4U;
+        }
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_COMPILED_METHOD_BODIES, snapshot_replay_buffer);
+    compiled_method_body_words_used = saved_compiled_method_body_word_count;
+    for (value_index = 0U; value_index < saved_compiled_method_body_word_count; ++value_index) {
+        compiled_method_body_words[value_index] = read_u32_le(section_bytes + ((uint32_t)value_index * 4U));
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_METHOD_DICTIONARIES, snapshot_replay_buffer);
+    method_dictionary_slots_used = saved_method_dictionary_slot_count;
+    for (value_index = 0U; value_index < saved_method_dictionary_slot_count; ++value_index) {
+        method_dictionary_slots[value_index] = read_u16_le(section_bytes + ((uint32_t)value_index * 2U));
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_SCHEDULED_PROCESS_SOURCES, snapshot_replay_buffer);
+    section_size = lengths[SNAPSHOT_SECTION_SCHEDULED_PROCESS_SOURCES];
+    offset = 0U;
+    for (source_index = 0U; source_index < saved_scheduled_process_source_count; ++source_index) {
+        uint16_t slot_id;
+        uint16_t source_length_value;
+        uint32_t text_offset;
+
+        snapshot_require(offset, SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_PREFIX_SIZE, section_size);
+        slot_id = read_u16_le(section_bytes + offset);
+        source_length_value = read_u16_le(section_bytes + offset + 2U);
+        if (slot_id >= SCHEDULED_PROCESS_SOURCE_LIMIT) {
+            machine_panic("snapshot scheduled process source slot is out of range");
+        }
+        if (source_length_value + 1U > SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT) {
+            machine_panic("snapshot scheduled process source length exceeds capacity");
+        }
+        text_offset = offset + SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_PREFIX_SIZE;
+        snapshot_require(text_offset, source_length_value + 1U, section_size);
+        if (section_bytes[text_offset + source_length_value] != 0U) {
+            machine_panic("snapshot scheduled process source is not terminated");
+        }
+        scheduled_process_sources[slot_id].in_use = 1U;
+        offset = snapshot_read_text(
+            section_bytes,
+            text_offset + source_length_value + 1U,
+            text_offset,
+            scheduled_process_sources[slot_id].source,
+            SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT
+        );
+    }
+    if (offset != section_size) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_SCHEDULED_ACTIVATIONS, snapshot_replay_buffer);
+    section_size = lengths[SNAPSHOT_SECTION_SCHEDULED_ACTIVATIONS];
+    offset = 0U;
+    for (activation_index = 0U; activation_index < saved_scheduled_activation_count; ++activation_index) {
+        struct recorz_mvp_scheduled_activation_record *record;
+        uint16_t slot_id;
+
+        snapshot_require(offset, SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_PREFIX_SIZE, section_size);
+        slot_id = read_u16_le(section_bytes + offset);
+        if (slot_id >= SCHEDULED_ACTIVATION_LIMIT) {
+            machine_panic("snapshot scheduled activation slot is out of range");
+        }
+        record = &scheduled_activation_records[slot_id];
+        record->in_use = 1U;
+        record->kind = section_bytes[offset + 2U];
+        record->argument_count = section_bytes[offset + 3U];
+        record->lexical_count = section_bytes[offset + 4U];
+        record->context_handle = read_u16_le(section_bytes + offset + 6U);
+        record->sender_context_handle = read_u16_le(section_bytes + offset + 8U);
+        record->compiled_method_handle = read_u16_le(section_bytes + offset + 10U);
+        record->selector_id = read_u16_le(section_bytes + offset + 12U);
+        record->source_slot = read_u16_le(section_bytes + offset + 14U);
+        record->shared_lexical_environment_index = (int16_t)read_u16_le(section_bytes + offset + 16U);
+        record->pc = read_u32_le(section_bytes + offset + 18U);
+        record->stack_size = read_u32_le(section_bytes + offset + 22U);
+        if (record->kind != RECORZ_MVP_SCHEDULED_ACTIVATION_WORKSPACE_SOURCE &&
+            record->kind != RECORZ_MVP_SCHEDULED_ACTIVATION_COMPILED_METHOD) {
+            machine_panic("snapshot scheduled activation kind is invalid");
+        }
+        if (record->argument_count > MAX_SEND_ARGS) {
+            machine_panic("snapshot scheduled activation argument count exceeds capacity");
+        }
+        if (record->lexical_count > LEXICAL_LIMIT) {
+            machine_panic("snapshot scheduled activation lexical count exceeds capacity");
+        }
+        if (record->stack_size > STACK_LIMIT) {
+            machine_panic("snapshot scheduled activation stack size exceeds capacity");
+        }
+        if (!heap_handle_is_live(record->context_handle)) {
+            machine_panic("snapshot scheduled activation context handle is out of range");
+        }
+        if (record->sender_context_handle != 0U && !heap_handle_is_live(record->sender_context_handle)) {
+            machine_panic("snapshot scheduled activation sender handle is out of range");
+        }
+        if (record->kind == RECORZ_MVP_SCHEDULED_ACTIVATION_COMPILED_METHOD &&
+            !heap_handle_is_live(record->compiled_method_handle)) {
+            machine_panic("snapshot scheduled activation compiled method handle is out of range");
+        }
+        if (record->kind == RECORZ_MVP_SCHEDULED_ACTIVATION_WORKSPACE_SOURCE &&
+            (record->source_slot >= SCHEDULED_PROCESS_SOURCE_LIMIT ||
+             !scheduled_process_sources[record->source_slot].in_use)) {
+            machine_panic("snapshot scheduled activation source slot is out of range");
+        }
+        if (record->shared_lexical_environment_index >= 0) {
+            machine_panic("snapshot scheduled activation shared lexical state is not supported");
+        }
+        offset += SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_PREFIX_SIZE;
+        snapshot_require(
+            offset,
+            snapshot_scheduled_activation_record_size(record) - SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_PREFIX_SIZE,
+            section_size
+        );
+        record->receiver = snapshot_decode_value(section_bytes + offset, string_byte_count);
+        offset += SNAPSHOT_VALUE_SIZE;
+        for (value_index = 0U; value_index < MAX_SEND_ARGS; ++value_index) {
+            record->arguments[value_index] = nil_value();
+        }
+        for (value_index = 0U; value_index < record->argument_count; ++value_index) {
+            record->arguments[value_index] = snapshot_decode_value(section_bytes + offset, string_byte_count);
+            offset += SNAPSHOT_VALUE_SIZE;
+        }
+        for (value_index = 0U; value_index < STACK_LIMIT; ++value_index) {
+            record->stack[value_index] = nil_value();
+        }
+        for (value_index = 0U; value_index < record->stack_size; ++value_index) {
+            record->stack[value_index] = snapshot_decode_value(section_bytes + offset, string_byte_count);
+            offset += SNAPSHOT_VALUE_SIZE;
+        }
+        for (value_index = 0U; value_index < LEXICAL_LIMIT; ++value_index) {
+            record->lexical[value_index] = nil_value();
+        }
+        for (value_index = 0U; value_index < record->lexical_count; ++value_index) {
+            record->lexical[value_index] = snapshot_decode_value(section_bytes + offset, string_byte_count);
+            offset += SNAPSHOT_VALUE_SIZE;
+        }
+    }
+    if (offset != section_size) {
+        machine_panic("snapshot fixed section size mismatch");
+    }
+    section_bytes = snapshot_section_payload(blob, SNAPSHOT_SECTION_SCHEDULED_PROCESSES, snapshot_replay_buffer);
+    offset = 0U;
+    for (process_index = 0U; process_index < saved_scheduled_process_count; ++process_index) {
+        struct recorz_mvp_scheduled_process_runtime *process_runtime;
+        uint16_t slot_id = read_u16_le(section_bytes + offset);
+
+        if (slot_id >= SCHEDULED_PROCESS_LIMIT) {
+            machine_panic("snapshot scheduled process slot is out of range");
+        }
+        process_runtime = &scheduled_processes[slot_id];
+        process_runtime->in_use = 1U;
+        process_runtime->state = section_bytes[offset + 2U];
+        process_runtime->process_handle = read_u16_le(section_bytes + offset + 4U);
+        process_runtime->current_context_handle = read_u16_le(section_bytes + offset + 6U);
+        process_runtime->source_slot = read_u16_le(section_bytes + offset + 8U);
+        process_runtime->next_runnable_index = read_u16_le(section_bytes + offset + 10U);
+        if (!heap_handle_is_live(process_runtime->process_handle)) {
+            machine_panic("snapshot scheduled process handle is out of range");
+        }
+        if (process_runtime->current_context_handle != 0U &&
+            !heap_handle_is_live(process_runtime->current_context_handle)) {
+            machine_panic("snapshot scheduled process context handle is out of range");
+        }
+        if (process_runtime->source_slot >= SCHEDULED_PROCESS_SOURCE_LIMIT ||
+            !scheduled_process_sources[process_runtime->source_slot].in_use) {
+            machine_panic("snapshot scheduled process source slot is out of range");
+        }
+        if (process_runtime->next_runnable_index != 0xFFFFU &&
+            process_runtime->next_runnable_index >= SCHEDULED_PROCESS_LIMIT) {
+            machine_panic("snapshot scheduled process next runnable slot is out of range");
+        }
+        offset += SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE;
+    }
+    snapshot_track_image(blob);
+    scheduled_runnable_head = saved_scheduled_runnable_head;
+    scheduled_runnable_tail = 0xFFFFU;
+    scheduled_active_process_index = -1;
+    if (scheduled_runnable_head != 0xFFFFU) {
+        uint16_t current_index = scheduled_runnable_head;
+        uint16_t traversed = 0U;
+
+        while (current_index != 0xFFFFU) {
+            if (current_index >= SCHEDULED_PROCESS_LIMIT || !scheduled_processes[current_index].in_use) {
+                machine_panic("snapshot runnable queue contains an invalid process slot");
+            }
+            scheduled_runnable_tail = current_index;
+            current_index = scheduled_processes[current_index].next_runnable_index;
+            if (++traversed > SCHEDULED_PROCESS_LIMIT) {
+                machine_panic("snapshot runnable queue contains a cycle");
+            }
+        }
+    }
+    for (process_index = 0U; process_index < SCHEDULED_PROCESS_LIMIT; ++process_index) {
+        if (scheduled_processes[process_index].in_use) {
+            scheduled_process_sync_object_fields(process_index);
+        }
+    }
+    next_dynamic_method_entry_execution_id = saved_next_dynamic_method_entry_execution_id;
+    cursor_x = saved_cursor_x;
+    cursor_y = saved_cursor_y;
+    startup_hook_receiver_handle = saved_startup_hook_receiver_handle;
+    startup_hook_selector_id = saved_startup_hook_selector_id;
+    initialize_selector_handle_cache();
+    validate_heap_class_graph(heap_size, 0U);
+    initialize_runtime_caches();
+    rebuild_live_method_programs();
+    if ((startup_hook_receiver_handle == 0U) != (startup_hook_selector_id == 0U)) {
+        machine_panic("snapshot startup hook is incomplete");
+    }
+        if (startup_hook_receiver_handle != 0U) {
+        if (!heap_handle_is_live(startup_hook_receiver_handle)) {
+            machine_panic("snapshot startup hook receiver is out of range");
+        }
+        if (startup_hook_selector_id == 0U || startup_hook_selector_id > last_selector_id()) {
+            machine_panic("snapshot startup hook selector is out of range");
+        }
+    }
+    {
+        struct recorz_mvp_value fallback_value =
+            heap_get_field(transcript_behavior_object(), TEXT_BEHAVIOR_FIELD_FALLBACK_BITMAP);
+        const struct recorz_mvp_heap_object *fallback_bitmap = heap_object_for_value(fallback_value);
+
+        if (fallback_bitmap->kind != RECORZ_MVP_OBJECT_BITMAP) {
+            machine_panic("snapshot fallback bitmap is not a bitmap");
+        }
+        glyph_fallback_handle = value_handle(fallback_value);
+    }
+    if (!value_is_object(heap_get_field(transcript_font_object(), FONT_FIELD_METRICS)) ||
+        value_handle(heap_get_field(transcript_font_object(), FONT_FIELD_METRICS)) != transcript_metrics_handle) {
+        machine_panic("snapshot transcript font does not point at transcript metrics");
+    }
+    if (!value_is_object(heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR)) ||
+        value_handle(heap_get_field(transcript_font_object(), FONT_FIELD_BEHAVIOR)) != transcript_behavior_handle) {
+        machine_panic("snapshot transcript font does not point at transcript behavior");
+    }
+    if (transcript_font_u32(FONT_FIELD_POINT_SIZE, "snapshot transcript font point size is not a small integer") == 0U) {
+        machine_panic("snapshot transcript font point size must be non-zero");
+    }
+    validate_transcript_font_glyphs_reference();
+    validate_transcript_text_metrics("snapshot transcript text metrics are inconsistent");
+    if (!value_is_object(heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS)) ||
+        value_handle(heap_get_field(heap_object(default_form_handle), FORM_FIELD_BITS)) != framebuffer_bitmap_handle) {
+        machine_panic("snapshot default form does not point at the framebuffer bitmap");
+    }
+}
+
+static void push(struct recorz_mvp_value value) {
+    if (stack_size >= STACK_LIMIT) {
+        machine_panic("bytecode stack overflow");
+    }
+    stack[stack_size++] = value;
+}
+
+static struct recorz_mvp_value pop_value(void) {
+    if (stack_size == 0U) {
+        machine_panic("bytecode stack underflow");
+    }
+    return stack[--stack_size];
+}
+
+static struct recorz_mvp_value literal_value(const struct recorz_mvp_literal *literal) {
+    if (literal->kind == RECORZ_MVP_LITERAL_STRING) {
+        return string_value(literal->string);
+    }
+    if (literal->kind == RECORZ_MVP_LITERAL_SMALL_INTEGER) {
+        return small_integer_value(literal->integer);
+    }
+    machine_panic("unknown literal kind");
+    return nil_value();
+}
+
+typedef struct recorz_mvp_instruction (*recorz_mvp_instruction_reader)(
+    const void *instruction_source,
+    uint32_t instruction_index
+);
+
+struct recorz_mvp_executable {
     const void *instruction_source;
     recorz_mvp_instruction_reader read_instruction;
     uint32_t instruction_count;
@@ -17941,8 +21401,50 @@ struct recorz_mvp_executable {
     const char (*lexical_names)[METHOD_SOURCE_NAME_LIMIT];
     const struct recorz_mvp_heap_object *block_defining_class;
     int16_t home_context_index;
+    int16_t outer_lexical_environment_index;
+    uint8_t is_block;
+    const char *failure_context_detail;
+    uint16_t send_site_base;
+    const struct recorz_mvp_instruction *instructions;
+};
+
+/* The interpreter keeps its pc here rather than publishing each instruction, so a panic
+   recovers the failing instruction from the innermost frame. */
+struct recorz_mvp_execution_frame {
+    struct recorz_mvp_execution_frame *caller;
+    const struct recorz_mvp_executable *executable;
+    const struct recorz_mvp_instruction *instructions;
+    uint32_t pc;
+};
+
+/* A compiled method or live method program sent from running bytecode gets one of these records
+   instead of a nested execute_executable call. Its receiver, arguments, lexicals and operand stack
+   live contiguously in interpreter_values starting at value_base; handles holds the context,
+   failure context and compiled method. */
+struct recorz_mvp_interpreter_activation {
+    struct recorz_mvp_executable method_executable;
+    struct recorz_mvp_execution_frame frame;
+    const struct recorz_mvp_executable *executable;
+    const struct recorz_mvp_heap_object *receiver_object;
+    struct recorz_mvp_value receiver;
+    const struct recorz_mvp_value *arguments;
+    uint16_t argument_count;
+    int16_t shared_lexical_environment_index;
+    uint32_t value_base;
+    uint32_t lexical_base;
+    uint32_t stack_base;
+    uint16_t sender_context_handle;
+    uint16_t handles[3];
+    uint8_t live_method;
+    struct recorz_mvp_gc_root_frame roots;
 };
 
+static struct recorz_mvp_interpreter_activation interpreter_activations[INTERPRETER_ACTIVATION_LIMIT];
+static uint32_t interpreter_activation_count = 0U;
+static struct recorz_mvp_value interpreter_values[INTERPRETER_VALUE_LIMIT];
+static uint32_t interpreter_entry_value_base = 0U;
+static const uint32_t *interpreter_entry_value_count = 0;
+
 static struct recorz_mvp_instruction read_program_instruction(
     const void *instruction_source,
     uint32_t instruction_index
@@ -17966,7 +21468,96 @@ static struct recorz_mvp_instruction read_compiled_method_instruction(
     const struct recorz_mvp_heap_object *compiled_method =
         (const struct recorz_mvp_heap_object *)instruction_source;
 
-    return decode_instruction_word(compiled_method_instruction_word(compiled_method, (uint8_t)instruction_index));
+    return decode_instruction_word(compiled_method_instruction_word(compiled_method, (uint16_t)instruction_index));
+}
+
+/* A fused instruction keeps its partner in the following slot, so jump targets stay valid and
+   a jump straight to the partner still runs it on its own. */
+static void quicken_decoded_instructions(struct recorz_mvp_instruction instructions[], uint16_t instruction_count) {
+    uint16_t index;
+
+    for (index = 0U; index + 1U < instruction_count; ++index) {
+        if (instructions[index].opcode == RECORZ_MVP_OP_PUSH_SMALL_INTEGER &&
+            instructions[index + 1U].opcode == RECORZ_MVP_OP_SEND) {
+            instructions[index].opcode = RECORZ_MVP_OP_PUSH_SMALL_INTEGER_SEND;
+        }
+    }
+}
+
+static void decoded_instructions_reset(void) {
+    uint32_t index;
+
+    for (index = 0U; index < HEAP_LIMIT; ++index) {
+        compiled_method_decoded_offsets[index] = 0U;
+    }
+    decoded_instructions_used = 0U;
+    decoded_instructions_exhausted = 0U;
+}
+
+/* Running frames point into the pool, so it is only recycled between top-level activations;
+   until then a method that does not fit runs from its packed words. */
+static const struct recorz_mvp_instruction *compiled_method_decoded_instructions(
+    const struct recorz_mvp_heap_object *compiled_method
+) {
+    uint16_t handle = heap_handle_for_object(compiled_method);
+    uint16_t instruction_count;
+    uint16_t index;
+    uint32_t offset;
+
+    if (compiled_method_decoded_offsets[handle - 1U] != 0U) {
+        return &decoded_instructions[compiled_method_decoded_offsets[handle - 1U] - 1U];
+    }
+    instruction_count = compiled_method_instruction_count(compiled_method);
+    if (decoded_instructions_used + instruction_count > DECODED_INSTRUCTION_LIMIT) {
+        decoded_instructions_exhausted = 1U;
+        return 0;
+    }
+    offset = decoded_instructions_used;
+    for (index = 0U; index < instruction_count; ++index) {
+        decoded_instructions[offset + index] =
+            decode_instruction_word(compiled_method_instruction_word(compiled_method, index));
+    }
+    quicken_decoded_instructions(&decoded_instructions[offset], instruction_count);
+    decoded_instructions_used += instruction_count;
+    compiled_method_decoded_offsets[handle - 1U] = (uint16_t)(offset + 1U);
+    return &decoded_instructions[offset];
+}
+
+static struct recorz_mvp_instruction execution_frame_instruction_at(
+    const struct recorz_mvp_execution_frame *frame,
+    uint32_t pc
+) {
+    if (frame->instructions != 0) {
+        return frame->instructions[pc];
+    }
+    return frame->executable->read_instruction(frame->executable->instruction_source, pc);
+}
+
+static uint8_t current_execution_instruction(uint32_t *pc, struct recorz_mvp_instruction *instruction) {
+    const struct recorz_mvp_execution_frame *frame = current_execution_frame;
+
+    if (frame == 0 || frame->pc == 0U) {
+        return 0U;
+    }
+    *pc = frame->pc - 1U;
+    *instruction = execution_frame_instruction_at(frame, *pc);
+    return 1U;
+}
+
+static struct recorz_mvp_value executable_literal_value(
+    const struct recorz_mvp_executable *executable,
+    uint16_t literal_index
+) {
+    if (executable->literals != 0) {
+        return literal_value(&executable->literals[literal_index]);
+    }
+    if (executable->read_instruction != read_compiled_method_instruction) {
+        machine_panic("executable has no literal frame");
+    }
+    return small_integer_value((int32_t)compiled_method_literal_word(
+        (const struct recorz_mvp_heap_object *)executable->instruction_source,
+        literal_index
+    ));
 }
 
 typedef void (*recorz_mvp_method_entry_handler)(
@@ -17987,17 +21578,17 @@ static void execute_entry_bitblt_fill_form_color(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[0])) {
         machine_panic("BitBlt fillForm:color: expects a form receiver argument");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(arguments[1])) {
         machine_panic("BitBlt fillForm:color: expects a small integer color");
     }
     form = heap_object_for_value(arguments[0]);
     if (primitive_kind_for_heap_object(form) != RECORZ_MVP_OBJECT_FORM) {
         machine_panic("BitBlt fillForm:color: expects a form");
     }
-    fill_form_color(form, (uint32_t)arguments[1].integer);
+    fill_form_color(form, (uint32_t)value_integer(arguments[1]));
     push(arguments[0]);
 }
 
@@ -18061,93 +21652,360 @@ static void execute_entry_bitblt_copy_bitmap_to_form_x_y_scale_color(
     push(arguments[1]);
 }
 
-static void execute_entry_bitblt_copy_bitmap_region_to_form_x_y_scale_color(
+static void execute_entry_bitblt_copy_bitmap_region_to_form_x_y_scale_color(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    const struct recorz_mvp_heap_object *source_bitmap;
+    const struct recorz_mvp_heap_object *dest_form;
+
+    (void)object;
+    (void)receiver;
+    (void)text;
+    require_bitblt_copy_operands_at(arguments, 0U, 5U, &source_bitmap, &dest_form);
+    bitblt_copy_mono_bitmap_to_form(
+        source_bitmap,
+        dest_form,
+        small_integer_u32(arguments[1], "BitBlt copy sourceX must be a non-negative small integer"),
+        small_integer_u32(arguments[2], "BitBlt copy sourceY must be a non-negative small integer"),
+        small_integer_u32(arguments[3], "BitBlt copy width must be a non-negative small integer"),
+        small_integer_u32(arguments[4], "BitBlt copy height must be a non-negative small integer"),
+        small_integer_u32(arguments[6], "BitBlt copy x must be a non-negative small integer"),
+        small_integer_u32(arguments[7], "BitBlt copy y must be a non-negative small integer"),
+        small_integer_u32(arguments[8], "BitBlt copy scale must be a non-negative small integer"),
+        small_integer_u32(arguments[9], "BitBlt copy color must be a non-negative small integer"),
+        0U,
+        RECORZ_MVP_TRANSFER_RULE_OVER
+    );
+    push(arguments[5]);
+}
+
+static void execute_entry_bitblt_draw_line_on_form_from_x_from_y_to_x_to_y_color(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    const struct recorz_mvp_heap_object *form;
+
+    (void)object;
+    (void)receiver;
+    (void)text;
+    if (!value_is_object(arguments[0])) {
+        machine_panic("BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a form");
+    }
+    form = heap_object_for_value(arguments[0]);
+    if (primitive_kind_for_heap_object(form) != RECORZ_MVP_OBJECT_FORM) {
+        machine_panic("BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a form");
+    }
+    form_draw_line_color(
+        form,
+        small_integer_i32(arguments[1], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer fromX"),
+        small_integer_i32(arguments[2], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer fromY"),
+        small_integer_i32(arguments[3], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer toX"),
+        small_integer_i32(arguments[4], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer toY"),
+        small_integer_u32(arguments[5], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a non-negative small integer color")
+    );
+    push(arguments[0]);
+}
+
+static void execute_entry_glyphs_at(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)text;
+    push(glyph_bitmap_value_for_code(small_integer_u32(arguments[0], "Glyphs at: expects a non-negative small integer")));
+}
+
+static void execute_entry_form_factory_from_bits(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)text;
+    if (!value_is_object(arguments[0])) {
+        machine_panic("Form fromBits: expects a bitmap");
+    }
+    push(allocate_form_from_bits_value(arguments[0]));
+}
+
+static void execute_entry_bitmap_factory_mono_width_height(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)text;
+    push(
+        allocate_mono_bitmap_value(
+            small_integer_u32(arguments[0], "Bitmap monoWidth:height: width must be a non-negative small integer"),
+            small_integer_u32(arguments[1], "Bitmap monoWidth:height: height must be a non-negative small integer")
+        )
+    );
+}
+
+static void execute_entry_form_clear(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)arguments;
+    (void)text;
+    form_clear(object);
+    push(receiver);
+}
+
+static void execute_entry_form_write_string(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)arguments;
+    form_write_string(object, text);
+    push(receiver);
+}
+
+static void execute_entry_form_write_styled_text(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    const struct recorz_mvp_heap_object *styled_text_object;
+    const struct recorz_mvp_heap_object *style_object;
+    struct recorz_mvp_value text_value;
+
+    (void)text;
+    if (!value_is_object(arguments[0])) {
+        machine_panic("Form writeStyledText: expects a styled text object");
+    }
+    styled_text_object = heap_object_for_value(arguments[0]);
+    if (styled_text_object->kind != RECORZ_MVP_OBJECT_STYLED_TEXT) {
+        machine_panic("Form writeStyledText: expects a styled text object");
+    }
+    text_value = heap_get_field(styled_text_object, STYLED_TEXT_FIELD_TEXT);
+    if (!value_is_string(text_value) || value_string(text_value) == 0) {
+        machine_panic("StyledText text is not a string");
+    }
+    style_object = text_style_object_for_value(
+        heap_get_field(styled_text_object, STYLED_TEXT_FIELD_STYLE),
+        "StyledText style is not a text style object"
+    );
+    {
+        const char *cursor = value_string(text_value);
+        uint32_t foreground_color = styled_text_foreground_color(style_object);
+        uint32_t background_color = styled_text_background_color(style_object);
+
+        while (*cursor != '\0') {
+            form_write_code_point_with_colors(object, (uint8_t)*cursor, foreground_color, background_color);
+            ++cursor;
+        }
+    }
+    push(receiver);
+}
+
+static void execute_entry_form_write_code_point_color(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)text;
+    if (!value_is_small_integer(arguments[0])) {
+        machine_panic("Form writeCodePoint:color: expects a small integer code point");
+    }
+    if (!value_is_small_integer(arguments[1])) {
+        machine_panic("Form writeCodePoint:color: expects a small integer color");
+    }
+    form_write_code_point_with_colors(
+        object,
+        (uint8_t)value_integer(arguments[0]),
+        (uint32_t)value_integer(arguments[1]),
+        text_background_color()
+    );
+    push(receiver);
+}
+
+static void execute_entry_text_style_with_text(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    uint16_t styled_text_handle;
+
+    (void)object;
+    (void)text;
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
+        machine_panic("TextStyle withText: expects a string");
+    }
+    (void)text_style_object_for_value(receiver, "TextStyle withText: expects a text style receiver");
+    styled_text_handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_STYLED_TEXT);
+    heap_set_field(styled_text_handle, STYLED_TEXT_FIELD_TEXT, arguments[0]);
+    heap_set_field(styled_text_handle, STYLED_TEXT_FIELD_STYLE, receiver);
+    push(object_value(styled_text_handle));
+}
+
+static void execute_entry_form_newline(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)arguments;
+    (void)text;
+    form_newline(object);
+    push(receiver);
+}
+
+static void execute_entry_form_be_display(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)arguments;
+    (void)text;
+    if (!form_can_be_display(object)) {
+        machine_panic("Form beDisplay expects a framebuffer-backed form");
+    }
+    active_display_form_handle = heap_handle_for_object(object);
+    push(receiver);
+}
+
+static void execute_entry_display_text_cursor_x(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    push(small_integer_value((int32_t)cursor_x));
+}
+
+static void execute_entry_display_text_cursor_y(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    push(small_integer_value((int32_t)cursor_y));
+}
+
+static void execute_entry_display_move_text_cursor_to_x_y(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)text;
+    cursor_x = small_integer_u32(arguments[0], "Display moveTextCursorToX:y: expects a non-negative small integer x");
+    cursor_y = small_integer_u32(arguments[1], "Display moveTextCursorToX:y: expects a non-negative small integer y");
+    push(receiver);
+}
+
+static void execute_entry_cursor_factory_from_bits_hotspot_x_hotspot_y(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    const struct recorz_mvp_heap_object *source_bitmap;
-    const struct recorz_mvp_heap_object *dest_form;
+    uint16_t cursor_handle;
 
     (void)object;
     (void)receiver;
     (void)text;
-    require_bitblt_copy_operands_at(arguments, 0U, 5U, &source_bitmap, &dest_form);
-    bitblt_copy_mono_bitmap_to_form(
-        source_bitmap,
-        dest_form,
-        small_integer_u32(arguments[1], "BitBlt copy sourceX must be a non-negative small integer"),
-        small_integer_u32(arguments[2], "BitBlt copy sourceY must be a non-negative small integer"),
-        small_integer_u32(arguments[3], "BitBlt copy width must be a non-negative small integer"),
-        small_integer_u32(arguments[4], "BitBlt copy height must be a non-negative small integer"),
-        small_integer_u32(arguments[6], "BitBlt copy x must be a non-negative small integer"),
-        small_integer_u32(arguments[7], "BitBlt copy y must be a non-negative small integer"),
-        small_integer_u32(arguments[8], "BitBlt copy scale must be a non-negative small integer"),
-        small_integer_u32(arguments[9], "BitBlt copy color must be a non-negative small integer"),
-        0U,
-        RECORZ_MVP_TRANSFER_RULE_OVER
-    );
-    push(arguments[5]);
+    if (!value_is_object(arguments[0])) {
+        machine_panic("Cursor fromBits:hotspotX:hotspotY: expects a bitmap");
+    }
+    if (!value_is_small_integer(arguments[1]) ||
+        !value_is_small_integer(arguments[2])) {
+        machine_panic("Cursor fromBits:hotspotX:hotspotY: expects small integer hotspot coordinates");
+    }
+    {
+        const struct recorz_mvp_heap_object *bitmap = heap_object_for_value(arguments[0]);
+        uint32_t storage_kind;
+
+        if (bitmap->kind != RECORZ_MVP_OBJECT_BITMAP) {
+            machine_panic("Cursor fromBits:hotspotX:hotspotY: expects a bitmap");
+        }
+        storage_kind = bitmap_storage_kind(bitmap);
+        if (storage_kind != BITMAP_STORAGE_GLYPH_MONO && storage_kind != BITMAP_STORAGE_HEAP_MONO) {
+            machine_panic("Cursor fromBits:hotspotX:hotspotY: expects a monochrome bitmap");
+        }
+    }
+    cursor_handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_CURSOR);
+    heap_set_field(cursor_handle, CURSOR_FIELD_BITS, arguments[0]);
+    heap_set_field(cursor_handle, CURSOR_FIELD_HOTSPOT_X, arguments[1]);
+    heap_set_field(cursor_handle, CURSOR_FIELD_HOTSPOT_Y, arguments[2]);
+    push(object_value(cursor_handle));
 }
 
-static void execute_entry_bitblt_draw_line_on_form_from_x_from_y_to_x_to_y_color(
+static void execute_entry_cursor_factory_current(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    const struct recorz_mvp_heap_object *form;
-
     (void)object;
     (void)receiver;
+    (void)arguments;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a form");
-    }
-    form = heap_object_for_value(arguments[0]);
-    if (primitive_kind_for_heap_object(form) != RECORZ_MVP_OBJECT_FORM) {
-        machine_panic("BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a form");
+    if (active_cursor_handle == 0U) {
+        push(nil_value());
+        return;
     }
-    form_draw_line_color(
-        form,
-        small_integer_i32(arguments[1], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer fromX"),
-        small_integer_i32(arguments[2], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer fromY"),
-        small_integer_i32(arguments[3], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer toX"),
-        small_integer_i32(arguments[4], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a small integer toY"),
-        small_integer_u32(arguments[5], "BitBlt drawLineOnForm:fromX:fromY:toX:toY:color: expects a non-negative small integer color")
-    );
-    push(arguments[0]);
+    push(object_value(active_cursor_handle));
 }
 
-static void execute_entry_glyphs_at(
+static void execute_entry_cursor_factory_show(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
     (void)object;
-    (void)receiver;
+    (void)arguments;
     (void)text;
-    push(glyph_bitmap_value_for_code(small_integer_u32(arguments[0], "Glyphs at: expects a non-negative small integer")));
+    active_cursor_set_visible(1U);
+    push(receiver);
 }
 
-static void execute_entry_form_factory_from_bits(
+static void execute_entry_cursor_factory_hide(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
     (void)object;
-    (void)receiver;
+    (void)arguments;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("Form fromBits: expects a bitmap");
-    }
-    push(allocate_form_from_bits_value(arguments[0]));
+    active_cursor_set_visible(0U);
+    push(receiver);
 }
 
-static void execute_entry_bitmap_factory_mono_width_height(
+static void execute_entry_cursor_factory_visible(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
@@ -18155,279 +22013,343 @@ static void execute_entry_bitmap_factory_mono_width_height(
 ) {
     (void)object;
     (void)receiver;
+    (void)arguments;
     (void)text;
-    push(
-        allocate_mono_bitmap_value(
-            small_integer_u32(arguments[0], "Bitmap monoWidth:height: width must be a non-negative small integer"),
-            small_integer_u32(arguments[1], "Bitmap monoWidth:height: height must be a non-negative small integer")
-        )
-    );
+    push(boolean_value(active_cursor_is_visible()));
 }
 
-static void execute_entry_form_clear(
+static void execute_entry_cursor_factory_x(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
+    (void)object;
+    (void)receiver;
     (void)arguments;
     (void)text;
-    form_clear(object);
-    push(receiver);
+    push(small_integer_value((int32_t)active_cursor_screen_x));
 }
 
-static void execute_entry_form_write_string(
+static void execute_entry_cursor_factory_y(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
+    (void)object;
+    (void)receiver;
     (void)arguments;
-    form_write_string(object, text);
-    push(receiver);
+    (void)text;
+    push(small_integer_value((int32_t)active_cursor_screen_y));
 }
 
-static void execute_entry_form_write_styled_text(
+static void execute_entry_cursor_factory_move_to_x_y(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    const struct recorz_mvp_heap_object *styled_text_object;
-    const struct recorz_mvp_heap_object *style_object;
-    struct recorz_mvp_value text_value;
-
+    (void)object;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("Form writeStyledText: expects a styled text object");
-    }
-    styled_text_object = heap_object_for_value(arguments[0]);
-    if (styled_text_object->kind != RECORZ_MVP_OBJECT_STYLED_TEXT) {
-        machine_panic("Form writeStyledText: expects a styled text object");
-    }
-    text_value = heap_get_field(styled_text_object, STYLED_TEXT_FIELD_TEXT);
-    if (text_value.kind != RECORZ_MVP_VALUE_STRING || text_value.string == 0) {
-        machine_panic("StyledText text is not a string");
-    }
-    style_object = text_style_object_for_value(
-        heap_get_field(styled_text_object, STYLED_TEXT_FIELD_STYLE),
-        "StyledText style is not a text style object"
+    active_cursor_move_to(
+        small_integer_u32(arguments[0], "Cursor moveToX:y: expects a non-negative x small integer"),
+        small_integer_u32(arguments[1], "Cursor moveToX:y: expects a non-negative y small integer")
     );
-    {
-        const char *cursor = text_value.string;
-        uint32_t foreground_color = styled_text_foreground_color(style_object);
-        uint32_t background_color = styled_text_background_color(style_object);
-
-        while (*cursor != '\0') {
-            form_write_code_point_with_colors(object, (uint8_t)*cursor, foreground_color, background_color);
-            ++cursor;
-        }
-    }
     push(receiver);
 }
 
-static void execute_entry_form_write_code_point_color(
+static void execute_entry_cursor_be_cursor(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
+    (void)arguments;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-        machine_panic("Form writeCodePoint:color: expects a small integer code point");
-    }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-        machine_panic("Form writeCodePoint:color: expects a small integer color");
-    }
-    form_write_code_point_with_colors(
-        object,
-        (uint8_t)arguments[0].integer,
-        (uint32_t)arguments[1].integer,
-        text_background_color()
-    );
+    (void)cursor_bitmap_object(object);
+    (void)cursor_hotspot_u32(object, CURSOR_FIELD_HOTSPOT_X, "Cursor hotspotX must be a non-negative small integer");
+    (void)cursor_hotspot_u32(object, CURSOR_FIELD_HOTSPOT_Y, "Cursor hotspotY must be a non-negative small integer");
+    active_cursor_handle = heap_handle_for_object(object);
     push(receiver);
 }
 
-static void execute_entry_text_style_with_text(
+static void execute_entry_character_scanner_scan(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    uint16_t styled_text_handle;
+    const struct recorz_mvp_heap_object *form;
+    const struct recorz_mvp_heap_object *style_object;
+    const char *source_text;
+    uint32_t source_length;
+    uint32_t text_index;
+    uint32_t x;
+    uint32_t y;
+    uint32_t right_margin;
+    uint32_t selection_boundary;
+    uint32_t cursor_boundary;
+    uint32_t foreground_color;
+    uint32_t background_color;
 
-    (void)object;
+    (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
-        machine_panic("TextStyle withText: expects a string");
+    if (object->kind != RECORZ_MVP_OBJECT_CHARACTER_SCANNER) {
+        machine_panic("CharacterScanner scan expects a character scanner receiver");
     }
-    (void)text_style_object_for_value(receiver, "TextStyle withText: expects a text style receiver");
-    styled_text_handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_STYLED_TEXT);
-    heap_set_field(styled_text_handle, STYLED_TEXT_FIELD_TEXT, arguments[0]);
-    heap_set_field(styled_text_handle, STYLED_TEXT_FIELD_STYLE, receiver);
-    push(object_value(styled_text_handle));
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
+        machine_panic("CharacterScanner scan expects a string");
+    }
+    if (!value_is_object(arguments[5])) {
+        machine_panic("CharacterScanner scan expects a form");
+    }
+    source_text = value_string(arguments[0]);
+    source_length = text_length(source_text);
+    text_index = small_integer_u32(arguments[1], "CharacterScanner scan index must be a positive small integer");
+    if (text_index == 0U) {
+        machine_panic("CharacterScanner scan index must be one-based");
+    }
+    x = small_integer_u32(arguments[2], "CharacterScanner scan x must be a non-negative small integer");
+    y = small_integer_u32(arguments[3], "CharacterScanner scan y must be a non-negative small integer");
+    style_object = text_style_object_for_value(arguments[4], "CharacterScanner scan expects a text style");
+    form = heap_object_for_value(arguments[5]);
+    if (form->kind != RECORZ_MVP_OBJECT_FORM) {
+        machine_panic("CharacterScanner scan expects a form");
+    }
+    right_margin = small_integer_u32(arguments[6], "CharacterScanner scan right margin must be a non-negative small integer");
+    selection_boundary = small_integer_u32(
+        arguments[7],
+        "CharacterScanner scan selectionBoundary must be a non-negative small integer"
+    );
+    cursor_boundary = small_integer_u32(
+        arguments[8],
+        "CharacterScanner scan cursorBoundary must be a non-negative small integer"
+    );
+    foreground_color = styled_text_foreground_color(style_object);
+    background_color = styled_text_background_color(style_object);
+
+    while (text_index <= source_length) {
+        uint8_t code_point = (uint8_t)source_text[text_index - 1U];
+
+        if (selection_boundary != 0U && text_index == selection_boundary) {
+            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_SELECTION, text_index, x, y);
+            push(receiver);
+            return;
+        }
+        if (cursor_boundary != 0U && text_index == cursor_boundary) {
+            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_CURSOR, text_index, x, y);
+            push(receiver);
+            return;
+        }
+        if (code_point == (uint8_t)'\t') {
+            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_TAB, text_index, x, y);
+            push(receiver);
+            return;
+        }
+        if (code_point == (uint8_t)'\n') {
+            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_NEWLINE, text_index, x, y);
+            push(receiver);
+            return;
+        }
+        if (code_point < 32U) {
+            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_CONTROL, text_index, x, y);
+            push(receiver);
+            return;
+        }
+        if (right_margin != 0U && x + char_width() > right_margin) {
+            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_RIGHT_MARGIN, text_index, x, y);
+            push(receiver);
+            return;
+        }
+        form_draw_code_point_at_with_colors(form, code_point, x, y, foreground_color, background_color);
+        x += char_width();
+        text_index += 1U;
+    }
+
+    character_scanner_set_state(object, CHARACTER_SCANNER_STOP_END_OF_RUN, text_index, x, y);
+    push(receiver);
 }
 
-static void execute_entry_form_newline(
+static void execute_entry_class_new(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
+    uint16_t instance_handle;
+    uint8_t instance_kind;
+    uint8_t field_count;
+    uint8_t field_index;
+
+    (void)receiver;
     (void)arguments;
     (void)text;
-    form_newline(object);
-    push(receiver);
+    if (object->kind != RECORZ_MVP_OBJECT_CLASS) {
+        machine_panic("Class new expects a class receiver");
+    }
+    instance_kind = (uint8_t)class_instance_kind(object);
+    if (object_kind_is_indexable(instance_kind)) {
+        push(object_value(indexable_allocate(object, instance_kind, 0U)));
+        return;
+    }
+    instance_handle = heap_allocate(instance_kind);
+    heap_set_class(instance_handle, heap_handle_for_object(object));
+    field_count = live_instance_field_count_for_class(object);
+    for (field_index = 0U; field_index < field_count; ++field_index) {
+        heap_set_field(instance_handle, field_index, nil_value());
+    }
+    push(object_value(instance_handle));
 }
 
-static void execute_entry_form_be_display(
+static void execute_entry_class_new_size(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    (void)arguments;
+    uint32_t instance_kind;
+
+    (void)receiver;
     (void)text;
-    if (!form_can_be_display(object)) {
-        machine_panic("Form beDisplay expects a framebuffer-backed form");
+    if (object->kind != RECORZ_MVP_OBJECT_CLASS) {
+        machine_panic("Class new: expects a class receiver");
     }
-    active_display_form_handle = heap_handle_for_object(object);
-    push(receiver);
+    instance_kind = class_instance_kind(object);
+    if (!object_kind_is_indexable(instance_kind)) {
+        machine_panic("Class new: expects an indexable class");
+    }
+    if (!value_is_small_integer(arguments[0]) || value_integer(arguments[0]) < 0) {
+        machine_panic("Class new: expects a non-negative small integer size");
+    }
+    push(object_value(indexable_allocate(object, (uint8_t)instance_kind, (uint32_t)value_integer(arguments[0]))));
 }
 
-static void execute_entry_display_text_cursor_x(
+static void execute_entry_array_at(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    (void)object;
     (void)receiver;
-    (void)arguments;
     (void)text;
-    push(small_integer_value((int32_t)cursor_x));
+    if (object->kind != RECORZ_MVP_OBJECT_ARRAY) {
+        machine_panic("Array at: expects an Array receiver");
+    }
+    push(indexable_at(object, arguments[0]));
 }
 
-static void execute_entry_display_text_cursor_y(
+static void execute_entry_array_at_put(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    (void)object;
     (void)receiver;
-    (void)arguments;
     (void)text;
-    push(small_integer_value((int32_t)cursor_y));
+    if (object->kind != RECORZ_MVP_OBJECT_ARRAY) {
+        machine_panic("Array at:put: expects an Array receiver");
+    }
+    indexable_at_put(object, arguments[0], arguments[1]);
+    push(arguments[1]);
 }
 
-static void execute_entry_display_move_text_cursor_to_x_y(
+static void execute_entry_byte_array_at(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    (void)object;
+    (void)receiver;
     (void)text;
-    cursor_x = small_integer_u32(arguments[0], "Display moveTextCursorToX:y: expects a non-negative small integer x");
-    cursor_y = small_integer_u32(arguments[1], "Display moveTextCursorToX:y: expects a non-negative small integer y");
-    push(receiver);
+    if (object->kind != RECORZ_MVP_OBJECT_BYTE_ARRAY) {
+        machine_panic("ByteArray at: expects a ByteArray receiver");
+    }
+    push(indexable_at(object, arguments[0]));
 }
 
-static void execute_entry_cursor_factory_from_bits_hotspot_x_hotspot_y(
+static void execute_entry_byte_array_at_put(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    uint16_t cursor_handle;
-
-    (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("Cursor fromBits:hotspotX:hotspotY: expects a bitmap");
-    }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_SMALL_INTEGER ||
-        arguments[2].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-        machine_panic("Cursor fromBits:hotspotX:hotspotY: expects small integer hotspot coordinates");
-    }
-    {
-        const struct recorz_mvp_heap_object *bitmap = heap_object_for_value(arguments[0]);
-        uint32_t storage_kind;
-
-        if (bitmap->kind != RECORZ_MVP_OBJECT_BITMAP) {
-            machine_panic("Cursor fromBits:hotspotX:hotspotY: expects a bitmap");
-        }
-        storage_kind = bitmap_storage_kind(bitmap);
-        if (storage_kind != BITMAP_STORAGE_GLYPH_MONO && storage_kind != BITMAP_STORAGE_HEAP_MONO) {
-            machine_panic("Cursor fromBits:hotspotX:hotspotY: expects a monochrome bitmap");
-        }
+    if (object->kind != RECORZ_MVP_OBJECT_BYTE_ARRAY) {
+        machine_panic("ByteArray at:put: expects a ByteArray receiver");
     }
-    cursor_handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_CURSOR);
-    heap_set_field(cursor_handle, CURSOR_FIELD_BITS, arguments[0]);
-    heap_set_field(cursor_handle, CURSOR_FIELD_HOTSPOT_X, arguments[1]);
-    heap_set_field(cursor_handle, CURSOR_FIELD_HOTSPOT_Y, arguments[2]);
-    push(object_value(cursor_handle));
+    indexable_at_put(object, arguments[0], arguments[1]);
+    push(arguments[1]);
 }
 
-static void execute_entry_cursor_factory_current(
+static void execute_entry_word_array_at(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    (void)object;
     (void)receiver;
-    (void)arguments;
     (void)text;
-    if (active_cursor_handle == 0U) {
-        push(nil_value());
-        return;
+    if (object->kind != RECORZ_MVP_OBJECT_WORD_ARRAY) {
+        machine_panic("WordArray at: expects a WordArray receiver");
     }
-    push(object_value(active_cursor_handle));
+    push(indexable_at(object, arguments[0]));
 }
 
-static void execute_entry_cursor_factory_show(
+static void execute_entry_word_array_at_put(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    (void)object;
-    (void)arguments;
+    (void)receiver;
     (void)text;
-    active_cursor_set_visible(1U);
-    push(receiver);
+    if (object->kind != RECORZ_MVP_OBJECT_WORD_ARRAY) {
+        machine_panic("WordArray at:put: expects a WordArray receiver");
+    }
+    indexable_at_put(object, arguments[0], arguments[1]);
+    push(arguments[1]);
 }
 
-static void execute_entry_cursor_factory_hide(
+static void execute_entry_large_positive_integer_print_string(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    (void)object;
+    (void)receiver;
     (void)arguments;
     (void)text;
-    active_cursor_set_visible(0U);
-    push(receiver);
+    if (object->kind != RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER) {
+        machine_panic("LargePositiveInteger printString expects a LargePositiveInteger receiver");
+    }
+    render_large_positive_integer(object);
+    push(string_value(print_buffer));
 }
 
-static void execute_entry_cursor_factory_visible(
+static void execute_entry_kernel_installer_class_named(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
+    const struct recorz_mvp_heap_object *class_object;
+
     (void)object;
     (void)receiver;
-    (void)arguments;
     (void)text;
-    push(boolean_value(active_cursor_is_visible()));
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
+        machine_panic("KernelInstaller classNamed: expects a source string");
+    }
+    class_object = lookup_class_by_name(value_string(arguments[0]));
+    if (class_object == 0) {
+        machine_panic("KernelInstaller classNamed: could not resolve class");
+    }
+    push(object_value(heap_handle_for_object(class_object)));
 }
 
-static void execute_entry_cursor_factory_x(
+static void execute_entry_kernel_installer_file_out_class_named(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
     const struct recorz_mvp_value arguments[],
@@ -18435,415 +22357,695 @@ static void execute_entry_cursor_factory_x(
 ) {
     (void)object;
     (void)receiver;
-    (void)arguments;
     (void)text;
-    push(small_integer_value((int32_t)active_cursor_screen_x));
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
+        machine_panic("KernelInstaller fileOutClassNamed: expects a class name string");
+    }
+    push(string_value(file_out_class_source_by_name(value_string(arguments[0]))));
+}
+
+static void panic_source_method_exceeds_compiled_method_capacity(void) {
+    if (compiling_method_class_handle != 0U &&
+        heap_handle_is_live(compiling_method_class_handle)) {
+        machine_puts("recorz qemu-riscv32 mvp: compile limit ");
+        machine_puts(class_name_for_object(heap_object(compiling_method_class_handle)));
+        machine_puts(">>");
+        machine_puts(selector_name(compiling_method_selector_id));
+        machine_putc('\n');
+    }
+    machine_panic("KernelInstaller source method exceeds compiled method capacity");
+}
+
+static uint8_t compile_source_operand_push(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *name,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
+) {
+    uint16_t argument_index;
+    uint16_t temporary_index;
+    uint8_t field_index;
+    uint8_t global_id;
+
+    if (*instruction_count >= COMPILED_METHOD_MAX_INSTRUCTIONS) {
+        panic_source_method_exceeds_compiled_method_capacity();
+    }
+    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
+        if (argument_names[argument_index][0] != '\0' &&
+            source_names_equal(name, argument_names[argument_index])) {
+            instruction_words[(*instruction_count)++] = encode_compiled_method_word(
+                COMPILED_METHOD_OP_PUSH_ARGUMENT,
+                (uint8_t)argument_index,
+                0U
+            );
+            return 1U;
+        }
+    }
+    for (temporary_index = 0U; temporary_index < temporary_count; ++temporary_index) {
+        if (temporary_names[temporary_index][0] != '\0' &&
+            source_names_equal(name, temporary_names[temporary_index])) {
+            instruction_words[(*instruction_count)++] = encode_compiled_method_word(
+                COMPILED_METHOD_OP_PUSH_LEXICAL,
+                0U,
+                temporary_index
+            );
+            return 1U;
+        }
+    }
+    if (class_field_index_for_name(class_object, name, &field_index)) {
+        instruction_words[(*instruction_count)++] = encode_compiled_method_word(COMPILED_METHOD_OP_PUSH_FIELD, field_index, 0U);
+        return 1U;
+    }
+    global_id = source_global_id_for_name(name);
+    if (global_id != 0U) {
+        instruction_words[(*instruction_count)++] = encode_compiled_method_word(COMPILED_METHOD_OP_PUSH_GLOBAL, global_id, 0U);
+        return 1U;
+    }
+    return 0U;
+}
+
+static uint8_t compile_source_identifier_is_global_binding(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *name,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint8_t expected_global_id
+) {
+    uint16_t argument_index;
+    uint16_t temporary_index;
+    uint8_t field_index;
+
+    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
+        if (argument_names[argument_index][0] != '\0' &&
+            source_names_equal(name, argument_names[argument_index])) {
+            return 0U;
+        }
+    }
+    for (temporary_index = 0U; temporary_index < temporary_count; ++temporary_index) {
+        if (temporary_names[temporary_index][0] != '\0' &&
+            source_names_equal(name, temporary_names[temporary_index])) {
+            return 0U;
+        }
+    }
+    if (class_field_index_for_name(class_object, name, &field_index)) {
+        return 0U;
+    }
+    return (uint8_t)(source_global_id_for_name(name) == expected_global_id);
+}
+
+static void compile_source_append_instruction(
+    uint32_t instruction_words[],
+    uint16_t *instruction_count,
+    uint8_t opcode,
+    uint16_t operand_a,
+    uint16_t operand_b
+) {
+    if (*instruction_count >= COMPILED_METHOD_MAX_INSTRUCTIONS) {
+        panic_source_method_exceeds_compiled_method_capacity();
+    }
+    instruction_words[(*instruction_count)++] = encode_compiled_method_word(opcode, operand_a, operand_b);
+}
+
+static uint16_t compile_source_literal_index(uint32_t literal_word) {
+    uint16_t literal_index;
+
+    for (literal_index = 0U; literal_index < compiling_method_literal_count; ++literal_index) {
+        if (compiling_method_literal_words[literal_index] == literal_word) {
+            return literal_index;
+        }
+    }
+    if (compiling_method_literal_count >= COMPILED_METHOD_MAX_LITERALS) {
+        machine_panic("KernelInstaller source method exceeds compiled method literal capacity");
+    }
+    compiling_method_literal_words[compiling_method_literal_count] = literal_word;
+    return compiling_method_literal_count++;
+}
+
+static void compile_source_patch_instruction(
+    uint32_t instruction_words[],
+    uint16_t instruction_count,
+    uint16_t instruction_index,
+    uint8_t opcode,
+    uint16_t operand_a,
+    uint16_t operand_b
+) {
+    if (instruction_index >= instruction_count) {
+        machine_panic("KernelInstaller source method patch is out of range");
+    }
+    instruction_words[instruction_index] = encode_compiled_method_word(opcode, operand_a, operand_b);
 }
 
-static void execute_entry_cursor_factory_y(
-    const struct recorz_mvp_heap_object *object,
-    struct recorz_mvp_value receiver,
-    const struct recorz_mvp_value arguments[],
-    const char *text
+static const char *compile_source_expression_push(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *cursor,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
+);
+static uint8_t compile_source_statement_line(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *line,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count,
+    uint8_t *produces_value
+);
+static void compile_source_return_line(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *line,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
+);
+static void compile_source_inline_block(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *source,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
+);
+static const char *compile_source_conditional_expression_push(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *cursor,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
+);
+static const char *compile_source_primary_push(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *cursor,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
+);
+
+static const char *compile_source_binary_expression_push(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *cursor,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
 ) {
-    (void)object;
-    (void)receiver;
-    (void)arguments;
-    (void)text;
-    push(small_integer_value((int32_t)active_cursor_screen_y));
-}
+    char selector_name_buffer[3];
+    const char *parsed_cursor;
+    uint16_t selector_id;
+    uint8_t special_opcode;
 
-static void execute_entry_cursor_factory_move_to_x_y(
-    const struct recorz_mvp_heap_object *object,
-    struct recorz_mvp_value receiver,
-    const struct recorz_mvp_value arguments[],
-    const char *text
-) {
-    (void)object;
-    (void)text;
-    active_cursor_move_to(
-        small_integer_u32(arguments[0], "Cursor moveToX:y: expects a non-negative x small integer"),
-        small_integer_u32(arguments[1], "Cursor moveToX:y: expects a non-negative y small integer")
+    parsed_cursor = compile_source_primary_push(
+        class_object,
+        cursor,
+        argument_names,
+        argument_count,
+        temporary_names,
+        temporary_count,
+        instruction_words,
+        instruction_count
     );
-    push(receiver);
+    if (parsed_cursor == 0) {
+        return 0;
+    }
+    cursor = source_skip_horizontal_space(parsed_cursor);
+    while (source_char_is_binary_selector(*cursor)) {
+        cursor = source_parse_binary_selector(cursor, selector_name_buffer);
+        cursor = compile_source_primary_push(
+            class_object,
+            cursor,
+            argument_names,
+            argument_count,
+            temporary_names,
+            temporary_count,
+            instruction_words,
+            instruction_count
+        );
+        if (cursor == 0) {
+            machine_panic("KernelInstaller source method binary send is missing an argument");
+        }
+        selector_id = source_selector_id_intern(selector_name_buffer);
+        special_opcode = special_send_opcode_for_selector(selector_id, 1U);
+        compile_source_append_instruction(
+            instruction_words,
+            instruction_count,
+            special_opcode != 0U ? special_opcode : COMPILED_METHOD_OP_SEND,
+            special_opcode != 0U ? 0U : selector_id,
+            special_opcode != 0U ? 0U : 1U
+        );
+        cursor = source_skip_horizontal_space(cursor);
+    }
+    return cursor;
 }
 
-static void execute_entry_cursor_be_cursor(
-    const struct recorz_mvp_heap_object *object,
-    struct recorz_mvp_value receiver,
-    const struct recorz_mvp_value arguments[],
-    const char *text
+static const char *compile_source_primary_push(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *cursor,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
 ) {
-    (void)arguments;
-    (void)text;
-    (void)cursor_bitmap_object(object);
-    (void)cursor_hotspot_u32(object, CURSOR_FIELD_HOTSPOT_X, "Cursor hotspotX must be a non-negative small integer");
-    (void)cursor_hotspot_u32(object, CURSOR_FIELD_HOTSPOT_Y, "Cursor hotspotY must be a non-negative small integer");
-    active_cursor_handle = heap_handle_for_object(object);
-    push(receiver);
-}
+    int32_t small_integer;
+    char quoted_text[METHOD_SOURCE_CHUNK_LIMIT];
+    char token[METHOD_SOURCE_NAME_LIMIT];
+    char special_selector[METHOD_SOURCE_NAME_LIMIT];
+    const char *token_cursor;
+    uint16_t selector_id;
+    uint32_t root_id;
 
-static void execute_entry_character_scanner_scan(
-    const struct recorz_mvp_heap_object *object,
-    struct recorz_mvp_value receiver,
-    const struct recorz_mvp_value arguments[],
-    const char *text
-) {
-    const struct recorz_mvp_heap_object *form;
-    const struct recorz_mvp_heap_object *style_object;
-    const char *source_text;
-    uint32_t source_length;
-    uint32_t text_index;
-    uint32_t x;
-    uint32_t y;
-    uint32_t right_margin;
-    uint32_t selection_boundary;
-    uint32_t cursor_boundary;
-    uint32_t foreground_color;
-    uint32_t background_color;
+    cursor = source_skip_horizontal_space(cursor);
+    if (*cursor == '(') {
+        ++cursor;
+        token_cursor = compile_source_expression_push(
+            class_object,
+            cursor,
+            argument_names,
+            argument_count,
+            temporary_names,
+            temporary_count,
+            instruction_words,
+            instruction_count
+        );
+        if (token_cursor == 0) {
+            machine_panic("KernelInstaller source method parenthesized expression is invalid");
+        }
+        token_cursor = source_skip_horizontal_space(token_cursor);
+        if (*token_cursor != ')') {
+            machine_panic("KernelInstaller source method parenthesized expression is missing ')'");
+        }
+        cursor = token_cursor + 1;
+    } else if (*cursor == '\'') {
+        uint16_t literal_slot;
 
-    (void)receiver;
-    (void)text;
-    if (object->kind != RECORZ_MVP_OBJECT_CHARACTER_SCANNER) {
-        machine_panic("CharacterScanner scan expects a character scanner receiver");
-    }
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
-        machine_panic("CharacterScanner scan expects a string");
-    }
-    if (arguments[5].kind != RECORZ_MVP_VALUE_OBJECT) {
-        machine_panic("CharacterScanner scan expects a form");
-    }
-    source_text = arguments[0].string;
-    source_length = text_length(source_text);
-    text_index = small_integer_u32(arguments[1], "CharacterScanner scan index must be a positive small integer");
-    if (text_index == 0U) {
-        machine_panic("CharacterScanner scan index must be one-based");
-    }
-    x = small_integer_u32(arguments[2], "CharacterScanner scan x must be a non-negative small integer");
-    y = small_integer_u32(arguments[3], "CharacterScanner scan y must be a non-negative small integer");
-    style_object = text_style_object_for_value(arguments[4], "CharacterScanner scan expects a text style");
-    form = heap_object_for_value(arguments[5]);
-    if (form->kind != RECORZ_MVP_OBJECT_FORM) {
-        machine_panic("CharacterScanner scan expects a form");
-    }
-    right_margin = small_integer_u32(arguments[6], "CharacterScanner scan right margin must be a non-negative small integer");
-    selection_boundary = small_integer_u32(
-        arguments[7],
-        "CharacterScanner scan selectionBoundary must be a non-negative small integer"
-    );
-    cursor_boundary = small_integer_u32(
-        arguments[8],
-        "CharacterScanner scan cursorBoundary must be a non-negative small integer"
-    );
-    foreground_color = styled_text_foreground_color(style_object);
-    background_color = styled_text_background_color(style_object);
+        token_cursor = source_copy_single_quoted_text(cursor, quoted_text, sizeof(quoted_text));
+        if (token_cursor == 0) {
+            machine_panic("KernelInstaller source method string literal is invalid");
+        }
+        if (compiling_method_class_handle == 0U) {
+            machine_panic("KernelInstaller source method string literal has no active method context");
+        }
+        literal_slot = remember_live_string_literal(
+            compiling_method_class_handle,
+            compiling_method_selector_id,
+            compiling_method_argument_count,
+            quoted_text
+        );
+        compile_source_append_instruction(
+            instruction_words,
+            instruction_count,
+            COMPILED_METHOD_OP_PUSH_STRING_LITERAL,
+            0U,
+            literal_slot
+        );
+        cursor = token_cursor;
+    } else {
+        token_cursor = source_parse_small_integer(cursor, &small_integer);
+        if (token_cursor != 0) {
+            if (small_integer < -32768 || small_integer > 32767) {
+                compile_source_append_instruction(
+                    instruction_words,
+                    instruction_count,
+                    COMPILED_METHOD_OP_PUSH_LITERAL,
+                    0U,
+                    compile_source_literal_index((uint32_t)small_integer)
+                );
+            } else {
+                compile_source_append_instruction(
+                    instruction_words,
+                    instruction_count,
+                    COMPILED_METHOD_OP_PUSH_SMALL_INTEGER,
+                    0U,
+                    (uint16_t)(int16_t)small_integer
+                );
+            }
+            cursor = token_cursor;
+        } else {
+            token_cursor = source_parse_identifier(cursor, token, sizeof(token));
+            if (token_cursor == 0) {
+                return 0;
+            }
+            if (compile_source_identifier_is_global_binding(
+                    class_object,
+                    token,
+                    argument_names,
+                    argument_count,
+                    temporary_names,
+                    temporary_count,
+                    RECORZ_MVP_GLOBAL_DISPLAY)) {
+                const char *selector_cursor = source_parse_identifier(
+                    source_skip_horizontal_space(token_cursor),
+                    special_selector,
+                    sizeof(special_selector)
+                );
 
-    while (text_index <= source_length) {
-        uint8_t code_point = (uint8_t)source_text[text_index - 1U];
+                if (selector_cursor != 0) {
+                    const char *after_selector = source_skip_horizontal_space(selector_cursor);
 
-        if (selection_boundary != 0U && text_index == selection_boundary) {
-            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_SELECTION, text_index, x, y);
-            push(receiver);
-            return;
-        }
-        if (cursor_boundary != 0U && text_index == cursor_boundary) {
-            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_CURSOR, text_index, x, y);
-            push(receiver);
-            return;
-        }
-        if (code_point == (uint8_t)'\t') {
-            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_TAB, text_index, x, y);
-            push(receiver);
-            return;
-        }
-        if (code_point == (uint8_t)'\n') {
-            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_NEWLINE, text_index, x, y);
-            push(receiver);
-            return;
+                    if (*after_selector != ':' &&
+                        display_source_root_id_for_selector(special_selector, &root_id)) {
+                        compile_source_append_instruction(
+                            instruction_words,
+                            instruction_count,
+                            COMPILED_METHOD_OP_PUSH_ROOT,
+                            (uint8_t)root_id,
+                            0U
+                        );
+                        cursor = after_selector;
+                        goto compile_source_primary_unary_tail;
+                    }
+                }
+            }
+            if (source_names_equal(token, "nil")) {
+                compile_source_append_instruction(
+                    instruction_words,
+                    instruction_count,
+                    COMPILED_METHOD_OP_PUSH_NIL,
+                    0U,
+                    0U
+                );
+            } else if (source_names_equal(token, "self")) {
+                compile_source_append_instruction(
+                    instruction_words,
+                    instruction_count,
+                    COMPILED_METHOD_OP_PUSH_SELF,
+                    0U,
+                    0U
+                );
+            } else if (!compile_source_operand_push(
+                    class_object,
+                    token,
+                    argument_names,
+                    argument_count,
+                    temporary_names,
+                    temporary_count,
+                    instruction_words,
+                    instruction_count)) {
+                return 0;
+            }
+            cursor = token_cursor;
         }
-        if (code_point < 32U) {
-            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_CONTROL, text_index, x, y);
-            push(receiver);
-            return;
+    }
+compile_source_primary_unary_tail:
+    cursor = source_skip_horizontal_space(cursor);
+    while (source_char_is_identifier_start(*cursor)) {
+        const char *selector_cursor = source_parse_identifier(cursor, token, sizeof(token));
+        const char *after_selector;
+
+        if (selector_cursor == 0) {
+            break;
         }
-        if (right_margin != 0U && x + char_width() > right_margin) {
-            character_scanner_set_state(object, CHARACTER_SCANNER_STOP_RIGHT_MARGIN, text_index, x, y);
-            push(receiver);
-            return;
+        after_selector = source_skip_horizontal_space(selector_cursor);
+        if (*after_selector == ':') {
+            break;
         }
-        form_draw_code_point_at_with_colors(form, code_point, x, y, foreground_color, background_color);
-        x += char_width();
-        text_index += 1U;
+        selector_id = source_selector_id_intern(token);
+        compile_source_append_instruction(
+            instruction_words,
+            instruction_count,
+            COMPILED_METHOD_OP_SEND,
+            selector_id,
+            0U
+        );
+        cursor = after_selector;
     }
-
-    character_scanner_set_state(object, CHARACTER_SCANNER_STOP_END_OF_RUN, text_index, x, y);
-    push(receiver);
+    return cursor;
 }
 
-static void execute_entry_class_new(
-    const struct recorz_mvp_heap_object *object,
-    struct recorz_mvp_value receiver,
-    const struct recorz_mvp_value arguments[],
-    const char *text
+static const char *compile_source_expression_push(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *cursor,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
 ) {
-    uint16_t instance_handle;
-    uint8_t instance_kind;
-    uint8_t field_count;
-    uint8_t field_index;
+    char selector_name_buffer[METHOD_SOURCE_NAME_LIMIT];
+    char selector_part[METHOD_SOURCE_NAME_LIMIT];
+    const char *part_cursor;
+    const char *parsed_cursor;
+    uint16_t keyword_argument_count = 0U;
+    uint32_t selector_length = 0U;
+    uint16_t selector_id;
+    uint8_t special_opcode;
 
-    (void)receiver;
-    (void)arguments;
-    (void)text;
-    if (object->kind != RECORZ_MVP_OBJECT_CLASS) {
-        machine_panic("Class new expects a class receiver");
+    parsed_cursor = compile_source_binary_expression_push(
+        class_object,
+        cursor,
+        argument_names,
+        argument_count,
+        temporary_names,
+        temporary_count,
+        instruction_words,
+        instruction_count
+    );
+    if (parsed_cursor == 0) {
+        return 0;
     }
-    instance_kind = (uint8_t)class_instance_kind(object);
-    instance_handle = heap_allocate(instance_kind);
-    heap_set_class(instance_handle, heap_handle_for_object(object));
-    field_count = live_instance_field_count_for_class(object);
-    for (field_index = 0U; field_index < field_count; ++field_index) {
-        heap_set_field(instance_handle, field_index, nil_value());
+    cursor = source_skip_horizontal_space(parsed_cursor);
+    part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
+    if (part_cursor == 0) {
+        return cursor;
     }
-    push(object_value(instance_handle));
-}
-
-static void execute_entry_kernel_installer_class_named(
-    const struct recorz_mvp_heap_object *object,
-    struct recorz_mvp_value receiver,
-    const struct recorz_mvp_value arguments[],
-    const char *text
-) {
-    const struct recorz_mvp_heap_object *class_object;
-
-    (void)object;
-    (void)receiver;
-    (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
-        machine_panic("KernelInstaller classNamed: expects a source string");
+    part_cursor = source_skip_horizontal_space(part_cursor);
+    if (*part_cursor != ':') {
+        return cursor;
     }
-    class_object = lookup_class_by_name(arguments[0].string);
-    if (class_object == 0) {
-        machine_panic("KernelInstaller classNamed: could not resolve class");
+    if (source_names_equal(selector_part, "ifTrue") || source_names_equal(selector_part, "ifFalse")) {
+        return compile_source_conditional_expression_push(
+            class_object,
+            cursor,
+            argument_names,
+            argument_count,
+            temporary_names,
+            temporary_count,
+            instruction_words,
+            instruction_count
+        );
     }
-    push(object_value(heap_handle_for_object(class_object)));
-}
-
-static void execute_entry_kernel_installer_file_out_class_named(
-    const struct recorz_mvp_heap_object *object,
-    struct recorz_mvp_value receiver,
-    const struct recorz_mvp_value arguments[],
-    const char *text
-) {
-    (void)object;
-    (void)receiver;
-    (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
-        machine_panic("KernelInstaller fileOutClassNamed: expects a class name string");
+    while (selector_part[selector_length] != '\0') {
+        selector_name_buffer[selector_length] = selector_part[selector_length];
+        ++selector_length;
     }
-    push(string_value(file_out_class_source_by_name(arguments[0].string)));
-}
+    selector_name_buffer[selector_length] = '\0';
+    do {
+        if (selector_length + 1U >= sizeof(selector_name_buffer)) {
+            machine_panic("KernelInstaller keyword selector exceeds buffer capacity");
+        }
+        selector_name_buffer[selector_length++] = ':';
+        selector_name_buffer[selector_length] = '\0';
+        cursor = compile_source_binary_expression_push(
+            class_object,
+            part_cursor + 1,
+            argument_names,
+            argument_count,
+            temporary_names,
+            temporary_count,
+            instruction_words,
+            instruction_count
+        );
+        if (cursor == 0) {
+            machine_panic("KernelInstaller source method keyword send is missing an argument");
+        }
+        ++keyword_argument_count;
+        cursor = source_skip_horizontal_space(cursor);
+        part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
+        if (part_cursor == 0) {
+            break;
+        }
+        part_cursor = source_skip_horizontal_space(part_cursor);
+        if (*part_cursor != ':') {
+            break;
+        }
+        {
+            uint32_t part_index = 0U;
 
-static void panic_source_method_exceeds_compiled_method_capacity(void) {
-    if (compiling_method_class_handle != 0U &&
-        heap_handle_is_live(compiling_method_class_handle)) {
-        machine_puts("recorz qemu-riscv32 mvp: compile limit ");
-        machine_puts(class_name_for_object(heap_object(compiling_method_class_handle)));
-        machine_puts(">>");
-        machine_puts(selector_name(compiling_method_selector_id));
-        machine_putc('\n');
-    }
-    machine_panic("KernelInstaller source method exceeds compiled method capacity");
+            while (selector_part[part_index] != '\0') {
+                if (selector_length + 1U >= sizeof(selector_name_buffer)) {
+                    machine_panic("KernelInstaller keyword selector exceeds buffer capacity");
+                }
+                selector_name_buffer[selector_length++] = selector_part[part_index++];
+            }
+            selector_name_buffer[selector_length] = '\0';
+        }
+    } while (*part_cursor == ':');
+    selector_id = source_selector_id_intern(selector_name_buffer);
+    special_opcode = special_send_opcode_for_selector(selector_id, keyword_argument_count);
+    compile_source_append_instruction(
+        instruction_words,
+        instruction_count,
+        special_opcode != 0U ? special_opcode : COMPILED_METHOD_OP_SEND,
+        special_opcode != 0U ? 0U : selector_id,
+        special_opcode != 0U ? 0U : keyword_argument_count
+    );
+    return cursor;
 }
 
-static uint8_t compile_source_operand_push(
+static void compile_source_inline_block(
     const struct recorz_mvp_heap_object *class_object,
-    const char *name,
+    const char *source,
     const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
     uint16_t argument_count,
     const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
     uint16_t temporary_count,
     uint32_t instruction_words[],
-    uint8_t *instruction_count
+    uint16_t *instruction_count
 ) {
-    uint16_t argument_index;
-    uint16_t temporary_index;
-    uint8_t field_index;
-    uint8_t global_id;
+    const char *cursor = source;
+    char statement[METHOD_SOURCE_CHUNK_LIMIT];
+    uint8_t statement_count = 0U;
+    uint8_t pending_statement_value = 0U;
 
-    if (*instruction_count >= COMPILED_METHOD_MAX_INSTRUCTIONS) {
-        panic_source_method_exceeds_compiled_method_capacity();
+    if (*source_skip_horizontal_space(source) == ':') {
+        machine_panic("KernelInstaller conditional blocks do not support block arguments yet");
     }
-    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
-        if (argument_names[argument_index][0] != '\0' &&
-            source_names_equal(name, argument_names[argument_index])) {
-            instruction_words[(*instruction_count)++] = encode_compiled_method_word(
-                COMPILED_METHOD_OP_PUSH_ARGUMENT,
-                (uint8_t)argument_index,
+    while (source_copy_next_statement(&cursor, statement, sizeof(statement)) != 0U) {
+        uint8_t produces_value = 0U;
+        const char *trimmed = source_skip_horizontal_space(statement);
+
+        if (pending_statement_value) {
+            compile_source_append_instruction(
+                instruction_words,
+                instruction_count,
+                COMPILED_METHOD_OP_POP,
+                0U,
                 0U
             );
-            return 1U;
+            pending_statement_value = 0U;
         }
-    }
-    for (temporary_index = 0U; temporary_index < temporary_count; ++temporary_index) {
-        if (temporary_names[temporary_index][0] != '\0' &&
-            source_names_equal(name, temporary_names[temporary_index])) {
-            instruction_words[(*instruction_count)++] = encode_compiled_method_word(
-                COMPILED_METHOD_OP_PUSH_LEXICAL,
-                0U,
-                temporary_index
+        if (trimmed[0] == '^') {
+            compile_source_return_line(
+                class_object,
+                statement,
+                argument_names,
+                argument_count,
+                temporary_names,
+                temporary_count,
+                instruction_words,
+                instruction_count
             );
-            return 1U;
+            if (source_copy_next_statement(&cursor, statement, sizeof(statement)) != 0U) {
+                machine_panic("KernelInstaller conditional block has unexpected trailing statements after a return");
+            }
+            return;
         }
+        if (!compile_source_statement_line(
+                class_object,
+                statement,
+                argument_names,
+                argument_count,
+                temporary_names,
+                temporary_count,
+                instruction_words,
+                instruction_count,
+                &produces_value
+            )) {
+            machine_panic("KernelInstaller conditional block statement is unsupported");
+        }
+        pending_statement_value = produces_value;
+        ++statement_count;
     }
-    if (class_field_index_for_name(class_object, name, &field_index)) {
-        instruction_words[(*instruction_count)++] = encode_compiled_method_word(COMPILED_METHOD_OP_PUSH_FIELD, field_index, 0U);
-        return 1U;
-    }
-    global_id = source_global_id_for_name(name);
-    if (global_id != 0U) {
-        instruction_words[(*instruction_count)++] = encode_compiled_method_word(COMPILED_METHOD_OP_PUSH_GLOBAL, global_id, 0U);
-        return 1U;
+    if (statement_count == 0U || !pending_statement_value) {
+        compile_source_append_instruction(
+            instruction_words,
+            instruction_count,
+            COMPILED_METHOD_OP_PUSH_NIL,
+            0U,
+            0U
+        );
     }
-    return 0U;
 }
 
-static uint8_t compile_source_identifier_is_global_binding(
+static const char *compile_source_conditional_expression_push(
     const struct recorz_mvp_heap_object *class_object,
-    const char *name,
+    const char *cursor,
     const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
     uint16_t argument_count,
     const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
     uint16_t temporary_count,
-    uint8_t expected_global_id
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
 ) {
-    uint16_t argument_index;
-    uint16_t temporary_index;
-    uint8_t field_index;
+    char first_selector[METHOD_SOURCE_NAME_LIMIT];
+    char second_selector[METHOD_SOURCE_NAME_LIMIT];
+    char first_block[METHOD_SOURCE_CHUNK_LIMIT];
+    char second_block[METHOD_SOURCE_CHUNK_LIMIT];
+    const char *part_cursor;
+    const char *after_selector;
+    const char *after_first_block;
+    const char *after_second_block;
+    uint8_t first_is_true;
+    uint16_t branch_instruction_index;
+    uint16_t jump_instruction_index;
+    uint8_t has_second_clause = 0U;
 
-    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
-        if (argument_names[argument_index][0] != '\0' &&
-            source_names_equal(name, argument_names[argument_index])) {
-            return 0U;
-        }
-    }
-    for (temporary_index = 0U; temporary_index < temporary_count; ++temporary_index) {
-        if (temporary_names[temporary_index][0] != '\0' &&
-            source_names_equal(name, temporary_names[temporary_index])) {
-            return 0U;
-        }
+    part_cursor = source_parse_identifier(cursor, first_selector, sizeof(first_selector));
+    if (part_cursor == 0) {
+        machine_panic("KernelInstaller conditional expression is missing a selector");
     }
-    if (class_field_index_for_name(class_object, name, &field_index)) {
-        return 0U;
+    after_selector = source_skip_horizontal_space(part_cursor);
+    if (*after_selector != ':') {
+        machine_panic("KernelInstaller conditional expression is missing ':'");
     }
-    return (uint8_t)(source_global_id_for_name(name) == expected_global_id);
-}
-
-static void compile_source_append_instruction(
-    uint32_t instruction_words[],
-    uint8_t *instruction_count,
-    uint8_t opcode,
-    uint16_t operand_a,
-    uint16_t operand_b
-) {
-    if (*instruction_count >= COMPILED_METHOD_MAX_INSTRUCTIONS) {
-        panic_source_method_exceeds_compiled_method_capacity();
+    after_first_block = source_copy_bracket_body(after_selector + 1, first_block, sizeof(first_block));
+    if (after_first_block == 0) {
+        machine_panic("KernelInstaller conditional expression is missing a block argument");
     }
-    instruction_words[(*instruction_count)++] = encode_compiled_method_word(opcode, operand_a, operand_b);
-}
-
-static void compile_source_patch_instruction(
-    uint32_t instruction_words[],
-    uint8_t instruction_count,
-    uint8_t instruction_index,
-    uint8_t opcode,
-    uint16_t operand_a,
-    uint16_t operand_b
-) {
-    if (instruction_index >= instruction_count) {
-        machine_panic("KernelInstaller source method patch is out of range");
+    cursor = source_skip_horizontal_space(after_first_block);
+    part_cursor = source_parse_identifier(cursor, second_selector, sizeof(second_selector));
+    if (part_cursor != 0) {
+        after_selector = source_skip_horizontal_space(part_cursor);
+        if (*after_selector == ':' &&
+            ((source_names_equal(first_selector, "ifTrue") && source_names_equal(second_selector, "ifFalse")) ||
+             (source_names_equal(first_selector, "ifFalse") && source_names_equal(second_selector, "ifTrue")))) {
+            after_second_block = source_copy_bracket_body(after_selector + 1, second_block, sizeof(second_block));
+            if (after_second_block == 0) {
+                machine_panic("KernelInstaller conditional expression is missing a matching block argument");
+            }
+            cursor = after_second_block;
+            has_second_clause = 1U;
+        }
     }
-    instruction_words[instruction_index] = encode_compiled_method_word(opcode, operand_a, operand_b);
-}
-
-static const char *compile_source_expression_push(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *cursor,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
-);
-static uint8_t compile_source_statement_line(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *line,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count,
-    uint8_t *produces_value
-);
-static void compile_source_return_line(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *line,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
-);
-static void compile_source_inline_block(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *source,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
-);
-static const char *compile_source_conditional_expression_push(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *cursor,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
-);
-static const char *compile_source_primary_push(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *cursor,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
-);
-
-static const char *compile_source_binary_expression_push(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *cursor,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
-) {
-    char selector_name_buffer[2];
-    const char *parsed_cursor;
-    uint16_t selector_id;
 
-    parsed_cursor = compile_source_primary_push(
+    first_is_true = (uint8_t)source_names_equal(first_selector, "ifTrue");
+    branch_instruction_index = *instruction_count;
+    compile_source_append_instruction(
+        instruction_words,
+        instruction_count,
+        first_is_true ? COMPILED_METHOD_OP_JUMP_IF_FALSE : COMPILED_METHOD_OP_JUMP_IF_TRUE,
+        0U,
+        0U
+    );
+    compile_source_inline_block(
         class_object,
-        cursor,
+        first_block,
         argument_names,
         argument_count,
         temporary_names,
@@ -18851,16 +23053,26 @@ static const char *compile_source_binary_expression_push(
         instruction_words,
         instruction_count
     );
-    if (parsed_cursor == 0) {
-        return 0;
-    }
-    cursor = source_skip_horizontal_space(parsed_cursor);
-    while (source_char_is_binary_selector(*cursor)) {
-        selector_name_buffer[0] = *cursor++;
-        selector_name_buffer[1] = '\0';
-        cursor = compile_source_primary_push(
+    jump_instruction_index = *instruction_count;
+    compile_source_append_instruction(
+        instruction_words,
+        instruction_count,
+        COMPILED_METHOD_OP_JUMP,
+        0U,
+        0U
+    );
+    compile_source_patch_instruction(
+        instruction_words,
+        *instruction_count,
+        branch_instruction_index,
+        first_is_true ? COMPILED_METHOD_OP_JUMP_IF_FALSE : COMPILED_METHOD_OP_JUMP_IF_TRUE,
+        0U,
+        *instruction_count
+    );
+    if (has_second_clause) {
+        compile_source_inline_block(
             class_object,
-            cursor,
+            second_block,
             argument_names,
             argument_count,
             temporary_names,
@@ -18868,47 +23080,56 @@ static const char *compile_source_binary_expression_push(
             instruction_words,
             instruction_count
         );
-        if (cursor == 0) {
-            machine_panic("KernelInstaller source method binary send is missing an argument");
-        }
-        selector_id = source_selector_id_for_name(selector_name_buffer);
-        if (selector_id == 0U) {
-            machine_panic("KernelInstaller source method uses an unknown binary selector");
-        }
+    } else {
         compile_source_append_instruction(
             instruction_words,
             instruction_count,
-            COMPILED_METHOD_OP_SEND,
-            selector_id,
-            1U
+            COMPILED_METHOD_OP_PUSH_NIL,
+            0U,
+            0U
         );
-        cursor = source_skip_horizontal_space(cursor);
     }
+    compile_source_patch_instruction(
+        instruction_words,
+        *instruction_count,
+        jump_instruction_index,
+        COMPILED_METHOD_OP_JUMP,
+        0U,
+        *instruction_count
+    );
     return cursor;
 }
 
-static const char *compile_source_primary_push(
+static uint8_t compile_source_statement_line(
     const struct recorz_mvp_heap_object *class_object,
-    const char *cursor,
+    const char *line,
     const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
     uint16_t argument_count,
     const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
     uint16_t temporary_count,
     uint32_t instruction_words[],
-    uint8_t *instruction_count
+    uint16_t *instruction_count,
+    uint8_t *produces_value
 ) {
-    int32_t small_integer;
-    char quoted_text[METHOD_SOURCE_CHUNK_LIMIT];
-    char token[METHOD_SOURCE_NAME_LIMIT];
-    char special_selector[METHOD_SOURCE_NAME_LIMIT];
-    const char *token_cursor;
-    uint16_t selector_id;
-    uint32_t root_id;
+    char receiver_name[METHOD_SOURCE_NAME_LIMIT];
+    const char *cursor = line;
 
+    *produces_value = 0U;
     cursor = source_skip_horizontal_space(cursor);
-    if (*cursor == '(') {
-        ++cursor;
-        token_cursor = compile_source_expression_push(
+    if (source_names_equal(cursor, "")) {
+        return 1U;
+    }
+    cursor = source_parse_identifier(cursor, receiver_name, sizeof(receiver_name));
+    if (cursor != 0) {
+        cursor = source_skip_horizontal_space(cursor);
+    }
+    if (cursor != 0 && cursor[0] == ':' && cursor[1] == '=') {
+        uint8_t field_index;
+        uint16_t temporary_index;
+
+        cursor += 2;
+        cursor = source_skip_horizontal_space(cursor);
+        cursor = compile_source_expression_push(
             class_object,
             cursor,
             argument_names,
@@ -18918,1698 +23139,2716 @@ static const char *compile_source_primary_push(
             instruction_words,
             instruction_count
         );
-        if (token_cursor == 0) {
-            machine_panic("KernelInstaller source method parenthesized expression is invalid");
+        if (cursor == 0) {
+            machine_panic("KernelInstaller source method assignment right-hand side is invalid");
         }
-        token_cursor = source_skip_horizontal_space(token_cursor);
-        if (*token_cursor != ')') {
-            machine_panic("KernelInstaller source method parenthesized expression is missing ')'");
+        cursor = source_skip_horizontal_space(cursor);
+        if (*cursor != '.' || cursor[1] != '\0') {
+            machine_panic("KernelInstaller source method assignment has unexpected trailing text");
+        }
+        for (temporary_index = 0U; temporary_index < temporary_count; ++temporary_index) {
+            if (temporary_names[temporary_index][0] != '\0' &&
+                source_names_equal(receiver_name, temporary_names[temporary_index])) {
+                compile_source_append_instruction(
+                    instruction_words,
+                    instruction_count,
+                    COMPILED_METHOD_OP_STORE_LEXICAL,
+                    0U,
+                    temporary_index
+                );
+                return 1U;
+            }
+        }
+        if (!class_field_index_for_name(class_object, receiver_name, &field_index)) {
+            machine_panic("KernelInstaller source method assignment target must be a temporary or an instance variable");
+        }
+        compile_source_append_instruction(
+            instruction_words,
+            instruction_count,
+            COMPILED_METHOD_OP_STORE_FIELD,
+            field_index,
+            0U
+        );
+        return 1U;
+    }
+    cursor = compile_source_expression_push(
+        class_object,
+        line,
+        argument_names,
+        argument_count,
+        temporary_names,
+        temporary_count,
+        instruction_words,
+        instruction_count
+    );
+    if (cursor == 0) {
+        machine_panic("KernelInstaller source method uses an unsupported receiver expression");
+    }
+    cursor = source_skip_horizontal_space(cursor);
+    if (*cursor != '\0' && !(*cursor == '.' && cursor[1] == '\0')) {
+        machine_panic("KernelInstaller source method statement has unexpected trailing text");
+    }
+    *produces_value = 1U;
+    return 1U;
+}
+
+static void compile_source_return_line(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *line,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t temporary_count,
+    uint32_t instruction_words[],
+    uint16_t *instruction_count
+) {
+    const char *cursor = source_skip_horizontal_space(line);
+
+    if (*cursor != '^') {
+        machine_panic("KernelInstaller source method return is invalid");
+    }
+    ++cursor;
+    cursor = source_skip_horizontal_space(cursor);
+    if (source_names_equal(cursor, "self")) {
+        if (*instruction_count >= COMPILED_METHOD_MAX_INSTRUCTIONS) {
+            panic_source_method_exceeds_compiled_method_capacity();
+        }
+        instruction_words[(*instruction_count)++] = encode_compiled_method_word(COMPILED_METHOD_OP_RETURN_RECEIVER, 0U, 0U);
+        return;
+    }
+    cursor = compile_source_expression_push(
+        class_object,
+        cursor,
+        argument_names,
+        argument_count,
+        temporary_names,
+        temporary_count,
+        instruction_words,
+        instruction_count
+    );
+    if (cursor == 0) {
+        machine_panic("KernelInstaller source method return expression is unsupported");
+    }
+    cursor = source_skip_horizontal_space(cursor);
+    if (*cursor != '\0') {
+        machine_panic("KernelInstaller source method return has unexpected trailing text");
+    }
+    compile_source_append_instruction(
+        instruction_words,
+        instruction_count,
+        COMPILED_METHOD_OP_RETURN_TOP,
+        0U,
+        0U
+    );
+}
+
+static void compile_source_parse_temporary_declarations(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *line,
+    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t argument_count,
+    char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t *temporary_count
+) {
+    const char *cursor = source_skip_horizontal_space(line);
+
+    if (*cursor != '|') {
+        machine_panic("KernelInstaller source temporary declaration is invalid");
+    }
+    ++cursor;
+    cursor = source_skip_horizontal_space(cursor);
+    *temporary_count = 0U;
+    while (*cursor != '\0') {
+        uint16_t existing_index;
+        uint8_t field_index;
+
+        if (*cursor == '|') {
+            ++cursor;
+            cursor = source_skip_horizontal_space(cursor);
+            if (*cursor != '\0') {
+                machine_panic("KernelInstaller source temporary declaration has unexpected trailing text");
+            }
+            return;
+        }
+        if (*temporary_count >= LEXICAL_LIMIT) {
+            machine_panic("KernelInstaller source method has too many temporaries");
+        }
+        cursor = source_parse_identifier(
+            cursor,
+            temporary_names[*temporary_count],
+            sizeof(temporary_names[*temporary_count])
+        );
+        if (cursor == 0) {
+            machine_panic("KernelInstaller source temporary declaration is invalid");
+        }
+        for (existing_index = 0U; existing_index < argument_count; ++existing_index) {
+            if (source_names_equal(temporary_names[*temporary_count], argument_names[existing_index])) {
+                machine_panic("KernelInstaller source temporary repeats an argument name");
+            }
+        }
+        for (existing_index = 0U; existing_index < *temporary_count; ++existing_index) {
+            if (source_names_equal(temporary_names[*temporary_count], temporary_names[existing_index])) {
+                machine_panic("KernelInstaller source temporary declaration repeats a temporary");
+            }
+        }
+        if (class_field_index_for_name(class_object, temporary_names[*temporary_count], &field_index)) {
+            machine_panic("KernelInstaller source temporary repeats an instance variable name");
+        }
+        ++(*temporary_count);
+        cursor = source_skip_horizontal_space(cursor);
+    }
+    machine_panic("KernelInstaller source temporary declaration is missing '|'");
+}
+
+static uint8_t compile_source_instruction_is_jump(uint8_t opcode) {
+    return (uint8_t)(
+        opcode == COMPILED_METHOD_OP_JUMP ||
+        opcode == COMPILED_METHOD_OP_JUMP_IF_TRUE ||
+        opcode == COMPILED_METHOD_OP_JUMP_IF_FALSE
+    );
+}
+
+static void compile_source_fuse_instructions(uint32_t instruction_words[], uint16_t *instruction_count) {
+    uint8_t jump_target[COMPILED_METHOD_MAX_INSTRUCTIONS + 1U];
+    uint16_t fused_index[COMPILED_METHOD_MAX_INSTRUCTIONS + 1U];
+    uint16_t read_index;
+    uint16_t write_index = 0U;
+
+    for (read_index = 0U; read_index <= *instruction_count; ++read_index) {
+        jump_target[read_index] = 0U;
+    }
+    for (read_index = 0U; read_index < *instruction_count; ++read_index) {
+        uint32_t instruction = instruction_words[read_index];
+        uint8_t opcode = compiled_method_instruction_opcode(instruction);
+        uint16_t target_pc = compiled_method_instruction_operand_b(opcode, instruction);
+
+        if (compile_source_instruction_is_jump(opcode) && target_pc <= *instruction_count) {
+            jump_target[target_pc] = 1U;
+        }
+    }
+    read_index = 0U;
+    while (read_index < *instruction_count) {
+        uint32_t instruction = instruction_words[read_index];
+        uint8_t opcode = compiled_method_instruction_opcode(instruction);
+        uint16_t operand_a = compiled_method_instruction_operand_a(opcode, instruction);
+
+        fused_index[read_index] = write_index;
+        if (read_index + 1U < *instruction_count && !jump_target[read_index + 1U]) {
+            uint32_t next_instruction = instruction_words[read_index + 1U];
+            uint8_t next_opcode = compiled_method_instruction_opcode(next_instruction);
+            uint16_t next_operand_a = compiled_method_instruction_operand_a(next_opcode, next_instruction);
+            uint16_t next_operand_b = compiled_method_instruction_operand_b(next_opcode, next_instruction);
+            uint32_t fused_word = 0U;
+
+            if (opcode == COMPILED_METHOD_OP_PUSH_FIELD && next_opcode == COMPILED_METHOD_OP_RETURN_TOP) {
+                fused_word = encode_compiled_method_word(COMPILED_METHOD_OP_RETURN_FIELD, operand_a, 0U);
+            } else if (opcode == COMPILED_METHOD_OP_PUSH_ARGUMENT && next_opcode == COMPILED_METHOD_OP_STORE_FIELD) {
+                fused_word = encode_compiled_method_word(COMPILED_METHOD_OP_STORE_FIELD_FROM_ARGUMENT, next_operand_a, operand_a);
+            } else if (opcode == COMPILED_METHOD_OP_PUSH_ARGUMENT && next_opcode == COMPILED_METHOD_OP_STORE_LEXICAL) {
+                fused_word = encode_compiled_method_word(COMPILED_METHOD_OP_STORE_LEXICAL_FROM_ARGUMENT, operand_a, next_operand_b);
+            }
+            if (fused_word != 0U) {
+                fused_index[read_index + 1U] = write_index;
+                instruction_words[write_index++] = fused_word;
+                read_index += 2U;
+                continue;
+            }
         }
-        cursor = token_cursor + 1;
-    } else if (*cursor == '\'') {
-        uint16_t literal_slot;
+        instruction_words[write_index++] = instruction;
+        ++read_index;
+    }
+    fused_index[*instruction_count] = write_index;
+    for (read_index = 0U; read_index < write_index; ++read_index) {
+        uint32_t instruction = instruction_words[read_index];
+        uint8_t opcode = compiled_method_instruction_opcode(instruction);
 
-        token_cursor = source_copy_single_quoted_text(cursor, quoted_text, sizeof(quoted_text));
-        if (token_cursor == 0) {
-            machine_panic("KernelInstaller source method string literal is invalid");
+        if (compile_source_instruction_is_jump(opcode)) {
+            instruction_words[read_index] = encode_compiled_method_word(
+                opcode,
+                compiled_method_instruction_operand_a(opcode, instruction),
+                fused_index[compiled_method_instruction_operand_b(opcode, instruction)]
+            );
         }
-        if (compiling_method_class_handle == 0U) {
-            machine_panic("KernelInstaller source method string literal has no active method context");
+    }
+    *instruction_count = write_index;
+}
+
+static uint16_t compile_source_method_and_allocate(
+    const struct recorz_mvp_heap_object *class_object,
+    const char *source,
+    uint16_t *selector_id_out,
+    uint16_t *argument_count_out
+) {
+    char header_line[METHOD_SOURCE_LINE_LIMIT];
+    char statement_line[METHOD_SOURCE_LINE_LIMIT];
+    char trailing_line[METHOD_SOURCE_LINE_LIMIT];
+    char selector_name_buffer[METHOD_SOURCE_NAME_LIMIT];
+    char selector_part_buffer[METHOD_SOURCE_NAME_LIMIT];
+    char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
+    char temporary_names[LEXICAL_LIMIT][METHOD_SOURCE_NAME_LIMIT];
+    const char *cursor = source;
+    const char *header_cursor;
+    uint16_t instruction_count = 0U;
+    uint16_t selector_id;
+    uint16_t argument_count = 0U;
+    uint16_t temporary_count = 0U;
+    uint8_t found_return = 0U;
+    uint8_t pending_statement_value = 0U;
+    uint32_t selector_length = 0U;
+    uint32_t part_length = 0U;
+    uint8_t have_pending_line = 0U;
+
+    if (source == 0 || *source == '\0') {
+        machine_panic("KernelInstaller source method string is empty");
+    }
+    if (source_text_requires_live_evaluator(source)) {
+        const char *body_cursor;
+
+        if (source_parse_method_header(
+                source,
+                selector_name_buffer,
+                argument_names,
+                &argument_count,
+                &body_cursor) == 0) {
+            machine_panic("KernelInstaller source method header is invalid");
         }
-        literal_slot = remember_live_string_literal(
-            compiling_method_class_handle,
-            compiling_method_selector_id,
-            compiling_method_argument_count,
-            quoted_text
-        );
-        compile_source_append_instruction(
-            instruction_words,
-            instruction_count,
-            COMPILED_METHOD_OP_PUSH_STRING_LITERAL,
-            0U,
-            literal_slot
-        );
-        cursor = token_cursor;
-    } else {
-        token_cursor = source_parse_small_integer(cursor, &small_integer);
-        if (token_cursor != 0) {
-            if (small_integer < -32768 || small_integer > 32767) {
-                machine_panic("KernelInstaller source method small integer literal is out of range");
+        (void)body_cursor;
+        selector_id = source_selector_id_intern(selector_name_buffer);
+        *selector_id_out = selector_id;
+        *argument_count_out = argument_count;
+        forget_live_string_literals(heap_handle_for_object(class_object), selector_id, (uint8_t)argument_count);
+        return allocate_placeholder_live_source_compiled_method();
+    }
+    for (argument_count = 0U; argument_count < MAX_SEND_ARGS; ++argument_count) {
+        argument_names[argument_count][0] = '\0';
+    }
+    for (temporary_count = 0U; temporary_count < LEXICAL_LIMIT; ++temporary_count) {
+        temporary_names[temporary_count][0] = '\0';
+    }
+    argument_count = 0U;
+    temporary_count = 0U;
+    if (source_copy_trimmed_line(&cursor, header_line, sizeof(header_line)) == 0U) {
+        machine_panic("KernelInstaller source method is missing a header");
+    }
+    header_cursor = source_parse_identifier(header_line, selector_name_buffer, sizeof(selector_name_buffer));
+    if (header_cursor == 0) {
+        machine_panic("KernelInstaller source method header is invalid");
+    }
+    header_cursor = source_skip_horizontal_space(header_cursor);
+    while (selector_name_buffer[selector_length] != '\0') {
+        ++selector_length;
+    }
+    if (*header_cursor == ':') {
+        while (*header_cursor == ':') {
+            if (argument_count >= MAX_SEND_ARGS) {
+                machine_panic("KernelInstaller source method has too many arguments");
             }
-            compile_source_append_instruction(
-                instruction_words,
-                instruction_count,
-                COMPILED_METHOD_OP_PUSH_SMALL_INTEGER,
-                0U,
-                (uint16_t)(int16_t)small_integer
+            if (selector_length + 1U >= sizeof(selector_name_buffer)) {
+                machine_panic("KernelInstaller source method selector exceeds buffer capacity");
+            }
+            selector_name_buffer[selector_length++] = ':';
+            selector_name_buffer[selector_length] = '\0';
+            ++header_cursor;
+            header_cursor = source_skip_horizontal_space(header_cursor);
+            header_cursor = source_parse_identifier(
+                header_cursor,
+                argument_names[argument_count],
+                sizeof(argument_names[argument_count])
             );
-            cursor = token_cursor;
-        } else {
-            token_cursor = source_parse_identifier(cursor, token, sizeof(token));
-            if (token_cursor == 0) {
-                return 0;
+            if (header_cursor == 0) {
+                machine_panic("KernelInstaller source method keyword header is missing an argument name");
             }
-            if (compile_source_identifier_is_global_binding(
-                    class_object,
-                    token,
-                    argument_names,
-                    argument_count,
-                    temporary_names,
-                    temporary_count,
-                    RECORZ_MVP_GLOBAL_DISPLAY)) {
-                const char *selector_cursor = source_parse_identifier(
-                    source_skip_horizontal_space(token_cursor),
-                    special_selector,
-                    sizeof(special_selector)
-                );
-
-                if (selector_cursor != 0) {
-                    const char *after_selector = source_skip_horizontal_space(selector_cursor);
-
-                    if (*after_selector != ':' &&
-                        display_source_root_id_for_selector(special_selector, &root_id)) {
-                        compile_source_append_instruction(
-                            instruction_words,
-                            instruction_count,
-                            COMPILED_METHOD_OP_PUSH_ROOT,
-                            (uint8_t)root_id,
-                            0U
-                        );
-                        cursor = after_selector;
-                        goto compile_source_primary_unary_tail;
-                    }
+            ++argument_count;
+            header_cursor = source_skip_horizontal_space(header_cursor);
+            if (*header_cursor == '\0') {
+                break;
+            }
+            header_cursor = source_parse_identifier(header_cursor, selector_part_buffer, sizeof(selector_part_buffer));
+            if (header_cursor == 0) {
+                machine_panic("KernelInstaller source method header has unexpected trailing text");
+            }
+            part_length = 0U;
+            while (selector_part_buffer[part_length] != '\0') {
+                if (selector_length + 1U >= sizeof(selector_name_buffer)) {
+                    machine_panic("KernelInstaller source method selector exceeds buffer capacity");
                 }
+                selector_name_buffer[selector_length++] = selector_part_buffer[part_length++];
             }
-            if (source_names_equal(token, "nil")) {
-                compile_source_append_instruction(
-                    instruction_words,
-                    instruction_count,
-                    COMPILED_METHOD_OP_PUSH_NIL,
-                    0U,
-                    0U
-                );
-            } else if (source_names_equal(token, "self")) {
+            selector_name_buffer[selector_length] = '\0';
+            header_cursor = source_skip_horizontal_space(header_cursor);
+        }
+        if (*header_cursor != '\0') {
+            machine_panic("KernelInstaller source method header has unexpected trailing text");
+        }
+    } else if (*header_cursor != '\0') {
+        machine_panic("KernelInstaller source method header has unexpected trailing text");
+    }
+    selector_id = source_selector_id_intern(selector_name_buffer);
+    forget_live_string_literals(heap_handle_for_object(class_object), selector_id, (uint8_t)argument_count);
+    compiling_method_class_handle = heap_handle_for_object(class_object);
+    compiling_method_selector_id = selector_id;
+    compiling_method_argument_count = (uint8_t)argument_count;
+    compiling_method_literal_count = 0U;
+    if (source_copy_trimmed_line(&cursor, statement_line, sizeof(statement_line)) != 0U) {
+        const char *trimmed_line = source_skip_horizontal_space(statement_line);
+
+        if (trimmed_line[0] == '|') {
+            compile_source_parse_temporary_declarations(
+                class_object,
+                statement_line,
+                argument_names,
+                argument_count,
+                temporary_names,
+                &temporary_count
+            );
+        } else {
+            have_pending_line = 1U;
+        }
+    }
+    while (have_pending_line || source_copy_trimmed_line(&cursor, statement_line, sizeof(statement_line)) != 0U) {
+        uint8_t produces_value = 0U;
+        const char *trimmed_line = source_skip_horizontal_space(statement_line);
+
+        have_pending_line = 0U;
+
+        if (pending_statement_value) {
+            const char *return_cursor = source_skip_horizontal_space(trimmed_line + 1);
+
+            if (!(trimmed_line[0] == '^' && source_names_equal(return_cursor, "self"))) {
                 compile_source_append_instruction(
-                    instruction_words,
-                    instruction_count,
-                    COMPILED_METHOD_OP_PUSH_SELF,
+                    compiling_method_instruction_words,
+                    &instruction_count,
+                    COMPILED_METHOD_OP_POP,
                     0U,
                     0U
                 );
-            } else if (!compile_source_operand_push(
-                    class_object,
-                    token,
-                    argument_names,
-                    argument_count,
-                    temporary_names,
-                    temporary_count,
-                    instruction_words,
-                    instruction_count)) {
-                return 0;
             }
-            cursor = token_cursor;
+            pending_statement_value = 0U;
         }
-    }
-compile_source_primary_unary_tail:
-    cursor = source_skip_horizontal_space(cursor);
-    while (source_char_is_identifier_start(*cursor)) {
-        const char *selector_cursor = source_parse_identifier(cursor, token, sizeof(token));
-        const char *after_selector;
 
-        if (selector_cursor == 0) {
-            break;
-        }
-        after_selector = source_skip_horizontal_space(selector_cursor);
-        if (*after_selector == ':') {
+        if (trimmed_line[0] == '^') {
+            compile_source_return_line(
+                class_object,
+                statement_line,
+                argument_names,
+                argument_count,
+                temporary_names,
+                temporary_count,
+                compiling_method_instruction_words,
+                &instruction_count
+            );
+            found_return = 1U;
             break;
         }
-        selector_id = source_selector_id_for_name(token);
-        if (selector_id == 0U) {
-            machine_panic("KernelInstaller source method uses an unknown unary selector");
+        if (!compile_source_statement_line(
+                class_object,
+                statement_line,
+                argument_names,
+                argument_count,
+                temporary_names,
+                temporary_count,
+                compiling_method_instruction_words,
+                &instruction_count,
+                &produces_value
+            )) {
+            machine_panic("KernelInstaller source method statement is unsupported");
         }
-        compile_source_append_instruction(
-            instruction_words,
-            instruction_count,
-            COMPILED_METHOD_OP_SEND,
-            selector_id,
-            0U
-        );
-        cursor = after_selector;
+        pending_statement_value = produces_value;
     }
-    return cursor;
+    if (!found_return) {
+        machine_panic("KernelInstaller source method is missing a return");
+    }
+    if (source_copy_trimmed_line(&cursor, trailing_line, sizeof(trailing_line)) != 0U) {
+        machine_panic("KernelInstaller source method has unexpected trailing lines");
+    }
+    compiling_method_class_handle = 0U;
+    compiling_method_selector_id = 0U;
+    compiling_method_argument_count = 0U;
+    *selector_id_out = selector_id;
+    *argument_count_out = argument_count;
+    compile_source_fuse_instructions(compiling_method_instruction_words, &instruction_count);
+    return allocate_compiled_method_from_words(
+        compiling_method_instruction_words,
+        instruction_count,
+        compiling_method_literal_words,
+        compiling_method_literal_count
+    );
 }
 
-static const char *compile_source_expression_push(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *cursor,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
-) {
-    char selector_name_buffer[METHOD_SOURCE_NAME_LIMIT];
-    char selector_part[METHOD_SOURCE_NAME_LIMIT];
-    const char *part_cursor;
-    const char *parsed_cursor;
-    uint16_t keyword_argument_count = 0U;
-    uint32_t selector_length = 0U;
-    uint16_t selector_id;
+static uint8_t source_environment_has_local_binding(int16_t lexical_environment_index, const char *name) {
+    uint16_t name_id = source_binding_name_id(name);
 
-    parsed_cursor = compile_source_binary_expression_push(
-        class_object,
-        cursor,
-        argument_names,
-        argument_count,
-        temporary_names,
-        temporary_count,
-        instruction_words,
-        instruction_count
+    return (uint8_t)(
+        name_id != 0U &&
+        source_environment_binding_index(source_lexical_environment_at(lexical_environment_index), name_id) >= 0
     );
-    if (parsed_cursor == 0) {
-        return 0;
+}
+
+static struct recorz_mvp_value source_read_identifier(
+    struct recorz_mvp_source_method_context *context,
+    const char *name
+) {
+    struct recorz_mvp_value *binding_cell;
+    uint8_t field_index;
+    uint8_t global_id;
+
+    if (source_names_equal(name, "self")) {
+        return context->receiver;
     }
-    cursor = source_skip_horizontal_space(parsed_cursor);
-    part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
-    if (part_cursor == 0) {
-        return cursor;
+    if (source_names_equal(name, "nil")) {
+        return nil_value();
     }
-    part_cursor = source_skip_horizontal_space(part_cursor);
-    if (*part_cursor != ':') {
-        return cursor;
+    if (source_names_equal(name, "true")) {
+        return global_value(RECORZ_MVP_GLOBAL_TRUE);
     }
-    if (source_names_equal(selector_part, "ifTrue") || source_names_equal(selector_part, "ifFalse")) {
-        return compile_source_conditional_expression_push(
-            class_object,
-            cursor,
-            argument_names,
-            argument_count,
-            temporary_names,
-            temporary_count,
-            instruction_words,
-            instruction_count
-        );
+    if (source_names_equal(name, "false")) {
+        return global_value(RECORZ_MVP_GLOBAL_FALSE);
     }
-    while (selector_part[selector_length] != '\0') {
-        selector_name_buffer[selector_length] = selector_part[selector_length];
-        ++selector_length;
+    if (source_names_equal(name, "thisContext")) {
+        if (context->current_context_handle == 0U) {
+            machine_panic("live source thisContext has no active context object");
+        }
+        return object_value(context_handle_reify(context->current_context_handle));
     }
-    selector_name_buffer[selector_length] = '\0';
-    do {
-        if (selector_length + 1U >= sizeof(selector_name_buffer)) {
-            machine_panic("KernelInstaller keyword selector exceeds buffer capacity");
+    binding_cell = source_lookup_binding_cell(context->lexical_environment_index, name);
+    if (binding_cell != 0) {
+        return *binding_cell;
+    }
+    if (value_is_object(context->receiver) &&
+        context->defining_class != 0 &&
+        class_field_index_for_name(context->defining_class, name, &field_index)) {
+        return heap_get_field(heap_object_for_value(context->receiver), field_index);
+    }
+    global_id = source_global_id_for_name(name);
+    if (global_id != 0U) {
+        return global_value(global_id);
+    }
+    machine_panic(source_unknown_identifier_error_text(name));
+    return nil_value();
+}
+
+static void source_write_identifier(
+    struct recorz_mvp_source_method_context *context,
+    const char *name,
+    struct recorz_mvp_value value
+) {
+    struct recorz_mvp_value *binding_cell = source_lookup_binding_cell(context->lexical_environment_index, name);
+    uint8_t field_index;
+
+    if (binding_cell != 0) {
+        *binding_cell = value;
+        return;
+    }
+    if (value_is_object(context->receiver) &&
+        context->defining_class != 0 &&
+        class_field_index_for_name(context->defining_class, name, &field_index)) {
+        heap_set_field(value_handle(context->receiver), field_index, value);
+        return;
+    }
+    machine_panic("live source assignment target is unknown");
+}
+
+static const char *source_parse_temporary_declarations(
+    struct recorz_mvp_source_method_context *context,
+    const char *source
+) {
+    struct recorz_mvp_source_lexical_environment *environment =
+        source_lexical_environment_at(context->lexical_environment_index);
+    const char *cursor = source_skip_horizontal_space(source);
+
+    if (*cursor != '|') {
+        machine_panic("live source temporary declaration is invalid");
+    }
+    ++cursor;
+    cursor = source_skip_horizontal_space(cursor);
+    while (*cursor != '\0') {
+        char name[METHOD_SOURCE_NAME_LIMIT];
+        uint8_t field_index;
+
+        if (*cursor == '|') {
+            ++cursor;
+            return source_skip_statement_space(cursor);
         }
-        selector_name_buffer[selector_length++] = ':';
-        selector_name_buffer[selector_length] = '\0';
-        cursor = compile_source_binary_expression_push(
-            class_object,
-            part_cursor + 1,
-            argument_names,
-            argument_count,
-            temporary_names,
-            temporary_count,
-            instruction_words,
-            instruction_count
-        );
+        cursor = source_parse_identifier(cursor, name, sizeof(name));
         if (cursor == 0) {
-            machine_panic("KernelInstaller source method keyword send is missing an argument");
+            machine_panic("live source temporary declaration is invalid");
         }
-        ++keyword_argument_count;
-        cursor = source_skip_horizontal_space(cursor);
-        part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
-        if (part_cursor == 0) {
-            break;
+        if (source_environment_has_local_binding(context->lexical_environment_index, name)) {
+            machine_panic("live source temporary declaration repeats a local binding");
         }
-        part_cursor = source_skip_horizontal_space(part_cursor);
-        if (*part_cursor != ':') {
-            break;
+        if (context->defining_class != 0 && class_field_index_for_name(context->defining_class, name, &field_index)) {
+            machine_panic("live source temporary declaration repeats an instance variable");
         }
-        {
-            uint32_t part_index = 0U;
+        if (environment->binding_count >= SOURCE_EVAL_BINDING_LIMIT) {
+            machine_panic("live source temporary declaration exceeds binding capacity");
+        }
+        source_append_binding(context->lexical_environment_index, name, nil_value());
+        cursor = source_skip_horizontal_space(cursor);
+    }
+    machine_panic("live source temporary declaration is missing a closing '|'");
+    return 0;
+}
 
-            while (selector_part[part_index] != '\0') {
-                if (selector_length + 1U >= sizeof(selector_name_buffer)) {
-                    machine_panic("KernelInstaller keyword selector exceeds buffer capacity");
-                }
-                selector_name_buffer[selector_length++] = selector_part[part_index++];
-            }
-            selector_name_buffer[selector_length] = '\0';
+static const char *source_parse_block_header(
+    const char *source,
+    char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+    uint16_t *argument_count_out
+) {
+    const char *cursor = source_skip_statement_space(source);
+
+    *argument_count_out = 0U;
+    while (*cursor == ':') {
+        ++cursor;
+        cursor = source_parse_identifier(cursor, argument_names[*argument_count_out], METHOD_SOURCE_NAME_LIMIT);
+        if (cursor == 0) {
+            machine_panic("block parameter name is invalid");
         }
-    } while (*part_cursor == ':');
-    selector_id = source_selector_id_for_name(selector_name_buffer);
-    if (selector_id == 0U) {
-        machine_panic("KernelInstaller source method uses an unknown keyword selector");
+        ++(*argument_count_out);
+        if (*argument_count_out > MAX_SEND_ARGS) {
+            machine_panic("block parameter count exceeds send capacity");
+        }
+        cursor = source_skip_statement_space(cursor);
+    }
+    if (*argument_count_out != 0U) {
+        if (*cursor != '|') {
+            machine_panic("block parameter list is missing '|'");
+        }
+        ++cursor;
     }
-    compile_source_append_instruction(
-        instruction_words,
-        instruction_count,
-        COMPILED_METHOD_OP_SEND,
-        selector_id,
-        keyword_argument_count
-    );
     return cursor;
 }
 
-static void compile_source_inline_block(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *source,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
+static uint8_t source_send_needs_failure_context(
+    struct recorz_mvp_value receiver,
+    uint16_t selector_id,
+    uint16_t argument_count
+) {
+    if (value_is_integer(receiver) && special_send_opcode_for_selector(selector_id, argument_count) != 0U) {
+        return 0U;
+    }
+    if (value_is_object(receiver)) {
+        const struct recorz_mvp_heap_object *class_object =
+            class_object_for_heap_object(heap_object_for_value(receiver));
+
+        return (uint8_t)(lookup_builtin_method_descriptor(class_object, selector_id, argument_count) == 0);
+    }
+    if (value_is_small_integer(receiver)) {
+        return (uint8_t)(selector_id != RECORZ_MVP_SELECTOR_EQUAL &&
+                         selector_id != RECORZ_MVP_SELECTOR_NOT_EQUAL &&
+                         selector_id != RECORZ_MVP_SELECTOR_PRINT_STRING);
+    }
+    if (value_is_string(receiver)) {
+        return (uint8_t)(selector_id != RECORZ_MVP_SELECTOR_PRINT_STRING &&
+                         selector_id != RECORZ_MVP_SELECTOR_SIZE &&
+                         selector_id != RECORZ_MVP_SELECTOR_AT);
+    }
+    return 1U;
+}
+
+static struct recorz_mvp_source_eval_result source_send_message(
+    struct recorz_mvp_source_method_context *context,
+    struct recorz_mvp_value receiver,
+    const char *selector_text,
     uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
+    const struct recorz_mvp_value arguments[]
 ) {
-    const char *cursor = source;
-    char statement[METHOD_SOURCE_CHUNK_LIMIT];
-    uint8_t statement_count = 0U;
-    uint8_t pending_statement_value = 0U;
+    const struct recorz_mvp_heap_object *source_owner_class = 0;
+    const struct recorz_mvp_live_method_source *source_record;
+    uint16_t selector_id;
 
-    if (*source_skip_horizontal_space(source) == ':') {
-        machine_panic("KernelInstaller conditional blocks do not support block arguments yet");
+    if (value_is_object(receiver) &&
+        primitive_kind_for_heap_object(heap_object_for_value(receiver)) == RECORZ_MVP_OBJECT_BLOCK_CLOSURE &&
+        ((source_names_equal(selector_text, "value") && argument_count == 0U) ||
+         (source_names_equal(selector_text, "value:") && argument_count == 1U))) {
+        return execute_block_closure(
+            heap_object_for_value(receiver),
+            argument_count,
+            arguments,
+            context->current_context_handle
+        );
     }
-    while (source_copy_next_statement(&cursor, statement, sizeof(statement)) != 0U) {
-        uint8_t produces_value = 0U;
-        const char *trimmed = source_skip_horizontal_space(statement);
+    if ((source_names_equal(selector_text, "ifTrue:") && argument_count == 1U) ||
+        (source_names_equal(selector_text, "ifFalse:") && argument_count == 1U) ||
+        (source_names_equal(selector_text, "ifTrue:ifFalse:") && argument_count == 2U)) {
+        uint8_t condition_is_true = condition_value_is_true(receiver);
+        uint16_t chosen_index = 0xFFFFU;
 
-        if (pending_statement_value) {
-            compile_source_append_instruction(
-                instruction_words,
-                instruction_count,
-                COMPILED_METHOD_OP_POP,
-                0U,
-                0U
-            );
-            pending_statement_value = 0U;
+        if (source_names_equal(selector_text, "ifTrue:")) {
+            chosen_index = condition_is_true ? 0U : 0xFFFFU;
+        } else if (source_names_equal(selector_text, "ifFalse:")) {
+            chosen_index = condition_is_true ? 0xFFFFU : 0U;
+        } else {
+            chosen_index = condition_is_true ? 0U : 1U;
         }
-        if (trimmed[0] == '^') {
-            compile_source_return_line(
-                class_object,
-                statement,
-                argument_names,
-                argument_count,
-                temporary_names,
-                temporary_count,
-                instruction_words,
-                instruction_count
-            );
-            if (source_copy_next_statement(&cursor, statement, sizeof(statement)) != 0U) {
-                machine_panic("KernelInstaller conditional block has unexpected trailing statements after a return");
+        if (chosen_index == 0xFFFFU) {
+            return source_eval_value_result(nil_value());
+        }
+        if (!value_is_object(arguments[chosen_index]) ||
+            primitive_kind_for_heap_object(heap_object_for_value(arguments[chosen_index])) != RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
+            machine_panic("conditional send expects a block closure argument");
+        }
+        return execute_block_closure(
+            heap_object_for_value(arguments[chosen_index]),
+            0U,
+            0,
+            context->current_context_handle
+        );
+    }
+    if (argument_count == 1U &&
+        value_is_small_integer(receiver) &&
+        value_is_small_integer(arguments[0])) {
+        if (source_names_equal(selector_text, "/")) {
+            if (value_integer(arguments[0]) == 0) {
+                machine_panic("/ expects a non-zero small integer argument");
             }
-            return;
+            return source_eval_value_result(small_integer_value(value_integer(receiver) / value_integer(arguments[0])));
         }
-        if (!compile_source_statement_line(
-                class_object,
-                statement,
-                argument_names,
+        if (source_names_equal(selector_text, "%")) {
+            if (value_integer(arguments[0]) == 0) {
+                machine_panic("% expects a non-zero small integer argument");
+            }
+            return source_eval_value_result(small_integer_value(value_integer(receiver) % value_integer(arguments[0])));
+        }
+    }
+    selector_id = source_selector_id_intern(selector_text);
+    if (value_is_object(receiver)) {
+        source_record = live_method_source_for_class_chain(
+            class_object_for_heap_object(heap_object_for_value(receiver)),
+            selector_id,
+            (uint8_t)argument_count,
+            &source_owner_class
+        );
+        if (source_record != 0 && source_record->execution_kind != RECORZ_MVP_LIVE_METHOD_EXECUTION_COMPILED) {
+            execute_live_method_with_sender(
+                source_owner_class,
+                receiver,
                 argument_count,
-                temporary_names,
-                temporary_count,
-                instruction_words,
-                instruction_count,
-                &produces_value
-            )) {
-            machine_panic("KernelInstaller conditional block statement is unsupported");
+                arguments,
+                source_record,
+                context->current_context_handle
+            );
+            return source_eval_send_result(pop_value());
         }
-        pending_statement_value = produces_value;
-        ++statement_count;
     }
-    if (statement_count == 0U || !pending_statement_value) {
-        compile_source_append_instruction(
-            instruction_words,
-            instruction_count,
-            COMPILED_METHOD_OP_PUSH_NIL,
+    if (context->current_context_handle == 0U &&
+        source_send_needs_failure_context(receiver, selector_id, argument_count)) {
+        const char *context_detail_text = context->is_block != 0U
+            ? "<block>"
+            : (context->selector_id == 0U ? "<doIt>" : selector_name(context->selector_id));
+
+        context->current_context_handle = activation_frame_context(
             0U,
-            0U
+            context->receiver,
+            context_detail_text
         );
     }
+    perform_send_with_sender(
+        receiver,
+        selector_id,
+        argument_count,
+        arguments,
+        context->current_context_handle,
+        0
+    );
+    receiver = pop_value();
+    return source_eval_send_result(receiver);
 }
 
-static const char *compile_source_conditional_expression_push(
-    const struct recorz_mvp_heap_object *class_object,
+static struct recorz_mvp_source_eval_result source_evaluate_primary_expression(
+    struct recorz_mvp_source_method_context *context,
     const char *cursor,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
+    const char **cursor_out
 ) {
-    char first_selector[METHOD_SOURCE_NAME_LIMIT];
-    char second_selector[METHOD_SOURCE_NAME_LIMIT];
-    char first_block[METHOD_SOURCE_CHUNK_LIMIT];
-    char second_block[METHOD_SOURCE_CHUNK_LIMIT];
-    const char *part_cursor;
-    const char *after_selector;
-    const char *after_first_block;
-    const char *after_second_block;
-    uint8_t first_is_true;
-    uint8_t branch_instruction_index;
-    uint8_t jump_instruction_index;
-    uint8_t has_second_clause = 0U;
+    struct recorz_mvp_source_eval_result result;
+    const char *parsed_cursor;
+    char token[METHOD_SOURCE_NAME_LIMIT];
+    char special_selector[METHOD_SOURCE_NAME_LIMIT];
+    char block_source[METHOD_SOURCE_CHUNK_LIMIT];
+    int32_t small_integer;
+    uint32_t root_id;
 
-    part_cursor = source_parse_identifier(cursor, first_selector, sizeof(first_selector));
-    if (part_cursor == 0) {
-        machine_panic("KernelInstaller conditional expression is missing a selector");
-    }
-    after_selector = source_skip_horizontal_space(part_cursor);
-    if (*after_selector != ':') {
-        machine_panic("KernelInstaller conditional expression is missing ':'");
-    }
-    after_first_block = source_copy_bracket_body(after_selector + 1, first_block, sizeof(first_block));
-    if (after_first_block == 0) {
-        machine_panic("KernelInstaller conditional expression is missing a block argument");
-    }
-    cursor = source_skip_horizontal_space(after_first_block);
-    part_cursor = source_parse_identifier(cursor, second_selector, sizeof(second_selector));
-    if (part_cursor != 0) {
-        after_selector = source_skip_horizontal_space(part_cursor);
-        if (*after_selector == ':' &&
-            ((source_names_equal(first_selector, "ifTrue") && source_names_equal(second_selector, "ifFalse")) ||
-             (source_names_equal(first_selector, "ifFalse") && source_names_equal(second_selector, "ifTrue")))) {
-            after_second_block = source_copy_bracket_body(after_selector + 1, second_block, sizeof(second_block));
-            if (after_second_block == 0) {
-                machine_panic("KernelInstaller conditional expression is missing a matching block argument");
-            }
-            cursor = after_second_block;
-            has_second_clause = 1U;
+    cursor = source_skip_horizontal_space(cursor);
+    if (*cursor == '(') {
+        result = source_evaluate_expression(context, cursor + 1, &parsed_cursor);
+        if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+            return result;
         }
-    }
+        parsed_cursor = source_skip_horizontal_space(parsed_cursor);
+        if (*parsed_cursor != ')') {
+            machine_panic("live source parenthesized expression is missing ')'");
+        }
+        cursor = parsed_cursor + 1;
+    } else if (*cursor == '[') {
+        uint16_t block_handle;
 
-    first_is_true = (uint8_t)source_names_equal(first_selector, "ifTrue");
-    branch_instruction_index = *instruction_count;
-    compile_source_append_instruction(
-        instruction_words,
-        instruction_count,
-        first_is_true ? COMPILED_METHOD_OP_JUMP_IF_FALSE : COMPILED_METHOD_OP_JUMP_IF_TRUE,
-        0U,
-        0U
-    );
-    compile_source_inline_block(
-        class_object,
-        first_block,
-        argument_names,
-        argument_count,
-        temporary_names,
-        temporary_count,
-        instruction_words,
-        instruction_count
-    );
-    jump_instruction_index = *instruction_count;
-    compile_source_append_instruction(
-        instruction_words,
-        instruction_count,
-        COMPILED_METHOD_OP_JUMP,
-        0U,
-        0U
-    );
-    compile_source_patch_instruction(
-        instruction_words,
-        *instruction_count,
-        branch_instruction_index,
-        first_is_true ? COMPILED_METHOD_OP_JUMP_IF_FALSE : COMPILED_METHOD_OP_JUMP_IF_TRUE,
-        0U,
-        *instruction_count
-    );
-    if (has_second_clause) {
-        compile_source_inline_block(
-            class_object,
-            second_block,
-            argument_names,
-            argument_count,
-            temporary_names,
-            temporary_count,
-            instruction_words,
-            instruction_count
+        parsed_cursor = source_copy_bracket_body(cursor, block_source, sizeof(block_source));
+        if (parsed_cursor == 0) {
+            machine_panic("live source block literal is invalid");
+        }
+        block_handle = allocate_block_closure_from_source(block_source, context->receiver, 1U);
+        source_register_block_state(
+            block_handle,
+            context->defining_class,
+            context->lexical_environment_index,
+            context->home_context_index
         );
+        result = source_eval_value_result(object_value(block_handle));
+        cursor = parsed_cursor;
+    } else if (*cursor == '\'') {
+        char quoted_text[METHOD_SOURCE_CHUNK_LIMIT];
+
+        parsed_cursor = source_copy_single_quoted_text(cursor, quoted_text, sizeof(quoted_text));
+        if (parsed_cursor == 0) {
+            machine_panic("live source string literal is invalid");
+        }
+        if (!context->is_block &&
+            context->defining_class != 0 &&
+            context->selector_id != 0U) {
+            uint16_t literal_slot = remember_live_string_literal(
+                heap_handle_for_object(context->defining_class),
+                context->selector_id,
+                context->argument_count,
+                quoted_text
+            );
+
+            result = source_eval_value_result(string_value(live_string_literals[literal_slot - 1U].text));
+        } else {
+            result = source_eval_value_result(string_value(runtime_string_intern_copy(quoted_text)));
+        }
+        cursor = parsed_cursor;
     } else {
-        compile_source_append_instruction(
-            instruction_words,
-            instruction_count,
-            COMPILED_METHOD_OP_PUSH_NIL,
-            0U,
-            0U
-        );
+        parsed_cursor = source_parse_small_integer(cursor, &small_integer);
+        if (parsed_cursor != 0) {
+            result = source_eval_value_result(small_integer_value(small_integer));
+            cursor = parsed_cursor;
+        } else {
+            parsed_cursor = source_parse_identifier(cursor, token, sizeof(token));
+            if (parsed_cursor == 0) {
+                machine_panic("live source primary expression is invalid");
+            }
+            result = source_eval_value_result(source_read_identifier(context, token));
+            cursor = parsed_cursor;
+        }
     }
-    compile_source_patch_instruction(
-        instruction_words,
-        *instruction_count,
-        jump_instruction_index,
-        COMPILED_METHOD_OP_JUMP,
-        0U,
-        *instruction_count
-    );
-    return cursor;
-}
-
-static uint8_t compile_source_statement_line(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *line,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count,
-    uint8_t *produces_value
-) {
-    char receiver_name[METHOD_SOURCE_NAME_LIMIT];
-    const char *cursor = line;
 
-    *produces_value = 0U;
     cursor = source_skip_horizontal_space(cursor);
-    if (source_names_equal(cursor, "")) {
-        return 1U;
-    }
-    cursor = source_parse_identifier(cursor, receiver_name, sizeof(receiver_name));
-    if (cursor != 0) {
-        cursor = source_skip_horizontal_space(cursor);
-    }
-    if (cursor != 0 && cursor[0] == ':' && cursor[1] == '=') {
-        uint8_t field_index;
-        uint16_t temporary_index;
+    if (value_is_object(result.value) &&
+        value_handle(result.value) == global_handles[RECORZ_MVP_GLOBAL_DISPLAY]) {
+        const char *selector_cursor = source_parse_identifier(cursor, special_selector, sizeof(special_selector));
 
-        cursor += 2;
-        cursor = source_skip_horizontal_space(cursor);
-        cursor = compile_source_expression_push(
-            class_object,
-            cursor,
-            argument_names,
-            argument_count,
-            temporary_names,
-            temporary_count,
-            instruction_words,
-            instruction_count
-        );
-        if (cursor == 0) {
-            machine_panic("KernelInstaller source method assignment right-hand side is invalid");
+        if (selector_cursor != 0) {
+            const char *after_selector = source_skip_horizontal_space(selector_cursor);
+
+            if (*after_selector != ':' &&
+                display_source_root_id_for_selector(special_selector, &root_id)) {
+                result = source_eval_value_result(seed_root_value(root_id));
+                cursor = after_selector;
+            }
         }
-        cursor = source_skip_horizontal_space(cursor);
-        if (*cursor != '.' || cursor[1] != '\0') {
-            machine_panic("KernelInstaller source method assignment has unexpected trailing text");
+    }
+    while (source_char_is_identifier_start(*cursor)) {
+        char selector_name[METHOD_SOURCE_NAME_LIMIT];
+        const char *selector_cursor = source_parse_identifier(cursor, selector_name, sizeof(selector_name));
+        const char *after_selector;
+
+        if (selector_cursor == 0) {
+            break;
         }
-        for (temporary_index = 0U; temporary_index < temporary_count; ++temporary_index) {
-            if (temporary_names[temporary_index][0] != '\0' &&
-                source_names_equal(receiver_name, temporary_names[temporary_index])) {
-                compile_source_append_instruction(
-                    instruction_words,
-                    instruction_count,
-                    COMPILED_METHOD_OP_STORE_LEXICAL,
-                    0U,
-                    temporary_index
-                );
-                return 1U;
-            }
+        after_selector = source_skip_horizontal_space(selector_cursor);
+        if (*after_selector == ':') {
+            break;
         }
-        if (!class_field_index_for_name(class_object, receiver_name, &field_index)) {
-            machine_panic("KernelInstaller source method assignment target must be a temporary or an instance variable");
+        result = source_send_message(context, result.value, selector_name, 0U, 0);
+        if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+            return result;
         }
-        compile_source_append_instruction(
-            instruction_words,
-            instruction_count,
-            COMPILED_METHOD_OP_STORE_FIELD,
-            field_index,
-            0U
-        );
-        return 1U;
-    }
-    cursor = compile_source_expression_push(
-        class_object,
-        line,
-        argument_names,
-        argument_count,
-        temporary_names,
-        temporary_count,
-        instruction_words,
-        instruction_count
-    );
-    if (cursor == 0) {
-        machine_panic("KernelInstaller source method uses an unsupported receiver expression");
-    }
-    cursor = source_skip_horizontal_space(cursor);
-    if (*cursor != '\0' && !(*cursor == '.' && cursor[1] == '\0')) {
-        machine_panic("KernelInstaller source method statement has unexpected trailing text");
+        cursor = after_selector;
     }
-    *produces_value = 1U;
-    return 1U;
+    *cursor_out = cursor;
+    return result;
 }
 
-static void compile_source_return_line(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *line,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    const char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t temporary_count,
-    uint32_t instruction_words[],
-    uint8_t *instruction_count
+static struct recorz_mvp_source_eval_result source_evaluate_binary_expression(
+    struct recorz_mvp_source_method_context *context,
+    const char *cursor,
+    const char **cursor_out
 ) {
-    const char *cursor = source_skip_horizontal_space(line);
+    struct recorz_mvp_source_eval_result receiver_result;
+    struct recorz_mvp_gc_root_frame receiver_roots;
 
-    if (*cursor != '^') {
-        machine_panic("KernelInstaller source method return is invalid");
+    receiver_result = source_evaluate_primary_expression(context, cursor, &cursor);
+    if (receiver_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+        return receiver_result;
     }
-    ++cursor;
     cursor = source_skip_horizontal_space(cursor);
-    if (source_names_equal(cursor, "self")) {
-        if (*instruction_count >= COMPILED_METHOD_MAX_INSTRUCTIONS) {
-            panic_source_method_exceeds_compiled_method_capacity();
+    gc_root_values(&receiver_roots, &receiver_result.value, 1U);
+    while (source_char_is_live_binary_selector(*cursor)) {
+        char selector_name[3];
+        struct recorz_mvp_source_eval_result argument_result;
+
+        cursor = source_parse_binary_selector(cursor, selector_name);
+        argument_result = source_evaluate_primary_expression(context, cursor, &cursor);
+        if (argument_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+            gc_unroot(&receiver_roots);
+            return argument_result;
         }
-        instruction_words[(*instruction_count)++] = encode_compiled_method_word(COMPILED_METHOD_OP_RETURN_RECEIVER, 0U, 0U);
-        return;
-    }
-    cursor = compile_source_expression_push(
-        class_object,
-        cursor,
-        argument_names,
-        argument_count,
-        temporary_names,
-        temporary_count,
-        instruction_words,
-        instruction_count
-    );
-    if (cursor == 0) {
-        machine_panic("KernelInstaller source method return expression is unsupported");
-    }
-    cursor = source_skip_horizontal_space(cursor);
-    if (*cursor != '\0') {
-        machine_panic("KernelInstaller source method return has unexpected trailing text");
+        receiver_result = source_send_message(context, receiver_result.value, selector_name, 1U, &argument_result.value);
+        if (receiver_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+            gc_unroot(&receiver_roots);
+            return receiver_result;
+        }
+        cursor = source_skip_horizontal_space(cursor);
     }
-    compile_source_append_instruction(
-        instruction_words,
-        instruction_count,
-        COMPILED_METHOD_OP_RETURN_TOP,
-        0U,
-        0U
-    );
+    gc_unroot(&receiver_roots);
+    *cursor_out = cursor;
+    return receiver_result;
 }
 
-static void compile_source_parse_temporary_declarations(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *line,
-    const char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t argument_count,
-    char temporary_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t *temporary_count
+static struct recorz_mvp_source_eval_result source_evaluate_expression(
+    struct recorz_mvp_source_method_context *context,
+    const char *cursor,
+    const char **cursor_out
 ) {
-    const char *cursor = source_skip_horizontal_space(line);
+    char selector_name[METHOD_SOURCE_NAME_LIMIT];
+    char selector_part[METHOD_SOURCE_NAME_LIMIT];
+    struct recorz_mvp_source_eval_result receiver_result;
+    struct recorz_mvp_value arguments[MAX_SEND_ARGS];
+    struct recorz_mvp_gc_root_frame receiver_roots;
+    struct recorz_mvp_gc_root_frame argument_roots;
+    const char *part_cursor;
+    uint32_t argument_count = 0U;
+    uint32_t selector_length = 0U;
 
-    if (*cursor != '|') {
-        machine_panic("KernelInstaller source temporary declaration is invalid");
+    receiver_result = source_evaluate_binary_expression(context, cursor, &cursor);
+    if (receiver_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+        return receiver_result;
     }
-    ++cursor;
     cursor = source_skip_horizontal_space(cursor);
-    *temporary_count = 0U;
-    while (*cursor != '\0') {
-        uint16_t existing_index;
-        uint8_t field_index;
+    part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
+    if (part_cursor == 0) {
+        *cursor_out = cursor;
+        return receiver_result;
+    }
+    part_cursor = source_skip_horizontal_space(part_cursor);
+    if (*part_cursor != ':') {
+        *cursor_out = cursor;
+        return receiver_result;
+    }
+    if ((source_names_equal(selector_part, "ifTrue") || source_names_equal(selector_part, "ifFalse")) &&
+        *source_skip_statement_space(part_cursor + 1) == '[') {
+        return source_evaluate_conditional_expression(context, receiver_result, cursor, cursor_out);
+    }
+    while (selector_part[selector_length] != '\0') {
+        selector_name[selector_length] = selector_part[selector_length];
+        ++selector_length;
+    }
+    selector_name[selector_length] = '\0';
+    gc_root_values(&receiver_roots, &receiver_result.value, 1U);
+    gc_root_value_stack(&argument_roots, arguments, &argument_count);
+    do {
+        struct recorz_mvp_source_eval_result argument_result;
+        uint32_t part_index = 0U;
 
-        if (*cursor == '|') {
-            ++cursor;
-            cursor = source_skip_horizontal_space(cursor);
-            if (*cursor != '\0') {
-                machine_panic("KernelInstaller source temporary declaration has unexpected trailing text");
-            }
-            return;
+        if (argument_count >= MAX_SEND_ARGS) {
+            machine_panic("live source send exceeds argument capacity");
         }
-        if (*temporary_count >= LEXICAL_LIMIT) {
-            machine_panic("KernelInstaller source method has too many temporaries");
+        if (selector_length + 1U >= sizeof(selector_name)) {
+            machine_panic("live source selector exceeds capacity");
         }
-        cursor = source_parse_identifier(
-            cursor,
-            temporary_names[*temporary_count],
-            sizeof(temporary_names[*temporary_count])
-        );
-        if (cursor == 0) {
-            machine_panic("KernelInstaller source temporary declaration is invalid");
+        selector_name[selector_length++] = ':';
+        selector_name[selector_length] = '\0';
+        argument_result = source_evaluate_binary_expression(context, part_cursor + 1, &cursor);
+        if (argument_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+            gc_unroot(&receiver_roots);
+            return argument_result;
         }
-        for (existing_index = 0U; existing_index < argument_count; ++existing_index) {
-            if (source_names_equal(temporary_names[*temporary_count], argument_names[existing_index])) {
-                machine_panic("KernelInstaller source temporary repeats an argument name");
-            }
+        arguments[argument_count++] = argument_result.value;
+        cursor = source_skip_horizontal_space(cursor);
+        part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
+        if (part_cursor == 0) {
+            break;
         }
-        for (existing_index = 0U; existing_index < *temporary_count; ++existing_index) {
-            if (source_names_equal(temporary_names[*temporary_count], temporary_names[existing_index])) {
-                machine_panic("KernelInstaller source temporary declaration repeats a temporary");
-            }
+        part_cursor = source_skip_horizontal_space(part_cursor);
+        if (*part_cursor != ':') {
+            break;
         }
-        if (class_field_index_for_name(class_object, temporary_names[*temporary_count], &field_index)) {
-            machine_panic("KernelInstaller source temporary repeats an instance variable name");
+        while (selector_part[part_index] != '\0') {
+            if (selector_length + 1U >= sizeof(selector_name)) {
+                machine_panic("live source selector exceeds capacity");
+            }
+            selector_name[selector_length++] = selector_part[part_index++];
         }
-        ++(*temporary_count);
-        cursor = source_skip_horizontal_space(cursor);
-    }
-    machine_panic("KernelInstaller source temporary declaration is missing '|'");
+        selector_name[selector_length] = '\0';
+    } while (*part_cursor == ':');
+    gc_unroot(&receiver_roots);
+    *cursor_out = cursor;
+    receiver_result = source_send_message(
+        context,
+        receiver_result.value,
+        selector_name,
+        (uint16_t)argument_count,
+        arguments
+    );
+    *cursor_out = cursor;
+    return receiver_result;
 }
 
-static uint16_t compile_source_method_and_allocate(
-    const struct recorz_mvp_heap_object *class_object,
-    const char *source,
-    uint16_t *selector_id_out,
-    uint16_t *argument_count_out
+static struct recorz_mvp_source_eval_result source_execute_block_closure(
+    const struct recorz_mvp_heap_object *object,
+    uint16_t argument_count,
+    const struct recorz_mvp_value arguments[],
+    uint16_t sender_context_handle
 ) {
-    char header_line[METHOD_SOURCE_LINE_LIMIT];
-    char statement_line[METHOD_SOURCE_LINE_LIMIT];
-    char trailing_line[METHOD_SOURCE_LINE_LIMIT];
-    char selector_name_buffer[METHOD_SOURCE_NAME_LIMIT];
-    char selector_part_buffer[METHOD_SOURCE_NAME_LIMIT];
+    struct recorz_mvp_runtime_block_state block_state_storage;
+    const struct recorz_mvp_runtime_block_state *block_state = 0;
+    const struct recorz_mvp_heap_object *defining_class = 0;
+    struct recorz_mvp_source_method_context context;
+    struct recorz_mvp_source_eval_result result;
+    struct recorz_mvp_value source_value;
+    struct recorz_mvp_value home_receiver;
+    struct recorz_mvp_gc_root_frame block_roots;
+    struct recorz_mvp_gc_root_frame context_roots;
+    uint16_t block_handle;
     char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
-    char temporary_names[LEXICAL_LIMIT][METHOD_SOURCE_NAME_LIMIT];
-    const char *cursor = source;
-    const char *header_cursor;
-    uint32_t instruction_words[COMPILED_METHOD_MAX_INSTRUCTIONS];
-    uint8_t instruction_count = 0U;
-    uint16_t selector_id;
-    uint16_t argument_count = 0U;
-    uint16_t temporary_count = 0U;
-    uint8_t found_return = 0U;
-    uint8_t pending_statement_value = 0U;
-    uint32_t selector_length = 0U;
-    uint32_t part_length = 0U;
-    uint8_t have_pending_line = 0U;
+    uint16_t parsed_argument_count = 0U;
+    const char *body_cursor;
+    int16_t lexical_environment_index;
+    uint16_t argument_index;
+    uint8_t allocate_context_object;
 
-    if (source == 0 || *source == '\0') {
-        machine_panic("KernelInstaller source method string is empty");
+    if (primitive_kind_for_heap_object(object) != RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
+        machine_panic("source block execution expects a block closure");
     }
-    if (source_text_requires_live_evaluator(source)) {
-        const char *body_cursor;
-
-        if (source_parse_method_header(
-                source,
-                selector_name_buffer,
-                argument_names,
-                &argument_count,
-                &body_cursor) == 0) {
-            machine_panic("KernelInstaller source method header is invalid");
-        }
-        (void)body_cursor;
-        selector_id = source_selector_id_for_name(selector_name_buffer);
-        if (selector_id == 0U) {
-            machine_panic("KernelInstaller source method uses an unknown selector");
+    source_value = heap_get_field(object, BLOCK_CLOSURE_FIELD_SOURCE);
+    if (!value_is_string(source_value) || value_string(source_value) == 0) {
+        machine_panic("block closure source field is invalid");
+    }
+    home_receiver = heap_get_field(object, BLOCK_CLOSURE_FIELD_HOME_RECEIVER);
+    if (source_block_state_for_handle(heap_handle_for_object(object), &block_state_storage)) {
+        block_state = &block_state_storage;
+        lexical_environment_index = source_allocate_lexical_environment(block_state->lexical_environment_index);
+        defining_class = block_state->defining_class;
+    } else {
+        lexical_environment_index = source_allocate_lexical_environment(-1);
+        if (value_is_object(home_receiver)) {
+            defining_class = class_object_for_heap_object(heap_object_for_value(home_receiver));
+        } else {
+            defining_class = class_object_for_kind(RECORZ_MVP_OBJECT_OBJECT);
         }
-        *selector_id_out = selector_id;
-        *argument_count_out = argument_count;
-        forget_live_string_literals(heap_handle_for_object(class_object), selector_id, (uint8_t)argument_count);
-        return allocate_placeholder_live_source_compiled_method();
     }
-    for (argument_count = 0U; argument_count < MAX_SEND_ARGS; ++argument_count) {
-        argument_names[argument_count][0] = '\0';
+    body_cursor = source_parse_block_header(value_string(source_value), argument_names, &parsed_argument_count);
+    if (parsed_argument_count != argument_count) {
+        machine_panic("block argument count does not match activation");
     }
-    for (temporary_count = 0U; temporary_count < LEXICAL_LIMIT; ++temporary_count) {
-        temporary_names[temporary_count][0] = '\0';
+    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
+        source_append_binding(lexical_environment_index, argument_names[argument_index], arguments[argument_index]);
     }
-    argument_count = 0U;
-    temporary_count = 0U;
-    if (source_copy_trimmed_line(&cursor, header_line, sizeof(header_line)) == 0U) {
-        machine_panic("KernelInstaller source method is missing a header");
+    allocate_context_object = source_text_contains_identifier(value_string(source_value), "thisContext");
+    context.defining_class = defining_class;
+    context.receiver = home_receiver;
+    context.lexical_environment_index = lexical_environment_index;
+    context.home_context_index = block_state == 0 ? -1 : block_state->home_context_index;
+    context.current_context_handle = allocate_context_object != 0U ?
+        allocate_source_context_object(
+            sender_context_handle,
+            home_receiver,
+            "<block>"
+        ) :
+        0U;
+    context.selector_id = 0U;
+    context.argument_count = 0U;
+    context.is_block = 1U;
+    block_handle = heap_handle_for_object(object);
+    gc_root_handles(&block_roots, &block_handle, 1U);
+    gc_root_source_method_context(&context_roots, &context);
+    result = source_evaluate_statement_sequence(&context, body_cursor, 1U);
+    gc_unroot(&block_roots);
+    mark_context_dead(context.current_context_handle);
+    if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN && block_return_home_context_index < 0) {
+        if (context.home_context_index < 0) {
+            machine_panic("block attempted a non-local return without a live home context");
+        }
+        if (!source_home_context_at(context.home_context_index)->alive) {
+            machine_panic("block attempted a non-local return to a dead home context");
+        }
+        block_return_home_context_index = context.home_context_index;
     }
-    header_cursor = source_parse_identifier(header_line, selector_name_buffer, sizeof(selector_name_buffer));
-    if (header_cursor == 0) {
-        machine_panic("KernelInstaller source method header is invalid");
+    source_release_lexical_environment_chain_if_unused(lexical_environment_index);
+    return result;
+}
+
+static struct recorz_mvp_source_eval_result source_execute_inline_block_source(
+    struct recorz_mvp_source_method_context *context,
+    const char *source
+) {
+    struct recorz_mvp_source_method_context block_context;
+    struct recorz_mvp_source_eval_result result;
+    struct recorz_mvp_gc_root_frame context_roots;
+    char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
+    uint16_t parsed_argument_count = 0U;
+    const char *body_cursor;
+    int16_t lexical_environment_index;
+    uint8_t allocate_context_object;
+
+    lexical_environment_index = source_allocate_lexical_environment(context->lexical_environment_index);
+    body_cursor = source_parse_block_header(source, argument_names, &parsed_argument_count);
+    if (parsed_argument_count != 0U) {
+        machine_panic("inline conditional blocks do not support block arguments yet");
     }
-    header_cursor = source_skip_horizontal_space(header_cursor);
-    while (selector_name_buffer[selector_length] != '\0') {
-        ++selector_length;
+    allocate_context_object = source_text_contains_identifier(source, "thisContext");
+    block_context.defining_class = context->defining_class;
+    block_context.receiver = context->receiver;
+    block_context.lexical_environment_index = lexical_environment_index;
+    block_context.home_context_index = context->home_context_index;
+    block_context.current_context_handle = allocate_context_object != 0U ?
+        allocate_source_context_object(
+            context->current_context_handle,
+            context->receiver,
+            "<block>"
+        ) :
+        0U;
+    block_context.selector_id = 0U;
+    block_context.argument_count = 0U;
+    block_context.is_block = 1U;
+    gc_root_source_method_context(&context_roots, &block_context);
+    result = source_evaluate_statement_sequence(&block_context, body_cursor, 1U);
+    gc_unroot(&context_roots);
+    mark_context_dead(block_context.current_context_handle);
+    if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN && block_return_home_context_index < 0) {
+        if (block_context.home_context_index < 0) {
+            machine_panic("block attempted a non-local return without a live home context");
+        }
+        if (!source_home_context_at(block_context.home_context_index)->alive) {
+            machine_panic("block attempted a non-local return to a dead home context");
+        }
     }
-    if (*header_cursor == ':') {
-        while (*header_cursor == ':') {
-            if (argument_count >= MAX_SEND_ARGS) {
-                machine_panic("KernelInstaller source method has too many arguments");
-            }
-            if (selector_length + 1U >= sizeof(selector_name_buffer)) {
-                machine_panic("KernelInstaller source method selector exceeds buffer capacity");
-            }
-            selector_name_buffer[selector_length++] = ':';
-            selector_name_buffer[selector_length] = '\0';
-            ++header_cursor;
-            header_cursor = source_skip_horizontal_space(header_cursor);
-            header_cursor = source_parse_identifier(
-                header_cursor,
-                argument_names[argument_count],
-                sizeof(argument_names[argument_count])
-            );
-            if (header_cursor == 0) {
-                machine_panic("KernelInstaller source method keyword header is missing an argument name");
-            }
-            ++argument_count;
-            header_cursor = source_skip_horizontal_space(header_cursor);
-            if (*header_cursor == '\0') {
-                break;
-            }
-            header_cursor = source_parse_identifier(header_cursor, selector_part_buffer, sizeof(selector_part_buffer));
-            if (header_cursor == 0) {
-                machine_panic("KernelInstaller source method header has unexpected trailing text");
+    source_release_single_lexical_environment_if_unused(lexical_environment_index);
+    return result;
+}
+
+static struct recorz_mvp_source_eval_result source_evaluate_conditional_expression(
+    struct recorz_mvp_source_method_context *context,
+    struct recorz_mvp_source_eval_result receiver_result,
+    const char *cursor,
+    const char **cursor_out
+) {
+    char first_selector[METHOD_SOURCE_NAME_LIMIT];
+    char second_selector[METHOD_SOURCE_NAME_LIMIT];
+    char first_block[METHOD_SOURCE_CHUNK_LIMIT];
+    char second_block[METHOD_SOURCE_CHUNK_LIMIT];
+    const char *part_cursor;
+    const char *after_selector;
+    const char *after_first_block;
+    const char *after_second_block;
+    const char *chosen_block = 0;
+    uint8_t first_is_true;
+    uint8_t has_second_clause = 0U;
+
+    part_cursor = source_parse_identifier(cursor, first_selector, sizeof(first_selector));
+    if (part_cursor == 0) {
+        machine_panic("live source conditional expression is missing a selector");
+    }
+    after_selector = source_skip_statement_space(part_cursor);
+    if (*after_selector != ':') {
+        machine_panic("live source conditional expression is missing ':'");
+    }
+    after_selector = source_skip_statement_space(after_selector + 1);
+    if (*after_selector != '[') {
+        machine_panic("live source inline conditional expects a block argument");
+    }
+    after_first_block = source_copy_bracket_body(after_selector, first_block, sizeof(first_block));
+    if (after_first_block == 0) {
+        machine_panic("live source conditional expression is missing a block argument");
+    }
+    cursor = source_skip_statement_space(after_first_block);
+    part_cursor = source_parse_identifier(cursor, second_selector, sizeof(second_selector));
+    if (part_cursor != 0) {
+        after_selector = source_skip_statement_space(part_cursor);
+        if (*after_selector == ':' &&
+            ((source_names_equal(first_selector, "ifTrue") && source_names_equal(second_selector, "ifFalse")) ||
+             (source_names_equal(first_selector, "ifFalse") && source_names_equal(second_selector, "ifTrue")))) {
+            after_selector = source_skip_statement_space(after_selector + 1);
+            if (*after_selector != '[') {
+                machine_panic("live source inline conditional matching clause expects a block argument");
             }
-            part_length = 0U;
-            while (selector_part_buffer[part_length] != '\0') {
-                if (selector_length + 1U >= sizeof(selector_name_buffer)) {
-                    machine_panic("KernelInstaller source method selector exceeds buffer capacity");
-                }
-                selector_name_buffer[selector_length++] = selector_part_buffer[part_length++];
+            after_second_block = source_copy_bracket_body(after_selector, second_block, sizeof(second_block));
+            if (after_second_block == 0) {
+                machine_panic("live source conditional expression is missing a matching block argument");
             }
-            selector_name_buffer[selector_length] = '\0';
-            header_cursor = source_skip_horizontal_space(header_cursor);
-        }
-        if (*header_cursor != '\0') {
-            machine_panic("KernelInstaller source method header has unexpected trailing text");
+            cursor = after_second_block;
+            has_second_clause = 1U;
         }
-    } else if (*header_cursor != '\0') {
-        machine_panic("KernelInstaller source method header has unexpected trailing text");
     }
-    selector_id = source_selector_id_for_name(selector_name_buffer);
-    if (selector_id == 0U) {
-        machine_panic("KernelInstaller source method uses an unknown selector");
-    }
-    forget_live_string_literals(heap_handle_for_object(class_object), selector_id, (uint8_t)argument_count);
-    compiling_method_class_handle = heap_handle_for_object(class_object);
-    compiling_method_selector_id = selector_id;
-    compiling_method_argument_count = (uint8_t)argument_count;
-    if (source_copy_trimmed_line(&cursor, statement_line, sizeof(statement_line)) != 0U) {
-        const char *trimmed_line = source_skip_horizontal_space(statement_line);
 
-        if (trimmed_line[0] == '|') {
-            compile_source_parse_temporary_declarations(
-                class_object,
-                statement_line,
-                argument_names,
-                argument_count,
-                temporary_names,
-                &temporary_count
-            );
-        } else {
-            have_pending_line = 1U;
-        }
+    first_is_true = (uint8_t)source_names_equal(first_selector, "ifTrue");
+    if (inline_condition_value_is_true(receiver_result.value) == first_is_true) {
+        chosen_block = first_block;
+    } else if (has_second_clause) {
+        chosen_block = second_block;
     }
-    while (have_pending_line || source_copy_trimmed_line(&cursor, statement_line, sizeof(statement_line)) != 0U) {
-        uint8_t produces_value = 0U;
-        const char *trimmed_line = source_skip_horizontal_space(statement_line);
+    *cursor_out = cursor;
+    if (chosen_block == 0) {
+        return source_eval_value_result(nil_value());
+    }
+    return source_execute_inline_block_source(context, chosen_block);
+}
 
-        have_pending_line = 0U;
+static struct recorz_mvp_source_eval_result source_evaluate_statement_sequence(
+    struct recorz_mvp_source_method_context *context,
+    const char *source,
+    uint8_t is_block
+) {
+    const char *cursor = source_skip_statement_space(source);
+    char statement[METHOD_SOURCE_CHUNK_LIMIT];
+    struct recorz_mvp_source_eval_result last_result = source_eval_value_result(nil_value());
+    uint8_t saw_statement = 0U;
 
-        if (pending_statement_value) {
-            const char *return_cursor = source_skip_horizontal_space(trimmed_line + 1);
+    (void)is_block;
+    if (*cursor == '|') {
+        cursor = source_parse_temporary_declarations(context, cursor);
+    }
+    while (source_copy_next_statement(&cursor, statement, sizeof(statement)) != 0U) {
+        const char *trimmed = source_skip_statement_space(statement);
 
-            if (!(trimmed_line[0] == '^' && source_names_equal(return_cursor, "self"))) {
-                compile_source_append_instruction(
-                    instruction_words,
-                    &instruction_count,
-                    COMPILED_METHOD_OP_POP,
-                    0U,
-                    0U
-                );
+        if (trimmed[0] == '\0') {
+            continue;
+        }
+        if (trimmed[0] == '^') {
+            const char *return_cursor;
+
+            last_result = source_evaluate_expression(context, trimmed + 1, &return_cursor);
+            if (last_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+                return last_result;
             }
-            pending_statement_value = 0U;
+            return_cursor = source_skip_horizontal_space(return_cursor);
+            if (*return_cursor != '\0') {
+                machine_panic("live source return has unexpected trailing text");
+            }
+            return source_eval_return_result(last_result.value);
         }
+        {
+            char binding_name[METHOD_SOURCE_NAME_LIMIT];
+            const char *binding_cursor = source_parse_identifier(trimmed, binding_name, sizeof(binding_name));
 
-        if (trimmed_line[0] == '^') {
-            compile_source_return_line(
-                class_object,
-                statement_line,
-                argument_names,
-                argument_count,
-                temporary_names,
-                temporary_count,
-                instruction_words,
-                &instruction_count
-            );
-            found_return = 1U;
-            break;
+            if (binding_cursor != 0) {
+                binding_cursor = source_skip_horizontal_space(binding_cursor);
+                if (binding_cursor[0] == ':' && binding_cursor[1] == '=') {
+                    const char *expression_cursor;
+
+                    last_result = source_evaluate_expression(context, binding_cursor + 2, &expression_cursor);
+                    if (last_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+                        return last_result;
+                    }
+                    expression_cursor = source_skip_horizontal_space(expression_cursor);
+                    if (*expression_cursor != '\0') {
+                        machine_panic("live source assignment has unexpected trailing text");
+                    }
+                    source_write_identifier(context, binding_name, last_result.value);
+                    saw_statement = 1U;
+                    continue;
+                }
+            }
         }
-        if (!compile_source_statement_line(
-                class_object,
-                statement_line,
-                argument_names,
-                argument_count,
-                temporary_names,
-                temporary_count,
-                instruction_words,
-                &instruction_count,
-                &produces_value
-            )) {
-            machine_panic("KernelInstaller source method statement is unsupported");
+        last_result = source_evaluate_expression(context, trimmed, &trimmed);
+        if (last_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+            return last_result;
         }
-        pending_statement_value = produces_value;
+        trimmed = source_skip_horizontal_space(trimmed);
+        if (*trimmed != '\0') {
+            machine_panic("live source statement has unexpected trailing text");
+        }
+        saw_statement = 1U;
     }
-    if (!found_return) {
-        machine_panic("KernelInstaller source method is missing a return");
+    if (!saw_statement) {
+        return source_eval_value_result(nil_value());
     }
-    if (source_copy_trimmed_line(&cursor, trailing_line, sizeof(trailing_line)) != 0U) {
-        machine_panic("KernelInstaller source method has unexpected trailing lines");
+    return last_result;
+}
+
+static void execute_live_source_method_with_sender(
+    const struct recorz_mvp_heap_object *class_object,
+    struct recorz_mvp_value receiver,
+    uint16_t argument_count,
+    const struct recorz_mvp_value arguments[],
+    const char *source,
+    uint16_t sender_context_handle
+) {
+    struct recorz_mvp_source_method_context context;
+    struct recorz_mvp_source_eval_result result;
+    struct recorz_mvp_gc_root_frame context_roots;
+    char selector_name[METHOD_SOURCE_NAME_LIMIT];
+    char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
+    uint16_t parsed_argument_count;
+    const char *body_cursor;
+    int16_t lexical_environment_index;
+    int16_t home_context_index;
+    uint16_t argument_index;
+    uint8_t allocate_context_object;
+
+    if (source == 0 || source[0] == '\0') {
+        machine_panic("live source method is empty");
     }
-    compiling_method_class_handle = 0U;
-    compiling_method_selector_id = 0U;
-    compiling_method_argument_count = 0U;
-    *selector_id_out = selector_id;
-    *argument_count_out = argument_count;
-    return allocate_compiled_method_from_words(instruction_words, instruction_count);
+    panic_live_source = source;
+    panic_live_selector_name[0] = '\0';
+    if (source_parse_method_header(
+            source,
+            selector_name,
+            argument_names,
+            &parsed_argument_count,
+            &body_cursor) == 0) {
+        machine_panic("live source method header is invalid");
+    }
+    if (parsed_argument_count != argument_count) {
+        machine_panic("live source method argument count does not match send");
+    }
+    source_copy_identifier(panic_live_selector_name, sizeof(panic_live_selector_name), selector_name);
+    context.selector_id = source_selector_id_for_name(selector_name);
+    if (context.selector_id == 0U) {
+        machine_panic("live source method uses an unknown selector");
+    }
+    lexical_environment_index = source_allocate_lexical_environment(-1);
+    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
+        source_append_binding(lexical_environment_index, argument_names[argument_index], arguments[argument_index]);
+    }
+    allocate_context_object = source_text_contains_identifier(source, "thisContext");
+    home_context_index = source_allocate_home_context(
+        class_object,
+        receiver,
+        lexical_environment_index,
+        sender_context_handle,
+        selector_name,
+        allocate_context_object
+    );
+    context.defining_class = class_object;
+    context.receiver = receiver;
+    context.lexical_environment_index = lexical_environment_index;
+    context.home_context_index = home_context_index;
+    context.current_context_handle = source_home_context_at(home_context_index)->context_handle;
+    context.argument_count = (uint8_t)argument_count;
+    context.is_block = 0U;
+    gc_root_source_method_context(&context_roots, &context);
+    result = source_evaluate_statement_sequence(&context, body_cursor, 0U);
+    gc_unroot(&context_roots);
+    if (block_return_home_context_index == home_context_index) {
+        block_return_home_context_index = -1;
+    }
+    source_home_context_at(home_context_index)->alive = 0U;
+    mark_context_dead(context.current_context_handle);
+    source_release_home_context_if_unused(home_context_index);
+    source_release_lexical_environment_chain_if_unused(lexical_environment_index);
+    panic_live_source = 0;
+    panic_live_selector_name[0] = '\0';
+    push(result.value);
 }
 
-static uint8_t source_environment_has_local_binding(int16_t lexical_environment_index, const char *name) {
-    struct recorz_mvp_source_lexical_environment *environment = source_lexical_environment_at(lexical_environment_index);
-    uint16_t binding_index;
+static void execute_executable(
+    const struct recorz_mvp_executable *executable,
+    const struct recorz_mvp_heap_object *receiver_object,
+    struct recorz_mvp_value receiver,
+    uint16_t argument_count,
+    const struct recorz_mvp_value arguments[],
+    uint16_t current_context_handle
+);
 
-    for (binding_index = 0U; binding_index < environment->binding_count; ++binding_index) {
-        if (source_names_equal(environment->bindings[binding_index].name, name)) {
-            return 1U;
-        }
+static uint8_t live_method_program_append_instruction(
+    struct recorz_mvp_live_method_program_builder *builder,
+    uint8_t opcode,
+    uint16_t operand_a,
+    uint16_t operand_b
+) {
+    if (builder->instruction_count >= LIVE_METHOD_PROGRAM_METHOD_INSTRUCTION_LIMIT) {
+        return 0U;
     }
-    return 0U;
+    builder->instructions[builder->instruction_count].opcode = opcode;
+    builder->instructions[builder->instruction_count].operand_a = operand_a;
+    builder->instructions[builder->instruction_count].operand_b = operand_b;
+    ++builder->instruction_count;
+    return 1U;
 }
 
-static struct recorz_mvp_value source_read_identifier(
-    struct recorz_mvp_source_method_context *context,
-    const char *name
+static uint8_t live_method_program_insert_dup(
+    struct recorz_mvp_live_method_program_builder *builder,
+    uint16_t index
 ) {
-    struct recorz_mvp_value *binding_cell;
-    uint8_t field_index;
-    uint8_t global_id;
+    uint16_t position;
 
-    if (source_names_equal(name, "self")) {
-        return context->receiver;
-    }
-    if (source_names_equal(name, "nil")) {
-        return nil_value();
-    }
-    if (source_names_equal(name, "true")) {
-        return global_value(RECORZ_MVP_GLOBAL_TRUE);
-    }
-    if (source_names_equal(name, "false")) {
-        return global_value(RECORZ_MVP_GLOBAL_FALSE);
+    if (builder->instruction_count >= LIVE_METHOD_PROGRAM_METHOD_INSTRUCTION_LIMIT) {
+        return 0U;
     }
-    if (source_names_equal(name, "thisContext")) {
-        if (context->current_context_handle == 0U) {
-            machine_panic("live source thisContext has no active context object");
+    for (position = builder->instruction_count; position > index; --position) {
+        struct recorz_mvp_instruction *instruction = &builder->instructions[position];
+
+        *instruction = builder->instructions[position - 1U];
+        if ((instruction->opcode == RECORZ_MVP_OP_JUMP ||
+             instruction->opcode == RECORZ_MVP_OP_JUMP_IF_TRUE ||
+             instruction->opcode == RECORZ_MVP_OP_JUMP_IF_FALSE) &&
+            instruction->operand_b >= index) {
+            ++instruction->operand_b;
         }
-        return object_value(context->current_context_handle);
-    }
-    binding_cell = source_lookup_binding_cell(context->lexical_environment_index, name);
-    if (binding_cell != 0) {
-        return *binding_cell;
-    }
-    if (context->receiver.kind == RECORZ_MVP_VALUE_OBJECT &&
-        context->defining_class != 0 &&
-        class_field_index_for_name(context->defining_class, name, &field_index)) {
-        return heap_get_field(heap_object_for_value(context->receiver), field_index);
-    }
-    global_id = source_global_id_for_name(name);
-    if (global_id != 0U) {
-        return global_value(global_id);
     }
-    machine_panic(source_unknown_identifier_error_text(name));
-    return nil_value();
+    builder->instructions[index].opcode = RECORZ_MVP_OP_DUP;
+    builder->instructions[index].operand_a = 0U;
+    builder->instructions[index].operand_b = 0U;
+    ++builder->instruction_count;
+    return 1U;
 }
 
-static void source_write_identifier(
-    struct recorz_mvp_source_method_context *context,
-    const char *name,
-    struct recorz_mvp_value value
+static uint16_t live_method_program_append_literal(
+    struct recorz_mvp_live_method_program_builder *builder,
+    uint8_t kind,
+    int32_t integer
 ) {
-    struct recorz_mvp_value *binding_cell = source_lookup_binding_cell(context->lexical_environment_index, name);
-    uint8_t field_index;
+    uint16_t index = builder->literal_count;
 
-    if (binding_cell != 0) {
-        *binding_cell = value;
-        return;
-    }
-    if (context->receiver.kind == RECORZ_MVP_VALUE_OBJECT &&
-        context->defining_class != 0 &&
-        class_field_index_for_name(context->defining_class, name, &field_index)) {
-        heap_set_field((uint16_t)context->receiver.integer, field_index, value);
-        return;
+    if (index >= LIVE_METHOD_PROGRAM_METHOD_LITERAL_LIMIT) {
+        return 0xFFFFU;
     }
-    machine_panic("live source assignment target is unknown");
+    builder->literals[index].kind = kind;
+    builder->literals[index].integer = integer;
+    builder->literals[index].string = 0;
+    ++builder->literal_count;
+    return index;
 }
 
-static const char *source_parse_temporary_declarations(
-    struct recorz_mvp_source_method_context *context,
-    const char *source
+static char *live_method_program_reserve_scratch(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *text,
+    uint32_t *capacity_out
 ) {
-    struct recorz_mvp_source_lexical_environment *environment =
-        source_lexical_environment_at(context->lexical_environment_index);
-    const char *cursor = source_skip_horizontal_space(source);
+    uint32_t capacity = text_length(text) + 1U;
+    char *buffer;
 
-    if (*cursor != '|') {
-        machine_panic("live source temporary declaration is invalid");
+    if (capacity > sizeof(builder->scratch_text) - builder->scratch_text_used) {
+        return 0;
     }
-    ++cursor;
-    cursor = source_skip_horizontal_space(cursor);
-    while (*cursor != '\0') {
-        char name[METHOD_SOURCE_NAME_LIMIT];
-        uint8_t field_index;
+    buffer = &builder->scratch_text[builder->scratch_text_used];
+    builder->scratch_text_used = (uint16_t)(builder->scratch_text_used + capacity);
+    *capacity_out = capacity;
+    return buffer;
+}
 
-        if (*cursor == '|') {
-            ++cursor;
-            return source_skip_statement_space(cursor);
-        }
-        cursor = source_parse_identifier(cursor, name, sizeof(name));
-        if (cursor == 0) {
-            machine_panic("live source temporary declaration is invalid");
-        }
-        if (source_environment_has_local_binding(context->lexical_environment_index, name)) {
-            machine_panic("live source temporary declaration repeats a local binding");
-        }
-        if (context->defining_class != 0 && class_field_index_for_name(context->defining_class, name, &field_index)) {
-            machine_panic("live source temporary declaration repeats an instance variable");
-        }
-        if (environment->binding_count >= SOURCE_EVAL_BINDING_LIMIT) {
-            machine_panic("live source temporary declaration exceeds binding capacity");
-        }
-        source_append_binding(context->lexical_environment_index, name, nil_value());
-        cursor = source_skip_horizontal_space(cursor);
-    }
-    machine_panic("live source temporary declaration is missing a closing '|'");
-    return 0;
+static void live_method_program_trim_scratch(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *buffer
+) {
+    builder->scratch_text_used = (uint16_t)((buffer - builder->scratch_text) + text_length(buffer) + 1U);
 }
 
-static const char *source_parse_block_header(
-    const char *source,
-    char argument_names[][METHOD_SOURCE_NAME_LIMIT],
-    uint16_t *argument_count_out
+static uint16_t live_method_program_lexical_index(
+    const struct recorz_mvp_live_method_program_builder *builder,
+    const char *name
 ) {
-    const char *cursor = source_skip_statement_space(source);
+    uint16_t lexical_index;
 
-    *argument_count_out = 0U;
-    while (*cursor == ':') {
-        ++cursor;
-        cursor = source_parse_identifier(cursor, argument_names[*argument_count_out], METHOD_SOURCE_NAME_LIMIT);
-        if (cursor == 0) {
-            machine_panic("block parameter name is invalid");
-        }
-        ++(*argument_count_out);
-        if (*argument_count_out > MAX_SEND_ARGS) {
-            machine_panic("block parameter count exceeds send capacity");
+    for (lexical_index = 0U; lexical_index < builder->lexical_count; ++lexical_index) {
+        if (source_names_equal(builder->lexical_names[lexical_index], name)) {
+            return lexical_index;
         }
-        cursor = source_skip_statement_space(cursor);
     }
-    if (*argument_count_out != 0U) {
-        if (*cursor != '|') {
-            machine_panic("block parameter list is missing '|'");
+    return 0xFFFFU;
+}
+
+static uint16_t live_method_program_argument_index(
+    const struct recorz_mvp_live_method_program_builder *builder,
+    const char *name
+) {
+    uint16_t argument_index;
+
+    for (argument_index = 0U; argument_index < builder->argument_count; ++argument_index) {
+        if (source_names_equal(builder->argument_names[argument_index], name)) {
+            return argument_index;
         }
-        ++cursor;
     }
-    return cursor;
+    return 0xFFFFU;
 }
 
-static struct recorz_mvp_source_eval_result source_send_message(
-    struct recorz_mvp_source_method_context *context,
-    struct recorz_mvp_value receiver,
-    const char *selector_text,
-    uint16_t argument_count,
-    const struct recorz_mvp_value arguments[]
+/* Block literals capture their defining scopes, so a block's environment chain has the same layout every time. */
+static uint8_t live_method_program_outer_lexical_slot(
+    const struct recorz_mvp_live_method_program_builder *builder,
+    const char *name,
+    uint16_t *depth_out,
+    uint16_t *index_out
 ) {
-    const struct recorz_mvp_heap_object *source_owner_class = 0;
-    const struct recorz_mvp_live_method_source *source_record;
-    uint16_t selector_id;
+    int16_t lexical_environment_index = builder->outer_lexical_environment_index;
+    uint16_t name_id = source_binding_name_id(name);
+    uint16_t depth = 0U;
 
-    if (receiver.kind == RECORZ_MVP_VALUE_OBJECT &&
-        primitive_kind_for_heap_object(heap_object_for_value(receiver)) == RECORZ_MVP_OBJECT_BLOCK_CLOSURE &&
-        ((source_names_equal(selector_text, "value") && argument_count == 0U) ||
-         (source_names_equal(selector_text, "value:") && argument_count == 1U))) {
-        return source_execute_block_closure(
-            heap_object_for_value(receiver),
-            argument_count,
-            arguments,
-            context->current_context_handle
-        );
+    if (name_id == 0U) {
+        return 0U;
     }
-    if ((source_names_equal(selector_text, "ifTrue:") && argument_count == 1U) ||
-        (source_names_equal(selector_text, "ifFalse:") && argument_count == 1U) ||
-        (source_names_equal(selector_text, "ifTrue:ifFalse:") && argument_count == 2U)) {
-        uint8_t condition_is_true = condition_value_is_true(receiver);
-        uint16_t chosen_index = 0xFFFFU;
+    while (lexical_environment_index >= 0) {
+        const struct recorz_mvp_source_lexical_environment *environment =
+            source_lexical_environment_at(lexical_environment_index);
+        int16_t binding_index = source_environment_binding_index(environment, name_id);
 
-        if (source_names_equal(selector_text, "ifTrue:")) {
-            chosen_index = condition_is_true ? 0U : 0xFFFFU;
-        } else if (source_names_equal(selector_text, "ifFalse:")) {
-            chosen_index = condition_is_true ? 0xFFFFU : 0U;
-        } else {
-            chosen_index = condition_is_true ? 0U : 1U;
-        }
-        if (chosen_index == 0xFFFFU) {
-            return source_eval_value_result(nil_value());
-        }
-        if (arguments[chosen_index].kind != RECORZ_MVP_VALUE_OBJECT ||
-            primitive_kind_for_heap_object(heap_object_for_value(arguments[chosen_index])) != RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
-            machine_panic("conditional send expects a block closure argument");
+        if (binding_index >= 0) {
+            *depth_out = depth;
+            *index_out = (uint16_t)binding_index;
+            return 1U;
         }
-        return source_execute_block_closure(
-            heap_object_for_value(arguments[chosen_index]),
-            0U,
-            0,
-            context->current_context_handle
-        );
+        lexical_environment_index = environment->parent_index;
+        ++depth;
     }
-    if (argument_count == 1U &&
-        receiver.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
-        arguments[0].kind == RECORZ_MVP_VALUE_SMALL_INTEGER) {
-        if (source_names_equal(selector_text, "/")) {
-            if (arguments[0].integer == 0) {
-                machine_panic("/ expects a non-zero small integer argument");
-            }
-            return source_eval_value_result(small_integer_value(receiver.integer / arguments[0].integer));
-        }
-        if (source_names_equal(selector_text, "%")) {
-            if (arguments[0].integer == 0) {
-                machine_panic("% expects a non-zero small integer argument");
-            }
-            return source_eval_value_result(small_integer_value(receiver.integer % arguments[0].integer));
-        }
+    return 0U;
+}
+
+static uint8_t live_method_program_field_index(
+    const struct recorz_mvp_live_method_program_builder *builder,
+    const char *name,
+    uint8_t *field_index_out
+) {
+    return (uint8_t)(builder->class_object != 0 &&
+                     class_field_index_for_name(builder->class_object, name, field_index_out));
+}
+
+static const char *live_method_program_compile_expression(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
+);
+static uint8_t live_method_program_compile_statement_sequence(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *source,
+    uint8_t is_block
+);
+
+/*
+ * Mirrors source_read_identifier: only names that resolve the same way on
+ * every activation compile; anything else leaves the method on the source
+ * evaluator so the runtime error stays where it was.
+ */
+static uint8_t live_method_program_compile_identifier_push(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *name,
+    uint8_t *pushed_display_out
+) {
+    uint16_t index;
+    uint16_t depth;
+    uint8_t field_index;
+    uint8_t global_id;
+
+    *pushed_display_out = 0U;
+    if (source_names_equal(name, "self")) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_SELF, 0U, 0U);
     }
-    selector_id = source_selector_id_for_name(selector_text);
-    if (selector_id == 0U) {
-        machine_panic("live source send uses an unknown selector");
+    if (source_names_equal(name, "nil")) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_NIL, 0U, 0U);
     }
-    if (receiver.kind == RECORZ_MVP_VALUE_OBJECT) {
-        source_record = live_method_source_for_class_chain(
-            class_object_for_heap_object(heap_object_for_value(receiver)),
-            selector_id,
-            (uint8_t)argument_count,
-            &source_owner_class
-        );
-        if (source_record != 0 && source_text_requires_live_evaluator(live_method_source_text(source_record))) {
-            execute_live_source_method_with_sender(
-                source_owner_class,
-                receiver,
-                argument_count,
-                arguments,
-                live_method_source_text(source_record),
-                context->current_context_handle
-            );
-            return source_eval_value_result(pop_value());
-        }
+    if (source_names_equal(name, "true")) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_GLOBAL, RECORZ_MVP_GLOBAL_TRUE, 0U);
+    }
+    if (source_names_equal(name, "false")) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_GLOBAL, RECORZ_MVP_GLOBAL_FALSE, 0U);
+    }
+    if (source_names_equal(name, "thisContext")) {
+        return 0U;
+    }
+    index = live_method_program_lexical_index(builder, name);
+    if (index != 0xFFFFU) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_LEXICAL, 0U, index);
+    }
+    index = live_method_program_argument_index(builder, name);
+    if (index != 0xFFFFU) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_ARGUMENT, index, 0U);
+    }
+    if (live_method_program_outer_lexical_slot(builder, name, &depth, &index)) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_OUTER_LEXICAL, depth, index);
+    }
+    if (live_method_program_field_index(builder, name, &field_index)) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_FIELD, field_index, 0U);
+    }
+    global_id = source_global_id_for_name(name);
+    if (global_id == 0U) {
+        return 0U;
+    }
+    *pushed_display_out = (uint8_t)(global_id == RECORZ_MVP_GLOBAL_DISPLAY);
+    return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_GLOBAL, global_id, 0U);
+}
+
+static uint8_t live_method_program_compile_store(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *name
+) {
+    uint16_t index = live_method_program_lexical_index(builder, name);
+    uint16_t depth;
+    uint8_t field_index;
+
+    if (index != 0xFFFFU) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_STORE_LEXICAL, 0U, index);
+    }
+    if (live_method_program_argument_index(builder, name) != 0xFFFFU) {
+        builder->needs_lexical_arguments = 1U;
+        return 0U;
+    }
+    if (live_method_program_outer_lexical_slot(builder, name, &depth, &index)) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_STORE_OUTER_LEXICAL, depth, index);
     }
-    if (context->current_context_handle == 0U) {
-        uint8_t needs_failure_context = 0U;
+    if (live_method_program_field_index(builder, name, &field_index)) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_STORE_FIELD, field_index, 0U);
+    }
+    return 0U;
+}
 
-        if (receiver.kind == RECORZ_MVP_VALUE_OBJECT) {
-            const struct recorz_mvp_heap_object *class_object =
-                class_object_for_heap_object(heap_object_for_value(receiver));
+static const char *live_method_program_compile_unary_messages(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
+) {
+    char token[METHOD_SOURCE_NAME_LIMIT];
 
-            if (lookup_builtin_method_descriptor(class_object, selector_id, argument_count) == 0) {
-                needs_failure_context = 1U;
-            }
-        } else if (receiver.kind == RECORZ_MVP_VALUE_SMALL_INTEGER) {
-            if (selector_id != RECORZ_MVP_SELECTOR_EQUAL &&
-                selector_id != RECORZ_MVP_SELECTOR_LESS_THAN &&
-                selector_id != RECORZ_MVP_SELECTOR_GREATER_THAN &&
-                selector_id != RECORZ_MVP_SELECTOR_ADD &&
-                selector_id != RECORZ_MVP_SELECTOR_SUBTRACT &&
-                selector_id != RECORZ_MVP_SELECTOR_MULTIPLY &&
-                selector_id != RECORZ_MVP_SELECTOR_PRINT_STRING) {
-                needs_failure_context = 1U;
-            }
-        } else if (receiver.kind == RECORZ_MVP_VALUE_STRING) {
-            if (selector_id != RECORZ_MVP_SELECTOR_PRINT_STRING &&
-                selector_id != RECORZ_MVP_SELECTOR_SIZE &&
-                selector_id != RECORZ_MVP_SELECTOR_AT) {
-                needs_failure_context = 1U;
-            }
-        } else {
-            needs_failure_context = 1U;
-        }
-        if (needs_failure_context) {
-            const char *context_detail_text = context->is_block != 0U
-                ? "<block>"
-                : (context->selector_id == 0U ? "<doIt>" : selector_name(context->selector_id));
+    cursor = source_skip_horizontal_space(cursor);
+    while (source_char_is_identifier_start(*cursor)) {
+        const char *selector_cursor = source_parse_identifier(cursor, token, sizeof(token));
+        const char *after_selector;
+        uint16_t selector_id;
 
-            context->current_context_handle = allocate_source_context_object(
-                0U,
-                context->receiver,
-                context_detail_text
-            );
+        if (selector_cursor == 0) {
+            break;
+        }
+        after_selector = source_skip_horizontal_space(selector_cursor);
+        if (*after_selector == ':') {
+            break;
+        }
+        selector_id = source_selector_id_for_name(token);
+        if (selector_id == 0U ||
+            !live_method_program_append_instruction(builder, RECORZ_MVP_OP_SEND, selector_id, 0U)) {
+            return 0;
         }
+        builder->cascade_receiver_end = (uint16_t)(builder->instruction_count - 1U);
+        cursor = after_selector;
     }
-    perform_send_with_sender(
-        receiver,
-        selector_id,
-        argument_count,
-        arguments,
-        context->current_context_handle,
-        0
-    );
-    receiver = pop_value();
-    return source_eval_value_result(receiver);
+    return cursor;
 }
 
-static struct recorz_mvp_source_eval_result source_evaluate_primary_expression(
-    struct recorz_mvp_source_method_context *context,
-    const char *cursor,
-    const char **cursor_out
+static const char *live_method_program_compile_primary(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
 ) {
-    struct recorz_mvp_source_eval_result result;
-    const char *parsed_cursor;
     char token[METHOD_SOURCE_NAME_LIMIT];
-    char special_selector[METHOD_SOURCE_NAME_LIMIT];
-    char block_source[METHOD_SOURCE_CHUNK_LIMIT];
+    const char *parsed_cursor;
     int32_t small_integer;
     uint32_t root_id;
+    uint8_t pushed_display = 0U;
 
     cursor = source_skip_horizontal_space(cursor);
     if (*cursor == '(') {
-        result = source_evaluate_expression(context, cursor + 1, &parsed_cursor);
-        if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-            return result;
+        parsed_cursor = live_method_program_compile_expression(builder, cursor + 1);
+        if (parsed_cursor == 0) {
+            return 0;
         }
         parsed_cursor = source_skip_horizontal_space(parsed_cursor);
         if (*parsed_cursor != ')') {
-            machine_panic("live source parenthesized expression is missing ')'");
+            return 0;
         }
         cursor = parsed_cursor + 1;
-    } else if (*cursor == '[') {
-        uint16_t block_handle;
-
-        parsed_cursor = source_copy_bracket_body(cursor, block_source, sizeof(block_source));
-        if (parsed_cursor == 0) {
-            machine_panic("live source block literal is invalid");
+    } else if (*cursor == '[' || *cursor == '\'') {
+        uint16_t text_offset = builder->literal_text_pool_used;
+        char *text = &builder->literal_text_pool[text_offset];
+        uint32_t text_capacity = (uint32_t)sizeof(builder->literal_text_pool) - text_offset;
+        uint8_t is_block = (uint8_t)(*cursor == '[');
+        uint16_t literal_index;
+
+        if (text_length(cursor) + 1U > text_capacity) {
+            return 0;
         }
-        block_handle = allocate_block_closure_from_source(block_source, context->receiver);
-        source_register_block_state(
-            block_handle,
-            context->defining_class,
-            context->lexical_environment_index,
-            context->home_context_index
-        );
-        result = source_eval_value_result(object_value(block_handle));
-        cursor = parsed_cursor;
-    } else if (*cursor == '\'') {
-        char quoted_text[METHOD_SOURCE_CHUNK_LIMIT];
-
-        parsed_cursor = source_copy_single_quoted_text(cursor, quoted_text, sizeof(quoted_text));
+        parsed_cursor = is_block
+            ? source_copy_bracket_body(cursor, text, text_capacity)
+            : source_copy_single_quoted_text(cursor, text, text_capacity);
         if (parsed_cursor == 0) {
-            machine_panic("live source string literal is invalid");
+            return 0;
         }
-        if (!context->is_block &&
-            context->defining_class != 0 &&
-            context->selector_id != 0U) {
-            uint16_t literal_slot = remember_live_string_literal(
-                heap_handle_for_object(context->defining_class),
-                context->selector_id,
-                context->argument_count,
-                quoted_text
-            );
-
-            result = source_eval_value_result(string_value(live_string_literals[literal_slot - 1U].text));
-        } else {
-            result = source_eval_value_result(string_value(runtime_string_intern_copy(quoted_text)));
+        builder->literal_text_pool_used = (uint16_t)(text_offset + text_length(text) + 1U);
+        literal_index = live_method_program_append_literal(builder, RECORZ_MVP_LITERAL_STRING, text_offset);
+        if (literal_index == 0xFFFFU ||
+            !live_method_program_append_instruction(
+                builder,
+                is_block ? RECORZ_MVP_OP_PUSH_BLOCK_LITERAL : RECORZ_MVP_OP_PUSH_LITERAL,
+                0U,
+                literal_index)) {
+            return 0;
+        }
+        if (is_block) {
+            builder->has_block_literal = 1U;
         }
         cursor = parsed_cursor;
     } else {
         parsed_cursor = source_parse_small_integer(cursor, &small_integer);
         if (parsed_cursor != 0) {
-            result = source_eval_value_result(small_integer_value(small_integer));
+            if (small_integer >= -32768 && small_integer <= 32767) {
+                if (!live_method_program_append_instruction(
+                        builder,
+                        RECORZ_MVP_OP_PUSH_SMALL_INTEGER,
+                        0U,
+                        (uint16_t)(int16_t)small_integer)) {
+                    return 0;
+                }
+            } else {
+                uint16_t literal_index =
+                    live_method_program_append_literal(builder, RECORZ_MVP_LITERAL_SMALL_INTEGER, small_integer);
+
+                if (literal_index == 0xFFFFU ||
+                    !live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_LITERAL, 0U, literal_index)) {
+                    return 0;
+                }
+            }
             cursor = parsed_cursor;
         } else {
             parsed_cursor = source_parse_identifier(cursor, token, sizeof(token));
-            if (parsed_cursor == 0) {
-                machine_panic("live source primary expression is invalid");
+            if (parsed_cursor == 0 ||
+                !live_method_program_compile_identifier_push(builder, token, &pushed_display)) {
+                return 0;
             }
-            result = source_eval_value_result(source_read_identifier(context, token));
             cursor = parsed_cursor;
         }
     }
 
     cursor = source_skip_horizontal_space(cursor);
-    if (result.value.kind == RECORZ_MVP_VALUE_OBJECT &&
-        (uint16_t)result.value.integer == global_handles[RECORZ_MVP_GLOBAL_DISPLAY]) {
-        const char *selector_cursor = source_parse_identifier(cursor, special_selector, sizeof(special_selector));
+    if (pushed_display) {
+        const char *selector_cursor = source_parse_identifier(cursor, token, sizeof(token));
 
         if (selector_cursor != 0) {
             const char *after_selector = source_skip_horizontal_space(selector_cursor);
 
-            if (*after_selector != ':' &&
-                display_source_root_id_for_selector(special_selector, &root_id)) {
-                result = source_eval_value_result(seed_root_value(root_id));
+            if (*after_selector != ':' && display_source_root_id_for_selector(token, &root_id)) {
+                builder->instructions[builder->instruction_count - 1U].opcode = RECORZ_MVP_OP_PUSH_ROOT;
+                builder->instructions[builder->instruction_count - 1U].operand_a = (uint16_t)root_id;
                 cursor = after_selector;
             }
         }
     }
-    while (source_char_is_identifier_start(*cursor)) {
-        char selector_name[METHOD_SOURCE_NAME_LIMIT];
-        const char *selector_cursor = source_parse_identifier(cursor, selector_name, sizeof(selector_name));
-        const char *after_selector;
+    builder->cascade_receiver_end = 0xFFFFU;
+    return live_method_program_compile_unary_messages(builder, cursor);
+}
 
-        if (selector_cursor == 0) {
-            break;
+static const char *live_method_program_compile_binary_messages(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
+) {
+    cursor = source_skip_horizontal_space(cursor);
+    while (source_char_is_live_binary_selector(*cursor)) {
+        char selector_text[3];
+        uint16_t receiver_end = builder->instruction_count;
+        uint16_t selector_id;
+        uint8_t special_opcode;
+
+        cursor = source_parse_binary_selector(cursor, selector_text);
+        cursor = live_method_program_compile_primary(builder, cursor);
+        if (cursor == 0) {
+            return 0;
         }
-        after_selector = source_skip_horizontal_space(selector_cursor);
-        if (*after_selector == ':') {
-            break;
+        selector_id = source_selector_id_for_name(selector_text);
+        special_opcode = special_send_opcode_for_selector(selector_id, 1U);
+        if (selector_id == 0U ||
+            !(special_opcode != 0U
+                  ? live_method_program_append_instruction(builder, special_opcode, 0U, 0U)
+                  : live_method_program_append_instruction(builder, RECORZ_MVP_OP_SEND, selector_id, 1U))) {
+            return 0;
         }
-        result = source_send_message(context, result.value, selector_name, 0U, 0);
-        if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-            return result;
+        builder->cascade_receiver_end = receiver_end;
+        cursor = source_skip_horizontal_space(cursor);
+    }
+    return cursor;
+}
+
+static const char *live_method_program_compile_binary_expression(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
+) {
+    cursor = live_method_program_compile_primary(builder, cursor);
+    if (cursor == 0) {
+        return 0;
+    }
+    return live_method_program_compile_binary_messages(builder, cursor);
+}
+
+static uint8_t live_method_program_compile_inline_block(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *source
+) {
+    const char *body_cursor = source_skip_statement_space(source);
+
+    if (*body_cursor == ':') {
+        return 0U;
+    }
+    return live_method_program_compile_statement_sequence(builder, body_cursor, 1U);
+}
+
+static const char *live_method_program_compile_conditional_expression(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
+) {
+    char first_selector[METHOD_SOURCE_NAME_LIMIT];
+    char second_selector[METHOD_SOURCE_NAME_LIMIT];
+    uint16_t scratch_mark = builder->scratch_text_used;
+    char *first_block;
+    char *second_block = 0;
+    uint32_t block_capacity;
+    const char *part_cursor;
+    const char *after_selector;
+    uint16_t branch_index;
+    uint16_t jump_index;
+    uint8_t first_is_true;
+
+    part_cursor = source_parse_identifier(cursor, first_selector, sizeof(first_selector));
+    if (part_cursor == 0) {
+        return 0;
+    }
+    after_selector = source_skip_statement_space(part_cursor);
+    if (*after_selector != ':') {
+        return 0;
+    }
+    after_selector = source_skip_statement_space(after_selector + 1);
+    first_block = live_method_program_reserve_scratch(builder, after_selector, &block_capacity);
+    if (first_block == 0) {
+        return 0;
+    }
+    cursor = source_copy_bracket_body(after_selector, first_block, block_capacity);
+    if (cursor == 0) {
+        return 0;
+    }
+    live_method_program_trim_scratch(builder, first_block);
+    cursor = source_skip_statement_space(cursor);
+    part_cursor = source_parse_identifier(cursor, second_selector, sizeof(second_selector));
+    if (part_cursor != 0) {
+        after_selector = source_skip_statement_space(part_cursor);
+        if (*after_selector == ':' &&
+            ((source_names_equal(first_selector, "ifTrue") && source_names_equal(second_selector, "ifFalse")) ||
+             (source_names_equal(first_selector, "ifFalse") && source_names_equal(second_selector, "ifTrue")))) {
+            after_selector = source_skip_statement_space(after_selector + 1);
+            if (*after_selector != '[') {
+                return 0;
+            }
+            second_block = live_method_program_reserve_scratch(builder, after_selector, &block_capacity);
+            if (second_block == 0) {
+                return 0;
+            }
+            cursor = source_copy_bracket_body(after_selector, second_block, block_capacity);
+            if (cursor == 0) {
+                return 0;
+            }
+            live_method_program_trim_scratch(builder, second_block);
         }
-        cursor = after_selector;
     }
-    *cursor_out = cursor;
-    return result;
+
+    first_is_true = (uint8_t)source_names_equal(first_selector, "ifTrue");
+    branch_index = builder->instruction_count;
+    if (!live_method_program_append_instruction(
+            builder,
+            first_is_true ? RECORZ_MVP_OP_JUMP_IF_FALSE : RECORZ_MVP_OP_JUMP_IF_TRUE,
+            0U,
+            0U) ||
+        !live_method_program_compile_inline_block(builder, first_block)) {
+        return 0;
+    }
+    jump_index = builder->instruction_count;
+    if (!live_method_program_append_instruction(builder, RECORZ_MVP_OP_JUMP, 0U, 0U)) {
+        return 0;
+    }
+    builder->instructions[branch_index].operand_b = builder->instruction_count;
+    if (second_block != 0) {
+        if (!live_method_program_compile_inline_block(builder, second_block)) {
+            return 0;
+        }
+    } else if (!live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_NIL, 0U, 0U)) {
+        return 0;
+    }
+    builder->instructions[jump_index].operand_b = builder->instruction_count;
+    builder->scratch_text_used = scratch_mark;
+    return cursor;
 }
 
-static struct recorz_mvp_source_eval_result source_evaluate_binary_expression(
-    struct recorz_mvp_source_method_context *context,
-    const char *cursor,
-    const char **cursor_out
+static const char *live_method_program_compile_keyword_message(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
 ) {
-    struct recorz_mvp_source_eval_result receiver_result;
+    char selector_name[METHOD_SOURCE_NAME_LIMIT];
+    char selector_part[METHOD_SOURCE_NAME_LIMIT];
+    const char *part_cursor;
+    uint16_t receiver_end = builder->instruction_count;
+    uint16_t argument_count = 0U;
+    uint32_t selector_length = 0U;
+    uint16_t selector_id;
+    uint8_t special_opcode;
 
-    receiver_result = source_evaluate_primary_expression(context, cursor, &cursor);
-    if (receiver_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-        return receiver_result;
+    cursor = source_skip_horizontal_space(cursor);
+    part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
+    if (part_cursor == 0) {
+        return cursor;
+    }
+    part_cursor = source_skip_horizontal_space(part_cursor);
+    if (*part_cursor != ':') {
+        return cursor;
+    }
+    selector_name[0] = '\0';
+    do {
+        uint32_t part_index = 0U;
+
+        if (argument_count >= MAX_SEND_ARGS) {
+            return 0;
+        }
+        while (selector_part[part_index] != '\0') {
+            if (selector_length + 2U >= sizeof(selector_name)) {
+                return 0;
+            }
+            selector_name[selector_length++] = selector_part[part_index++];
+        }
+        selector_name[selector_length++] = ':';
+        selector_name[selector_length] = '\0';
+        cursor = live_method_program_compile_binary_expression(builder, part_cursor + 1);
+        if (cursor == 0) {
+            return 0;
+        }
+        ++argument_count;
+        cursor = source_skip_horizontal_space(cursor);
+        part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
+        if (part_cursor == 0) {
+            break;
+        }
+        part_cursor = source_skip_horizontal_space(part_cursor);
+    } while (*part_cursor == ':');
+    selector_id = source_selector_id_for_name(selector_name);
+    special_opcode = special_send_opcode_for_selector(selector_id, argument_count);
+    if (selector_id == 0U ||
+        !(special_opcode != 0U
+              ? live_method_program_append_instruction(builder, special_opcode, 0U, 0U)
+              : live_method_program_append_instruction(builder, RECORZ_MVP_OP_SEND, selector_id, argument_count))) {
+        return 0;
     }
-    cursor = source_skip_horizontal_space(cursor);
-    while (source_char_is_live_binary_selector(*cursor)) {
-        char selector_name[2];
-        struct recorz_mvp_source_eval_result argument_result;
+    builder->cascade_receiver_end = receiver_end;
+    return cursor;
+}
 
-        selector_name[0] = *cursor++;
-        selector_name[1] = '\0';
-        argument_result = source_evaluate_primary_expression(context, cursor, &cursor);
-        if (argument_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-            return argument_result;
+/* Each cascade part re-sends to the receiver of the last message, duplicated under its arguments. */
+static const char *live_method_program_compile_cascade(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
+) {
+    uint16_t receiver_end = builder->cascade_receiver_end;
+
+    while (*cursor == ';') {
+        if (receiver_end == 0xFFFFU ||
+            !live_method_program_insert_dup(builder, receiver_end) ||
+            !live_method_program_append_instruction(builder, RECORZ_MVP_OP_POP, 0U, 0U)) {
+            return 0;
         }
-        receiver_result = source_send_message(context, receiver_result.value, selector_name, 1U, &argument_result.value);
-        if (receiver_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-            return receiver_result;
+        receiver_end = builder->instruction_count;
+        cursor = live_method_program_compile_unary_messages(builder, cursor + 1);
+        if (cursor != 0) {
+            cursor = live_method_program_compile_binary_messages(builder, cursor);
+        }
+        if (cursor != 0) {
+            cursor = live_method_program_compile_keyword_message(builder, cursor);
+        }
+        if (cursor == 0 || builder->instruction_count == receiver_end) {
+            return 0;
         }
         cursor = source_skip_horizontal_space(cursor);
     }
-    *cursor_out = cursor;
-    return receiver_result;
+    builder->cascade_receiver_end = 0xFFFFU;
+    return cursor;
 }
 
-static struct recorz_mvp_source_eval_result source_evaluate_expression(
-    struct recorz_mvp_source_method_context *context,
-    const char *cursor,
-    const char **cursor_out
+static const char *live_method_program_compile_expression(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *cursor
 ) {
-    char selector_name[METHOD_SOURCE_NAME_LIMIT];
     char selector_part[METHOD_SOURCE_NAME_LIMIT];
-    struct recorz_mvp_source_eval_result receiver_result;
-    struct recorz_mvp_value arguments[MAX_SEND_ARGS];
     const char *part_cursor;
-    uint16_t argument_count = 0U;
-    uint32_t selector_length = 0U;
 
-    receiver_result = source_evaluate_binary_expression(context, cursor, &cursor);
-    if (receiver_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-        return receiver_result;
+    cursor = live_method_program_compile_binary_expression(builder, cursor);
+    if (cursor == 0) {
+        return 0;
     }
     cursor = source_skip_horizontal_space(cursor);
     part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
-    if (part_cursor == 0) {
-        *cursor_out = cursor;
-        return receiver_result;
+    if (part_cursor != 0 &&
+        (source_names_equal(selector_part, "ifTrue") || source_names_equal(selector_part, "ifFalse"))) {
+        part_cursor = source_skip_horizontal_space(part_cursor);
+        if (*part_cursor == ':' && *source_skip_statement_space(part_cursor + 1) == '[') {
+            builder->cascade_receiver_end = 0xFFFFU;
+            return live_method_program_compile_conditional_expression(builder, cursor);
+        }
     }
-    part_cursor = source_skip_horizontal_space(part_cursor);
-    if (*part_cursor != ':') {
-        *cursor_out = cursor;
-        return receiver_result;
+    cursor = live_method_program_compile_keyword_message(builder, cursor);
+    if (cursor == 0) {
+        return 0;
     }
-    if ((source_names_equal(selector_part, "ifTrue") || source_names_equal(selector_part, "ifFalse")) &&
-        *source_skip_statement_space(part_cursor + 1) == '[') {
-        return source_evaluate_conditional_expression(context, receiver_result, cursor, cursor_out);
+    return live_method_program_compile_cascade(builder, source_skip_horizontal_space(cursor));
+}
+
+static const char *live_method_program_parse_temporary_declarations(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *source
+) {
+    const char *cursor = source_skip_horizontal_space(source);
+
+    if (*cursor != '|') {
+        return 0;
     }
-    while (selector_part[selector_length] != '\0') {
-        selector_name[selector_length] = selector_part[selector_length];
-        ++selector_length;
+    ++cursor;
+    cursor = source_skip_horizontal_space(cursor);
+    while (*cursor != '\0') {
+        char name[METHOD_SOURCE_NAME_LIMIT];
+        uint8_t field_index;
+
+        if (*cursor == '|') {
+            ++cursor;
+            return source_skip_statement_space(cursor);
+        }
+        cursor = source_parse_identifier(cursor, name, sizeof(name));
+        if (cursor == 0 ||
+            live_method_program_lexical_index(builder, name) != 0xFFFFU ||
+            live_method_program_argument_index(builder, name) != 0xFFFFU ||
+            live_method_program_field_index(builder, name, &field_index) ||
+            builder->lexical_count >= LEXICAL_LIMIT) {
+            return 0;
+        }
+        source_copy_identifier(
+            builder->lexical_names[builder->lexical_count],
+            sizeof(builder->lexical_names[builder->lexical_count]),
+            name
+        );
+        ++builder->lexical_count;
+        cursor = source_skip_horizontal_space(cursor);
     }
-    selector_name[selector_length] = '\0';
-    do {
-        struct recorz_mvp_source_eval_result argument_result;
-        uint32_t part_index = 0U;
+    return 0;
+}
 
-        if (argument_count >= MAX_SEND_ARGS) {
-            machine_panic("live source send exceeds argument capacity");
+static uint8_t live_method_program_compile_statement_sequence(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const char *source,
+    uint8_t is_block
+) {
+    const char *cursor = source_skip_statement_space(source);
+    uint16_t scratch_mark = builder->scratch_text_used;
+    uint32_t statement_capacity;
+    char *statement;
+    uint8_t saw_statement = 0U;
+
+    if (*cursor == '|') {
+        /* Inline blocks scope their temporaries to a child environment; keep those on the evaluator. */
+        if (is_block) {
+            return 0U;
         }
-        if (selector_length + 1U >= sizeof(selector_name)) {
-            machine_panic("live source selector exceeds capacity");
+        cursor = live_method_program_parse_temporary_declarations(builder, cursor);
+        if (cursor == 0) {
+            return 0U;
         }
-        selector_name[selector_length++] = ':';
-        selector_name[selector_length] = '\0';
-        argument_result = source_evaluate_binary_expression(context, part_cursor + 1, &cursor);
-        if (argument_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-            return argument_result;
+    }
+    statement = live_method_program_reserve_scratch(builder, cursor, &statement_capacity);
+    if (statement == 0) {
+        return 0U;
+    }
+    while (source_copy_next_statement(&cursor, statement, statement_capacity) != 0U) {
+        char binding_name[METHOD_SOURCE_NAME_LIMIT];
+        const char *trimmed = source_skip_statement_space(statement);
+        const char *binding_cursor;
+
+        if (trimmed[0] == '\0') {
+            continue;
         }
-        arguments[argument_count++] = argument_result.value;
-        cursor = source_skip_horizontal_space(cursor);
-        part_cursor = source_parse_identifier(cursor, selector_part, sizeof(selector_part));
-        if (part_cursor == 0) {
-            break;
+        if (saw_statement &&
+            !live_method_program_append_instruction(builder, RECORZ_MVP_OP_POP, 0U, 0U)) {
+            return 0U;
         }
-        part_cursor = source_skip_horizontal_space(part_cursor);
-        if (*part_cursor != ':') {
-            break;
+        if (trimmed[0] == '^') {
+            trimmed = live_method_program_compile_expression(builder, trimmed + 1);
+            if (trimmed == 0 ||
+                *source_skip_horizontal_space(trimmed) != '\0' ||
+                !live_method_program_append_instruction(
+                    builder,
+                    builder->is_block_body ? RECORZ_MVP_OP_RETURN_NON_LOCAL : RECORZ_MVP_OP_RETURN,
+                    0U,
+                    0U)) {
+                return 0U;
+            }
+            builder->scratch_text_used = scratch_mark;
+            return 1U;
         }
-        while (selector_part[part_index] != '\0') {
-            if (selector_length + 1U >= sizeof(selector_name)) {
-                machine_panic("live source selector exceeds capacity");
+        binding_cursor = source_parse_identifier(trimmed, binding_name, sizeof(binding_name));
+        if (binding_cursor != 0) {
+            binding_cursor = source_skip_horizontal_space(binding_cursor);
+            if (binding_cursor[0] == ':' && binding_cursor[1] == '=') {
+                trimmed = live_method_program_compile_expression(builder, binding_cursor + 2);
+                if (trimmed == 0 ||
+                    *source_skip_horizontal_space(trimmed) != '\0' ||
+                    !live_method_program_append_instruction(builder, RECORZ_MVP_OP_DUP, 0U, 0U) ||
+                    !live_method_program_compile_store(builder, binding_name)) {
+                    return 0U;
+                }
+                saw_statement = 1U;
+                continue;
             }
-            selector_name[selector_length++] = selector_part[part_index++];
         }
-        selector_name[selector_length] = '\0';
-    } while (*part_cursor == ':');
-    *cursor_out = cursor;
-    receiver_result = source_send_message(context, receiver_result.value, selector_name, argument_count, arguments);
-    *cursor_out = cursor;
-    return receiver_result;
+        trimmed = live_method_program_compile_expression(builder, trimmed);
+        if (trimmed == 0 || *source_skip_horizontal_space(trimmed) != '\0') {
+            return 0U;
+        }
+        saw_statement = 1U;
+    }
+    builder->scratch_text_used = scratch_mark;
+    if (!saw_statement) {
+        return live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_NIL, 0U, 0U);
+    }
+    return 1U;
 }
 
-static struct recorz_mvp_source_eval_result source_execute_block_closure(
-    const struct recorz_mvp_heap_object *object,
-    uint16_t argument_count,
-    const struct recorz_mvp_value arguments[],
-    uint16_t sender_context_handle
+/*
+ * The evaluator parses brackets, strings and identifiers lazily and panics on
+ * malformed text only when that text runs. Reject such sources up front so
+ * installing them keeps its old behaviour.
+ */
+static uint8_t live_method_program_source_is_well_formed(const char *source) {
+    uint32_t block_depth = 0U;
+    uint32_t identifier_length = 0U;
+    uint8_t in_string = 0U;
+
+    while (*source != '\0') {
+        char ch = *source++;
+
+        if (ch == '\'') {
+            in_string = (uint8_t)!in_string;
+        } else if (!in_string && ch == '[') {
+            ++block_depth;
+        } else if (!in_string && ch == ']') {
+            if (block_depth == 0U) {
+                return 0U;
+            }
+            --block_depth;
+        }
+        if (!in_string && source_char_is_identifier_char(ch)) {
+            if (++identifier_length >= METHOD_SOURCE_NAME_LIMIT) {
+                return 0U;
+            }
+        } else {
+            identifier_length = 0U;
+        }
+    }
+    return (uint8_t)(!in_string && block_depth == 0U);
+}
+
+static void live_method_program_builder_reset(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const struct recorz_mvp_heap_object *class_object,
+    uint8_t arguments_are_lexical
+) {
+    builder->class_object = class_object;
+    builder->instruction_count = 0U;
+    builder->literal_count = 0U;
+    builder->literal_text_pool_used = 0U;
+    builder->scratch_text_used = 0U;
+    builder->argument_count = 0U;
+    builder->lexical_count = 0U;
+    builder->outer_lexical_environment_index = -1;
+    builder->arguments_are_lexical = arguments_are_lexical;
+    builder->has_block_literal = 0U;
+    builder->needs_lexical_arguments = 0U;
+    builder->is_block_body = 0U;
+}
+
+static uint8_t live_method_program_copy_lexical_arguments(
+    struct recorz_mvp_live_method_program_builder *builder
 ) {
-    struct recorz_mvp_runtime_block_state block_state_storage;
-    const struct recorz_mvp_runtime_block_state *block_state = 0;
-    const struct recorz_mvp_heap_object *defining_class = 0;
-    struct recorz_mvp_source_method_context context;
-    struct recorz_mvp_source_eval_result result;
-    struct recorz_mvp_value source_value;
-    struct recorz_mvp_value home_receiver;
-    char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
-    uint16_t parsed_argument_count = 0U;
-    const char *body_cursor;
-    int16_t lexical_environment_index;
     uint16_t argument_index;
-    uint8_t allocate_context_object;
 
-    if (primitive_kind_for_heap_object(object) != RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
-        machine_panic("source block execution expects a block closure");
+    /* Blocks and assignments see arguments as bindings, so copy them into lexical slots first. */
+    for (argument_index = 0U; argument_index < builder->argument_count; ++argument_index) {
+        source_copy_identifier(
+            builder->lexical_names[argument_index],
+            sizeof(builder->lexical_names[argument_index]),
+            builder->argument_names[argument_index]
+        );
+        if (!live_method_program_append_instruction(builder, RECORZ_MVP_OP_PUSH_ARGUMENT, argument_index, 0U) ||
+            !live_method_program_append_instruction(builder, RECORZ_MVP_OP_STORE_LEXICAL, 0U, argument_index)) {
+            return 0U;
+        }
     }
-    source_value = heap_get_field(object, BLOCK_CLOSURE_FIELD_SOURCE);
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING || source_value.string == 0) {
-        machine_panic("block closure source field is invalid");
+    builder->lexical_count = builder->argument_count;
+    return 1U;
+}
+
+static uint8_t build_live_method_program(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const struct recorz_mvp_heap_object *class_object,
+    const char *source,
+    uint8_t arguments_are_lexical
+) {
+    char selector_name[METHOD_SOURCE_NAME_LIMIT];
+    const char *body_cursor;
+
+    live_method_program_builder_reset(builder, class_object, arguments_are_lexical);
+    if (source_parse_method_header(
+            source,
+            selector_name,
+            builder->argument_names,
+            &builder->argument_count,
+            &body_cursor) == 0) {
+        return 0U;
     }
-    home_receiver = heap_get_field(object, BLOCK_CLOSURE_FIELD_HOME_RECEIVER);
-    if (source_block_state_for_handle(heap_handle_for_object(object), &block_state_storage)) {
-        block_state = &block_state_storage;
-        lexical_environment_index = source_allocate_lexical_environment(block_state->lexical_environment_index);
-        defining_class = block_state->defining_class;
-    } else {
-        lexical_environment_index = source_allocate_lexical_environment(-1);
-        if (home_receiver.kind == RECORZ_MVP_VALUE_OBJECT) {
-            defining_class = class_object_for_heap_object(heap_object_for_value(home_receiver));
-        } else {
-            defining_class = class_object_for_kind(RECORZ_MVP_OBJECT_OBJECT);
-        }
+    if (arguments_are_lexical && !live_method_program_copy_lexical_arguments(builder)) {
+        return 0U;
     }
-    body_cursor = source_parse_block_header(source_value.string, argument_names, &parsed_argument_count);
-    if (parsed_argument_count != argument_count) {
-        machine_panic("block argument count does not match activation");
+    if (!live_method_program_compile_statement_sequence(builder, body_cursor, 0U)) {
+        return 0U;
     }
-    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
-        source_append_binding(lexical_environment_index, argument_names[argument_index], arguments[argument_index]);
+    return live_method_program_append_instruction(builder, RECORZ_MVP_OP_RETURN, 0U, 0U);
+}
+
+/* A block body returns its last statement's value; '^' unwinds to the home activation instead. */
+static uint8_t build_compiled_block_program(
+    struct recorz_mvp_live_method_program_builder *builder,
+    const struct recorz_mvp_heap_object *class_object,
+    const char *source,
+    int16_t outer_lexical_environment_index,
+    uint8_t arguments_are_lexical
+) {
+    const char *body_cursor;
+
+    live_method_program_builder_reset(builder, class_object, arguments_are_lexical);
+    builder->outer_lexical_environment_index = outer_lexical_environment_index;
+    builder->is_block_body = 1U;
+    body_cursor = source_parse_block_header(source, builder->argument_names, &builder->argument_count);
+    if (arguments_are_lexical && !live_method_program_copy_lexical_arguments(builder)) {
+        return 0U;
     }
-    allocate_context_object = source_text_contains_identifier(source_value.string, "thisContext");
-    context.defining_class = defining_class;
-    context.receiver = home_receiver;
-    context.lexical_environment_index = lexical_environment_index;
-    context.home_context_index = block_state == 0 ? -1 : block_state->home_context_index;
-    context.current_context_handle = allocate_context_object != 0U ?
-        allocate_source_context_object(
-            sender_context_handle,
-            home_receiver,
-            "<block>"
-        ) :
-        0U;
-    context.selector_id = 0U;
-    context.argument_count = 0U;
-    context.is_block = 1U;
-    result = source_evaluate_statement_sequence(&context, body_cursor, 1U);
-    if (context.current_context_handle != 0U) {
-        heap_set_field(context.current_context_handle, CONTEXT_FIELD_ALIVE, boolean_value(0U));
+    if (!live_method_program_compile_statement_sequence(builder, body_cursor, 0U)) {
+        return 0U;
     }
-    if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-        if (context.home_context_index < 0) {
-            machine_panic("block attempted a non-local return without a live home context");
+    return live_method_program_append_instruction(builder, RECORZ_MVP_OP_RETURN, 0U, 0U);
+}
+
+static void repack_live_method_program_pools(void) {
+    uint16_t source_index;
+    uint16_t instruction_write = 0U;
+    uint16_t literal_write = 0U;
+    uint16_t lexical_write = 0U;
+
+    for (source_index = 0U; source_index < live_method_source_count; ++source_index) {
+        struct recorz_mvp_live_method_source *source_record = &live_method_sources[source_index];
+        uint16_t index;
+
+        if (source_record->execution_kind != RECORZ_MVP_LIVE_METHOD_EXECUTION_PROGRAM) {
+            continue;
         }
-        if (!source_home_context_at(context.home_context_index)->alive) {
-            machine_panic("block attempted a non-local return to a dead home context");
+        if (source_record->program_instruction_offset < instruction_write ||
+            source_record->program_literal_offset < literal_write ||
+            source_record->program_lexical_name_offset < lexical_write) {
+            machine_panic("live method program pool is out of order");
+        }
+        for (index = 0U; index < source_record->program_instruction_count; ++index) {
+            live_method_program_instructions[instruction_write + index] =
+                live_method_program_instructions[source_record->program_instruction_offset + index];
+        }
+        for (index = 0U; index < source_record->program_literal_count; ++index) {
+            live_method_program_literals[literal_write + index] =
+                live_method_program_literals[source_record->program_literal_offset + index];
+        }
+        if (source_record->program_has_block_literal) {
+            for (index = 0U; index < source_record->program_lexical_count; ++index) {
+                source_copy_identifier(
+                    live_method_program_lexical_names[lexical_write + index],
+                    sizeof(live_method_program_lexical_names[lexical_write + index]),
+                    live_method_program_lexical_names[source_record->program_lexical_name_offset + index]
+                );
+            }
+            source_record->program_lexical_name_offset = lexical_write;
+            lexical_write = (uint16_t)(lexical_write + source_record->program_lexical_count);
         }
+        source_record->program_instruction_offset = instruction_write;
+        source_record->program_literal_offset = literal_write;
+        instruction_write = (uint16_t)(instruction_write + source_record->program_instruction_count);
+        literal_write = (uint16_t)(literal_write + source_record->program_literal_count);
     }
-    source_release_lexical_environment_chain_if_unused(lexical_environment_index);
-    return result;
+    live_method_program_instructions_used = instruction_write;
+    live_method_program_literals_used = literal_write;
+    live_method_program_lexical_names_used = lexical_write;
 }
 
-static struct recorz_mvp_source_eval_result source_execute_inline_block_source(
-    struct recorz_mvp_source_method_context *context,
-    const char *source
+static uint8_t live_method_program_pools_have_room(
+    const struct recorz_mvp_live_method_program_builder *builder
 ) {
-    struct recorz_mvp_source_method_context block_context;
-    struct recorz_mvp_source_eval_result result;
-    char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
-    uint16_t parsed_argument_count = 0U;
-    const char *body_cursor;
-    int16_t lexical_environment_index;
-    uint8_t allocate_context_object;
+    uint16_t lexical_count = builder->has_block_literal ? builder->lexical_count : 0U;
 
-    lexical_environment_index = source_allocate_lexical_environment(context->lexical_environment_index);
-    body_cursor = source_parse_block_header(source, argument_names, &parsed_argument_count);
-    if (parsed_argument_count != 0U) {
-        machine_panic("inline conditional blocks do not support block arguments yet");
+    return (uint8_t)(
+        live_method_program_instructions_used + builder->instruction_count <= LIVE_METHOD_PROGRAM_INSTRUCTION_LIMIT &&
+        live_method_program_literals_used + builder->literal_count <= LIVE_METHOD_PROGRAM_LITERAL_LIMIT &&
+        live_method_program_lexical_names_used + lexical_count <= LIVE_METHOD_PROGRAM_LEXICAL_LIMIT
+    );
+}
+
+static void compile_live_method_program(struct recorz_mvp_live_method_source *source_record) {
+    struct recorz_mvp_live_method_program_builder *builder = &live_method_program_builder;
+    const char *source = live_method_source_text(source_record);
+    uint16_t index;
+
+    source_record->execution_kind = RECORZ_MVP_LIVE_METHOD_EXECUTION_COMPILED;
+    source_record->program_has_block_literal = 0U;
+    source_record->program_lexical_count = 0U;
+    source_record->program_instruction_offset = 0U;
+    source_record->program_instruction_count = 0U;
+    source_record->program_literal_offset = 0U;
+    source_record->program_literal_count = 0U;
+    source_record->program_lexical_name_offset = 0U;
+    source_record->send_site_base = 0U;
+    if (!source_text_requires_live_evaluator(source)) {
+        return;
     }
-    allocate_context_object = source_text_contains_identifier(source, "thisContext");
-    block_context.defining_class = context->defining_class;
-    block_context.receiver = context->receiver;
-    block_context.lexical_environment_index = lexical_environment_index;
-    block_context.home_context_index = context->home_context_index;
-    block_context.current_context_handle = allocate_context_object != 0U ?
-        allocate_source_context_object(
-            context->current_context_handle,
-            context->receiver,
-            "<block>"
-        ) :
-        0U;
-    block_context.selector_id = 0U;
-    block_context.argument_count = 0U;
-    block_context.is_block = 1U;
-    result = source_evaluate_statement_sequence(&block_context, body_cursor, 1U);
-    if (block_context.current_context_handle != 0U) {
-        heap_set_field(block_context.current_context_handle, CONTEXT_FIELD_ALIVE, boolean_value(0U));
+    source_record->execution_kind = RECORZ_MVP_LIVE_METHOD_EXECUTION_SOURCE;
+    if (source_text_contains_identifier(source, "thisContext") ||
+        !live_method_program_source_is_well_formed(source)) {
+        return;
     }
-    if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-        if (block_context.home_context_index < 0) {
-            machine_panic("block attempted a non-local return without a live home context");
+    if (!build_live_method_program(builder, heap_object(source_record->class_handle), source, 0U)) {
+        if (!builder->needs_lexical_arguments ||
+            !build_live_method_program(builder, heap_object(source_record->class_handle), source, 1U)) {
+            return;
         }
-        if (!source_home_context_at(block_context.home_context_index)->alive) {
-            machine_panic("block attempted a non-local return to a dead home context");
+    } else if (builder->has_block_literal && builder->argument_count != 0U &&
+               !build_live_method_program(builder, heap_object(source_record->class_handle), source, 1U)) {
+        return;
+    }
+    if (!live_method_program_pools_have_room(builder)) {
+        /* Executing programs point into the pools, so only repack between top-level sends. */
+        if (live_method_program_activation_depth != 0U) {
+            return;
+        }
+        repack_live_method_program_pools();
+        if (!live_method_program_pools_have_room(builder)) {
+            return;
         }
     }
-    source_release_single_lexical_environment_if_unused(lexical_environment_index);
-    return result;
+    source_record->program_instruction_offset = live_method_program_instructions_used;
+    source_record->program_instruction_count = builder->instruction_count;
+    for (index = 0U; index < builder->instruction_count; ++index) {
+        live_method_program_instructions[live_method_program_instructions_used++] = builder->instructions[index];
+    }
+    source_record->program_literal_offset = live_method_program_literals_used;
+    source_record->program_literal_count = builder->literal_count;
+    for (index = 0U; index < builder->literal_count; ++index) {
+        struct recorz_mvp_literal *literal = &live_method_program_literals[live_method_program_literals_used++];
+
+        literal->kind = builder->literals[index].kind;
+        literal->integer = builder->literals[index].integer;
+        literal->string = 0;
+        if (literal->kind == RECORZ_MVP_LITERAL_STRING) {
+            literal->integer = 0;
+            literal->string = runtime_string_allocate_copy(
+                &builder->literal_text_pool[builder->literals[index].integer]
+            );
+        }
+    }
+    if (builder->has_block_literal) {
+        source_record->program_has_block_literal = 1U;
+        source_record->program_lexical_count = (uint8_t)builder->lexical_count;
+        source_record->program_lexical_name_offset = live_method_program_lexical_names_used;
+        for (index = 0U; index < builder->lexical_count; ++index) {
+            source_copy_identifier(
+                live_method_program_lexical_names[live_method_program_lexical_names_used],
+                sizeof(live_method_program_lexical_names[live_method_program_lexical_names_used]),
+                builder->lexical_names[index]
+            );
+            ++live_method_program_lexical_names_used;
+        }
+    } else {
+        source_record->program_lexical_count = (uint8_t)builder->lexical_count;
+    }
+    source_record->execution_kind = RECORZ_MVP_LIVE_METHOD_EXECUTION_PROGRAM;
 }
 
-static struct recorz_mvp_source_eval_result source_evaluate_conditional_expression(
-    struct recorz_mvp_source_method_context *context,
-    struct recorz_mvp_source_eval_result receiver_result,
-    const char *cursor,
-    const char **cursor_out
-) {
-    char first_selector[METHOD_SOURCE_NAME_LIMIT];
-    char second_selector[METHOD_SOURCE_NAME_LIMIT];
-    char first_block[METHOD_SOURCE_CHUNK_LIMIT];
-    char second_block[METHOD_SOURCE_CHUNK_LIMIT];
-    const char *part_cursor;
-    const char *after_selector;
-    const char *after_first_block;
-    const char *after_second_block;
-    const char *chosen_block = 0;
-    uint8_t first_is_true;
-    uint8_t has_second_clause = 0U;
+static void rebuild_live_method_programs(void) {
+    uint16_t source_index;
 
-    part_cursor = source_parse_identifier(cursor, first_selector, sizeof(first_selector));
-    if (part_cursor == 0) {
-        machine_panic("live source conditional expression is missing a selector");
-    }
-    after_selector = source_skip_statement_space(part_cursor);
-    if (*after_selector != ':') {
-        machine_panic("live source conditional expression is missing ':'");
+    live_method_program_instructions_used = 0U;
+    live_method_program_literals_used = 0U;
+    live_method_program_lexical_names_used = 0U;
+    for (source_index = 0U; source_index < live_method_source_count; ++source_index) {
+        compile_live_method_program(&live_method_sources[source_index]);
     }
-    after_selector = source_skip_statement_space(after_selector + 1);
-    if (*after_selector != '[') {
-        machine_panic("live source inline conditional expects a block argument");
+}
+
+static uint32_t compiled_block_hash(const char *source, uint16_t class_handle) {
+    return ((uint32_t)(uintptr_t)source * 2654435761U) ^ ((uint32_t)class_handle * 40503U);
+}
+
+/* Slots hold block index + 1; the index is twice the table size, so probing always finds a hole. */
+static void compiled_block_index_insert(uint16_t block_index) {
+    uint32_t slot = compiled_block_hash(compiled_blocks[block_index].source, compiled_blocks[block_index].class_handle) &
+        (COMPILED_BLOCK_INDEX_SIZE - 1U);
+
+    while (compiled_block_index[slot] != 0U) {
+        slot = (slot + 1U) & (COMPILED_BLOCK_INDEX_SIZE - 1U);
     }
-    after_first_block = source_copy_bracket_body(after_selector, first_block, sizeof(first_block));
-    if (after_first_block == 0) {
-        machine_panic("live source conditional expression is missing a block argument");
+    compiled_block_index[slot] = (uint16_t)(block_index + 1U);
+}
+
+static void compiled_block_index_rebuild(void) {
+    uint32_t slot;
+    uint16_t block_index;
+
+    for (slot = 0U; slot < COMPILED_BLOCK_INDEX_SIZE; ++slot) {
+        compiled_block_index[slot] = 0U;
     }
-    cursor = source_skip_statement_space(after_first_block);
-    part_cursor = source_parse_identifier(cursor, second_selector, sizeof(second_selector));
-    if (part_cursor != 0) {
-        after_selector = source_skip_statement_space(part_cursor);
-        if (*after_selector == ':' &&
-            ((source_names_equal(first_selector, "ifTrue") && source_names_equal(second_selector, "ifFalse")) ||
-             (source_names_equal(first_selector, "ifFalse") && source_names_equal(second_selector, "ifTrue")))) {
-            after_selector = source_skip_statement_space(after_selector + 1);
-            if (*after_selector != '[') {
-                machine_panic("live source inline conditional matching clause expects a block argument");
-            }
-            after_second_block = source_copy_bracket_body(after_selector, second_block, sizeof(second_block));
-            if (after_second_block == 0) {
-                machine_panic("live source conditional expression is missing a matching block argument");
-            }
-            cursor = after_second_block;
-            has_second_clause = 1U;
+    for (block_index = 0U; block_index < compiled_block_count; ++block_index) {
+        if (compiled_blocks[block_index].state != RECORZ_MVP_COMPILED_BLOCK_FREE) {
+            compiled_block_index_insert(block_index);
         }
     }
+}
 
-    first_is_true = (uint8_t)source_names_equal(first_selector, "ifTrue");
-    if (condition_value_is_true(receiver_result.value) == first_is_true) {
-        chosen_block = first_block;
-    } else if (has_second_clause) {
-        chosen_block = second_block;
-    }
-    *cursor_out = cursor;
-    if (chosen_block == 0) {
-        return source_eval_value_result(nil_value());
+static struct recorz_mvp_compiled_block *compiled_block_lookup(const char *source, uint16_t class_handle) {
+    uint32_t slot = compiled_block_hash(source, class_handle) & (COMPILED_BLOCK_INDEX_SIZE - 1U);
+
+    while (compiled_block_index[slot] != 0U) {
+        struct recorz_mvp_compiled_block *block = &compiled_blocks[compiled_block_index[slot] - 1U];
+
+        if (block->source == source && block->class_handle == class_handle) {
+            return block;
+        }
+        slot = (slot + 1U) & (COMPILED_BLOCK_INDEX_SIZE - 1U);
     }
-    return source_execute_inline_block_source(context, chosen_block);
+    return 0;
 }
 
-static struct recorz_mvp_source_eval_result source_evaluate_statement_sequence(
-    struct recorz_mvp_source_method_context *context,
-    const char *source,
-    uint8_t is_block
-) {
-    const char *cursor = source_skip_statement_space(source);
-    char statement[METHOD_SOURCE_CHUNK_LIMIT];
-    struct recorz_mvp_source_eval_result last_result = source_eval_value_result(nil_value());
-    uint8_t saw_statement = 0U;
+static void repack_compiled_block_pools(void) {
+    uint16_t block_index;
+    uint16_t block_write = 0U;
+    uint16_t instruction_write = 0U;
+    uint16_t literal_write = 0U;
+    uint16_t lexical_write = 0U;
 
-    (void)is_block;
-    if (*cursor == '|') {
-        cursor = source_parse_temporary_declarations(context, cursor);
-    }
-    while (source_copy_next_statement(&cursor, statement, sizeof(statement)) != 0U) {
-        const char *trimmed = source_skip_statement_space(statement);
+    for (block_index = 0U; block_index < compiled_block_count; ++block_index) {
+        struct recorz_mvp_compiled_block block = compiled_blocks[block_index];
+        uint16_t index;
 
-        if (trimmed[0] == '\0') {
+        if (block.state == RECORZ_MVP_COMPILED_BLOCK_FREE) {
             continue;
         }
-        if (trimmed[0] == '^') {
-            const char *return_cursor;
-
-            last_result = source_evaluate_expression(context, trimmed + 1, &return_cursor);
-            if (last_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-                return last_result;
+        if (block.state == RECORZ_MVP_COMPILED_BLOCK_PROGRAM) {
+            if (block.instruction_offset < instruction_write ||
+                block.literal_offset < literal_write ||
+                block.lexical_name_offset < lexical_write) {
+                machine_panic("compiled block pool is out of order");
             }
-            return_cursor = source_skip_horizontal_space(return_cursor);
-            if (*return_cursor != '\0') {
-                machine_panic("live source return has unexpected trailing text");
+            for (index = 0U; index < block.instruction_count; ++index) {
+                compiled_block_instructions[instruction_write + index] =
+                    compiled_block_instructions[block.instruction_offset + index];
             }
-            return source_eval_return_result(last_result.value);
+            for (index = 0U; index < block.literal_count; ++index) {
+                compiled_block_literals[literal_write + index] = compiled_block_literals[block.literal_offset + index];
+            }
+            if (block.has_block_literal) {
+                for (index = 0U; index < block.lexical_count; ++index) {
+                    source_copy_identifier(
+                        compiled_block_lexical_names[lexical_write + index],
+                        sizeof(compiled_block_lexical_names[lexical_write + index]),
+                        compiled_block_lexical_names[block.lexical_name_offset + index]
+                    );
+                }
+                block.lexical_name_offset = lexical_write;
+                lexical_write = (uint16_t)(lexical_write + block.lexical_count);
+            }
+            block.instruction_offset = instruction_write;
+            block.literal_offset = literal_write;
+            instruction_write = (uint16_t)(instruction_write + block.instruction_count);
+            literal_write = (uint16_t)(literal_write + block.literal_count);
         }
-        {
-            char binding_name[METHOD_SOURCE_NAME_LIMIT];
-            const char *binding_cursor = source_parse_identifier(trimmed, binding_name, sizeof(binding_name));
+        compiled_blocks[block_write++] = block;
+    }
+    compiled_block_count = block_write;
+    compiled_block_instructions_used = instruction_write;
+    compiled_block_literals_used = literal_write;
+    compiled_block_lexical_names_used = lexical_write;
+    compiled_block_index_rebuild();
+}
 
-            if (binding_cursor != 0) {
-                binding_cursor = source_skip_horizontal_space(binding_cursor);
-                if (binding_cursor[0] == ':' && binding_cursor[1] == '=') {
-                    const char *expression_cursor;
+static uint8_t compiled_block_pools_have_room(const struct recorz_mvp_live_method_program_builder *builder) {
+    uint16_t lexical_count = builder->has_block_literal ? builder->lexical_count : 0U;
 
-                    last_result = source_evaluate_expression(context, binding_cursor + 2, &expression_cursor);
-                    if (last_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-                        return last_result;
-                    }
-                    expression_cursor = source_skip_horizontal_space(expression_cursor);
-                    if (*expression_cursor != '\0') {
-                        machine_panic("live source assignment has unexpected trailing text");
-                    }
-                    source_write_identifier(context, binding_name, last_result.value);
-                    saw_statement = 1U;
-                    continue;
-                }
-            }
+    return (uint8_t)(
+        compiled_block_instructions_used + builder->instruction_count <= COMPILED_BLOCK_INSTRUCTION_LIMIT &&
+        compiled_block_literals_used + builder->literal_count <= COMPILED_BLOCK_LITERAL_LIMIT &&
+        compiled_block_lexical_names_used + lexical_count <= COMPILED_BLOCK_LEXICAL_LIMIT
+    );
+}
+
+/*
+ * Blocks compile on their first activation, once their captured environment
+ * exists to resolve outer names against. A block the compiler cannot handle
+ * stays recorded as source so later activations skip straight to the evaluator.
+ */
+static struct recorz_mvp_compiled_block *compile_block_program(
+    const char *source,
+    const struct recorz_mvp_heap_object *class_object,
+    uint16_t class_handle,
+    int16_t outer_lexical_environment_index
+) {
+    struct recorz_mvp_live_method_program_builder *builder = &live_method_program_builder;
+    struct recorz_mvp_compiled_block *block;
+    uint16_t index;
+
+    /* Executing blocks point into the pools, so only repack between top-level activations. */
+    if (compiled_block_count >= COMPILED_BLOCK_LIMIT && compiled_block_activation_depth == 0U) {
+        repack_compiled_block_pools();
+    }
+    if (compiled_block_count >= COMPILED_BLOCK_LIMIT) {
+        return 0;
+    }
+    block = &compiled_blocks[compiled_block_count];
+    block->source = source;
+    block->class_handle = class_handle;
+    block->state = RECORZ_MVP_COMPILED_BLOCK_SOURCE;
+    block->argument_count = 0U;
+    block->has_block_literal = 0U;
+    block->lexical_count = 0U;
+    block->instruction_offset = 0U;
+    block->instruction_count = 0U;
+    block->literal_offset = 0U;
+    block->literal_count = 0U;
+    block->lexical_name_offset = 0U;
+    block->send_site_base = 0U;
+    compiled_block_index_insert(compiled_block_count++);
+    if (source_text_contains_identifier(source, "thisContext") ||
+        !live_method_program_source_is_well_formed(source)) {
+        return 0;
+    }
+    if (!build_compiled_block_program(builder, class_object, source, outer_lexical_environment_index, 0U)) {
+        if (!builder->needs_lexical_arguments ||
+            !build_compiled_block_program(builder, class_object, source, outer_lexical_environment_index, 1U)) {
+            return 0;
         }
-        last_result = source_evaluate_expression(context, trimmed, &trimmed);
-        if (last_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-            return last_result;
+    } else if (builder->has_block_literal && builder->argument_count != 0U &&
+               !build_compiled_block_program(builder, class_object, source, outer_lexical_environment_index, 1U)) {
+        return 0;
+    }
+    if (!compiled_block_pools_have_room(builder)) {
+        if (compiled_block_activation_depth == 0U) {
+            repack_compiled_block_pools();
+            block = &compiled_blocks[compiled_block_count - 1U];
         }
-        trimmed = source_skip_horizontal_space(trimmed);
-        if (*trimmed != '\0') {
-            machine_panic("live source statement has unexpected trailing text");
+        if (!compiled_block_pools_have_room(builder)) {
+            /* Out of room is not a property of the block; forget it so a later activation can retry. */
+            block->state = RECORZ_MVP_COMPILED_BLOCK_FREE;
+            block->source = 0;
+            compiled_block_index_rebuild();
+            return 0;
         }
-        saw_statement = 1U;
     }
-    if (!saw_statement) {
-        return source_eval_value_result(nil_value());
+    block->instruction_offset = compiled_block_instructions_used;
+    block->instruction_count = builder->instruction_count;
+    for (index = 0U; index < builder->instruction_count; ++index) {
+        compiled_block_instructions[compiled_block_instructions_used++] = builder->instructions[index];
+    }
+    block->literal_offset = compiled_block_literals_used;
+    block->literal_count = builder->literal_count;
+    for (index = 0U; index < builder->literal_count; ++index) {
+        struct recorz_mvp_literal *literal = &compiled_block_literals[compiled_block_literals_used++];
+
+        literal->kind = builder->literals[index].kind;
+        literal->integer = builder->literals[index].integer;
+        literal->string = 0;
+        if (literal->kind == RECORZ_MVP_LITERAL_STRING) {
+            literal->integer = 0;
+            literal->string = runtime_string_allocate_copy(
+                &builder->literal_text_pool[builder->literals[index].integer]
+            );
+        }
+    }
+    block->argument_count = (uint8_t)builder->argument_count;
+    block->lexical_count = (uint8_t)builder->lexical_count;
+    if (builder->has_block_literal) {
+        block->has_block_literal = 1U;
+        block->lexical_name_offset = compiled_block_lexical_names_used;
+        for (index = 0U; index < builder->lexical_count; ++index) {
+            source_copy_identifier(
+                compiled_block_lexical_names[compiled_block_lexical_names_used],
+                sizeof(compiled_block_lexical_names[compiled_block_lexical_names_used]),
+                builder->lexical_names[index]
+            );
+            ++compiled_block_lexical_names_used;
+        }
+    }
+    block->state = RECORZ_MVP_COMPILED_BLOCK_PROGRAM;
+    return block;
+}
+
+/*
+ * Runs a closure from its compiled block when it has one, else on the source
+ * evaluator. A non-local return leaves block_return_home_context_index set and
+ * comes back as a return result so each caller unwinds until the home
+ * activation claims it.
+ */
+static struct recorz_mvp_source_eval_result execute_block_closure(
+    const struct recorz_mvp_heap_object *object,
+    uint16_t argument_count,
+    const struct recorz_mvp_value arguments[],
+    uint16_t sender_context_handle
+) {
+    struct recorz_mvp_runtime_block_state block_state;
+    struct recorz_mvp_compiled_block *block;
+    struct recorz_mvp_value source_value = heap_get_field(object, BLOCK_CLOSURE_FIELD_SOURCE);
+    struct recorz_mvp_value home_receiver = heap_get_field(object, BLOCK_CLOSURE_FIELD_HOME_RECEIVER);
+    const struct recorz_mvp_heap_object *defining_class = 0;
+    struct recorz_mvp_gc_root_frame block_roots;
+    uint16_t block_handle = heap_handle_for_object(object);
+    uint16_t class_handle = 0U;
+    struct recorz_mvp_executable executable = {
+        .read_instruction = read_program_instruction,
+        .failure_context_detail = "<block>",
+        .is_block = 1U,
+    };
+
+    if (primitive_kind_for_heap_object(object) != RECORZ_MVP_OBJECT_BLOCK_CLOSURE ||
+        !value_is_string(source_value) ||
+        value_string(source_value) == 0) {
+        return source_execute_block_closure(object, argument_count, arguments, sender_context_handle);
+    }
+    if (source_block_state_for_handle(block_handle, &block_state)) {
+        defining_class = block_state.defining_class;
+    } else {
+        block_state.lexical_environment_index = -1;
+        block_state.home_context_index = -1;
+        defining_class = value_is_object(home_receiver)
+            ? class_object_for_heap_object(heap_object_for_value(home_receiver))
+            : class_object_for_kind(RECORZ_MVP_OBJECT_OBJECT);
+    }
+    if (!value_is_object(home_receiver)) {
+        defining_class = 0;
+    }
+    if (defining_class != 0) {
+        class_handle = heap_handle_for_object(defining_class);
+    }
+    gc_root_handles(&block_roots, &block_handle, 1U);
+    block = compiled_block_lookup(value_string(source_value), class_handle);
+    if (block == 0) {
+        block = compile_block_program(
+            value_string(source_value),
+            defining_class,
+            class_handle,
+            block_state.lexical_environment_index
+        );
+    }
+    if (block == 0 ||
+        block->state != RECORZ_MVP_COMPILED_BLOCK_PROGRAM ||
+        block->argument_count != argument_count) {
+        gc_unroot(&block_roots);
+        return source_execute_block_closure(object, argument_count, arguments, sender_context_handle);
+    }
+    executable.instruction_source = &compiled_block_instructions[block->instruction_offset];
+    executable.instructions = &compiled_block_instructions[block->instruction_offset];
+    executable.instruction_count = block->instruction_count;
+    executable.literals = &compiled_block_literals[block->literal_offset];
+    executable.literal_count = block->literal_count;
+    executable.lexical_count = block->lexical_count;
+    executable.lexical_names = block->has_block_literal ? &compiled_block_lexical_names[block->lexical_name_offset] : 0;
+    executable.block_defining_class = defining_class;
+    executable.home_context_index = block_state.home_context_index;
+    executable.outer_lexical_environment_index = block_state.lexical_environment_index;
+    executable.send_site_base = compiled_block_send_site_base(block);
+    ++compiled_block_activation_depth;
+    execute_executable(
+        &executable,
+        value_is_object(home_receiver) ? heap_object_for_value(home_receiver) : 0,
+        home_receiver,
+        argument_count,
+        arguments,
+        0U
+    );
+    --compiled_block_activation_depth;
+    gc_unroot(&block_roots);
+    return source_eval_send_result(pop_value());
+}
+
+static void live_method_program_begin(
+    struct recorz_mvp_executable *executable,
+    const struct recorz_mvp_heap_object *class_object,
+    struct recorz_mvp_value receiver,
+    uint16_t argument_count,
+    const struct recorz_mvp_live_method_source *source_record,
+    uint16_t sender_context_handle
+) {
+    if (argument_count != source_record->argument_count) {
+        machine_panic("live source method argument count does not match send");
+    }
+    *executable = (struct recorz_mvp_executable){
+        .instruction_source = &live_method_program_instructions[source_record->program_instruction_offset],
+        .read_instruction = read_program_instruction,
+        .instructions = &live_method_program_instructions[source_record->program_instruction_offset],
+        .instruction_count = source_record->program_instruction_count,
+        .literals = &live_method_program_literals[source_record->program_literal_offset],
+        .literal_count = source_record->program_literal_count,
+        .lexical_count = source_record->program_lexical_count,
+        .block_defining_class = class_object,
+        .home_context_index = -1,
+        .outer_lexical_environment_index = -1,
+        .failure_context_detail = selector_name(source_record->selector_id),
+    };
+    executable->send_site_base = live_method_send_site_base(source_record);
+    panic_live_source = live_method_source_text(source_record);
+    source_copy_identifier(
+        panic_live_selector_name,
+        sizeof(panic_live_selector_name),
+        selector_name(source_record->selector_id)
+    );
+    if (source_record->program_has_block_literal) {
+        executable->lexical_names = &live_method_program_lexical_names[source_record->program_lexical_name_offset];
+        executable->home_context_index = source_allocate_home_context(
+            class_object,
+            receiver,
+            -1,
+            sender_context_handle,
+            selector_name(source_record->selector_id),
+            0U
+        );
     }
-    return last_result;
+    ++live_method_program_activation_depth;
 }
 
-static void execute_live_source_method_with_sender(
+static void live_method_program_end(const struct recorz_mvp_executable *executable) {
+    --live_method_program_activation_depth;
+    if (executable->home_context_index >= 0) {
+        source_home_context_at(executable->home_context_index)->alive = 0U;
+        source_release_home_context_if_unused(executable->home_context_index);
+    }
+    panic_live_source = 0;
+    panic_live_selector_name[0] = '\0';
+}
+
+static void execute_live_method_with_sender(
     const struct recorz_mvp_heap_object *class_object,
     struct recorz_mvp_value receiver,
     uint16_t argument_count,
     const struct recorz_mvp_value arguments[],
-    const char *source,
+    const struct recorz_mvp_live_method_source *source_record,
     uint16_t sender_context_handle
 ) {
-    struct recorz_mvp_source_method_context context;
-    struct recorz_mvp_source_eval_result result;
-    char selector_name[METHOD_SOURCE_NAME_LIMIT];
-    char argument_names[MAX_SEND_ARGS][METHOD_SOURCE_NAME_LIMIT];
-    uint16_t parsed_argument_count;
-    const char *body_cursor;
-    int16_t lexical_environment_index;
-    int16_t home_context_index;
-    uint16_t argument_index;
-    uint8_t allocate_context_object;
+    struct recorz_mvp_executable executable;
 
-    if (source == 0 || source[0] == '\0') {
-        machine_panic("live source method is empty");
-    }
-    panic_live_source = source;
-    panic_live_selector_name[0] = '\0';
-    if (source_parse_method_header(
-            source,
-            selector_name,
-            argument_names,
-            &parsed_argument_count,
-            &body_cursor) == 0) {
-        machine_panic("live source method header is invalid");
-    }
-    if (parsed_argument_count != argument_count) {
-        machine_panic("live source method argument count does not match send");
-    }
-    source_copy_identifier(panic_live_selector_name, sizeof(panic_live_selector_name), selector_name);
-    context.selector_id = source_selector_id_for_name(selector_name);
-    if (context.selector_id == 0U) {
-        machine_panic("live source method uses an unknown selector");
-    }
-    lexical_environment_index = source_allocate_lexical_environment(-1);
-    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
-        source_append_binding(lexical_environment_index, argument_names[argument_index], arguments[argument_index]);
+    if (source_record->execution_kind != RECORZ_MVP_LIVE_METHOD_EXECUTION_PROGRAM) {
+        execute_live_source_method_with_sender(
+            class_object,
+            receiver,
+            argument_count,
+            arguments,
+            live_method_source_text(source_record),
+            sender_context_handle
+        );
+        return;
     }
-    allocate_context_object = source_text_contains_identifier(source, "thisContext");
-    home_context_index = source_allocate_home_context(
+    live_method_program_begin(
+        &executable,
         class_object,
         receiver,
-        lexical_environment_index,
-        sender_context_handle,
-        selector_name,
-        allocate_context_object
+        argument_count,
+        source_record,
+        sender_context_handle
     );
-    context.defining_class = class_object;
-    context.receiver = receiver;
-    context.lexical_environment_index = lexical_environment_index;
-    context.home_context_index = home_context_index;
-    context.current_context_handle = source_home_context_at(home_context_index)->context_handle;
-    context.argument_count = (uint8_t)argument_count;
-    context.is_block = 0U;
-    result = source_evaluate_statement_sequence(&context, body_cursor, 0U);
-    source_home_context_at(home_context_index)->alive = 0U;
-    if (context.current_context_handle != 0U) {
-        heap_set_field(context.current_context_handle, CONTEXT_FIELD_ALIVE, boolean_value(0U));
-    }
-    source_release_home_context_if_unused(home_context_index);
-    source_release_lexical_environment_chain_if_unused(lexical_environment_index);
-    panic_live_source = 0;
-    panic_live_selector_name[0] = '\0';
-    push(result.value);
+    execute_executable(
+        &executable,
+        value_is_object(receiver) ? heap_object_for_value(receiver) : 0,
+        receiver,
+        argument_count,
+        arguments,
+        0U
+    );
+    live_method_program_end(&executable);
 }
 
 static uint8_t remember_seeded_primitive_method_source(
@@ -20655,7 +25894,7 @@ static uint8_t remember_seeded_primitive_method_source(
     }
     entry_object = method_descriptor_entry_object(method_object);
     implementation_value = method_entry_implementation_value(entry_object);
-    if (implementation_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(implementation_value)) {
         machine_panic("KernelInstaller primitive method chunk does not match a primitive method");
     }
     remember_live_method_source(
@@ -20738,8 +25977,8 @@ static void install_method_chunk_on_class(
         protocol_name,
         chunk
     );
-    if (gc_collection_allowed_for_current_phase()) {
-        (void)gc_collect_now();
+    if (gc_collection_is_due()) {
+        gc_collect_now_or_when_idle();
     }
 }
 
@@ -20755,8 +25994,8 @@ static void install_method_source_on_class(
     validate_compiled_method(heap_object(compiled_method_handle), argument_count);
     install_compiled_method_update(class_object, selector_id, argument_count, compiled_method_handle);
     remember_live_method_source(heap_handle_for_object(class_object), selector_id, (uint8_t)argument_count, "", source);
-    if (gc_collection_allowed_for_current_phase()) {
-        (void)gc_collect_now();
+    if (gc_collection_is_due()) {
+        gc_collect_now_or_when_idle();
     }
 }
 
@@ -20983,6 +26222,9 @@ static const struct recorz_mvp_heap_object *ensure_class_defined(
         superclass_object = class_object_for_kind(RECORZ_MVP_OBJECT_OBJECT);
     }
     validate_dynamic_class_definition(definition, existing_dynamic_definition, superclass_object);
+    if (class_superclass_object_or_null(class_object) != superclass_object) {
+        method_cache_flush();
+    }
     heap_set_field(
         class_handle,
         CLASS_FIELD_SUPERCLASS,
@@ -21266,7 +26508,6 @@ static void append_class_method_source_chunks(
     uint8_t class_side,
     uint8_t *wrote_any_chunk
 ) {
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint32_t method_count = class_method_count(class_object);
     char current_protocol[METHOD_SOURCE_NAME_LIMIT];
     uint32_t method_index;
@@ -21404,13 +26645,8 @@ static void append_class_method_source_chunks(
     if (method_count == 0U) {
         return;
     }
-    if (method_start_object == 0) {
-        machine_panic("KernelInstaller fileOutClassNamed: method start is missing");
-    }
     for (method_index = 0U; method_index < method_count; ++method_index) {
-        const struct recorz_mvp_heap_object *method_object = (const struct recorz_mvp_heap_object *)heap_object(
-            (uint16_t)(heap_handle_for_object(method_start_object) + method_index)
-        );
+        const struct recorz_mvp_heap_object *method_object = class_method_descriptor_at(class_object, method_index);
         const struct recorz_mvp_live_method_source *source_record = live_method_source_for_selector_and_arity(
             heap_handle_for_object(class_object),
             method_descriptor_selector(method_object),
@@ -21734,105 +26970,105 @@ static void regenerated_boot_source_emit_view_restore(
     char selector_name_text[METHOD_SOURCE_NAME_LIMIT];
     char protocol_name[METHOD_SOURCE_NAME_LIMIT];
 
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         regenerated_boot_source_emit_text(emitter, "Workspace reopen.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_OPENING_MENU) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_OPENING_MENU) {
         regenerated_boot_source_emit_text(emitter, "Workspace developmentHome.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_CLASSES) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_CLASSES) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseClasses.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_INTERACTIVE_CLASSES) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_INTERACTIVE_CLASSES) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseClasses.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_PACKAGES) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGES) {
         regenerated_boot_source_emit_text(emitter, "Workspace browsePackages.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_REGENERATED_BOOT_SOURCE) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_REGENERATED_BOOT_SOURCE) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseRegeneratedBootSource.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_REGENERATED_KERNEL_SOURCE) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_REGENERATED_KERNEL_SOURCE) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseRegeneratedKernelSource.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_REGENERATED_FILE_IN_SOURCE) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_REGENERATED_FILE_IN_SOURCE) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseRegeneratedFileInSource.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_INPUT_MONITOR) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_INPUT_MONITOR) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseInteractiveInput.\n");
         return;
     }
-    if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-        target_name_value.string == 0 ||
-        target_name_value.string[0] == '\0') {
+    if (!value_is_string(target_name_value) ||
+        value_string(target_name_value) == 0 ||
+        value_string(target_name_value)[0] == '\0') {
         regenerated_boot_source_emit_text(emitter, "Workspace reopen.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_METHODS) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_METHODS) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseMethodsForClassNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_PACKAGE) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE) {
         regenerated_boot_source_emit_text(emitter, "Workspace browsePackageNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_PROTOCOLS) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOLS) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseProtocolsForClassNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_CLASS) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseClassNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_OBJECT) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_OBJECT) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseObjectNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_CLASS_METHODS) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_METHODS) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseClassMethodsForClassNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
         regenerated_boot_source_emit_text(emitter, "Workspace browseClassProtocolsForClassNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_CLASS_SOURCE) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_SOURCE) {
         regenerated_boot_source_emit_text(emitter, "Workspace fileOutClassNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_PACKAGE_SOURCE) {
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE_SOURCE) {
         regenerated_boot_source_emit_text(emitter, "Workspace fileOutPackageNamed: '");
-        regenerated_boot_source_emit_quoted_string(emitter, target_name_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(target_name_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_METHOD &&
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_METHOD &&
         workspace_parse_method_target_name(
-            target_name_value.string,
+            value_string(target_name_value),
             class_name,
             sizeof(class_name),
             selector_name_text,
@@ -21844,9 +27080,9 @@ static void regenerated_boot_source_emit_view_restore(
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_CLASS_METHOD &&
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_METHOD &&
         workspace_parse_method_target_name(
-            target_name_value.string,
+            value_string(target_name_value),
             class_name,
             sizeof(class_name),
             selector_name_text,
@@ -21858,9 +27094,9 @@ static void regenerated_boot_source_emit_view_restore(
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_PROTOCOL &&
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOL &&
         workspace_parse_protocol_target_name(
-            target_name_value.string,
+            value_string(target_name_value),
             class_name,
             sizeof(class_name),
             protocol_name,
@@ -21872,9 +27108,9 @@ static void regenerated_boot_source_emit_view_restore(
         regenerated_boot_source_emit_text(emitter, "'.\n");
         return;
     }
-    if (view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOL &&
+    if (value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOL &&
         workspace_parse_protocol_target_name(
-            target_name_value.string,
+            value_string(target_name_value),
             class_name,
             sizeof(class_name),
             protocol_name,
@@ -22068,11 +27304,11 @@ static void regenerated_boot_source_emit_program(
     regenerated_boot_source_emit_system_source(emitter);
     regenerated_boot_source_emit_text(emitter, "'.\n");
     regenerated_boot_source_emit_view_restore(emitter, workspace_object);
-    if (current_source_value.kind == RECORZ_MVP_VALUE_STRING &&
-        current_source_value.string != 0 &&
-        current_source_value.string[0] != '\0') {
+    if (value_is_string(current_source_value) &&
+        value_string(current_source_value) != 0 &&
+        value_string(current_source_value)[0] != '\0') {
         regenerated_boot_source_emit_text(emitter, "Workspace setContents: '");
-        regenerated_boot_source_emit_quoted_string(emitter, current_source_value.string);
+        regenerated_boot_source_emit_quoted_string(emitter, value_string(current_source_value));
         regenerated_boot_source_emit_text(emitter, "'.\n");
     }
 }
@@ -22171,7 +27407,7 @@ static void execute_entry_kernel_installer_compiled_method_word0_word1_word2_wor
     const struct recorz_mvp_value arguments[],
     const char *text
 ) {
-    uint32_t instruction_words[COMPILED_METHOD_MAX_INSTRUCTIONS];
+    uint32_t instruction_words[COMPILED_METHOD_INLINE_INSTRUCTIONS];
     uint32_t instruction_count;
     uint32_t instruction_index;
 
@@ -22182,7 +27418,7 @@ static void execute_entry_kernel_installer_compiled_method_word0_word1_word2_wor
         arguments[4],
         "KernelInstaller instructionCount must be a non-negative small integer"
     );
-    if (instruction_count == 0U || instruction_count > COMPILED_METHOD_MAX_INSTRUCTIONS) {
+    if (instruction_count == 0U || instruction_count > COMPILED_METHOD_INLINE_INSTRUCTIONS) {
         machine_panic("KernelInstaller instructionCount is out of range");
     }
     for (instruction_index = 0U; instruction_index < instruction_count; ++instruction_index) {
@@ -22191,7 +27427,7 @@ static void execute_entry_kernel_installer_compiled_method_word0_word1_word2_wor
             "KernelInstaller compiled method words must be non-negative small integers"
         );
     }
-    push(object_value(allocate_compiled_method_from_words(instruction_words, (uint8_t)instruction_count)));
+    push(object_value(allocate_compiled_method_from_words(instruction_words, (uint16_t)instruction_count, 0, 0U)));
 }
 
 static void execute_entry_kernel_installer_install_compiled_method_on_class_selector_id_argument_count(
@@ -22207,10 +27443,10 @@ static void execute_entry_kernel_installer_install_compiled_method_on_class_sele
 
     (void)object;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[0])) {
         machine_panic("KernelInstaller installCompiledMethod:onClass:selectorId:argumentCount: expects a compiled method");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[1])) {
         machine_panic("KernelInstaller installCompiledMethod:onClass:selectorId:argumentCount: expects a class object");
     }
     compiled_method = heap_object_for_value(arguments[0]);
@@ -22229,7 +27465,7 @@ static void execute_entry_kernel_installer_install_compiled_method_on_class_sele
         arguments[3],
         "KernelInstaller argumentCount must be a non-negative small integer"
     );
-    if (selector_id == 0U || selector_id > MAX_SELECTOR_ID) {
+    if (selector_id == 0U || selector_id > last_selector_id()) {
         machine_panic("KernelInstaller selectorId is out of range");
     }
     if (argument_count > MAX_SEND_ARGS) {
@@ -22256,17 +27492,17 @@ static void execute_entry_kernel_installer_install_method_source_on_class(
 
     (void)object;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("KernelInstaller installMethodSource:onClass: expects a source string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[1])) {
         machine_panic("KernelInstaller installMethodSource:onClass: expects a class object");
     }
     class_object = heap_object_for_value(arguments[1]);
     if (class_object->kind != RECORZ_MVP_OBJECT_CLASS) {
         machine_panic("KernelInstaller installMethodSource:onClass: expects a Class");
     }
-    install_method_source_on_class(class_object, arguments[0].string);
+    install_method_source_on_class(class_object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -22280,17 +27516,17 @@ static void execute_entry_kernel_installer_file_in_method_chunks_on_class(
 
     (void)object;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("KernelInstaller fileInMethodChunks:onClass: expects a source string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[1])) {
         machine_panic("KernelInstaller fileInMethodChunks:onClass: expects a class object");
     }
     class_object = heap_object_for_value(arguments[1]);
     if (class_object->kind != RECORZ_MVP_OBJECT_CLASS) {
         machine_panic("KernelInstaller fileInMethodChunks:onClass: expects a Class");
     }
-    file_in_method_chunks_on_class(arguments[0].string, class_object);
+    file_in_method_chunks_on_class(value_string(arguments[0]), class_object);
     push(receiver);
 }
 
@@ -22309,10 +27545,10 @@ static void execute_entry_kernel_installer_file_in_class_chunks(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("KernelInstaller fileInClassChunks: expects a source string");
     }
-    cursor = arguments[0].string;
+    cursor = value_string(arguments[0]);
     while (source_copy_next_chunk(&cursor, chunk, sizeof(chunk)) != 0U) {
         if (source_starts_with(chunk, "RecorzKernelPackage:")) {
             continue;
@@ -22335,7 +27571,7 @@ static void execute_entry_kernel_installer_file_in_class_chunks(
     if (!found_class) {
         machine_panic("KernelInstaller fileInClassChunks: source is missing an initial class header");
     }
-    file_in_class_chunks_source(arguments[0].string);
+    file_in_class_chunks_source(value_string(arguments[0]));
     class_object = lookup_class_by_name(class_name);
     if (class_object == 0) {
         machine_panic("KernelInstaller fileInClassChunks: class could not be resolved after install");
@@ -22434,8 +27670,8 @@ static void file_in_chunk_stream_source(const char *source) {
     if (class_header_count == 0U && do_it_chunk_count == 0U && package_chunk_count == 0U) {
         machine_panic("KernelInstaller file-in stream contains no package, class, or do-it chunks");
     }
-    if (gc_collection_allowed_for_current_phase()) {
-        (void)gc_collect_now();
+    if (gc_collection_is_due()) {
+        gc_collect_now_or_when_idle();
     }
 }
 
@@ -22468,18 +27704,18 @@ static void execute_entry_kernel_installer_remember_object_named(
 
     (void)object;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[0])) {
         machine_panic("KernelInstaller rememberObject:named: expects an object");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("KernelInstaller rememberObject:named: expects a name string");
     }
     remembered_object = heap_object_for_value(arguments[0]);
     if (remembered_object->kind == RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
-        heap_set_field((uint16_t)arguments[0].integer, BLOCK_CLOSURE_FIELD_LEXICAL0, small_integer_value(-1));
-        heap_set_field((uint16_t)arguments[0].integer, BLOCK_CLOSURE_FIELD_LEXICAL1, small_integer_value(-1));
+        heap_set_field(value_handle(arguments[0]), BLOCK_CLOSURE_FIELD_LEXICAL0, small_integer_value(-1));
+        heap_set_field(value_handle(arguments[0]), BLOCK_CLOSURE_FIELD_LEXICAL1, small_integer_value(-1));
     }
-    remember_named_object_handle((uint16_t)arguments[0].integer, arguments[1].string);
+    remember_named_object_handle(value_handle(arguments[0]), value_string(arguments[1]));
     push(receiver);
 }
 
@@ -22494,10 +27730,10 @@ static void execute_entry_kernel_installer_object_named(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("KernelInstaller objectNamed: expects a name string");
     }
-    object_handle = named_object_handle_for_name(arguments[0].string);
+    object_handle = named_object_handle_for_name(value_string(arguments[0]));
     if (object_handle == 0U) {
         machine_panic("KernelInstaller objectNamed: could not resolve object");
     }
@@ -22513,7 +27749,7 @@ static void execute_entry_kernel_installer_save_snapshot(
     (void)object;
     (void)arguments;
     (void)text;
-    emit_live_snapshot();
+    emit_live_snapshot(SNAPSHOT_SAVE_AND_CONTINUE);
     push(receiver);
 }
 
@@ -22526,10 +27762,10 @@ static void execute_entry_kernel_installer_file_out_package_named(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("KernelInstaller fileOutPackageNamed: expects a package name string");
     }
-    push(string_value(file_out_package_source_by_name(arguments[0].string)));
+    push(string_value(file_out_package_source_by_name(value_string(arguments[0]))));
 }
 
 static void execute_entry_kernel_installer_memory_report(
@@ -22545,6 +27781,19 @@ static void execute_entry_kernel_installer_memory_report(
     push(string_value(kernel_memory_report_text()));
 }
 
+static void execute_entry_kernel_installer_garbage_collect(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    push(small_integer_value((int32_t)gc_collect_inside_primitive()));
+}
+
 static void execute_entry_kernel_installer_configure_startup_selector_named(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
@@ -22555,17 +27804,17 @@ static void execute_entry_kernel_installer_configure_startup_selector_named(
 
     (void)object;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_object(arguments[0])) {
         machine_panic("KernelInstaller configureStartup:selectorNamed: expects an object");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("KernelInstaller configureStartup:selectorNamed: expects a selector name");
     }
-    selector_id = source_selector_id_for_name(arguments[1].string);
+    selector_id = source_selector_id_for_name(value_string(arguments[1]));
     if (selector_id == 0U) {
         machine_panic("KernelInstaller configureStartup:selectorNamed: selector is not declared");
     }
-    startup_hook_receiver_handle = (uint16_t)arguments[0].integer;
+    startup_hook_receiver_handle = value_handle(arguments[0]);
     startup_hook_selector_id = selector_id;
     push(receiver);
 }
@@ -22594,14 +27843,14 @@ static void execute_entry_test_runner_run_class_named(
 
     (void)text;
     validate_test_runner_receiver(object);
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("TestRunner runClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[0].string);
+    class_object = lookup_class_by_name(value_string(arguments[0]));
     if (class_object == 0) {
         machine_panic("TestRunner runClassNamed: could not resolve class");
     }
-    test_runner_run_class(object, class_object, arguments[0].string);
+    test_runner_run_class(object, class_object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -22613,10 +27862,10 @@ static void execute_entry_test_runner_run_package_named(
 ) {
     (void)text;
     validate_test_runner_receiver(object);
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("TestRunner runPackageNamed: expects a package name string");
     }
-    test_runner_run_package(object, arguments[0].string);
+    test_runner_run_package(object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -22628,10 +27877,10 @@ static void execute_entry_workspace_file_in(
 ) {
     (void)object;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace fileIn: expects a chunk stream string");
     }
-    file_in_chunk_stream_source(arguments[0].string);
+    file_in_chunk_stream_source(value_string(arguments[0]));
     push(receiver);
 }
 
@@ -22644,13 +27893,13 @@ static void execute_entry_workspace_file_out_class_named(
     const char *source;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace fileOutClassNamed: expects a class name string");
     }
-    source = file_out_class_source_by_name(arguments[0].string);
+    source = file_out_class_source_by_name(value_string(arguments[0]));
     workspace_remember_current_source(object, source);
-    workspace_remember_view(object, WORKSPACE_VIEW_CLASS_SOURCE, arguments[0].string);
-    workspace_render_class_source_browser(object, arguments[0].string);
+    workspace_remember_view(object, WORKSPACE_VIEW_CLASS_SOURCE, value_string(arguments[0]));
+    workspace_render_class_source_browser(object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -22663,13 +27912,13 @@ static void execute_entry_workspace_file_out_package_named(
     const char *source;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace fileOutPackageNamed: expects a package name string");
     }
-    source = file_out_package_source_by_name(arguments[0].string);
+    source = file_out_package_source_by_name(value_string(arguments[0]));
     workspace_remember_current_source(object, source);
-    workspace_remember_view(object, WORKSPACE_VIEW_PACKAGE_SOURCE, arguments[0].string);
-    workspace_render_package_source_browser(object, arguments[0].string);
+    workspace_remember_view(object, WORKSPACE_VIEW_PACKAGE_SOURCE, value_string(arguments[0]));
+    workspace_render_package_source_browser(object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -22680,10 +27929,10 @@ static void execute_entry_workspace_edit_package_named(
     const char *text
 ) {
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace editPackageNamed: expects a package name string");
     }
-    workspace_edit_package_in_place(object, arguments[0].string);
+    workspace_edit_package_in_place(object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -22731,13 +27980,13 @@ static void execute_entry_workspace_set_contents(
     const char *text
 ) {
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace setContents: expects a source string");
     }
     if (workspace_current_source_is_editor_target(object)) {
-        workspace_remember_editor_current_source(object, arguments[0].string);
+        workspace_remember_editor_current_source(object, value_string(arguments[0]));
     } else {
-        workspace_remember_current_source(object, arguments[0].string);
+        workspace_remember_current_source(object, value_string(arguments[0]));
     }
     push(receiver);
 }
@@ -22749,7 +27998,7 @@ static void execute_entry_workspace_set_current_view_kind(
     const char *text
 ) {
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(arguments[0])) {
         machine_panic("Workspace setCurrentViewKind: expects a small integer");
     }
     heap_set_field(
@@ -22767,14 +28016,14 @@ static void execute_entry_workspace_set_current_target_name(
     const char *text
 ) {
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_NIL &&
-        (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0)) {
+    if (!value_is_nil(arguments[0]) &&
+        (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0)) {
         machine_panic("Workspace setCurrentTargetName: expects a string or nil");
     }
     heap_set_field(
         heap_handle_for_object(object),
         workspace_current_target_name_field_index(object),
-        arguments[0].kind == RECORZ_MVP_VALUE_NIL ? nil_value() : arguments[0]
+        value_is_nil(arguments[0]) ? nil_value() : arguments[0]
     );
     push(receiver);
 }
@@ -23099,11 +28348,11 @@ static void execute_entry_workspace_seed_boot_contents(
     const char *text
 ) {
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace seedBootContents: expects a source string");
     }
     if (!booted_from_snapshot) {
-        workspace_remember_current_source(object, arguments[0].string);
+        workspace_remember_current_source(object, value_string(arguments[0]));
     }
     push(receiver);
 }
@@ -23117,10 +28366,10 @@ static void execute_entry_workspace_evaluate(
     const char *chunk_source;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace evaluate: expects a source string");
     }
-    chunk_source = workspace_normalize_do_it_source(arguments[0].string);
+    chunk_source = workspace_normalize_do_it_source(value_string(arguments[0]));
     workspace_remember_current_source(object, chunk_source);
     workspace_remember_source(object, chunk_source);
     workspace_evaluate_source(workspace_source_for_evaluation(chunk_source));
@@ -23139,12 +28388,12 @@ static void execute_entry_workspace_evaluate_current(
     (void)arguments;
     (void)text;
     source_value = workspace_current_source_value(object);
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         machine_panic("Workspace evaluateCurrent has no current source");
     }
-    chunk_source = workspace_normalize_do_it_source(source_value.string);
+    chunk_source = workspace_normalize_do_it_source(value_string(source_value));
     workspace_remember_current_source(object, chunk_source);
     workspace_remember_source(object, chunk_source);
     workspace_evaluate_source(workspace_source_for_evaluation(chunk_source));
@@ -23163,16 +28412,16 @@ static void execute_entry_workspace_file_in_current(
     (void)arguments;
     (void)text;
     source_value = workspace_current_source_value(object);
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         machine_panic("Workspace fileInCurrent has no current source");
     }
-    if (source_starts_with(source_value.string, "RecorzKernelClass:") ||
-        source_starts_with(source_value.string, "RecorzKernelClassSide:") ||
-        source_starts_with(source_value.string, "RecorzKernelPackage:") ||
-        source_starts_with(source_value.string, "RecorzKernelDoIt:")) {
-        file_in_chunk_stream_source(source_value.string);
+    if (source_starts_with(value_string(source_value), "RecorzKernelClass:") ||
+        source_starts_with(value_string(source_value), "RecorzKernelClassSide:") ||
+        source_starts_with(value_string(source_value), "RecorzKernelPackage:") ||
+        source_starts_with(value_string(source_value), "RecorzKernelDoIt:")) {
+        file_in_chunk_stream_source(value_string(source_value));
         push(receiver);
         return;
     }
@@ -23180,7 +28429,7 @@ static void execute_entry_workspace_file_in_current(
     if (class_object == 0) {
         machine_panic("Workspace fileInCurrent has no target class");
     }
-    install_method_source_on_class(class_object, source_value.string);
+    install_method_source_on_class(class_object, value_string(source_value));
     push(receiver);
 }
 
@@ -23267,16 +28516,16 @@ static void execute_entry_workspace_browse_methods_for_class_named(
     const struct recorz_mvp_heap_object *class_object;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseMethodsForClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[0].string);
+    class_object = lookup_class_by_name(value_string(arguments[0]));
     if (class_object == 0) {
         machine_panic("Workspace browseMethodsForClassNamed: could not resolve class");
     }
     workspace_capture_plain_return_state_if_needed(object);
-    workspace_remember_view(object, WORKSPACE_VIEW_METHODS, arguments[0].string);
-    workspace_render_method_list_browser(object, class_object, arguments[0].string, "INST");
+    workspace_remember_view(object, WORKSPACE_VIEW_METHODS, value_string(arguments[0]));
+    workspace_render_method_list_browser(object, class_object, value_string(arguments[0]), "INST");
     push(receiver);
 }
 
@@ -23287,15 +28536,15 @@ static void execute_entry_workspace_browse_package_named(
     const char *text
 ) {
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browsePackageNamed: expects a package name string");
     }
-    if (package_definition_for_name(arguments[0].string) == 0) {
+    if (package_definition_for_name(value_string(arguments[0])) == 0) {
         machine_panic("Workspace browsePackageNamed: could not resolve package");
     }
     workspace_capture_plain_return_state_if_needed(object);
-    workspace_remember_view(object, WORKSPACE_VIEW_PACKAGE, arguments[0].string);
-    workspace_render_package_browser(object, arguments[0].string);
+    workspace_remember_view(object, WORKSPACE_VIEW_PACKAGE, value_string(arguments[0]));
+    workspace_render_package_browser(object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -23308,16 +28557,16 @@ static void execute_entry_workspace_browse_protocols_for_class_named(
     const struct recorz_mvp_heap_object *class_object;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseProtocolsForClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[0].string);
+    class_object = lookup_class_by_name(value_string(arguments[0]));
     if (class_object == 0) {
         machine_panic("Workspace browseProtocolsForClassNamed: could not resolve class");
     }
     workspace_capture_plain_return_state_if_needed(object);
-    workspace_remember_view(object, WORKSPACE_VIEW_PROTOCOLS, arguments[0].string);
-    workspace_render_protocol_list_browser(object, class_object, arguments[0].string, "INST");
+    workspace_remember_view(object, WORKSPACE_VIEW_PROTOCOLS, value_string(arguments[0]));
+    workspace_render_protocol_list_browser(object, class_object, value_string(arguments[0]), "INST");
     push(receiver);
 }
 
@@ -23330,13 +28579,13 @@ static void execute_entry_workspace_browse_protocol_of_class_named(
     const struct recorz_mvp_heap_object *class_object;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseProtocol:ofClassNamed: expects a protocol name string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace browseProtocol:ofClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[1].string);
+    class_object = lookup_class_by_name(value_string(arguments[1]));
     if (class_object == 0) {
         machine_panic("Workspace browseProtocol:ofClassNamed: could not resolve class");
     }
@@ -23344,14 +28593,14 @@ static void execute_entry_workspace_browse_protocol_of_class_named(
     workspace_remember_view(
         object,
         WORKSPACE_VIEW_PROTOCOL,
-        workspace_compose_protocol_target_name(arguments[1].string, arguments[0].string)
+        workspace_compose_protocol_target_name(value_string(arguments[1]), value_string(arguments[0]))
     );
     workspace_render_protocol_method_list_browser(
         object,
         class_object,
-        arguments[1].string,
+        value_string(arguments[1]),
         "INST",
-        arguments[0].string
+        value_string(arguments[0])
     );
     push(receiver);
 }
@@ -23365,16 +28614,16 @@ static void execute_entry_workspace_browse_class_named(
     const struct recorz_mvp_heap_object *class_object;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[0].string);
+    class_object = lookup_class_by_name(value_string(arguments[0]));
     if (class_object == 0) {
         machine_panic("Workspace browseClassNamed: could not resolve class");
     }
     workspace_capture_plain_return_state_if_needed(object);
-    workspace_remember_view(object, WORKSPACE_VIEW_CLASS, arguments[0].string);
-    workspace_render_class_browser(object, class_object, arguments[0].string);
+    workspace_remember_view(object, WORKSPACE_VIEW_CLASS, value_string(arguments[0]));
+    workspace_render_class_browser(object, class_object, value_string(arguments[0]));
     push(receiver);
 }
 
@@ -23387,15 +28636,15 @@ static void execute_entry_workspace_browse_object_named(
     uint16_t object_handle;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseObjectNamed: expects an object name string");
     }
-    object_handle = named_object_handle_for_name(arguments[0].string);
+    object_handle = named_object_handle_for_name(value_string(arguments[0]));
     if (object_handle == 0U) {
         machine_panic("Workspace browseObjectNamed: could not resolve object");
     }
-    workspace_remember_view(object, WORKSPACE_VIEW_OBJECT, arguments[0].string);
-    workspace_render_object_browser(object, arguments[0].string, heap_object(object_handle));
+    workspace_remember_view(object, WORKSPACE_VIEW_OBJECT, value_string(arguments[0]));
+    workspace_render_object_browser(object, value_string(arguments[0]), heap_object(object_handle));
     push(receiver);
 }
 
@@ -23408,10 +28657,10 @@ static void execute_entry_workspace_object_detail_named(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace objectDetailNamed: expects an object name string");
     }
-    push(string_value(workspace_object_detail_text_for_named_object(arguments[0].string)));
+    push(string_value(workspace_object_detail_text_for_named_object(value_string(arguments[0]))));
 }
 
 static void execute_entry_workspace_context_stack_named(
@@ -23423,10 +28672,10 @@ static void execute_entry_workspace_context_stack_named(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace contextStackNamed: expects an object name string");
     }
-    push(string_value(workspace_context_stack_text_for_named_object(arguments[0].string)));
+    push(string_value(workspace_context_stack_text_for_named_object(value_string(arguments[0]))));
 }
 
 static void execute_entry_workspace_context_frame_count_named(
@@ -23438,10 +28687,10 @@ static void execute_entry_workspace_context_frame_count_named(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace contextFrameCountNamed: expects an object name string");
     }
-    push(small_integer_value((int32_t)workspace_context_stack_frame_count_for_named_object(arguments[0].string)));
+    push(small_integer_value((int32_t)workspace_context_stack_frame_count_for_named_object(value_string(arguments[0]))));
 }
 
 static void execute_entry_workspace_context_frame_summary_at_named(
@@ -23459,10 +28708,10 @@ static void execute_entry_workspace_context_frame_summary_at_named(
         arguments[0],
         "Workspace contextFrameSummaryAt:named: expects a positive small integer frame index"
     );
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace contextFrameSummaryAt:named: expects an object name string");
     }
-    push(string_value(workspace_context_stack_frame_summary_text_for_named_object(arguments[1].string, frame_index)));
+    push(string_value(workspace_context_stack_frame_summary_text_for_named_object(value_string(arguments[1]), frame_index)));
 }
 
 static void execute_entry_workspace_context_frame_detail_at_named(
@@ -23480,10 +28729,10 @@ static void execute_entry_workspace_context_frame_detail_at_named(
         arguments[0],
         "Workspace contextFrameDetailAt:named: expects a positive small integer frame index"
     );
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace contextFrameDetailAt:named: expects an object name string");
     }
-    push(string_value(workspace_context_stack_frame_detail_text_for_named_object(arguments[1].string, frame_index)));
+    push(string_value(workspace_context_stack_frame_detail_text_for_named_object(value_string(arguments[1]), frame_index)));
 }
 
 static void execute_entry_workspace_context_frame_at_named(
@@ -23502,14 +28751,14 @@ static void execute_entry_workspace_context_frame_at_named(
         arguments[0],
         "Workspace contextFrameAt:named: expects a positive small integer frame index"
     );
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace contextFrameAt:named: expects an object name string");
     }
     if (frame_index == 0U) {
         push(nil_value());
         return;
     }
-    context_handle = workspace_context_frame_handle_for_index_named(arguments[1].string, frame_index);
+    context_handle = workspace_context_frame_handle_for_index_named(value_string(arguments[1]), frame_index);
     if (context_handle == 0U) {
         push(nil_value());
         return;
@@ -23642,11 +28891,11 @@ static void execute_entry_workspace_context_frame_summaries_visible_from_count_n
         arguments[1],
         "Workspace contextFrameSummariesVisibleFrom:count:named: expects a non-negative line count"
     );
-    if (arguments[2].kind != RECORZ_MVP_VALUE_STRING || arguments[2].string == 0) {
+    if (!value_is_string(arguments[2]) || value_string(arguments[2]) == 0) {
         machine_panic("Workspace contextFrameSummariesVisibleFrom:count:named: expects an object name string");
     }
     push(string_value(workspace_context_frame_summaries_visible_from_count_named_text(
-        arguments[2].string,
+        value_string(arguments[2]),
         first_index,
         count
     )));
@@ -23711,13 +28960,13 @@ static void execute_entry_process_set_label_state_context(
     if (object->kind != RECORZ_MVP_OBJECT_PROCESS) {
         machine_panic("Process setLabel:state:context: expects a Process receiver");
     }
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Process setLabel:state:context: expects a label string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Process setLabel:state:context: expects a state string");
     }
-    if (arguments[2].kind != RECORZ_MVP_VALUE_NIL && arguments[2].kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (!value_is_nil(arguments[2]) && !value_is_object(arguments[2])) {
         machine_panic("Process setLabel:state:context: expects a context object or nil");
     }
     heap_set_field(heap_handle_for_object(object), PROCESS_FIELD_LABEL, arguments[0]);
@@ -23847,13 +29096,13 @@ static void execute_entry_workspace_spawn_process_named_source(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace spawnProcessNamed:source: expects a process name string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace spawnProcessNamed:source: expects a source string");
     }
-    process_handle = scheduled_spawn_workspace_source_process(arguments[0].string, arguments[1].string);
+    process_handle = scheduled_spawn_workspace_source_process(value_string(arguments[0]), value_string(arguments[1]));
     push(object_value(process_handle));
 }
 
@@ -23883,17 +29132,17 @@ static void execute_entry_workspace_browse_method_of_class_named(
     uint16_t selector_id;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseMethod:ofClassNamed: expects a selector name string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace browseMethod:ofClassNamed: expects a class name string");
     }
-    selector_id = source_selector_id_for_name(arguments[0].string);
+    selector_id = source_selector_id_for_name(value_string(arguments[0]));
     if (selector_id == 0U) {
         machine_panic("Workspace browseMethod:ofClassNamed: selector is not declared");
     }
-    class_object = lookup_class_by_name(arguments[1].string);
+    class_object = lookup_class_by_name(value_string(arguments[1]));
     if (class_object == 0) {
         machine_panic("Workspace browseMethod:ofClassNamed: could not resolve class");
     }
@@ -23904,8 +29153,8 @@ static void execute_entry_workspace_browse_method_of_class_named(
     workspace_capture_plain_return_state_if_needed(object);
     method_source = workspace_method_source_text_for_browser_target(
         class_object,
-        arguments[1].string,
-        arguments[0].string,
+        value_string(arguments[1]),
+        value_string(arguments[0]),
         0U
     );
     workspace_remember_editor_current_source(object, method_source);
@@ -23913,9 +29162,9 @@ static void execute_entry_workspace_browse_method_of_class_named(
     workspace_remember_view(
         object,
         WORKSPACE_VIEW_METHOD,
-        workspace_compose_method_target_name(arguments[1].string, arguments[0].string)
+        workspace_compose_method_target_name(value_string(arguments[1]), value_string(arguments[0]))
     );
-    workspace_render_method_browser(object, arguments[1].string, arguments[0].string, "INST");
+    workspace_render_method_browser(object, value_string(arguments[1]), value_string(arguments[0]), "INST");
     push(receiver);
 }
 
@@ -23930,17 +29179,17 @@ static void execute_entry_workspace_edit_method_of_class_named(
     uint16_t selector_id;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace editMethod:ofClassNamed: expects a selector name string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace editMethod:ofClassNamed: expects a class name string");
     }
-    selector_id = source_selector_id_for_name(arguments[0].string);
+    selector_id = source_selector_id_for_name(value_string(arguments[0]));
     if (selector_id == 0U) {
         machine_panic("Workspace editMethod:ofClassNamed: selector is not declared");
     }
-    class_object = lookup_class_by_name(arguments[1].string);
+    class_object = lookup_class_by_name(value_string(arguments[1]));
     if (class_object == 0) {
         machine_panic("Workspace editMethod:ofClassNamed: could not resolve class");
     }
@@ -23951,8 +29200,8 @@ static void execute_entry_workspace_edit_method_of_class_named(
     workspace_capture_plain_return_state_if_needed(object);
     method_source = workspace_method_source_text_for_browser_target(
         class_object,
-        arguments[1].string,
-        arguments[0].string,
+        value_string(arguments[1]),
+        value_string(arguments[0]),
         0U
     );
     workspace_remember_editor_current_source(object, method_source);
@@ -23960,9 +29209,9 @@ static void execute_entry_workspace_edit_method_of_class_named(
     workspace_remember_view(
         object,
         WORKSPACE_VIEW_METHOD,
-        workspace_compose_method_target_name(arguments[1].string, arguments[0].string)
+        workspace_compose_method_target_name(value_string(arguments[1]), value_string(arguments[0]))
     );
-    workspace_render_method_browser(object, arguments[1].string, arguments[0].string, "INST");
+    workspace_render_method_browser(object, value_string(arguments[1]), value_string(arguments[0]), "INST");
     workspace_run_interactive_input_monitor(object);
     push(receiver);
 }
@@ -23976,19 +29225,19 @@ static void execute_entry_workspace_browse_class_methods_for_class_named(
     const struct recorz_mvp_heap_object *class_object;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseClassMethodsForClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[0].string);
+    class_object = lookup_class_by_name(value_string(arguments[0]));
     if (class_object == 0) {
         machine_panic("Workspace browseClassMethodsForClassNamed: could not resolve class");
     }
     workspace_capture_plain_return_state_if_needed(object);
-    workspace_remember_view(object, WORKSPACE_VIEW_CLASS_METHODS, arguments[0].string);
+    workspace_remember_view(object, WORKSPACE_VIEW_CLASS_METHODS, value_string(arguments[0]));
     workspace_render_method_list_browser(
         object,
         class_side_lookup_target(class_object),
-        arguments[0].string,
+        value_string(arguments[0]),
         "CLASS"
     );
     push(receiver);
@@ -24003,19 +29252,19 @@ static void execute_entry_workspace_browse_class_protocols_for_class_named(
     const struct recorz_mvp_heap_object *class_object;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseClassProtocolsForClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[0].string);
+    class_object = lookup_class_by_name(value_string(arguments[0]));
     if (class_object == 0) {
         machine_panic("Workspace browseClassProtocolsForClassNamed: could not resolve class");
     }
     workspace_capture_plain_return_state_if_needed(object);
-    workspace_remember_view(object, WORKSPACE_VIEW_CLASS_PROTOCOLS, arguments[0].string);
+    workspace_remember_view(object, WORKSPACE_VIEW_CLASS_PROTOCOLS, value_string(arguments[0]));
     workspace_render_protocol_list_browser(
         object,
         class_side_lookup_target(class_object),
-        arguments[0].string,
+        value_string(arguments[0]),
         "CLASS"
     );
     push(receiver);
@@ -24030,13 +29279,13 @@ static void execute_entry_workspace_browse_class_protocol_of_class_named(
     const struct recorz_mvp_heap_object *class_object;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseClassProtocol:ofClassNamed: expects a protocol name string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace browseClassProtocol:ofClassNamed: expects a class name string");
     }
-    class_object = lookup_class_by_name(arguments[1].string);
+    class_object = lookup_class_by_name(value_string(arguments[1]));
     if (class_object == 0) {
         machine_panic("Workspace browseClassProtocol:ofClassNamed: could not resolve class");
     }
@@ -24044,14 +29293,14 @@ static void execute_entry_workspace_browse_class_protocol_of_class_named(
     workspace_remember_view(
         object,
         WORKSPACE_VIEW_CLASS_PROTOCOL,
-        workspace_compose_protocol_target_name(arguments[1].string, arguments[0].string)
+        workspace_compose_protocol_target_name(value_string(arguments[1]), value_string(arguments[0]))
     );
     workspace_render_protocol_method_list_browser(
         object,
         class_side_lookup_target(class_object),
-        arguments[1].string,
+        value_string(arguments[1]),
         "CLASS",
-        arguments[0].string
+        value_string(arguments[0])
     );
     push(receiver);
 }
@@ -24068,17 +29317,17 @@ static void execute_entry_workspace_browse_class_method_of_class_named(
     uint16_t selector_id;
 
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("Workspace browseClassMethod:ofClassNamed: expects a selector name string");
     }
-    if (arguments[1].kind != RECORZ_MVP_VALUE_STRING || arguments[1].string == 0) {
+    if (!value_is_string(arguments[1]) || value_string(arguments[1]) == 0) {
         machine_panic("Workspace browseClassMethod:ofClassNamed: expects a class name string");
     }
-    selector_id = source_selector_id_for_name(arguments[0].string);
+    selector_id = source_selector_id_for_name(value_string(arguments[0]));
     if (selector_id == 0U) {
         machine_panic("Workspace browseClassMethod:ofClassNamed: selector is not declared");
     }
-    class_object = lookup_class_by_name(arguments[1].string);
+    class_object = lookup_class_by_name(value_string(arguments[1]));
     if (class_object == 0) {
         machine_panic("Workspace browseClassMethod:ofClassNamed: could not resolve class");
     }
@@ -24090,17 +29339,17 @@ static void execute_entry_workspace_browse_class_method_of_class_named(
     workspace_capture_plain_return_state_if_needed(object);
     method_source = workspace_method_source_text_for_browser_target(
         metaclass_object,
-        arguments[1].string,
-        arguments[0].string,
+        value_string(arguments[1]),
+        value_string(arguments[0]),
         1U
     );
     workspace_remember_editor_current_source(object, method_source);
     workspace_remember_view(
         object,
         WORKSPACE_VIEW_CLASS_METHOD,
-        workspace_compose_method_target_name(arguments[1].string, arguments[0].string)
+        workspace_compose_method_target_name(value_string(arguments[1]), value_string(arguments[0]))
     );
-    workspace_render_method_browser(object, arguments[1].string, arguments[0].string, "CLASS");
+    workspace_render_method_browser(object, value_string(arguments[1]), value_string(arguments[0]), "CLASS");
     push(receiver);
 }
 
@@ -24115,12 +29364,12 @@ static void execute_entry_workspace_rerun(
     (void)arguments;
     (void)text;
     source_value = heap_get_field(object, workspace_last_source_field_index(object));
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         machine_panic("Workspace rerun has no remembered source");
     }
-    workspace_evaluate_source(workspace_source_for_evaluation(source_value.string));
+    workspace_evaluate_source(workspace_source_for_evaluation(value_string(source_value)));
     push(receiver);
 }
 
@@ -24147,14 +29396,14 @@ static void execute_entry_workspace_save_and_rerun(
     (void)arguments;
     (void)text;
     source_value = heap_get_field(object, workspace_last_source_field_index(object));
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         machine_panic("Workspace saveAndRerun has no remembered source");
     }
     startup_hook_receiver_handle = heap_handle_for_object(object);
     startup_hook_selector_id = RECORZ_MVP_SELECTOR_RERUN;
-    emit_live_snapshot();
+    emit_live_snapshot(SNAPSHOT_SAVE_AND_SHUT_DOWN);
     push(receiver);
 }
 
@@ -24181,12 +29430,12 @@ static void execute_entry_workspace_recover_last_source(
     (void)arguments;
     (void)text;
     source_value = heap_get_field(object, workspace_last_source_field_index(object));
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         machine_panic("Workspace recoverLastSource has no remembered source");
     }
-    workspace_remember_current_source(object, source_value.string);
+    workspace_remember_current_source(object, value_string(source_value));
     push(receiver);
 }
 
@@ -24262,13 +29511,13 @@ static void execute_entry_workspace_development_home(
     (void)text;
     source_value = workspace_current_source_value(object);
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (source_value.kind != RECORZ_MVP_VALUE_STRING ||
-        source_value.string == 0 ||
-        source_value.string[0] == '\0') {
+    if (!value_is_string(source_value) ||
+        value_string(source_value) == 0 ||
+        value_string(source_value)[0] == '\0') {
         seed_initial_source = 1U;
-    } else if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER ||
-               (uint32_t)view_kind_value.integer != WORKSPACE_VIEW_INPUT_MONITOR) {
-        if (source_starts_with(source_value.string, "Display clear.\nWorkspace developmentHome.")) {
+    } else if (!value_is_small_integer(view_kind_value) ||
+               (uint32_t)value_integer(view_kind_value) != WORKSPACE_VIEW_INPUT_MONITOR) {
+        if (source_starts_with(value_string(source_value), "Display clear.\nWorkspace developmentHome.")) {
             seed_initial_source = 1U;
         }
     }
@@ -24284,8 +29533,8 @@ static void execute_entry_workspace_development_home(
             workspace_current_target_name_field_index(object),
             nil_value()
         );
-    } else if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER ||
-               (uint32_t)view_kind_value.integer == WORKSPACE_VIEW_NONE) {
+    } else if (!value_is_small_integer(view_kind_value) ||
+               (uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_NONE) {
         heap_set_field(
             heap_handle_for_object(object),
             workspace_current_view_kind_field_index(object),
@@ -24298,11 +29547,11 @@ static void execute_entry_workspace_development_home(
         );
     }
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (view_kind_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
-        workspace_view_kind_uses_image_session((uint32_t)view_kind_value.integer)) {
+    if (value_is_small_integer(view_kind_value) &&
+        workspace_view_kind_uses_image_session((uint32_t)value_integer(view_kind_value))) {
         workspace_present_image_session(
             object,
-            workspace_image_session_mode_for_view_kind((uint32_t)view_kind_value.integer)
+            workspace_image_session_mode_for_view_kind((uint32_t)value_integer(view_kind_value))
         );
     } else {
         workspace_present_image_session(object, 0U);
@@ -24345,11 +29594,11 @@ static void execute_entry_workspace_interactive_input_monitor(
     (void)arguments;
     (void)text;
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (view_kind_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
-        workspace_view_kind_uses_image_session((uint32_t)view_kind_value.integer)) {
+    if (value_is_small_integer(view_kind_value) &&
+        workspace_view_kind_uses_image_session((uint32_t)value_integer(view_kind_value))) {
         workspace_run_interactive_image_session(
             object,
-            workspace_image_session_mode_for_view_kind((uint32_t)view_kind_value.integer)
+            workspace_image_session_mode_for_view_kind((uint32_t)value_integer(view_kind_value))
         );
     } else {
         workspace_run_interactive_image_session(object, 1U);
@@ -24366,63 +29615,63 @@ static void workspace_reopen_in_place(
     const struct recorz_mvp_heap_object *class_object;
 
     view_kind_value = heap_get_field(object, workspace_current_view_kind_field_index(object));
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_small_integer(view_kind_value)) {
         form_clear(form);
         form_write_string(form, "WORKSPACE");
         form_newline(form);
         return;
     }
-    if (workspace_view_kind_uses_image_session((uint32_t)view_kind_value.integer)) {
+    if (workspace_view_kind_uses_image_session((uint32_t)value_integer(view_kind_value))) {
         workspace_present_image_session(
             object,
-            workspace_image_session_mode_for_view_kind((uint32_t)view_kind_value.integer)
+            workspace_image_session_mode_for_view_kind((uint32_t)value_integer(view_kind_value))
         );
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASSES) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASSES) {
         workspace_render_class_list_browser(object);
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_METHODS) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_METHODS) {
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered method-list class");
         }
-        class_object = lookup_class_by_name(target_name_value.string);
+        class_object = lookup_class_by_name(value_string(target_name_value));
         if (class_object == 0) {
             machine_panic("Workspace reopen could not resolve the remembered method-list class");
         }
-        workspace_render_method_list_browser(object, class_object, target_name_value.string, "INST");
+        workspace_render_method_list_browser(object, class_object, value_string(target_name_value), "INST");
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PROTOCOLS) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOLS) {
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered protocol-list class");
         }
-        class_object = lookup_class_by_name(target_name_value.string);
+        class_object = lookup_class_by_name(value_string(target_name_value));
         if (class_object == 0) {
             machine_panic("Workspace reopen could not resolve the remembered protocol-list class");
         }
-        workspace_render_protocol_list_browser(object, class_object, target_name_value.string, "INST");
+        workspace_render_protocol_list_browser(object, class_object, value_string(target_name_value), "INST");
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PROTOCOL) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PROTOCOL) {
         char class_name[METHOD_SOURCE_NAME_LIMIT];
         char protocol_name[METHOD_SOURCE_NAME_LIMIT];
 
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered protocol target");
         }
         if (!workspace_parse_protocol_target_name(
-                target_name_value.string,
+                value_string(target_name_value),
                 class_name,
                 sizeof(class_name),
                 protocol_name,
@@ -24436,56 +29685,56 @@ static void workspace_reopen_in_place(
         workspace_render_protocol_method_list_browser(object, class_object, class_name, "INST", protocol_name);
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_METHODS) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_METHODS) {
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered class-side method-list class");
         }
-        class_object = lookup_class_by_name(target_name_value.string);
+        class_object = lookup_class_by_name(value_string(target_name_value));
         if (class_object == 0) {
             machine_panic("Workspace reopen could not resolve the remembered class-side method-list class");
         }
         workspace_render_method_list_browser(
             object,
             class_side_lookup_target(class_object),
-            target_name_value.string,
+            value_string(target_name_value),
             "CLASS"
         );
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOLS) {
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered class-side protocol-list class");
         }
-        class_object = lookup_class_by_name(target_name_value.string);
+        class_object = lookup_class_by_name(value_string(target_name_value));
         if (class_object == 0) {
             machine_panic("Workspace reopen could not resolve the remembered class-side protocol-list class");
         }
         workspace_render_protocol_list_browser(
             object,
             class_side_lookup_target(class_object),
-            target_name_value.string,
+            value_string(target_name_value),
             "CLASS"
         );
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_CLASS_PROTOCOL) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_CLASS_PROTOCOL) {
         char class_name[METHOD_SOURCE_NAME_LIMIT];
         char protocol_name[METHOD_SOURCE_NAME_LIMIT];
 
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered class-side protocol target");
         }
         if (!workspace_parse_protocol_target_name(
-                target_name_value.string,
+                value_string(target_name_value),
                 class_name,
                 sizeof(class_name),
                 protocol_name,
@@ -24505,50 +29754,50 @@ static void workspace_reopen_in_place(
         );
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_OBJECT) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_OBJECT) {
         uint16_t object_handle;
 
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered object name");
         }
-        object_handle = named_object_handle_for_name(target_name_value.string);
+        object_handle = named_object_handle_for_name(value_string(target_name_value));
         if (object_handle == 0U) {
             machine_panic("Workspace reopen could not resolve the remembered object");
         }
-        workspace_render_object_browser(object, target_name_value.string, heap_object(object_handle));
+        workspace_render_object_browser(object, value_string(target_name_value), heap_object(object_handle));
         return;
     }
-    if ((uint32_t)view_kind_value.integer == WORKSPACE_VIEW_PACKAGE) {
+    if ((uint32_t)value_integer(view_kind_value) == WORKSPACE_VIEW_PACKAGE) {
         target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-        if (target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-            target_name_value.string == 0 ||
-            target_name_value.string[0] == '\0') {
+        if (!value_is_string(target_name_value) ||
+            value_string(target_name_value) == 0 ||
+            value_string(target_name_value)[0] == '\0') {
             machine_panic("Workspace reopen is missing the remembered package target");
         }
-        if (package_definition_for_name(target_name_value.string) == 0) {
+        if (package_definition_for_name(value_string(target_name_value)) == 0) {
             machine_panic("Workspace reopen could not resolve the remembered package");
         }
-        workspace_render_package_browser(object, target_name_value.string);
+        workspace_render_package_browser(object, value_string(target_name_value));
         return;
     }
     target_name_value = heap_get_field(object, workspace_current_target_name_field_index(object));
-    if ((uint32_t)view_kind_value.integer != WORKSPACE_VIEW_CLASS ||
-        target_name_value.kind != RECORZ_MVP_VALUE_STRING ||
-        target_name_value.string == 0 ||
-        target_name_value.string[0] == '\0') {
+    if ((uint32_t)value_integer(view_kind_value) != WORKSPACE_VIEW_CLASS ||
+        !value_is_string(target_name_value) ||
+        value_string(target_name_value) == 0 ||
+        value_string(target_name_value)[0] == '\0') {
         form_clear(form);
         form_write_string(form, "WORKSPACE");
         form_newline(form);
         return;
     }
-    class_object = lookup_class_by_name(target_name_value.string);
+    class_object = lookup_class_by_name(value_string(target_name_value));
     if (class_object == 0) {
         machine_panic("Workspace reopen could not resolve the remembered class");
     }
-    workspace_render_class_browser(object, class_object, target_name_value.string);
+    workspace_render_class_browser(object, class_object, value_string(target_name_value));
 }
 
 static void execute_entry_workspace_reopen(
@@ -24587,10 +29836,10 @@ static void execute_entry_workspace_tool_named_object_or_nil(
     (void)object;
     (void)receiver;
     (void)text;
-    if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+    if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
         machine_panic("WorkspaceTool namedObjectOrNil: expects a name string");
     }
-    object_handle = named_object_handle_for_name(arguments[0].string);
+    object_handle = named_object_handle_for_name(value_string(arguments[0]));
     if (object_handle == 0U) {
         push(nil_value());
         return;
@@ -24637,8 +29886,9 @@ static uint8_t executable_uses_this_context(const struct recorz_mvp_executable *
     uint32_t instruction_index;
 
     for (instruction_index = 0U; instruction_index < executable->instruction_count; ++instruction_index) {
-        struct recorz_mvp_instruction instruction =
-            executable->read_instruction(executable->instruction_source, instruction_index);
+        struct recorz_mvp_instruction instruction = executable->instructions != 0
+            ? executable->instructions[instruction_index]
+            : executable->read_instruction(executable->instruction_source, instruction_index);
 
         if (instruction.opcode == RECORZ_MVP_OP_PUSH_THIS_CONTEXT) {
             return 1U;
@@ -24653,10 +29903,13 @@ static uint16_t allocate_compiled_activation_context_if_needed(
     struct recorz_mvp_value receiver,
     const char *detail_text
 ) {
-    if (sender_context_handle == 0U && !executable_uses_this_context(executable)) {
+    if (executable_uses_this_context(executable)) {
+        return allocate_source_context_object(sender_context_handle, receiver, detail_text);
+    }
+    if (sender_context_handle == 0U) {
         return 0U;
     }
-    return allocate_source_context_object(sender_context_handle, receiver, detail_text);
+    return activation_frame_context(sender_context_handle, receiver, detail_text);
 }
 
 static int16_t ensure_executable_lexical_environment(
@@ -24671,7 +29924,7 @@ static int16_t ensure_executable_lexical_environment(
         executable->lexical_count == 0U) {
         return lexical_environment_index;
     }
-    lexical_environment_index = source_allocate_lexical_environment(-1);
+    lexical_environment_index = source_allocate_lexical_environment(executable->outer_lexical_environment_index);
     for (lexical_index = 0U; lexical_index < executable->lexical_count; ++lexical_index) {
         source_append_binding(
             lexical_environment_index,
@@ -24774,8 +30027,8 @@ static void scheduled_process_release_context_chain(uint16_t context_handle) {
                 break;
             }
             sender_value = heap_get_field(context_object, CONTEXT_FIELD_SENDER);
-            if (sender_value.kind == RECORZ_MVP_VALUE_OBJECT) {
-                next_context_handle = (uint16_t)sender_value.integer;
+            if (value_is_object(sender_value)) {
+                next_context_handle = value_handle(sender_value);
             }
         }
         mark_context_dead(context_handle);
@@ -24989,61 +30242,18 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_non_object_for_act
         nil_value()
     };
 
-    if (selector == RECORZ_MVP_SELECTOR_EQUAL) {
+    if (selector == RECORZ_MVP_SELECTOR_EQUAL || selector == RECORZ_MVP_SELECTOR_NOT_EQUAL) {
         if (argument_count != 1U) {
             return scheduled_send_failure_result(record->context_handle, "= expects one argument", "FAILED SEND");
         }
-        result.value = boolean_value(value_equals(receiver, arguments[0]));
-        return result;
-    }
-    if (selector == RECORZ_MVP_SELECTOR_LESS_THAN || selector == RECORZ_MVP_SELECTOR_GREATER_THAN) {
-        if (argument_count != 1U) {
-            return scheduled_send_failure_result(
-                record->context_handle,
-                "comparison expects one argument",
-                "FAILED SEND"
-            );
-        }
-        if (receiver.kind != RECORZ_MVP_VALUE_SMALL_INTEGER ||
-            arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-            return scheduled_send_failure_result(
-                record->context_handle,
-                "comparison expects small integer operands",
-                "FAILED SEND"
-            );
-        }
-        result.value = boolean_value(
-            selector == RECORZ_MVP_SELECTOR_LESS_THAN ?
-                (receiver.integer < arguments[0].integer) :
-                (receiver.integer > arguments[0].integer)
-        );
+        result.value = boolean_value((uint8_t)(
+            value_equals(receiver, arguments[0]) != (selector == RECORZ_MVP_SELECTOR_NOT_EQUAL)
+        ));
         return result;
     }
-    if (receiver.kind == RECORZ_MVP_VALUE_SMALL_INTEGER) {
-        if (selector == RECORZ_MVP_SELECTOR_ADD ||
-            selector == RECORZ_MVP_SELECTOR_SUBTRACT ||
-            selector == RECORZ_MVP_SELECTOR_MULTIPLY) {
-            if (argument_count != 1U || arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-                const char *message = "+ expects a small integer argument";
-
-                if (selector == RECORZ_MVP_SELECTOR_SUBTRACT) {
-                    message = "- expects a small integer argument";
-                } else if (selector == RECORZ_MVP_SELECTOR_MULTIPLY) {
-                    message = "* expects a small integer argument";
-                }
-                return scheduled_send_failure_result(record->context_handle, message, "FAILED SEND");
-            }
-            if (selector == RECORZ_MVP_SELECTOR_ADD) {
-                result.value = small_integer_value(receiver.integer + arguments[0].integer);
-            } else if (selector == RECORZ_MVP_SELECTOR_SUBTRACT) {
-                result.value = small_integer_value(receiver.integer - arguments[0].integer);
-            } else {
-                result.value = small_integer_value(receiver.integer * arguments[0].integer);
-            }
-            return result;
-        }
+    if (value_is_small_integer(receiver)) {
         if (selector == RECORZ_MVP_SELECTOR_PRINT_STRING) {
-            render_small_integer(receiver.integer);
+            render_small_integer(value_integer(receiver));
             result.value = string_value(print_buffer);
             return result;
         }
@@ -25053,44 +30263,44 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_non_object_for_act
             "FAILED SEND"
         );
     }
-    if (receiver.kind == RECORZ_MVP_VALUE_STRING) {
+    if (value_is_string(receiver)) {
         if (selector == RECORZ_MVP_SELECTOR_PRINT_STRING) {
             result.value = receiver;
             return result;
         }
         if (selector == RECORZ_MVP_SELECTOR_SIZE) {
-            result.value = small_integer_value((int32_t)text_length(receiver.string == 0 ? "" : receiver.string));
+            result.value = small_integer_value((int32_t)text_length(value_string(receiver) == 0 ? "" : value_string(receiver)));
             return result;
         }
         if (selector == RECORZ_MVP_SELECTOR_AT) {
             uint32_t index;
 
-            if (argument_count != 1U || arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+            if (argument_count != 1U || !value_is_small_integer(arguments[0])) {
                 return scheduled_send_failure_result(
                     record->context_handle,
                     "String at: expects a small integer argument",
                     "FAILED SEND"
                 );
             }
-            if (receiver.string == 0) {
+            if (value_string(receiver) == 0) {
                 return scheduled_send_failure_result(record->context_handle, "String at: receiver is null", "FAILED SEND");
             }
-            if (arguments[0].integer <= 0) {
+            if (value_integer(arguments[0]) <= 0) {
                 return scheduled_send_failure_result(
                     record->context_handle,
                     "String at: index must be positive",
                     "FAILED SEND"
                 );
             }
-            index = (uint32_t)arguments[0].integer - 1U;
-            if (index >= text_length(receiver.string)) {
+            index = (uint32_t)value_integer(arguments[0]) - 1U;
+            if (index >= text_length(value_string(receiver))) {
                 return scheduled_send_failure_result(
                     record->context_handle,
                     "String at: index is out of range",
                     "FAILED SEND"
                 );
             }
-            result.value = small_integer_value((int32_t)(uint8_t)receiver.string[index]);
+            result.value = small_integer_value((int32_t)(uint8_t)value_string(receiver)[index]);
             return result;
         }
         return scheduled_send_failure_result(
@@ -25123,11 +30333,24 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
 
     if ((selector == RECORZ_MVP_SELECTOR_SHOW || selector == RECORZ_MVP_SELECTOR_WRITE_STRING) &&
         argument_count > 0U &&
-        arguments[0].kind == RECORZ_MVP_VALUE_STRING) {
-        text = arguments[0].string;
+        value_is_string(arguments[0])) {
+        text = value_string(arguments[0]);
     }
 
-    if (receiver.kind != RECORZ_MVP_VALUE_OBJECT) {
+    if (value_is_integer(receiver) && special_send_opcode_for_selector(selector, argument_count) != 0U) {
+        const char *failure = integer_special_send(
+            special_send_opcode_for_selector(selector, argument_count),
+            receiver,
+            arguments[0],
+            &result.value
+        );
+
+        if (failure != 0) {
+            return scheduled_send_failure_result(record->context_handle, failure, "FAILED SEND");
+        }
+        return result;
+    }
+    if (!value_is_object(receiver)) {
         return scheduled_send_non_object_for_activation(record, receiver, selector, argument_count, arguments);
     }
     {
@@ -25147,6 +30370,8 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
         uint32_t baseline_stack_size;
         uint32_t primitive_binding_id;
         recorz_mvp_method_entry_handler handler;
+        struct recorz_mvp_gc_root_frame receiver_roots;
+        struct recorz_mvp_gc_root_frame argument_roots;
 
         if (selector == RECORZ_MVP_SELECTOR_CLASS) {
             result.value = object_value(object->class_handle);
@@ -25161,13 +30386,14 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
                     "FAILED SEND"
                 );
             }
-            source_result = source_execute_block_closure(
+            source_result = execute_block_closure(
                 object,
                 argument_count,
                 arguments,
                 record->context_handle
             );
             if (source_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+                block_return_home_context_index = -1;
                 return scheduled_send_failure_result(
                     record->context_handle,
                     "scheduled block non-local return crossed an unsupported boundary",
@@ -25194,7 +30420,7 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
                 result.value = nil_value();
                 return result;
             }
-            if (arguments[chosen_index].kind != RECORZ_MVP_VALUE_OBJECT ||
+            if (!value_is_object(arguments[chosen_index]) ||
                 primitive_kind_for_heap_object(heap_object_for_value(arguments[chosen_index])) !=
                     RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
                 return scheduled_send_failure_result(
@@ -25208,13 +30434,14 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
                     &block_state_storage)) {
                 block_state = &block_state_storage;
             }
-            source_result = source_execute_block_closure(
+            source_result = execute_block_closure(
                 heap_object_for_value(arguments[chosen_index]),
                 0U,
                 0,
                 record->context_handle
             );
             if (source_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
+                block_return_home_context_index = -1;
                 if (block_state == 0 || block_state->home_context_index < 0) {
                     return scheduled_send_failure_result(
                         record->context_handle,
@@ -25239,20 +30466,28 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
             &source_owner_class
         );
         if (source_record != 0 &&
-            source_text_requires_live_evaluator(live_method_source_text(source_record))) {
+            source_record->execution_kind != RECORZ_MVP_LIVE_METHOD_EXECUTION_COMPILED) {
             baseline_stack_size = stack_size;
-            execute_live_source_method_with_sender(
+            execute_live_method_with_sender(
                 source_owner_class,
                 receiver,
                 argument_count,
                 arguments,
-                live_method_source_text(source_record),
+                source_record,
                 record->context_handle
             );
             if (stack_size != baseline_stack_size + 1U) {
                 machine_panic("scheduled live source send did not return exactly one value");
             }
             result.value = pop_value();
+            if (block_return_home_context_index >= 0) {
+                block_return_home_context_index = -1;
+                return scheduled_send_failure_result(
+                    record->context_handle,
+                    "scheduled block non-local return crossed an unsupported boundary",
+                    "FAILED SEND"
+                );
+            }
             if (scheduled_terminate_requested || scheduled_suspend_requested || scheduled_yield_requested) {
                 machine_panic("scheduled live source method attempted unsupported process control");
             }
@@ -25268,7 +30503,7 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
         }
         entry_object = method_descriptor_entry_object(method_object);
         implementation_value = method_entry_implementation_value(entry_object);
-        if (implementation_value.kind == RECORZ_MVP_VALUE_OBJECT) {
+        if (value_is_object(implementation_value)) {
             implementation_object = heap_object_for_value(implementation_value);
             child_context_handle = allocate_source_context_object(
                 record->context_handle,
@@ -25290,10 +30525,10 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
             result.child_context_handle = child_context_handle;
             return result;
         }
-        if (implementation_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+        if (!value_is_small_integer(implementation_value)) {
             machine_panic("scheduled process method entry implementation kind is unknown");
         }
-        primitive_binding_id = (uint32_t)implementation_value.integer;
+        primitive_binding_id = (uint32_t)value_integer(implementation_value);
         if (primitive_binding_id == 0U || primitive_binding_id >= RECORZ_MVP_PRIMITIVE_COUNT) {
             machine_panic("scheduled process primitive binding id is out of range");
         }
@@ -25302,11 +30537,22 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
             machine_panic("scheduled process primitive handler is not installed");
         }
         baseline_stack_size = stack_size;
+        gc_root_values(&receiver_roots, &receiver, 1U);
+        gc_root_values(&argument_roots, arguments, argument_count);
         handler(object, receiver, arguments, text);
+        gc_unroot(&receiver_roots);
         if (stack_size != baseline_stack_size + 1U) {
             machine_panic("scheduled primitive send did not return exactly one value");
         }
         result.value = pop_value();
+        if (block_return_home_context_index >= 0) {
+            block_return_home_context_index = -1;
+            return scheduled_send_failure_result(
+                record->context_handle,
+                "scheduled block non-local return crossed an unsupported boundary",
+                "FAILED SEND"
+            );
+        }
         if (scheduled_terminate_requested) {
             result.kind = RECORZ_MVP_SCHEDULER_SEND_EVENT;
             result.event = RECORZ_MVP_SCHEDULER_EVENT_TERMINATED;
@@ -25321,7 +30567,10 @@ static struct recorz_mvp_scheduler_send_result scheduled_send_for_activation(
     }
 }
 
-static enum recorz_mvp_scheduler_run_event scheduled_process_run_by_index(uint16_t process_index) {
+static enum recorz_mvp_scheduler_run_event scheduled_process_run_activations(
+    uint16_t process_index,
+    struct recorz_mvp_execution_frame *frame
+) {
     struct recorz_mvp_scheduled_process_runtime *process_runtime = &scheduled_processes[process_index];
 
 resume_next_activation:
@@ -25332,6 +30581,7 @@ resume_next_activation:
         struct recorz_mvp_executable executable = {0};
         const struct recorz_mvp_heap_object *receiver_object;
 
+        frame->pc = 0U;
         if (process_runtime->current_context_handle == 0U) {
             process_runtime->state = RECORZ_MVP_PROCESS_STATE_TERMINATED;
             scheduled_process_sync_object_fields(process_index);
@@ -25357,36 +30607,41 @@ resume_next_activation:
                 heap_object_for_value(record->receiver)
             );
             executable.home_context_index = -1;
+            executable.outer_lexical_environment_index = -1;
         } else if (record->kind == RECORZ_MVP_SCHEDULED_ACTIVATION_COMPILED_METHOD) {
             const struct recorz_mvp_heap_object *compiled_method =
                 heap_object(record->compiled_method_handle);
 
             executable.instruction_source = compiled_method;
             executable.read_instruction = read_compiled_method_instruction;
-            executable.instruction_count = compiled_method->field_count;
+            executable.instruction_count = compiled_method_instruction_count(compiled_method);
             executable.literals = 0;
-            executable.literal_count = 0U;
+            executable.literal_count = compiled_method_literal_count(compiled_method);
             executable.lexical_count = compiled_method_lexical_count(compiled_method);
             executable.lexical_names = 0;
             executable.block_defining_class = class_object_for_heap_object(
                 heap_object_for_value(record->receiver)
             );
             executable.home_context_index = -1;
+            executable.outer_lexical_environment_index = -1;
         } else {
             machine_panic("scheduled activation kind is invalid");
         }
         receiver_object = heap_object_for_value(record->receiver);
+        frame->executable = &executable;
         process_runtime->state = RECORZ_MVP_PROCESS_STATE_RUNNING;
         scheduled_process_sync_object_fields(process_index);
         while (record->pc < executable.instruction_count) {
             struct recorz_mvp_instruction instruction =
                 executable.read_instruction(executable.instruction_source, record->pc++);
 
-            panic_phase = "execute";
-            panic_pc = record->pc - 1U;
-            panic_instruction = instruction;
-            panic_have_instruction = 1U;
-            panic_have_send = 0U;
+            frame->pc = record->pc;
+            forget_send_context();
+            if (opcode_is_special_send(instruction.opcode)) {
+                instruction.operand_a = special_send_selector(instruction.opcode);
+                instruction.operand_b = 1U;
+                instruction.opcode = RECORZ_MVP_OP_SEND;
+            }
 
             switch (instruction.opcode) {
                 case RECORZ_MVP_OP_PUSH_GLOBAL:
@@ -25399,7 +30654,7 @@ resume_next_activation:
                     activation_push(
                         record->stack,
                         (uint32_t *)&record->stack_size,
-                        literal_value(&executable.literals[instruction.operand_b])
+                        executable_literal_value(&executable, instruction.operand_b)
                     );
                     break;
                 case RECORZ_MVP_OP_PUSH_NIL:
@@ -25414,8 +30669,7 @@ resume_next_activation:
                             record->stack,
                             (uint32_t *)&record->stack_size,
                             source_lexical_environment_at(record->shared_lexical_environment_index)
-                                ->bindings[instruction.operand_b]
-                                .value
+                                ->values[instruction.operand_b]
                         );
                     } else {
                         activation_push(
@@ -25431,8 +30685,7 @@ resume_next_activation:
                     }
                     if (record->shared_lexical_environment_index >= 0) {
                         source_lexical_environment_at(record->shared_lexical_environment_index)
-                            ->bindings[instruction.operand_b]
-                            .value =
+                            ->values[instruction.operand_b] =
                             activation_pop(record->stack, (uint32_t *)&record->stack_size);
                     } else {
                         record->lexical[instruction.operand_b] =
@@ -25515,7 +30768,8 @@ resume_next_activation:
                     }
                     block_handle = allocate_block_closure_from_source(
                         executable.literals[instruction.operand_b].string,
-                        record->receiver
+                        record->receiver,
+                        0U
                     );
                     if (block_defining_class == 0) {
                         block_defining_class = class_object_for_heap_object(receiver_object);
@@ -25567,6 +30821,30 @@ resume_next_activation:
                         activation_pop(record->stack, (uint32_t *)&record->stack_size)
                     );
                     break;
+                case RECORZ_MVP_OP_STORE_FIELD_FROM_ARGUMENT:
+                    if (instruction.operand_b >= record->argument_count) {
+                        machine_panic("scheduled argument read is out of range");
+                    }
+                    heap_set_field(
+                        heap_handle_for_object(receiver_object),
+                        instruction.operand_a,
+                        record->arguments[instruction.operand_b]
+                    );
+                    break;
+                case RECORZ_MVP_OP_STORE_LEXICAL_FROM_ARGUMENT:
+                    if (instruction.operand_a >= record->argument_count) {
+                        machine_panic("scheduled argument read is out of range");
+                    }
+                    if ((uint32_t)instruction.operand_b >= executable.lexical_count) {
+                        machine_panic("scheduled lexical write is out of range");
+                    }
+                    if (record->shared_lexical_environment_index >= 0) {
+                        source_lexical_environment_at(record->shared_lexical_environment_index)
+                            ->values[instruction.operand_b] = record->arguments[instruction.operand_a];
+                    } else {
+                        record->lexical[instruction.operand_b] = record->arguments[instruction.operand_a];
+                    }
+                    break;
                 case RECORZ_MVP_OP_SEND: {
                     struct recorz_mvp_value send_arguments[MAX_SEND_ARGS];
                     struct recorz_mvp_value send_receiver;
@@ -25623,10 +30901,13 @@ resume_next_activation:
                     break;
                 }
                 case RECORZ_MVP_OP_RETURN:
-                case RECORZ_MVP_OP_RETURN_RECEIVER: {
+                case RECORZ_MVP_OP_RETURN_RECEIVER:
+                case RECORZ_MVP_OP_RETURN_FIELD: {
                     struct recorz_mvp_value return_value =
                         instruction.opcode == RECORZ_MVP_OP_RETURN_RECEIVER ?
                             record->receiver :
+                        instruction.opcode == RECORZ_MVP_OP_RETURN_FIELD ?
+                            heap_get_field(receiver_object, instruction.operand_a) :
                             activation_peek(record->stack, record->stack_size);
                     uint16_t sender_context_handle = record->sender_context_handle;
 
@@ -25669,6 +30950,17 @@ resume_next_activation:
     }
 }
 
+static enum recorz_mvp_scheduler_run_event scheduled_process_run_by_index(uint16_t process_index) {
+    struct recorz_mvp_execution_frame frame = {0};
+    enum recorz_mvp_scheduler_run_event event;
+
+    frame.caller = current_execution_frame;
+    current_execution_frame = &frame;
+    event = scheduled_process_run_activations(process_index, &frame);
+    current_execution_frame = frame.caller;
+    return event;
+}
+
 static void scheduled_scheduler_run_runnable_queue(void) {
     while (scheduled_runnable_head != 0xFFFFU) {
         uint16_t process_index = scheduled_runnable_head;
@@ -25693,6 +30985,9 @@ static void scheduled_scheduler_run_runnable_queue(void) {
         if (event == RECORZ_MVP_SCHEDULER_EVENT_YIELDED) {
             process_runtime->state = RECORZ_MVP_PROCESS_STATE_RUNNABLE;
             scheduled_process_append_runnable_queue(process_index);
+            if (gc_collection_allowed_for_current_phase()) {
+                gc_incremental_step(1U);
+            }
         } else if (event == RECORZ_MVP_SCHEDULER_EVENT_SUSPENDED) {
             process_runtime->state = RECORZ_MVP_PROCESS_STATE_SUSPENDED;
         } else if (event == RECORZ_MVP_SCHEDULER_EVENT_FAILED) {
@@ -25711,6 +31006,12 @@ static void scheduled_scheduler_run_runnable_queue(void) {
             scheduled_debug_clear();
         }
         scheduled_process_sync_object_fields(process_index);
+        if (scheduled_snapshot_save_mode != 0U) {
+            uint8_t save_mode = scheduled_snapshot_save_mode;
+
+            scheduled_snapshot_save_mode = 0U;
+            emit_live_snapshot(save_mode);
+        }
     }
 }
 
@@ -25795,53 +31096,266 @@ static void scheduled_process_step_by_index(uint16_t process_index, uint8_t debu
 static void scheduled_process_step_into_by_handle(uint16_t process_handle) {
     uint16_t process_index = scheduled_process_slot_for_handle(process_handle);
 
-    if (process_index == 0xFFFFU) {
-        return;
+    if (process_index == 0xFFFFU) {
+        return;
+    }
+    scheduled_process_step_by_index(process_index, RECORZ_MVP_SCHEDULER_DEBUG_STEP_INTO);
+}
+
+static void scheduled_process_step_over_by_handle(uint16_t process_handle) {
+    uint16_t process_index = scheduled_process_slot_for_handle(process_handle);
+
+    if (process_index == 0xFFFFU) {
+        return;
+    }
+    scheduled_process_step_by_index(process_index, RECORZ_MVP_SCHEDULER_DEBUG_STEP_OVER);
+}
+
+static void scheduled_process_terminate_by_handle(uint16_t process_handle) {
+    uint16_t process_index = scheduled_process_slot_for_handle(process_handle);
+
+    if (process_index == 0xFFFFU) {
+        return;
+    }
+    if (scheduled_active_process_index >= 0 &&
+        (uint16_t)scheduled_active_process_index == process_index) {
+        scheduled_terminate_requested = 1U;
+        return;
+    }
+    scheduled_process_release_context_chain(scheduled_processes[process_index].current_context_handle);
+    scheduled_processes[process_index].current_context_handle = 0U;
+    scheduled_processes[process_index].state = RECORZ_MVP_PROCESS_STATE_TERMINATED;
+    scheduled_process_sync_object_fields(process_index);
+}
+
+static uint16_t scheduled_spawn_workspace_source_process(const char *process_name, const char *source_text) {
+    uint16_t process_index = scheduled_process_create_named_source(process_name, source_text);
+
+    scheduled_processes[process_index].state = RECORZ_MVP_PROCESS_STATE_RUNNABLE;
+    scheduled_process_append_runnable_queue(process_index);
+    scheduled_process_sync_object_fields(process_index);
+    return scheduled_processes[process_index].process_handle;
+}
+
+static void mark_context_dead(uint16_t context_handle) {
+    if ((context_handle & ACTIVATION_FRAME_HANDLE_TAG) != 0U) {
+        if ((uint16_t)(context_handle & ~ACTIVATION_FRAME_HANDLE_TAG) + 1U != activation_frame_count) {
+            machine_panic("activation frame released out of order");
+        }
+        context_handle = activation_frames[--activation_frame_count].context_handle;
+    }
+    if (context_handle != 0U) {
+        heap_set_field(context_handle, CONTEXT_FIELD_ALIVE, boolean_value(0U));
+    }
+}
+
+/* Block activations share their home's index, so only a method or doIt activation can be the return target. */
+static void executable_claim_block_return(const struct recorz_mvp_executable *executable) {
+    if (!executable->is_block && block_return_home_context_index == executable->home_context_index) {
+        block_return_home_context_index = -1;
+    }
+}
+
+static struct recorz_mvp_value *executable_outer_lexical_cell(
+    const struct recorz_mvp_executable *executable,
+    uint16_t depth,
+    uint16_t binding_index
+) {
+    struct recorz_mvp_source_lexical_environment *environment =
+        source_lexical_environment_at(executable->outer_lexical_environment_index);
+
+    while (depth-- > 0U) {
+        environment = source_lexical_environment_at(environment->parent_index);
+    }
+    if (binding_index >= environment->binding_count) {
+        machine_panic("outer lexical binding is out of range");
+    }
+    return &environment->values[binding_index];
+}
+
+static struct recorz_mvp_instruction execution_frame_fetch(struct recorz_mvp_execution_frame *frame) {
+    if (frame->instructions != 0) {
+        return frame->instructions[frame->pc++];
+    }
+    return frame->executable->read_instruction(frame->executable->instruction_source, frame->pc++);
+}
+
+static uint8_t execution_frame_returns_top(const struct recorz_mvp_execution_frame *frame) {
+    return (uint8_t)(frame->pc < frame->executable->instruction_count &&
+                     execution_frame_instruction_at(frame, frame->pc).opcode == RECORZ_MVP_OP_RETURN);
+}
+
+static void compiled_method_executable(
+    struct recorz_mvp_executable *executable,
+    const struct recorz_mvp_heap_object *compiled_method
+) {
+    if (compiled_method->kind != RECORZ_MVP_OBJECT_COMPILED_METHOD) {
+        machine_panic("method entry implementation is not a compiled method");
+    }
+    *executable = (struct recorz_mvp_executable){
+        .instruction_source = compiled_method,
+        .read_instruction = read_compiled_method_instruction,
+        .instruction_count = compiled_method_instruction_count(compiled_method),
+        .literals = 0,
+        .literal_count = compiled_method_literal_count(compiled_method),
+        .lexical_count = compiled_method_lexical_count(compiled_method),
+        .home_context_index = -1,
+        .outer_lexical_environment_index = -1,
+    };
+    executable->send_site_base = compiled_method_send_site_base(compiled_method);
+    executable->instructions = compiled_method_decoded_instructions(compiled_method);
+}
+
+static void interpreter_push(
+    struct recorz_mvp_value values[],
+    uint32_t *value_count,
+    struct recorz_mvp_value value
+) {
+    if (interpreter_entry_value_base + *value_count >= INTERPRETER_VALUE_LIMIT) {
+        machine_panic("interpreter value stack overflow");
     }
-    scheduled_process_step_by_index(process_index, RECORZ_MVP_SCHEDULER_DEBUG_STEP_INTO);
+    values[(*value_count)++] = value;
 }
 
-static void scheduled_process_step_over_by_handle(uint16_t process_handle) {
-    uint16_t process_index = scheduled_process_slot_for_handle(process_handle);
-
-    if (process_index == 0xFFFFU) {
-        return;
+static struct recorz_mvp_interpreter_activation *interpreter_activation_allocate(void) {
+    if (interpreter_activation_count >= INTERPRETER_ACTIVATION_LIMIT) {
+        machine_panic("interpreter activation stack overflow");
     }
-    scheduled_process_step_by_index(process_index, RECORZ_MVP_SCHEDULER_DEBUG_STEP_OVER);
+    return &interpreter_activations[interpreter_activation_count++];
 }
 
-static void scheduled_process_terminate_by_handle(uint16_t process_handle) {
-    uint16_t process_index = scheduled_process_slot_for_handle(process_handle);
+/* The caller fills in executable and handles; this lays out the lexicals above the values already
+   pushed and makes the activation the innermost execution frame. */
+static void interpreter_activation_open(
+    struct recorz_mvp_interpreter_activation *activation,
+    const struct recorz_mvp_heap_object *receiver_object,
+    struct recorz_mvp_value receiver,
+    uint16_t argument_count,
+    const struct recorz_mvp_value arguments[],
+    struct recorz_mvp_value values[],
+    uint32_t *value_count
+) {
+    uint16_t lexical_index;
 
-    if (process_index == 0xFFFFU) {
-        return;
+    if (activation->executable->lexical_count > LEXICAL_LIMIT) {
+        machine_panic("too many lexical slots for MVP VM");
     }
-    if (scheduled_active_process_index >= 0 &&
-        (uint16_t)scheduled_active_process_index == process_index) {
-        scheduled_terminate_requested = 1U;
-        return;
+    activation->receiver_object = receiver_object;
+    activation->receiver = receiver;
+    activation->argument_count = argument_count;
+    activation->arguments = arguments;
+    activation->shared_lexical_environment_index = -1;
+    activation->lexical_base = *value_count;
+    for (lexical_index = 0U; lexical_index < activation->executable->lexical_count; ++lexical_index) {
+        interpreter_push(values, value_count, nil_value());
+    }
+    activation->stack_base = *value_count;
+    activation->handles[1] = 0U;
+    gc_root_values(&activation->roots, &activation->receiver, 1U);
+    activation->roots.handles = activation->handles;
+    activation->roots.handle_count = 3U;
+    activation->frame.caller = current_execution_frame;
+    activation->frame.executable = activation->executable;
+    activation->frame.instructions = activation->executable->instructions;
+    activation->frame.pc = 0U;
+    current_execution_frame = &activation->frame;
+}
+
+static void interpreter_activation_close(struct recorz_mvp_interpreter_activation *activation) {
+    current_execution_frame = activation->frame.caller;
+    gc_unroot(&activation->roots);
+}
+
+static uint8_t value_is_block_created_by_activation(
+    struct recorz_mvp_value value,
+    const struct recorz_mvp_interpreter_activation *activation
+) {
+    struct recorz_mvp_runtime_block_state block_state;
+
+    if (!value_is_object(value) || !source_block_state_for_handle(value_handle(value), &block_state)) {
+        return 0U;
     }
-    scheduled_process_release_context_chain(scheduled_processes[process_index].current_context_handle);
-    scheduled_processes[process_index].current_context_handle = 0U;
-    scheduled_processes[process_index].state = RECORZ_MVP_PROCESS_STATE_TERMINATED;
-    scheduled_process_sync_object_fields(process_index);
+    return (uint8_t)(
+        (block_state.home_context_index >= 0 &&
+         block_state.home_context_index == activation->executable->home_context_index) ||
+        (block_state.lexical_environment_index >= 0 &&
+         block_state.lexical_environment_index == activation->shared_lexical_environment_index)
+    );
 }
 
-static uint16_t scheduled_spawn_workspace_source_process(const char *process_name, const char *source_text) {
-    uint16_t process_index = scheduled_process_create_named_source(process_name, source_text);
-
-    scheduled_processes[process_index].state = RECORZ_MVP_PROCESS_STATE_RUNNABLE;
-    scheduled_process_append_runnable_queue(process_index);
-    scheduled_process_sync_object_fields(process_index);
-    return scheduled_processes[process_index].process_handle;
-}
+/* Reusing the sender's record for a tail send kills its home context and releases its lexical
+   environment, so a sender whose blocks may still run keeps its record. */
+static uint8_t interpreter_activation_allows_tail_send(
+    const struct recorz_mvp_interpreter_activation *activation,
+    struct recorz_mvp_value send_receiver,
+    const struct recorz_mvp_value send_arguments[],
+    uint16_t argument_count
+) {
+    int16_t home_context_index = activation->executable->home_context_index;
+    uint16_t argument_index;
 
-static void mark_context_dead(uint16_t context_handle) {
-    if (context_handle != 0U) {
-        heap_set_field(context_handle, CONTEXT_FIELD_ALIVE, boolean_value(0U));
+    if ((home_context_index >= 0 && source_home_context_at(home_context_index)->alive) ||
+        activation->shared_lexical_environment_index >= 0 ||
+        value_is_block_created_by_activation(send_receiver, activation)) {
+        return 0U;
+    }
+    for (argument_index = 0U; argument_index < argument_count; ++argument_index) {
+        if (value_is_block_created_by_activation(send_arguments[argument_index], activation)) {
+            return 0U;
+        }
     }
+    return 1U;
 }
 
+/* Everything an inline activation owns dies with it. A live method program's context is its
+   failure context, so that one is only released once. */
+static void interpreter_activation_finish(struct recorz_mvp_interpreter_activation *activation) {
+    mark_context_dead(activation->handles[1]);
+    source_release_lexical_environment_chain_if_unused(activation->shared_lexical_environment_index);
+    if (activation->handles[0] != activation->handles[1]) {
+        mark_context_dead(activation->handles[0]);
+    }
+    if (activation->live_method) {
+        live_method_program_end(activation->executable);
+    }
+    interpreter_activation_close(activation);
+}
+
+/* With RECORZ_MVP_THREADED_DISPATCH each handler jumps straight to the next one through
+   execute_dispatch; otherwise the same handlers are switch cases that loop back for the next fetch. */
+#if RECORZ_MVP_THREADED_DISPATCH
+#define EXECUTE_OPCODE(name) case RECORZ_MVP_OP_##name: execute_op_##name
+#define EXECUTE_DEFAULT default: execute_op_unknown
+#define EXECUTE_NEXT() \
+    do { \
+        if (frame->pc >= executable->instruction_count) { \
+            machine_panic("executable did not return"); \
+        } \
+        instruction = execution_frame_fetch(frame); \
+        goto *execute_dispatch[instruction.opcode <= MAX_OPCODE ? instruction.opcode : 0U]; \
+    } while (0)
+#else
+#define EXECUTE_OPCODE(name) case RECORZ_MVP_OP_##name
+#define EXECUTE_DEFAULT default
+#define EXECUTE_NEXT() break
+#endif
+#define EXECUTE_LOAD_ACTIVATION() \
+    do { \
+        executable = activation->executable; \
+        receiver_object = activation->receiver_object; \
+        receiver = activation->receiver; \
+        argument_count = activation->argument_count; \
+        arguments = activation->arguments; \
+        current_context_handle = activation->handles[0]; \
+        failure_context_handle = activation->handles[1]; \
+        lexical = &activation_stack[activation->lexical_base]; \
+        stack_base = activation->stack_base; \
+        shared_lexical_environment = activation->shared_lexical_environment_index >= 0 \
+            ? source_lexical_environment_at(activation->shared_lexical_environment_index) \
+            : 0; \
+        frame = &activation->frame; \
+    } while (0)
+
 static void execute_executable(
     const struct recorz_mvp_executable *executable,
     const struct recorz_mvp_heap_object *receiver_object,
@@ -25850,135 +31364,249 @@ static void execute_executable(
     const struct recorz_mvp_value arguments[],
     uint16_t current_context_handle
 ) {
-    struct recorz_mvp_value activation_stack[STACK_LIMIT];
-    struct recorz_mvp_value lexical[LEXICAL_LIMIT];
-    struct recorz_mvp_source_lexical_environment *shared_lexical_environment = 0;
+    struct recorz_mvp_interpreter_activation *entry_activation;
+    struct recorz_mvp_interpreter_activation *activation;
+    struct recorz_mvp_value *activation_stack;
+    struct recorz_mvp_value *lexical;
+    struct recorz_mvp_source_lexical_environment *shared_lexical_environment;
     uint32_t activation_stack_size = 0U;
-    uint32_t lexical_index;
-    uint32_t pc = 0U;
-    int16_t shared_lexical_environment_index = -1;
-
-    if (executable->lexical_count > LEXICAL_LIMIT) {
-        machine_panic("too many lexical slots for MVP VM");
-    }
-    for (lexical_index = 0U; lexical_index < executable->lexical_count; ++lexical_index) {
-        lexical[lexical_index] = nil_value();
-    }
-
-    while (pc < executable->instruction_count) {
-        struct recorz_mvp_instruction instruction =
-            executable->read_instruction(executable->instruction_source, pc++);
+    uint32_t stack_base;
+    struct recorz_mvp_execution_frame *frame;
+    struct recorz_mvp_instruction instruction;
+    uint16_t failure_context_handle;
+    uint32_t outer_value_base = interpreter_entry_value_base;
+    const uint32_t *outer_value_count = interpreter_entry_value_count;
+    struct recorz_mvp_gc_root_frame stack_roots;
+    struct recorz_mvp_gc_root_frame argument_roots;
+#if RECORZ_MVP_THREADED_DISPATCH
+    static const void *const execute_dispatch[MAX_OPCODE + 1U] = {
+        [0] = &&execute_op_unknown,
+        [RECORZ_MVP_OP_PUSH_GLOBAL] = &&execute_op_PUSH_GLOBAL,
+        [RECORZ_MVP_OP_PUSH_LITERAL] = &&execute_op_PUSH_LITERAL,
+        [RECORZ_MVP_OP_SEND] = &&execute_op_SEND,
+        [RECORZ_MVP_OP_DUP] = &&execute_op_DUP,
+        [RECORZ_MVP_OP_POP] = &&execute_op_POP,
+        [RECORZ_MVP_OP_RETURN] = &&execute_op_RETURN,
+        [RECORZ_MVP_OP_PUSH_NIL] = &&execute_op_PUSH_NIL,
+        [RECORZ_MVP_OP_PUSH_LEXICAL] = &&execute_op_PUSH_LEXICAL,
+        [RECORZ_MVP_OP_STORE_LEXICAL] = &&execute_op_STORE_LEXICAL,
+        [RECORZ_MVP_OP_PUSH_ROOT] = &&execute_op_PUSH_ROOT,
+        [RECORZ_MVP_OP_PUSH_ARGUMENT] = &&execute_op_PUSH_ARGUMENT,
+        [RECORZ_MVP_OP_PUSH_FIELD] = &&execute_op_PUSH_FIELD,
+        [RECORZ_MVP_OP_RETURN_RECEIVER] = &&execute_op_RETURN_RECEIVER,
+        [RECORZ_MVP_OP_STORE_FIELD] = &&execute_op_STORE_FIELD,
+        [RECORZ_MVP_OP_PUSH_SELF] = &&execute_op_PUSH_SELF,
+        [RECORZ_MVP_OP_PUSH_SMALL_INTEGER] = &&execute_op_PUSH_SMALL_INTEGER,
+        [RECORZ_MVP_OP_PUSH_STRING_LITERAL] = &&execute_op_PUSH_STRING_LITERAL,
+        [RECORZ_MVP_OP_JUMP] = &&execute_op_JUMP,
+        [RECORZ_MVP_OP_JUMP_IF_TRUE] = &&execute_op_JUMP_IF_TRUE,
+        [RECORZ_MVP_OP_JUMP_IF_FALSE] = &&execute_op_JUMP_IF_FALSE,
+        [RECORZ_MVP_OP_PUSH_BLOCK_LITERAL] = &&execute_op_PUSH_BLOCK_LITERAL,
+        [RECORZ_MVP_OP_PUSH_THIS_CONTEXT] = &&execute_op_PUSH_THIS_CONTEXT,
+        [RECORZ_MVP_OP_PUSH_OUTER_LEXICAL] = &&execute_op_PUSH_OUTER_LEXICAL,
+        [RECORZ_MVP_OP_STORE_OUTER_LEXICAL] = &&execute_op_STORE_OUTER_LEXICAL,
+        [RECORZ_MVP_OP_RETURN_NON_LOCAL] = &&execute_op_RETURN_NON_LOCAL,
+        [RECORZ_MVP_OP_RETURN_FIELD] = &&execute_op_RETURN_FIELD,
+        [RECORZ_MVP_OP_STORE_FIELD_FROM_ARGUMENT] = &&execute_op_STORE_FIELD_FROM_ARGUMENT,
+        [RECORZ_MVP_OP_STORE_LEXICAL_FROM_ARGUMENT] = &&execute_op_STORE_LEXICAL_FROM_ARGUMENT,
+        [RECORZ_MVP_OP_PUSH_SMALL_INTEGER_SEND] = &&execute_op_PUSH_SMALL_INTEGER_SEND,
+        [RECORZ_MVP_OP_SEND_ADD] = &&execute_op_SEND_ADD,
+        [RECORZ_MVP_OP_SEND_SUBTRACT] = &&execute_op_SEND_SUBTRACT,
+        [RECORZ_MVP_OP_SEND_MULTIPLY] = &&execute_op_SEND_MULTIPLY,
+        [RECORZ_MVP_OP_SEND_LESS_THAN] = &&execute_op_SEND_LESS_THAN,
+        [RECORZ_MVP_OP_SEND_GREATER_THAN] = &&execute_op_SEND_GREATER_THAN,
+        [RECORZ_MVP_OP_SEND_LESS_EQUAL] = &&execute_op_SEND_LESS_EQUAL,
+        [RECORZ_MVP_OP_SEND_GREATER_EQUAL] = &&execute_op_SEND_GREATER_EQUAL,
+        [RECORZ_MVP_OP_SEND_EQUAL] = &&execute_op_SEND_EQUAL,
+        [RECORZ_MVP_OP_SEND_NOT_EQUAL] = &&execute_op_SEND_NOT_EQUAL,
+        [RECORZ_MVP_OP_SEND_INTEGER_DIVIDE] = &&execute_op_SEND_INTEGER_DIVIDE,
+        [RECORZ_MVP_OP_SEND_MODULO] = &&execute_op_SEND_MODULO,
+        [RECORZ_MVP_OP_SEND_BIT_AND] = &&execute_op_SEND_BIT_AND,
+        [RECORZ_MVP_OP_SEND_BIT_OR] = &&execute_op_SEND_BIT_OR,
+        [RECORZ_MVP_OP_SEND_BIT_XOR] = &&execute_op_SEND_BIT_XOR,
+        [RECORZ_MVP_OP_SEND_BIT_SHIFT] = &&execute_op_SEND_BIT_SHIFT,
+        [RECORZ_MVP_OP_SEND_MAX] = &&execute_op_SEND_MAX,
+        [RECORZ_MVP_OP_SEND_MIN] = &&execute_op_SEND_MIN,
+    };
+#endif
 
-        panic_phase = "execute";
-        panic_pc = pc - 1U;
-        panic_instruction = instruction;
-        panic_have_instruction = 1U;
-        panic_have_send = 0U;
+    /* Each nested entry from C stacks its values above whatever the enclosing entry has pushed. */
+    if (outer_value_count != 0) {
+        interpreter_entry_value_base = outer_value_base + *outer_value_count;
+    }
+    activation_stack = &interpreter_values[interpreter_entry_value_base];
+    interpreter_entry_value_count = &activation_stack_size;
+    gc_root_value_stack(&stack_roots, activation_stack, &activation_stack_size);
+    gc_root_values(&argument_roots, arguments, argument_count);
+    if (current_execution_frame == 0 && decoded_instructions_exhausted) {
+        decoded_instructions_reset();
+    }
+    entry_activation = interpreter_activation_allocate();
+    entry_activation->executable = executable;
+    entry_activation->value_base = 0U;
+    entry_activation->sender_context_handle = 0U;
+    entry_activation->handles[0] = current_context_handle;
+    entry_activation->handles[2] = 0U;
+    entry_activation->live_method = 0U;
+    interpreter_activation_open(
+        entry_activation,
+        receiver_object,
+        receiver,
+        argument_count,
+        arguments,
+        activation_stack,
+        &activation_stack_size
+    );
+    activation = entry_activation;
+    EXECUTE_LOAD_ACTIVATION();
+    forget_send_context();
 
+execute_loop:
+#if RECORZ_MVP_THREADED_DISPATCH
+    EXECUTE_NEXT();
+#endif
+    while (frame->pc < executable->instruction_count) {
+        instruction = execution_frame_fetch(frame);
         switch (instruction.opcode) {
-            case RECORZ_MVP_OP_PUSH_GLOBAL:
-                activation_push(activation_stack, &activation_stack_size, global_value(instruction.operand_a));
-                break;
-            case RECORZ_MVP_OP_PUSH_LITERAL:
+            EXECUTE_OPCODE(PUSH_GLOBAL):
+                interpreter_push(activation_stack, &activation_stack_size, global_value(instruction.operand_a));
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_LITERAL):
                 if ((uint32_t)instruction.operand_b >= executable->literal_count) {
                     machine_panic("literal out of range");
                 }
-                activation_push(
+                interpreter_push(
                     activation_stack,
                     &activation_stack_size,
-                    literal_value(&executable->literals[instruction.operand_b])
+                    executable_literal_value(executable, instruction.operand_b)
                 );
-                break;
-            case RECORZ_MVP_OP_PUSH_NIL:
-                activation_push(activation_stack, &activation_stack_size, nil_value());
-                break;
-            case RECORZ_MVP_OP_PUSH_LEXICAL:
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_NIL):
+                interpreter_push(activation_stack, &activation_stack_size, nil_value());
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_LEXICAL):
                 if ((uint32_t)instruction.operand_b >= executable->lexical_count) {
                     machine_panic("lexical read out of range");
                 }
                 if (shared_lexical_environment != 0) {
-                    activation_push(
+                    interpreter_push(
                         activation_stack,
                         &activation_stack_size,
-                        shared_lexical_environment->bindings[instruction.operand_b].value
+                        shared_lexical_environment->values[instruction.operand_b]
                     );
                 } else {
-                    activation_push(activation_stack, &activation_stack_size, lexical[instruction.operand_b]);
+                    interpreter_push(activation_stack, &activation_stack_size, lexical[instruction.operand_b]);
                 }
-                break;
-            case RECORZ_MVP_OP_STORE_LEXICAL:
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(STORE_LEXICAL):
                 if ((uint32_t)instruction.operand_b >= executable->lexical_count) {
                     machine_panic("lexical write out of range");
                 }
                 if (shared_lexical_environment != 0) {
-                    shared_lexical_environment->bindings[instruction.operand_b].value =
+                    shared_lexical_environment->values[instruction.operand_b] =
                         activation_pop(activation_stack, &activation_stack_size);
                 } else {
                     lexical[instruction.operand_b] = activation_pop(activation_stack, &activation_stack_size);
                 }
-                break;
-            case RECORZ_MVP_OP_DUP:
-                activation_push(
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(STORE_LEXICAL_FROM_ARGUMENT):
+                if (instruction.operand_a >= argument_count) {
+                    machine_panic("argument read out of range");
+                }
+                if ((uint32_t)instruction.operand_b >= executable->lexical_count) {
+                    machine_panic("lexical write out of range");
+                }
+                if (shared_lexical_environment != 0) {
+                    shared_lexical_environment->values[instruction.operand_b] = arguments[instruction.operand_a];
+                } else {
+                    lexical[instruction.operand_b] = arguments[instruction.operand_a];
+                }
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_OUTER_LEXICAL):
+                interpreter_push(
+                    activation_stack,
+                    &activation_stack_size,
+                    *executable_outer_lexical_cell(executable, instruction.operand_a, instruction.operand_b)
+                );
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(STORE_OUTER_LEXICAL):
+                *executable_outer_lexical_cell(executable, instruction.operand_a, instruction.operand_b) =
+                    activation_pop(activation_stack, &activation_stack_size);
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(DUP):
+                interpreter_push(
                     activation_stack,
                     &activation_stack_size,
                     activation_peek(activation_stack, activation_stack_size)
                 );
-                break;
-            case RECORZ_MVP_OP_POP:
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(POP):
                 (void)activation_pop(activation_stack, &activation_stack_size);
-                break;
-            case RECORZ_MVP_OP_PUSH_ROOT:
-                activation_push(
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_ROOT):
+                interpreter_push(
                     activation_stack,
                     &activation_stack_size,
                     seed_root_value((uint32_t)instruction.operand_a)
                 );
-                break;
-            case RECORZ_MVP_OP_PUSH_ARGUMENT:
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_ARGUMENT):
                 if (instruction.operand_a >= argument_count) {
                     machine_panic("argument read out of range");
                 }
-                activation_push(activation_stack, &activation_stack_size, arguments[instruction.operand_a]);
-                break;
-            case RECORZ_MVP_OP_PUSH_FIELD:
+                interpreter_push(activation_stack, &activation_stack_size, arguments[instruction.operand_a]);
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_FIELD):
                 if (receiver_object == 0) {
                     machine_panic("pushField requires a receiver object");
                 }
-                activation_push(
+                interpreter_push(
                     activation_stack,
                     &activation_stack_size,
                     heap_get_field(receiver_object, instruction.operand_a)
                 );
-                break;
-            case RECORZ_MVP_OP_PUSH_SELF:
-                activation_push(activation_stack, &activation_stack_size, receiver);
-                break;
-            case RECORZ_MVP_OP_PUSH_THIS_CONTEXT:
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_SELF):
+                interpreter_push(activation_stack, &activation_stack_size, receiver);
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_THIS_CONTEXT):
                 if (current_context_handle == 0U) {
                     machine_panic("thisContext requires an activation context");
                 }
-                activation_push(activation_stack, &activation_stack_size, object_value(current_context_handle));
-                break;
-            case RECORZ_MVP_OP_PUSH_SMALL_INTEGER:
-                activation_push(
+                interpreter_push(
+                    activation_stack,
+                    &activation_stack_size,
+                    object_value(context_handle_reify(current_context_handle))
+                );
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_SMALL_INTEGER):
+                interpreter_push(
                     activation_stack,
                     &activation_stack_size,
                     small_integer_value((int16_t)instruction.operand_b)
                 );
-                break;
-            case RECORZ_MVP_OP_PUSH_STRING_LITERAL:
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_SMALL_INTEGER_SEND):
+                interpreter_push(
+                    activation_stack,
+                    &activation_stack_size,
+                    small_integer_value((int16_t)instruction.operand_b)
+                );
+                instruction = execution_frame_fetch(frame);
+                goto execute_send;
+            EXECUTE_OPCODE(PUSH_STRING_LITERAL):
                 if (instruction.operand_b == 0U ||
                     instruction.operand_b > LIVE_STRING_LITERAL_LIMIT ||
                     live_string_literals[instruction.operand_b - 1U].text == 0) {
                     machine_panic("string literal slot is out of range");
                 }
-                activation_push(
+                interpreter_push(
                     activation_stack,
                     &activation_stack_size,
                     string_value(live_string_literals[instruction.operand_b - 1U].text)
                 );
-                break;
-            case RECORZ_MVP_OP_PUSH_BLOCK_LITERAL:
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(PUSH_BLOCK_LITERAL):
                 {
                     uint16_t block_handle;
                     const struct recorz_mvp_heap_object *block_defining_class = executable->block_defining_class;
@@ -25992,60 +31620,66 @@ static void execute_executable(
                 }
                     block_handle = allocate_block_closure_from_source(
                         executable->literals[instruction.operand_b].string,
-                        receiver
+                        receiver,
+                        0U
                     );
                     if (block_defining_class == 0) {
-                        if (receiver.kind == RECORZ_MVP_VALUE_OBJECT) {
+                        if (value_is_object(receiver)) {
                             block_defining_class = class_object_for_heap_object(heap_object_for_value(receiver));
                         } else {
                             block_defining_class = class_object_for_kind(RECORZ_MVP_OBJECT_OBJECT);
                         }
                     }
-                    shared_lexical_environment_index = ensure_executable_lexical_environment(
+                    activation->shared_lexical_environment_index = ensure_executable_lexical_environment(
                         executable,
                         lexical,
-                        shared_lexical_environment_index
+                        activation->shared_lexical_environment_index
                     );
-                    if (shared_lexical_environment_index >= 0) {
+                    if (activation->shared_lexical_environment_index >= 0) {
                         shared_lexical_environment =
-                            source_lexical_environment_at(shared_lexical_environment_index);
+                            source_lexical_environment_at(activation->shared_lexical_environment_index);
                     }
                     source_register_block_state(
                         block_handle,
                         block_defining_class,
-                        shared_lexical_environment_index,
+                        activation->shared_lexical_environment_index >= 0
+                            ? activation->shared_lexical_environment_index
+                            : executable->outer_lexical_environment_index,
                         executable->home_context_index
                     );
-                activation_push(
+                interpreter_push(
                     activation_stack,
                     &activation_stack_size,
                         object_value(block_handle)
                 );
-                break;
+                EXECUTE_NEXT();
                 }
-            case RECORZ_MVP_OP_JUMP:
+            EXECUTE_OPCODE(JUMP):
                 if (instruction.operand_b >= executable->instruction_count) {
                     machine_panic("jump target is out of range");
                 }
-                pc = instruction.operand_b;
-                break;
-            case RECORZ_MVP_OP_JUMP_IF_TRUE:
-            case RECORZ_MVP_OP_JUMP_IF_FALSE: {
+                if (instruction.operand_b < frame->pc) {
+                    gc_bytecode_safepoint();
+                }
+                frame->pc = instruction.operand_b;
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(JUMP_IF_TRUE):
+            EXECUTE_OPCODE(JUMP_IF_FALSE): {
                 uint8_t condition_is_true;
 
                 if (instruction.operand_b >= executable->instruction_count) {
                     machine_panic("conditional jump target is out of range");
                 }
-                condition_is_true = condition_value_is_true(
+                condition_is_true = inline_condition_value_is_true(
                     activation_pop(activation_stack, &activation_stack_size)
                 );
                 if ((instruction.opcode == RECORZ_MVP_OP_JUMP_IF_TRUE && condition_is_true) ||
                     (instruction.opcode == RECORZ_MVP_OP_JUMP_IF_FALSE && !condition_is_true)) {
-                    pc = instruction.operand_b;
+                    frame->pc = instruction.operand_b;
                 }
-                break;
+                EXECUTE_NEXT();
             }
-            case RECORZ_MVP_OP_STORE_FIELD:
+            EXECUTE_OPCODE(STORE_FIELD):
                 if (receiver_object == 0) {
                     machine_panic("storeField requires a receiver object");
                 }
@@ -26054,54 +31688,95 @@ static void execute_executable(
                     instruction.operand_a,
                     activation_pop(activation_stack, &activation_stack_size)
                 );
-                break;
-            case RECORZ_MVP_OP_SEND: {
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(STORE_FIELD_FROM_ARGUMENT):
+                if (receiver_object == 0) {
+                    machine_panic("storeField requires a receiver object");
+                }
+                if (instruction.operand_b >= argument_count) {
+                    machine_panic("argument read out of range");
+                }
+                heap_set_field(
+                    heap_handle_for_object(receiver_object),
+                    instruction.operand_a,
+                    arguments[instruction.operand_b]
+                );
+                EXECUTE_NEXT();
+            EXECUTE_OPCODE(SEND_ADD):
+            EXECUTE_OPCODE(SEND_SUBTRACT):
+            EXECUTE_OPCODE(SEND_MULTIPLY):
+            EXECUTE_OPCODE(SEND_LESS_THAN):
+            EXECUTE_OPCODE(SEND_GREATER_THAN):
+            EXECUTE_OPCODE(SEND_LESS_EQUAL):
+            EXECUTE_OPCODE(SEND_GREATER_EQUAL):
+            EXECUTE_OPCODE(SEND_EQUAL):
+            EXECUTE_OPCODE(SEND_NOT_EQUAL):
+            EXECUTE_OPCODE(SEND_INTEGER_DIVIDE):
+            EXECUTE_OPCODE(SEND_MODULO):
+            EXECUTE_OPCODE(SEND_BIT_AND):
+            EXECUTE_OPCODE(SEND_BIT_OR):
+            EXECUTE_OPCODE(SEND_BIT_XOR):
+            EXECUTE_OPCODE(SEND_BIT_SHIFT):
+            EXECUTE_OPCODE(SEND_MAX):
+            EXECUTE_OPCODE(SEND_MIN): {
+                struct recorz_mvp_value special_result;
+
+                if (activation_stack_size < stack_base + 2U) {
+                    machine_panic("send stack underflow");
+                }
+                if (small_integer_special_send(
+                        instruction.opcode,
+                        activation_stack[activation_stack_size - 2U],
+                        activation_stack[activation_stack_size - 1U],
+                        &special_result
+                    )) {
+                    --activation_stack_size;
+                    activation_stack[activation_stack_size - 1U] = special_result;
+                    EXECUTE_NEXT();
+                }
+                instruction.operand_a = special_send_selector(instruction.opcode);
+                instruction.operand_b = 1U;
+                goto execute_send;
+            }
+            execute_send:
+            EXECUTE_OPCODE(SEND): {
                 struct recorz_mvp_value send_arguments[MAX_SEND_ARGS];
                 struct recorz_mvp_value send_receiver;
                 struct recorz_mvp_source_eval_result source_result;
-                struct recorz_mvp_runtime_block_state block_state_storage;
-                const struct recorz_mvp_runtime_block_state *block_state = 0;
+                const struct recorz_mvp_method_cache_entry *cache_entry;
                 uint16_t send_index;
 
                 if (instruction.operand_b > MAX_SEND_ARGS) {
                     machine_panic("too many bytecode arguments");
                 }
-                if (activation_stack_size < (uint32_t)instruction.operand_b + 1U) {
+                if (activation_stack_size < stack_base + instruction.operand_b + 1U) {
                     machine_panic("send stack underflow");
                 }
+                gc_bytecode_safepoint();
                 for (send_index = instruction.operand_b; send_index > 0U; --send_index) {
                     send_arguments[send_index - 1U] = activation_pop(activation_stack, &activation_stack_size);
                 }
                 send_receiver = activation_pop(activation_stack, &activation_stack_size);
                 panic_phase = "send";
                 remember_send_context(instruction.operand_a, instruction.operand_b, send_receiver, send_arguments);
-                if (send_receiver.kind == RECORZ_MVP_VALUE_OBJECT &&
+                if (value_is_object(send_receiver) &&
                     primitive_kind_for_heap_object(heap_object_for_value(send_receiver)) == RECORZ_MVP_OBJECT_BLOCK_CLOSURE &&
                     ((instruction.operand_a == RECORZ_MVP_SELECTOR_VALUE && instruction.operand_b == 0U) ||
                      (instruction.operand_a == RECORZ_MVP_SELECTOR_VALUE_ARG && instruction.operand_b == 1U))) {
-                    if (source_block_state_for_handle(
-                            heap_handle_for_object(heap_object_for_value(send_receiver)),
-                            &block_state_storage)) {
-                        block_state = &block_state_storage;
-                    }
-                    source_result = source_execute_block_closure(
+                    source_result = execute_block_closure(
                         heap_object_for_value(send_receiver),
                         instruction.operand_b,
                         send_arguments,
                         current_context_handle
                     );
                     if (source_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-                        if (block_state == 0 ||
-                            block_state->home_context_index != executable->home_context_index ||
-                            executable->home_context_index < 0) {
-                            machine_panic("block non-local return crossed an unsupported executable boundary");
-                        }
                         push(source_result.value);
-                        source_release_lexical_environment_chain_if_unused(shared_lexical_environment_index);
-                        return;
+                        executable_claim_block_return(executable);
+                        goto execute_return;
                     }
-                    activation_push(activation_stack, &activation_stack_size, source_result.value);
-                    break;
+                    forget_send_context();
+                    interpreter_push(activation_stack, &activation_stack_size, source_result.value);
+                    EXECUTE_NEXT();
                 }
                 if ((instruction.operand_a == RECORZ_MVP_SELECTOR_IF_TRUE && instruction.operand_b == 1U) ||
                     (instruction.operand_a == RECORZ_MVP_SELECTOR_IF_FALSE && instruction.operand_b == 1U) ||
@@ -26117,79 +31792,224 @@ static void execute_executable(
                         chosen_index = condition_is_true ? 0U : 1U;
                     }
                     if (chosen_index == 0xFFFFU) {
-                        activation_push(activation_stack, &activation_stack_size, nil_value());
-                        break;
+                        forget_send_context();
+                        interpreter_push(activation_stack, &activation_stack_size, nil_value());
+                        EXECUTE_NEXT();
                     }
-                    if (send_arguments[chosen_index].kind != RECORZ_MVP_VALUE_OBJECT ||
+                    if (!value_is_object(send_arguments[chosen_index]) ||
                         primitive_kind_for_heap_object(heap_object_for_value(send_arguments[chosen_index])) != RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
                         machine_panic("conditional send expects a block closure argument");
                     }
-                    if (source_block_state_for_handle(
-                            heap_handle_for_object(heap_object_for_value(send_arguments[chosen_index])),
-                            &block_state_storage)) {
-                        block_state = &block_state_storage;
-                    } else {
-                        block_state = 0;
-                    }
-                    source_result = source_execute_block_closure(
+                    source_result = execute_block_closure(
                         heap_object_for_value(send_arguments[chosen_index]),
                         0U,
                         0,
                         current_context_handle
                     );
                     if (source_result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-                        if (block_state == 0 ||
-                            block_state->home_context_index != executable->home_context_index ||
-                            executable->home_context_index < 0) {
-                            machine_panic("block non-local return crossed an unsupported executable boundary");
-                        }
                         push(source_result.value);
-                        source_release_lexical_environment_chain_if_unused(shared_lexical_environment_index);
-                        return;
+                        executable_claim_block_return(executable);
+                        goto execute_return;
                     }
-                    activation_push(activation_stack, &activation_stack_size, source_result.value);
-                    break;
+                    forget_send_context();
+                    interpreter_push(activation_stack, &activation_stack_size, source_result.value);
+                    EXECUTE_NEXT();
                 }
-                perform_send_with_sender(
+                if (current_context_handle == 0U &&
+                    executable->failure_context_detail != 0 &&
+                    source_send_needs_failure_context(send_receiver, instruction.operand_a, instruction.operand_b)) {
+                    failure_context_handle = activation_frame_context(
+                        0U,
+                        receiver,
+                        executable->failure_context_detail
+                    );
+                    current_context_handle = failure_context_handle;
+                    activation->handles[0] = current_context_handle;
+                    activation->handles[1] = failure_context_handle;
+                }
+                cache_entry = send_site_entry(
+                    executable->send_site_base == 0U ? 0U : (uint16_t)(executable->send_site_base + frame->pc - 1U),
                     send_receiver,
                     instruction.operand_a,
-                    instruction.operand_b,
-                    send_arguments,
-                    current_context_handle,
-                    0
+                    instruction.operand_b
                 );
-                activation_push(activation_stack, &activation_stack_size, pop_value());
-                break;
+                if (cache_entry != 0 &&
+                    (cache_entry->implementation_kind == METHOD_CACHE_COMPILED_METHOD ||
+                     (cache_entry->implementation_kind == METHOD_CACHE_LIVE_SOURCE &&
+                      cache_entry->implementation < live_method_source_count &&
+                      live_method_sources[cache_entry->implementation].execution_kind ==
+                          RECORZ_MVP_LIVE_METHOD_EXECUTION_PROGRAM))) {
+                    struct recorz_mvp_interpreter_activation *callee;
+                    struct recorz_mvp_method_cache_entry callee_entry = *cache_entry;
+                    uint16_t sender_context_handle = current_context_handle;
+                    uint32_t value_base = activation_stack_size;
+
+                    /* A send whose result is returned straight away reuses the sender's record, so
+                       tail-recursive methods run in constant space. */
+                    if (activation != entry_activation && execution_frame_returns_top(frame) &&
+                        interpreter_activation_allows_tail_send(
+                            activation,
+                            send_receiver,
+                            send_arguments,
+                            instruction.operand_b
+                        )) {
+                        sender_context_handle = activation->sender_context_handle;
+                        value_base = activation->value_base;
+                        interpreter_activation_finish(activation);
+                        callee = activation;
+                    } else {
+                        callee = interpreter_activation_allocate();
+                    }
+                    activation_stack_size = value_base;
+                    interpreter_push(activation_stack, &activation_stack_size, send_receiver);
+                    for (send_index = 0U; send_index < instruction.operand_b; ++send_index) {
+                        interpreter_push(activation_stack, &activation_stack_size, send_arguments[send_index]);
+                    }
+                    callee->executable = &callee->method_executable;
+                    callee->value_base = value_base;
+                    callee->sender_context_handle = sender_context_handle;
+                    if (callee_entry.implementation_kind == METHOD_CACHE_LIVE_SOURCE) {
+                        live_method_program_begin(
+                            &callee->method_executable,
+                            heap_object(callee_entry.owner_class_handle),
+                            send_receiver,
+                            instruction.operand_b,
+                            &live_method_sources[callee_entry.implementation],
+                            sender_context_handle
+                        );
+                        callee->live_method = 1U;
+                        callee->handles[0] = 0U;
+                        callee->handles[2] = 0U;
+                    } else {
+                        compiled_method_executable(&callee->method_executable, heap_object(callee_entry.implementation));
+                        callee->live_method = 0U;
+                        callee->handles[0] = allocate_compiled_activation_context_if_needed(
+                            callee->executable,
+                            sender_context_handle,
+                            send_receiver,
+                            selector_name(instruction.operand_a)
+                        );
+                        callee->handles[2] = callee_entry.implementation;
+                    }
+                    interpreter_activation_open(
+                        callee,
+                        heap_object_for_value(send_receiver),
+                        send_receiver,
+                        instruction.operand_b,
+                        &activation_stack[value_base + 1U],
+                        activation_stack,
+                        &activation_stack_size
+                    );
+                    activation = callee;
+                    EXECUTE_LOAD_ACTIVATION();
+                    forget_send_context();
+                    EXECUTE_NEXT();
+                }
+                if (cache_entry != 0) {
+                    dispatch_method_cache_entry(
+                        heap_object_for_value(send_receiver),
+                        cache_entry,
+                        instruction.operand_a,
+                        instruction.operand_b,
+                        send_receiver,
+                        send_arguments,
+                        current_context_handle,
+                        0
+                    );
+                } else {
+                    perform_send_with_sender(
+                        send_receiver,
+                        instruction.operand_a,
+                        instruction.operand_b,
+                        send_arguments,
+                        current_context_handle,
+                        0
+                    );
+                }
+                if (block_return_home_context_index >= 0) {
+                    executable_claim_block_return(executable);
+                    goto execute_return;
+                }
+                forget_send_context();
+                interpreter_push(activation_stack, &activation_stack_size, pop_value());
+                EXECUTE_NEXT();
             }
-            case RECORZ_MVP_OP_RETURN:
-                if (activation_stack_size == 0U) {
+            EXECUTE_OPCODE(RETURN):
+                if (activation_stack_size == stack_base) {
                     machine_panic("returnTop stack underflow");
                 }
                 push(activation_peek(activation_stack, activation_stack_size));
-                source_release_lexical_environment_chain_if_unused(shared_lexical_environment_index);
-                return;
-            case RECORZ_MVP_OP_RETURN_RECEIVER:
+                goto execute_return;
+            EXECUTE_OPCODE(RETURN_NON_LOCAL):
+                if (activation_stack_size == stack_base) {
+                    machine_panic("returnTop stack underflow");
+                }
+                if (executable->home_context_index < 0) {
+                    machine_panic("block attempted a non-local return without a live home context");
+                }
+                if (!source_home_context_at(executable->home_context_index)->alive) {
+                    machine_panic("block attempted a non-local return to a dead home context");
+                }
+                push(activation_peek(activation_stack, activation_stack_size));
+                block_return_home_context_index = executable->home_context_index;
+                goto execute_return;
+            EXECUTE_OPCODE(RETURN_RECEIVER):
                 push(receiver);
-                source_release_lexical_environment_chain_if_unused(shared_lexical_environment_index);
-                return;
-            default:
+                goto execute_return;
+            EXECUTE_OPCODE(RETURN_FIELD):
+                if (receiver_object == 0) {
+                    machine_panic("pushField requires a receiver object");
+                }
+                push(heap_get_field(receiver_object, instruction.operand_a));
+                goto execute_return;
+            EXECUTE_DEFAULT:
                 machine_panic("unknown opcode in MVP VM");
         }
     }
 
     machine_panic("executable did not return");
-}
+
+execute_return:
+    if (activation != entry_activation) {
+        activation_stack_size = activation->value_base;
+        interpreter_activation_finish(activation);
+        --interpreter_activation_count;
+        --activation;
+        EXECUTE_LOAD_ACTIVATION();
+        if (block_return_home_context_index >= 0) {
+            executable_claim_block_return(executable);
+            goto execute_return;
+        }
+        forget_send_context();
+        interpreter_push(activation_stack, &activation_stack_size, pop_value());
+        goto execute_loop;
+    }
+    mark_context_dead(failure_context_handle);
+    source_release_lexical_environment_chain_if_unused(activation->shared_lexical_environment_index);
+    interpreter_activation_close(entry_activation);
+    --interpreter_activation_count;
+    interpreter_entry_value_base = outer_value_base;
+    interpreter_entry_value_count = outer_value_count;
+    gc_unroot(&stack_roots);
+}
+
+#undef EXECUTE_OPCODE
+#undef EXECUTE_DEFAULT
+#undef EXECUTE_NEXT
+#undef EXECUTE_LOAD_ACTIVATION
 
 static struct recorz_mvp_value workspace_evaluate_source(const char *source) {
     struct recorz_mvp_workspace_source_program program;
     struct recorz_mvp_executable executable = {
         .instruction_source = program.instructions,
         .read_instruction = read_program_instruction,
+        .instructions = program.instructions,
         .instruction_count = 0U,
         .literals = program.literals,
         .literal_count = 0U,
         .lexical_count = 0U,
         .home_context_index = -1,
+        .outer_lexical_environment_index = -1,
     };
     struct recorz_mvp_value workspace_receiver = top_level_receiver_value();
     const struct recorz_mvp_heap_object *workspace_receiver_object = heap_object_for_value(workspace_receiver);
@@ -26213,7 +32033,9 @@ static struct recorz_mvp_value workspace_evaluate_source(const char *source) {
     executable.lexical_names = program.temporary_names;
     executable.block_defining_class = class_object_for_heap_object(workspace_receiver_object);
     executable.home_context_index = home_context_index;
+    executable.send_site_base = send_site_allocate(executable.instruction_count);
     execute_executable(&executable, workspace_receiver_object, workspace_receiver, 0U, 0, context_handle);
+    send_site_release(executable.send_site_base, executable.instruction_count);
     source_home_context_at(home_context_index)->alive = 0U;
     mark_context_dead(context_handle);
     source_release_home_context_if_unused(home_context_index);
@@ -26221,7 +32043,7 @@ static struct recorz_mvp_value workspace_evaluate_source(const char *source) {
         machine_panic("Workspace source execution did not return exactly one value");
     }
     result = pop_value();
-    if (gc_collection_allowed_for_current_phase()) {
+    if (gc_collection_is_due()) {
         gc_collect_preserving_value(result);
     }
     return result;
@@ -26233,13 +32055,7 @@ static void execute_block_closure_with_sender(
     const struct recorz_mvp_value arguments[],
     uint16_t sender_context_handle
 ) {
-    struct recorz_mvp_source_eval_result result =
-        source_execute_block_closure(object, argument_count, arguments, sender_context_handle);
-
-    if (result.kind == RECORZ_MVP_SOURCE_EVAL_RETURN) {
-        machine_panic("block non-local return requires a live source caller");
-    }
-    push(result.value);
+    push(execute_block_closure(object, argument_count, arguments, sender_context_handle).value);
 }
 
 static void dispatch_conditional_block_send_with_sender(
@@ -26264,7 +32080,7 @@ static void dispatch_conditional_block_send_with_sender(
         push(nil_value());
         return;
     }
-    if (arguments[chosen_index].kind != RECORZ_MVP_VALUE_OBJECT ||
+    if (!value_is_object(arguments[chosen_index]) ||
         primitive_kind_for_heap_object(heap_object_for_value(arguments[chosen_index])) != RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
         machine_panic("conditional send expects a block closure argument");
     }
@@ -26285,60 +32101,131 @@ static void execute_compiled_method_with_sender(
     uint16_t sender_context_handle,
     const struct recorz_mvp_heap_object *compiled_method
 ) {
-    const struct recorz_mvp_executable executable = {
-        .instruction_source = compiled_method,
-        .read_instruction = read_compiled_method_instruction,
-        .instruction_count = compiled_method->field_count,
-        .literals = 0,
-        .literal_count = 0U,
-        .lexical_count = compiled_method_lexical_count(compiled_method),
-        .home_context_index = -1,
-    };
+    struct recorz_mvp_executable executable;
     uint16_t context_handle;
+    uint16_t compiled_method_handle = heap_handle_for_object(compiled_method);
+    struct recorz_mvp_gc_root_frame method_roots;
 
-    if (compiled_method->kind != RECORZ_MVP_OBJECT_COMPILED_METHOD) {
-        machine_panic("method entry implementation is not a compiled method");
-    }
+    compiled_method_executable(&executable, compiled_method);
     context_handle = allocate_compiled_activation_context_if_needed(
         &executable,
         sender_context_handle,
         receiver,
         selector_name(selector)
     );
+    gc_root_handles(&method_roots, &compiled_method_handle, 1U);
     execute_executable(&executable, receiver_object, receiver, argument_count, arguments, context_handle);
+    gc_unroot(&method_roots);
     mark_context_dead(context_handle);
 }
 
-static uint16_t allocate_compiled_method_from_words(
+static uint32_t compiled_method_body_allocate(
     const uint32_t instruction_words[],
-    uint8_t instruction_count
+    uint16_t instruction_count,
+    const uint32_t literal_words[],
+    uint16_t literal_count
 ) {
-    uint16_t compiled_method_handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_COMPILED_METHOD);
-    uint8_t instruction_index;
+    uint32_t body_word_count = (uint32_t)instruction_count + literal_count;
+    uint32_t body_offset;
+    uint32_t word_index;
+
+    if (compiled_method_body_words_used + 1U + body_word_count > COMPILED_METHOD_BODY_WORD_LIMIT) {
+        compiled_method_body_compact();
+    }
+    if (compiled_method_body_words_used + 1U + body_word_count > COMPILED_METHOD_BODY_WORD_LIMIT) {
+        machine_panic("compiled method body pool overflow");
+    }
+    body_offset = compiled_method_body_words_used;
+    snapshot_note_compiled_method_body_write(body_offset);
+    compiled_method_body_words[body_offset] = body_word_count;
+    for (word_index = 0U; word_index < instruction_count; ++word_index) {
+        compiled_method_body_words[body_offset + 1U + word_index] = instruction_words[word_index];
+    }
+    for (word_index = 0U; word_index < literal_count; ++word_index) {
+        compiled_method_body_words[body_offset + 1U + instruction_count + word_index] = literal_words[word_index];
+    }
+    compiled_method_body_words_used += 1U + body_word_count;
+    return body_offset;
+}
+
+/* Inline instruction words live in SmallInteger fields, so a word that needs the top payload bit
+   sends the method to the body store instead. */
+static uint8_t compiled_method_words_fit_inline(const uint32_t instruction_words[], uint16_t instruction_count) {
+    uint16_t instruction_index;
 
     for (instruction_index = 0U; instruction_index < instruction_count; ++instruction_index) {
-        heap_set_field(
-            compiled_method_handle,
-            instruction_index,
-            small_integer_value((int32_t)instruction_words[instruction_index])
-        );
+        if (instruction_words[instruction_index] > (uint32_t)SMALL_INTEGER_MAX) {
+            return 0U;
+        }
+    }
+    return 1U;
+}
+
+static uint16_t allocate_compiled_method_from_words(
+    const uint32_t instruction_words[],
+    uint16_t instruction_count,
+    const uint32_t literal_words[],
+    uint16_t literal_count
+) {
+    uint16_t compiled_method_handle;
+    uint32_t body_offset;
+    uint16_t instruction_index;
+
+    if (instruction_count == 0U || instruction_count > COMPILED_METHOD_MAX_INSTRUCTIONS) {
+        machine_panic("compiled method instruction count is out of range");
+    }
+    if (literal_count > COMPILED_METHOD_MAX_LITERALS) {
+        machine_panic("compiled method literal count is out of range");
+    }
+    if (literal_count == 0U &&
+        instruction_count <= COMPILED_METHOD_INLINE_INSTRUCTIONS &&
+        compiled_method_words_fit_inline(instruction_words, instruction_count)) {
+        compiled_method_handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_COMPILED_METHOD);
+        for (instruction_index = 0U; instruction_index < instruction_count; ++instruction_index) {
+            heap_set_field(
+                compiled_method_handle,
+                (uint8_t)instruction_index,
+                small_integer_value((int32_t)instruction_words[instruction_index])
+            );
+        }
+        return compiled_method_handle;
     }
+    body_offset = compiled_method_body_allocate(instruction_words, instruction_count, literal_words, literal_count);
+    compiled_method_handle = heap_allocate_seeded_class(RECORZ_MVP_OBJECT_COMPILED_METHOD);
+    heap_set_field(compiled_method_handle, 0U, nil_value());
+    heap_set_field(compiled_method_handle, COMPILED_METHOD_BODY_FIELD_OFFSET, small_integer_value((int32_t)body_offset));
+    heap_set_field(
+        compiled_method_handle,
+        COMPILED_METHOD_BODY_FIELD_INSTRUCTION_COUNT,
+        small_integer_value((int32_t)instruction_count)
+    );
+    heap_set_field(
+        compiled_method_handle,
+        COMPILED_METHOD_BODY_FIELD_LITERAL_COUNT,
+        small_integer_value((int32_t)literal_count)
+    );
     return compiled_method_handle;
 }
 
 static uint16_t allocate_updated_compiled_method(
     const uint8_t *blob,
-    uint16_t instruction_count
+    uint16_t instruction_count,
+    uint16_t literal_count
 ) {
     uint32_t instruction_words[COMPILED_METHOD_MAX_INSTRUCTIONS];
+    uint32_t literal_words[COMPILED_METHOD_MAX_LITERALS];
     uint32_t offset = RECORZ_MVP_METHOD_UPDATE_HEADER_SIZE;
-    uint16_t instruction_index;
+    uint16_t word_index;
 
-    for (instruction_index = 0U; instruction_index < instruction_count; ++instruction_index) {
-        instruction_words[instruction_index] = read_u32_le(blob + offset);
+    for (word_index = 0U; word_index < instruction_count; ++word_index) {
+        instruction_words[word_index] = read_u32_le(blob + offset);
+        offset += 4U;
+    }
+    for (word_index = 0U; word_index < literal_count; ++word_index) {
+        literal_words[word_index] = read_u32_le(blob + offset);
         offset += 4U;
     }
-    return allocate_compiled_method_from_words(instruction_words, (uint8_t)instruction_count);
+    return allocate_compiled_method_from_words(instruction_words, instruction_count, literal_words, literal_count);
 }
 
 static uint16_t allocate_dynamic_method_entry(uint16_t compiled_method_handle) {
@@ -26393,62 +32280,17 @@ static uint16_t allocate_method_descriptor(
     return descriptor_handle;
 }
 
-static void clone_method_descriptor_into_handle(
-    uint16_t cloned_handle,
-    const struct recorz_mvp_heap_object *method_object
-) {
-    uint8_t field_index;
-
-    for (field_index = 0U; field_index < method_object->field_count; ++field_index) {
-        heap_set_field(cloned_handle, field_index, heap_get_field(method_object, field_index));
-    }
-}
-
 static void append_compiled_method_to_class(
     const struct recorz_mvp_heap_object *class_object,
     uint16_t selector,
     uint16_t argument_count,
     uint16_t compiled_method_handle
 ) {
-    uint16_t class_handle = heap_handle_for_object(class_object);
     uint32_t class_kind = class_instance_kind(class_object);
-    uint32_t method_count = class_method_count(class_object);
-    const struct recorz_mvp_heap_object *method_start_object = class_method_start_object(class_object);
     uint16_t entry_handle = allocate_dynamic_method_entry(compiled_method_handle);
-    uint16_t new_method_start_handle;
-    uint32_t method_index;
-
-    if (method_count == 0U) {
-        uint16_t descriptor_handle = allocate_method_descriptor((uint8_t)class_kind, selector, argument_count, entry_handle);
-        heap_set_field(class_handle, CLASS_FIELD_METHOD_START, object_value(descriptor_handle));
-        heap_set_field(class_handle, CLASS_FIELD_METHOD_COUNT, small_integer_value(1));
-        return;
-    }
-    if (method_start_object == 0) {
-        machine_panic("class with methods is missing a method start");
-    }
-    new_method_start_handle = heap_allocate_seeded_class_run(
-        RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR,
-        (uint16_t)(method_count + 1U)
-    );
-    for (method_index = 0U; method_index < method_count; ++method_index) {
-        const struct recorz_mvp_heap_object *existing_method_object =
-            (const struct recorz_mvp_heap_object *)heap_object((uint16_t)(heap_handle_for_object(method_start_object) + method_index));
+    uint16_t descriptor_handle = allocate_method_descriptor((uint8_t)class_kind, selector, argument_count, entry_handle);
 
-        if (existing_method_object->kind != RECORZ_MVP_OBJECT_METHOD_DESCRIPTOR) {
-            machine_panic("class method range contains a non-method descriptor");
-        }
-        clone_method_descriptor_into_handle((uint16_t)(new_method_start_handle + method_index), existing_method_object);
-    }
-    initialize_method_descriptor(
-        (uint16_t)(new_method_start_handle + method_count),
-        (uint8_t)class_kind,
-        selector,
-        argument_count,
-        entry_handle
-    );
-    heap_set_field(class_handle, CLASS_FIELD_METHOD_START, object_value(new_method_start_handle));
-    heap_set_field(class_handle, CLASS_FIELD_METHOD_COUNT, small_integer_value((int32_t)(method_count + 1U)));
+    class_method_dictionary_add(heap_handle_for_object(class_object), selector, descriptor_handle);
 }
 
 static void install_compiled_method_update(
@@ -26457,11 +32299,18 @@ static void install_compiled_method_update(
     uint16_t argument_count,
     uint16_t compiled_method_handle
 ) {
-    const struct recorz_mvp_heap_object *method_object =
-        lookup_builtin_method_descriptor(class_object, selector, argument_count);
+    uint16_t method_handle = class_method_lookup_handle(class_object, selector);
+
+    method_cache_flush_selector(selector);
+    if (method_handle != 0U) {
+        const struct recorz_mvp_heap_object *method_object =
+            (const struct recorz_mvp_heap_object *)heap_object(method_handle);
+        struct recorz_mvp_heap_object *entry_object;
 
-    if (method_object != 0) {
-        struct recorz_mvp_heap_object *entry_object = mutable_method_descriptor_entry_object(method_object);
+        if (method_descriptor_argument_count(method_object) != argument_count) {
+            machine_panic("selector argument count does not match method descriptor");
+        }
+        entry_object = mutable_method_descriptor_entry_object(method_object);
 
         heap_set_field(
             heap_handle_for_object(entry_object),
@@ -26480,7 +32329,7 @@ static void apply_method_update_payload(const uint8_t *blob, uint32_t size) {
     uint16_t selector;
     uint16_t argument_count;
     uint16_t instruction_count;
-    uint16_t reserved;
+    uint16_t literal_count;
     uint32_t expected_size;
     uint16_t compiled_method_handle;
 
@@ -26499,15 +32348,12 @@ static void apply_method_update_payload(const uint8_t *blob, uint32_t size) {
     selector = read_u16_le(blob + 8U);
     argument_count = read_u16_le(blob + 10U);
     instruction_count = read_u16_le(blob + 12U);
-    reserved = read_u16_le(blob + 14U);
+    literal_count = read_u16_le(blob + 14U);
     if (version != RECORZ_MVP_METHOD_UPDATE_VERSION) {
         machine_panic("method update payload version mismatch");
     }
-    if (reserved != 0U) {
-        machine_panic("method update payload reserved field is nonzero");
-    }
     if (selector < RECORZ_MVP_SELECTOR_SHOW ||
-        selector > MAX_SELECTOR_ID) {
+        selector > last_selector_id()) {
         machine_panic("method update payload selector is out of range");
     }
     if (argument_count > MAX_SEND_ARGS) {
@@ -26516,18 +32362,23 @@ static void apply_method_update_payload(const uint8_t *blob, uint32_t size) {
     if (instruction_count == 0U || instruction_count > COMPILED_METHOD_MAX_INSTRUCTIONS) {
         machine_panic("method update payload instruction count is invalid");
     }
-    expected_size = RECORZ_MVP_METHOD_UPDATE_HEADER_SIZE + ((uint32_t)instruction_count * 4U);
+    if (literal_count > COMPILED_METHOD_MAX_LITERALS) {
+        machine_panic("method update payload literal count is invalid");
+    }
+    expected_size = RECORZ_MVP_METHOD_UPDATE_HEADER_SIZE + (((uint32_t)instruction_count + literal_count) * 4U);
     if (size != expected_size) {
         machine_panic("method update payload size mismatch");
     }
 
     class_object = class_object_for_kind((uint8_t)class_kind);
-    compiled_method_handle = allocate_updated_compiled_method(blob, instruction_count);
+    compiled_method_handle = allocate_updated_compiled_method(blob, instruction_count, literal_count);
     validate_compiled_method(heap_object(compiled_method_handle), argument_count);
     forget_live_string_literals(heap_handle_for_object(class_object), selector, (uint8_t)argument_count);
     forget_live_method_source(heap_handle_for_object(class_object), selector, (uint8_t)argument_count);
     install_compiled_method_update(class_object, selector, argument_count, compiled_method_handle);
-    (void)gc_collect_now();
+    if (gc_collection_is_due()) {
+        (void)gc_collect_now();
+    }
 }
 
 static const struct recorz_mvp_live_method_source *live_method_source_for_class_chain(
@@ -26560,6 +32411,335 @@ static const struct recorz_mvp_live_method_source *live_method_source_for_class_
     return 0;
 }
 
+static void method_cache_entries_flush_selector(
+    struct recorz_mvp_method_cache_entry entries[],
+    uint32_t entry_count,
+    uint16_t selector_id
+) {
+    uint32_t entry_index;
+
+    for (entry_index = 0U; entry_index < entry_count; ++entry_index) {
+        if (entries[entry_index].selector_id == selector_id) {
+            entries[entry_index].class_handle = 0U;
+        }
+    }
+}
+
+static void method_cache_entries_flush_live_sources_from(
+    struct recorz_mvp_method_cache_entry entries[],
+    uint32_t entry_count,
+    uint16_t source_index
+) {
+    uint32_t entry_index;
+
+    for (entry_index = 0U; entry_index < entry_count; ++entry_index) {
+        if (entries[entry_index].implementation_kind == METHOD_CACHE_LIVE_SOURCE &&
+            entries[entry_index].implementation >= source_index) {
+            entries[entry_index].class_handle = 0U;
+        }
+    }
+}
+
+/* Executables may still hold send site ranges from before a reset, so every flush covers the whole pool. */
+static void send_site_reset(void) {
+    uint32_t index;
+
+    for (index = 0U; index < SEND_SITE_LIMIT; ++index) {
+        send_site_entries[index].class_handle = 0U;
+        send_site_polymorphic_indexes[index] = 0U;
+    }
+    for (index = 0U; index < SEND_SITE_POLYMORPHIC_LIMIT * SEND_SITE_POLYMORPHIC_WAYS; ++index) {
+        send_site_polymorphic_entries[index].class_handle = 0U;
+    }
+    for (index = 0U; index < HEAP_LIMIT; ++index) {
+        compiled_method_send_site_bases[index] = 0U;
+    }
+    for (index = 0U; index < LIVE_METHOD_SOURCE_LIMIT; ++index) {
+        live_method_sources[index].send_site_base = 0U;
+    }
+    for (index = 0U; index < COMPILED_BLOCK_LIMIT; ++index) {
+        compiled_blocks[index].send_site_base = 0U;
+    }
+    send_sites_used = 1U;
+    send_site_polymorphic_used = 0U;
+}
+
+static void method_cache_flush(void) {
+    uint32_t cache_index;
+
+    for (cache_index = 0U; cache_index < METHOD_CACHE_SIZE; ++cache_index) {
+        method_cache[cache_index].class_handle = 0U;
+    }
+    send_site_reset();
+}
+
+static void method_cache_flush_selector(uint16_t selector_id) {
+    method_cache_entries_flush_selector(method_cache, METHOD_CACHE_SIZE, selector_id);
+    method_cache_entries_flush_selector(send_site_entries, SEND_SITE_LIMIT, selector_id);
+    method_cache_entries_flush_selector(
+        send_site_polymorphic_entries,
+        SEND_SITE_POLYMORPHIC_LIMIT * SEND_SITE_POLYMORPHIC_WAYS,
+        selector_id
+    );
+}
+
+static void method_cache_flush_live_sources_from(uint16_t source_index) {
+    method_cache_entries_flush_live_sources_from(method_cache, METHOD_CACHE_SIZE, source_index);
+    method_cache_entries_flush_live_sources_from(send_site_entries, SEND_SITE_LIMIT, source_index);
+    method_cache_entries_flush_live_sources_from(
+        send_site_polymorphic_entries,
+        SEND_SITE_POLYMORPHIC_LIMIT * SEND_SITE_POLYMORPHIC_WAYS,
+        source_index
+    );
+}
+
+/* Slot 0 is never handed out, so a zero base means the executable has no send sites. */
+static uint16_t send_site_allocate(uint32_t instruction_count) {
+    uint16_t base;
+    uint32_t index;
+
+    if (instruction_count == 0U || instruction_count >= SEND_SITE_LIMIT) {
+        return 0U;
+    }
+    if ((uint32_t)send_sites_used + instruction_count > SEND_SITE_LIMIT) {
+        send_site_reset();
+    }
+    base = send_sites_used;
+    for (index = 0U; index < instruction_count; ++index) {
+        send_site_entries[base + index].class_handle = 0U;
+        send_site_polymorphic_indexes[base + index] = 0U;
+    }
+    send_sites_used = (uint16_t)(send_sites_used + instruction_count);
+    return base;
+}
+
+static void send_site_release(uint16_t base, uint32_t instruction_count) {
+    if (base != 0U && (uint32_t)base + instruction_count == send_sites_used) {
+        send_sites_used = base;
+    }
+}
+
+static uint16_t compiled_method_send_site_base(const struct recorz_mvp_heap_object *compiled_method) {
+    uint16_t handle = heap_handle_for_object(compiled_method);
+
+    if (compiled_method_send_site_bases[handle - 1U] == 0U) {
+        compiled_method_send_site_bases[handle - 1U] =
+            send_site_allocate(compiled_method_instruction_count(compiled_method));
+    }
+    return compiled_method_send_site_bases[handle - 1U];
+}
+
+static uint16_t live_method_send_site_base(const struct recorz_mvp_live_method_source *source_record) {
+    struct recorz_mvp_live_method_source *mutable_record = &live_method_sources[source_record - live_method_sources];
+
+    if (mutable_record->send_site_base == 0U) {
+        mutable_record->send_site_base = send_site_allocate(mutable_record->program_instruction_count);
+    }
+    return mutable_record->send_site_base;
+}
+
+static uint16_t compiled_block_send_site_base(struct recorz_mvp_compiled_block *block) {
+    if (block->send_site_base == 0U) {
+        block->send_site_base = send_site_allocate(block->instruction_count);
+    }
+    return block->send_site_base;
+}
+
+/* Accessor-shaped methods are answered straight from the cache entry without an activation. */
+static void method_cache_classify_compiled_method(
+    struct recorz_mvp_method_cache_entry *cache_entry,
+    const struct recorz_mvp_heap_object *compiled_method,
+    uint16_t argument_count
+) {
+    uint16_t instruction_count;
+    uint32_t first_word;
+    uint32_t second_word;
+    uint8_t first_opcode;
+    uint8_t second_opcode;
+
+    if (compiled_method->kind != RECORZ_MVP_OBJECT_COMPILED_METHOD) {
+        return;
+    }
+    instruction_count = compiled_method_instruction_count(compiled_method);
+    if (instruction_count == 0U || instruction_count > 3U) {
+        return;
+    }
+    first_word = compiled_method_instruction_word(compiled_method, 0U);
+    first_opcode = compiled_method_instruction_opcode(first_word);
+    if (instruction_count == 1U) {
+        if (first_opcode == COMPILED_METHOD_OP_RETURN_RECEIVER) {
+            cache_entry->implementation_kind = METHOD_CACHE_RETURN_SELF;
+        } else if (first_opcode == COMPILED_METHOD_OP_RETURN_FIELD) {
+            cache_entry->implementation_kind = METHOD_CACHE_GETTER;
+            cache_entry->implementation = compiled_method_instruction_operand_a(first_opcode, first_word);
+        }
+        return;
+    }
+    second_word = compiled_method_instruction_word(compiled_method, 1U);
+    second_opcode = compiled_method_instruction_opcode(second_word);
+    if (instruction_count == 2U) {
+        if (first_opcode == COMPILED_METHOD_OP_PUSH_FIELD && second_opcode == COMPILED_METHOD_OP_RETURN_TOP) {
+            cache_entry->implementation_kind = METHOD_CACHE_GETTER;
+            cache_entry->implementation = compiled_method_instruction_operand_a(first_opcode, first_word);
+        } else if (argument_count == 1U &&
+                   first_opcode == COMPILED_METHOD_OP_STORE_FIELD_FROM_ARGUMENT &&
+                   compiled_method_instruction_operand_b(first_opcode, first_word) == 0U &&
+                   second_opcode == COMPILED_METHOD_OP_RETURN_RECEIVER) {
+            cache_entry->implementation_kind = METHOD_CACHE_SETTER;
+            cache_entry->implementation = compiled_method_instruction_operand_a(first_opcode, first_word);
+        }
+        return;
+    }
+    if (argument_count == 1U &&
+        first_opcode == COMPILED_METHOD_OP_PUSH_ARGUMENT &&
+        compiled_method_instruction_operand_a(first_opcode, first_word) == 0U &&
+        second_opcode == COMPILED_METHOD_OP_STORE_FIELD &&
+        compiled_method_instruction_opcode(compiled_method_instruction_word(compiled_method, 2U)) ==
+            COMPILED_METHOD_OP_RETURN_RECEIVER) {
+        cache_entry->implementation_kind = METHOD_CACHE_SETTER;
+        cache_entry->implementation = compiled_method_instruction_operand_a(second_opcode, second_word);
+    }
+}
+
+static const struct recorz_mvp_method_cache_entry *method_cache_lookup(
+    const struct recorz_mvp_heap_object *class_object,
+    uint16_t selector,
+    uint16_t argument_count
+) {
+    uint16_t class_handle = heap_handle_for_object(class_object);
+    struct recorz_mvp_method_cache_entry *cache_entry =
+        &method_cache[(((uint32_t)class_handle * 40503U) ^ selector) & (METHOD_CACHE_SIZE - 1U)];
+    const struct recorz_mvp_heap_object *method_object;
+    const struct recorz_mvp_heap_object *entry_object;
+    const struct recorz_mvp_heap_object *source_owner_class = 0;
+    const struct recorz_mvp_live_method_source *source_record;
+    struct recorz_mvp_value implementation_value;
+    uint32_t primitive_binding_id;
+
+    if (cache_entry->class_handle == class_handle &&
+        cache_entry->selector_id == selector &&
+        cache_entry->argument_count == argument_count) {
+        ++method_cache_hit_count;
+        return cache_entry;
+    }
+    ++method_cache_miss_count;
+    source_record = live_method_source_for_class_chain(
+        class_object,
+        selector,
+        (uint8_t)argument_count,
+        &source_owner_class
+    );
+    if (source_record != 0 && source_record->execution_kind != RECORZ_MVP_LIVE_METHOD_EXECUTION_COMPILED) {
+        cache_entry->implementation_kind = METHOD_CACHE_LIVE_SOURCE;
+        cache_entry->implementation = (uint16_t)(source_record - live_method_sources);
+        cache_entry->owner_class_handle = heap_handle_for_object(source_owner_class);
+    } else {
+        method_object = lookup_builtin_method_descriptor(class_object, selector, argument_count);
+        if (method_object == 0) {
+            return 0;
+        }
+        entry_object = method_descriptor_entry_object(method_object);
+        if (entry_object->kind != RECORZ_MVP_OBJECT_METHOD_ENTRY) {
+            machine_panic("method descriptor entry does not point at a method entry");
+        }
+        if (method_entry_execution_id(entry_object) == 0U) {
+            machine_panic("method entry execution id is out of range");
+        }
+        implementation_value = method_entry_implementation_value(entry_object);
+        if (value_is_object(implementation_value)) {
+            cache_entry->implementation_kind = METHOD_CACHE_COMPILED_METHOD;
+            cache_entry->implementation = value_handle(implementation_value);
+            method_cache_classify_compiled_method(
+                cache_entry,
+                (const struct recorz_mvp_heap_object *)heap_object(cache_entry->implementation),
+                argument_count
+            );
+        } else {
+            if (!value_is_small_integer(implementation_value)) {
+                machine_panic("method entry implementation kind is unknown");
+            }
+            primitive_binding_id = (uint32_t)value_integer(implementation_value);
+            if (primitive_binding_id == 0U || primitive_binding_id >= RECORZ_MVP_PRIMITIVE_COUNT) {
+                machine_panic("primitive method entry binding id is out of range");
+            }
+            if (primitive_binding_handlers[primitive_binding_id] == 0) {
+                machine_panic("primitive binding handler is not installed");
+            }
+            cache_entry->implementation_kind = METHOD_CACHE_PRIMITIVE;
+            cache_entry->implementation = (uint16_t)primitive_binding_id;
+        }
+        cache_entry->owner_class_handle = 0U;
+    }
+    cache_entry->class_handle = class_handle;
+    cache_entry->selector_id = selector;
+    cache_entry->argument_count = (uint8_t)argument_count;
+    return cache_entry;
+}
+
+static void dispatch_method_cache_entry(
+    const struct recorz_mvp_heap_object *object,
+    const struct recorz_mvp_method_cache_entry *cache_entry,
+    uint16_t selector,
+    uint16_t argument_count,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    uint16_t sender_context_handle,
+    const char *text
+) {
+    uint8_t implementation_kind;
+    uint16_t implementation;
+    uint16_t owner_class_handle;
+    struct recorz_mvp_gc_root_frame receiver_roots;
+    struct recorz_mvp_gc_root_frame argument_roots;
+
+    implementation_kind = cache_entry->implementation_kind;
+    implementation = cache_entry->implementation;
+    owner_class_handle = cache_entry->owner_class_handle;
+    if (implementation_kind == METHOD_CACHE_LIVE_SOURCE) {
+        if (implementation >= live_method_source_count) {
+            machine_panic("method cache live source is out of range");
+        }
+        execute_live_method_with_sender(
+            (const struct recorz_mvp_heap_object *)heap_object(owner_class_handle),
+            receiver,
+            argument_count,
+            arguments,
+            &live_method_sources[implementation],
+            sender_context_handle
+        );
+        return;
+    }
+    if (implementation_kind == METHOD_CACHE_GETTER) {
+        push(heap_get_field(object, (uint8_t)implementation));
+        return;
+    }
+    if (implementation_kind == METHOD_CACHE_SETTER) {
+        heap_set_field(heap_handle_for_object(object), (uint8_t)implementation, arguments[0]);
+        push(receiver);
+        return;
+    }
+    if (implementation_kind == METHOD_CACHE_RETURN_SELF) {
+        push(receiver);
+        return;
+    }
+    if (implementation_kind == METHOD_CACHE_COMPILED_METHOD) {
+        execute_compiled_method_with_sender(
+            object,
+            receiver,
+            argument_count,
+            arguments,
+            selector,
+            sender_context_handle,
+            (const struct recorz_mvp_heap_object *)heap_object(implementation)
+        );
+        return;
+    }
+    gc_root_values(&receiver_roots, &receiver, 1U);
+    gc_root_values(&argument_roots, arguments, argument_count);
+    primitive_binding_handlers[implementation](object, receiver, arguments, text);
+    gc_unroot(&receiver_roots);
+}
+
 static void dispatch_heap_object_send(
     const struct recorz_mvp_heap_object *object,
     uint16_t selector,
@@ -26569,16 +32749,7 @@ static void dispatch_heap_object_send(
     uint16_t sender_context_handle,
     const char *text
 ) {
-    const struct recorz_mvp_heap_object *class_object;
-    const struct recorz_mvp_heap_object *method_object;
-    const struct recorz_mvp_heap_object *entry_object;
-    const struct recorz_mvp_heap_object *implementation_object;
-    const struct recorz_mvp_heap_object *source_owner_class = 0;
-    const struct recorz_mvp_live_method_source *source_record;
-    struct recorz_mvp_value implementation_value;
-    recorz_mvp_method_entry_handler handler;
-    uint32_t entry;
-    uint32_t primitive_binding_id;
+    const struct recorz_mvp_method_cache_entry *cache_entry;
 
     if (selector == RECORZ_MVP_SELECTOR_CLASS) {
         push(object_value(object->class_handle));
@@ -26605,26 +32776,8 @@ static void dispatch_heap_object_send(
         }
         machine_panic("BlockClosure only understands value/value:");
     }
-    class_object = class_object_for_heap_object(object);
-    source_record = live_method_source_for_class_chain(
-        class_object,
-        selector,
-        (uint8_t)argument_count,
-        &source_owner_class
-    );
-    if (source_record != 0 && source_text_requires_live_evaluator(live_method_source_text(source_record))) {
-        execute_live_source_method_with_sender(
-            source_owner_class,
-            receiver,
-            argument_count,
-            arguments,
-            live_method_source_text(source_record),
-            sender_context_handle
-        );
-        return;
-    }
-    method_object = lookup_builtin_method_descriptor(class_object, selector, argument_count);
-    if (method_object == 0) {
+    cache_entry = method_cache_lookup(class_object_for_heap_object(object), selector, argument_count);
+    if (cache_entry == 0) {
         if (workspace_enter_debugger_for_runtime_failure(
                 sender_context_handle,
                 "selector is not understood by receiver class",
@@ -26634,40 +32787,16 @@ static void dispatch_heap_object_send(
         }
         machine_panic("selector is not understood by receiver class");
     }
-    entry_object = method_descriptor_entry_object(method_object);
-    if (entry_object->kind != RECORZ_MVP_OBJECT_METHOD_ENTRY) {
-        machine_panic("method descriptor entry does not point at a method entry");
-    }
-    entry = method_entry_execution_id(entry_object);
-    implementation_value = method_entry_implementation_value(entry_object);
-    if (entry == 0U) {
-        machine_panic("method entry execution id is out of range");
-    }
-    if (implementation_value.kind == RECORZ_MVP_VALUE_OBJECT) {
-        implementation_object = heap_object_for_value(implementation_value);
-        execute_compiled_method_with_sender(
-            object,
-            receiver,
-            argument_count,
-            arguments,
-            selector,
-            sender_context_handle,
-            implementation_object
-        );
-        return;
-    }
-    if (implementation_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-        machine_panic("method entry implementation kind is unknown");
-    }
-    primitive_binding_id = (uint32_t)implementation_value.integer;
-    if (primitive_binding_id == 0U || primitive_binding_id >= RECORZ_MVP_PRIMITIVE_COUNT) {
-        machine_panic("primitive method entry binding id is out of range");
-    }
-    handler = primitive_binding_handlers[primitive_binding_id];
-    if (handler == 0) {
-        machine_panic("primitive binding handler is not installed");
-    }
-    handler(object, receiver, arguments, text);
+    dispatch_method_cache_entry(
+        object,
+        cache_entry,
+        selector,
+        argument_count,
+        receiver,
+        arguments,
+        sender_context_handle,
+        text
+    );
 }
 
 static void perform_send_with_sender(
@@ -26679,37 +32808,40 @@ static void perform_send_with_sender(
     const char *text
 ) {
     const struct recorz_mvp_heap_object *object = 0;
+    uint8_t special_opcode;
 
-    if (selector == RECORZ_MVP_SELECTOR_EQUAL) {
+    if (selector == RECORZ_MVP_SELECTOR_EQUAL || selector == RECORZ_MVP_SELECTOR_NOT_EQUAL) {
         if (send_argument_count != 1U) {
             machine_panic("= expects one argument");
         }
-        push(boolean_value(value_equals(receiver, arguments[0])));
+        push(boolean_value((uint8_t)(
+            value_equals(receiver, arguments[0]) != (selector == RECORZ_MVP_SELECTOR_NOT_EQUAL)
+        )));
         return;
     }
-    if (selector == RECORZ_MVP_SELECTOR_LESS_THAN || selector == RECORZ_MVP_SELECTOR_GREATER_THAN) {
-        if (send_argument_count != 1U) {
-            machine_panic("comparison expects one argument");
-        }
-        if (receiver.kind != RECORZ_MVP_VALUE_SMALL_INTEGER ||
-            arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-            machine_panic("comparison expects small integer operands");
+    special_opcode = special_send_opcode_for_selector(selector, send_argument_count);
+    if (special_opcode != 0U && value_is_integer(receiver)) {
+        struct recorz_mvp_value result;
+        const char *failure = integer_special_send(special_opcode, receiver, arguments[0], &result);
+
+        if (failure != 0) {
+            if (workspace_enter_debugger_for_runtime_failure(sender_context_handle, failure, "FAILED SEND")) {
+                push(nil_value());
+                return;
+            }
+            machine_panic(failure);
         }
-        push(boolean_value(
-            selector == RECORZ_MVP_SELECTOR_LESS_THAN
-                ? (receiver.integer < arguments[0].integer)
-                : (receiver.integer > arguments[0].integer)
-        ));
+        push(result);
         return;
     }
     if (selector == RECORZ_MVP_SELECTOR_SHOW || selector == RECORZ_MVP_SELECTOR_WRITE_STRING) {
-        if (arguments[0].kind != RECORZ_MVP_VALUE_STRING || arguments[0].string == 0) {
+        if (!value_is_string(arguments[0]) || value_string(arguments[0]) == 0) {
             machine_panic("text send expects a string literal");
         }
-        text = arguments[0].string;
+        text = value_string(arguments[0]);
     }
 
-    if (receiver.kind == RECORZ_MVP_VALUE_OBJECT) {
+    if (value_is_object(receiver)) {
         object = heap_object_for_value(receiver);
         dispatch_heap_object_send(
             object,
@@ -26723,30 +32855,9 @@ static void perform_send_with_sender(
         return;
     }
 
-    if (receiver.kind == RECORZ_MVP_VALUE_SMALL_INTEGER) {
-        if (selector == RECORZ_MVP_SELECTOR_ADD) {
-            if (arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-                machine_panic("+ expects a small integer argument");
-            }
-            push(small_integer_value(receiver.integer + arguments[0].integer));
-            return;
-        }
-        if (selector == RECORZ_MVP_SELECTOR_SUBTRACT) {
-            if (arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-                machine_panic("- expects a small integer argument");
-            }
-            push(small_integer_value(receiver.integer - arguments[0].integer));
-            return;
-        }
-        if (selector == RECORZ_MVP_SELECTOR_MULTIPLY) {
-            if (arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
-                machine_panic("* expects a small integer argument");
-            }
-            push(small_integer_value(receiver.integer * arguments[0].integer));
-            return;
-        }
+    if (value_is_small_integer(receiver)) {
         if (selector == RECORZ_MVP_SELECTOR_PRINT_STRING) {
-            render_small_integer(receiver.integer);
+            render_small_integer(value_integer(receiver));
             push(string_value(print_buffer));
             return;
         }
@@ -26760,32 +32871,32 @@ static void perform_send_with_sender(
         machine_panic("unsupported SmallInteger selector");
     }
 
-    if (receiver.kind == RECORZ_MVP_VALUE_STRING) {
+    if (value_is_string(receiver)) {
         if (selector == RECORZ_MVP_SELECTOR_PRINT_STRING) {
             push(receiver);
             return;
         }
         if (selector == RECORZ_MVP_SELECTOR_SIZE) {
-            push(small_integer_value((int32_t)text_length(receiver.string == 0 ? "" : receiver.string)));
+            push(small_integer_value((int32_t)text_length(value_string(receiver) == 0 ? "" : value_string(receiver))));
             return;
         }
         if (selector == RECORZ_MVP_SELECTOR_AT) {
             uint32_t index;
 
-            if (arguments[0].kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+            if (!value_is_small_integer(arguments[0])) {
                 machine_panic("String at: expects a small integer argument");
             }
-            if (receiver.string == 0) {
+            if (value_string(receiver) == 0) {
                 machine_panic("String at: receiver is null");
             }
-            if (arguments[0].integer <= 0) {
+            if (value_integer(arguments[0]) <= 0) {
                 machine_panic("String at: index must be positive");
             }
-            index = (uint32_t)arguments[0].integer - 1U;
-            if (index >= text_length(receiver.string)) {
+            index = (uint32_t)value_integer(arguments[0]) - 1U;
+            if (index >= text_length(value_string(receiver))) {
                 machine_panic("String at: index is out of range");
             }
-            push(small_integer_value((int32_t)(uint8_t)receiver.string[index]));
+            push(small_integer_value((int32_t)(uint8_t)value_string(receiver)[index]));
             return;
         }
         if (workspace_enter_debugger_for_runtime_failure(
@@ -26808,6 +32919,100 @@ static void perform_send_with_sender(
     machine_panic("unsupported receiver in MVP VM");
 }
 
+static const struct recorz_mvp_method_cache_entry *send_site_lookup(
+    uint16_t site_index,
+    const struct recorz_mvp_heap_object *class_object,
+    uint16_t selector,
+    uint16_t argument_count
+) {
+    uint16_t class_handle = heap_handle_for_object(class_object);
+    struct recorz_mvp_method_cache_entry *site_entry = &send_site_entries[site_index];
+    struct recorz_mvp_method_cache_entry *polymorphic_entries = 0;
+    const struct recorz_mvp_method_cache_entry *resolved_entry;
+    uint16_t polymorphic_index = send_site_polymorphic_indexes[site_index];
+    uint32_t way;
+
+    if (site_entry->class_handle == class_handle &&
+        site_entry->selector_id == selector &&
+        site_entry->argument_count == argument_count) {
+        ++send_site_hit_count;
+        return site_entry;
+    }
+    if (polymorphic_index != 0U && polymorphic_index != SEND_SITE_MEGAMORPHIC) {
+        polymorphic_entries = &send_site_polymorphic_entries[(uint32_t)(polymorphic_index - 1U) * SEND_SITE_POLYMORPHIC_WAYS];
+        for (way = 0U; way < SEND_SITE_POLYMORPHIC_WAYS; ++way) {
+            if (polymorphic_entries[way].class_handle == class_handle &&
+                polymorphic_entries[way].selector_id == selector &&
+                polymorphic_entries[way].argument_count == argument_count) {
+                ++send_site_hit_count;
+                return &polymorphic_entries[way];
+            }
+        }
+    }
+    ++send_site_miss_count;
+    resolved_entry = method_cache_lookup(class_object, selector, argument_count);
+    if (resolved_entry == 0 || polymorphic_index == SEND_SITE_MEGAMORPHIC) {
+        return resolved_entry;
+    }
+    if (site_entry->class_handle == 0U) {
+        *site_entry = *resolved_entry;
+        return site_entry;
+    }
+    if (polymorphic_entries == 0) {
+        if (send_site_polymorphic_used >= SEND_SITE_POLYMORPHIC_LIMIT) {
+            send_site_polymorphic_indexes[site_index] = SEND_SITE_MEGAMORPHIC;
+            return resolved_entry;
+        }
+        polymorphic_entries =
+            &send_site_polymorphic_entries[(uint32_t)send_site_polymorphic_used * SEND_SITE_POLYMORPHIC_WAYS];
+        for (way = 0U; way < SEND_SITE_POLYMORPHIC_WAYS; ++way) {
+            polymorphic_entries[way].class_handle = 0U;
+        }
+        send_site_polymorphic_indexes[site_index] = ++send_site_polymorphic_used;
+    }
+    for (way = 0U; way < SEND_SITE_POLYMORPHIC_WAYS; ++way) {
+        if (polymorphic_entries[way].class_handle == 0U) {
+            polymorphic_entries[way] = *resolved_entry;
+            return &polymorphic_entries[way];
+        }
+    }
+    send_site_polymorphic_indexes[site_index] = SEND_SITE_MEGAMORPHIC;
+    return resolved_entry;
+}
+
+static uint8_t send_site_selector_is_cacheable(uint16_t selector) {
+    return (uint8_t)(selector != RECORZ_MVP_SELECTOR_EQUAL &&
+                     selector != RECORZ_MVP_SELECTOR_LESS_THAN &&
+                     selector != RECORZ_MVP_SELECTOR_GREATER_THAN &&
+                     selector != RECORZ_MVP_SELECTOR_SHOW &&
+                     selector != RECORZ_MVP_SELECTOR_WRITE_STRING &&
+                     selector != RECORZ_MVP_SELECTOR_CLASS &&
+                     selector != RECORZ_MVP_SELECTOR_IF_TRUE &&
+                     selector != RECORZ_MVP_SELECTOR_IF_FALSE &&
+                     selector != RECORZ_MVP_SELECTOR_IF_TRUE_IF_FALSE);
+}
+
+/* A null entry means the send has to go through perform_send_with_sender. */
+static const struct recorz_mvp_method_cache_entry *send_site_entry(
+    uint16_t site_index,
+    struct recorz_mvp_value receiver,
+    uint16_t selector,
+    uint16_t send_argument_count
+) {
+    const struct recorz_mvp_heap_object *object;
+
+    if (site_index == 0U ||
+        !value_is_object(receiver) ||
+        !send_site_selector_is_cacheable(selector)) {
+        return 0;
+    }
+    object = heap_object_for_value(receiver);
+    if (primitive_kind_for_heap_object(object) == RECORZ_MVP_OBJECT_BLOCK_CLOSURE) {
+        return 0;
+    }
+    return send_site_lookup(site_index, class_object_for_heap_object(object), selector, send_argument_count);
+}
+
 static void perform_send(
     struct recorz_mvp_value receiver,
     uint16_t selector,
@@ -26827,7 +33032,7 @@ static void run_startup_hook_if_configured(void) {
     if (!heap_handle_is_live(startup_hook_receiver_handle)) {
         machine_panic("startup hook receiver is out of range");
     }
-    if (startup_hook_selector_id > MAX_SELECTOR_ID) {
+    if (startup_hook_selector_id > last_selector_id()) {
         machine_panic("startup hook selector is out of range");
     }
     receiver = object_value(startup_hook_receiver_handle);
@@ -26841,6 +33046,10 @@ static void run_startup_hook_if_configured(void) {
     (void)gc_collect_now();
 }
 
+uint8_t *recorz_mvp_vm_snapshot_buffer(void) {
+    return snapshot_buffer;
+}
+
 void recorz_mvp_vm_run(
     const struct recorz_mvp_program *program,
     const struct recorz_mvp_seed *seed,
@@ -26851,16 +33060,17 @@ void recorz_mvp_vm_run(
     const uint8_t *snapshot_blob,
     uint32_t snapshot_size
 ) {
-    uintptr_t stack_base_marker = 0U;
     struct recorz_mvp_executable executable = {
         .instruction_source = program->instructions,
         .read_instruction = read_program_instruction,
+        .instructions = program->instructions,
         .instruction_count = program->instruction_count,
         .literals = program->literals,
         .literal_count = program->literal_count,
         .lexical_count = program->lexical_count,
         .lexical_names = program->lexical_names,
         .home_context_index = -1,
+        .outer_lexical_environment_index = -1,
     };
     struct recorz_mvp_value top_level_receiver;
     const struct recorz_mvp_heap_object *top_level_receiver_object;
@@ -26869,12 +33079,17 @@ void recorz_mvp_vm_run(
 
     stack_size = 0U;
     panic_phase = "bootstrap";
-    panic_pc = 0U;
-    panic_have_instruction = 0U;
+    current_execution_frame = 0;
+    interpreter_activation_count = 0U;
+    interpreter_entry_value_base = 0U;
+    interpreter_entry_value_count = 0;
     panic_have_send = 0U;
     machine_set_panic_hook(vm_panic_hook);
-    gc_stack_base_address = (uintptr_t)&stack_base_marker;
-    if (snapshot_blob != 0 && snapshot_size != 0U) {
+    if (snapshot_blob == 0 || snapshot_size == 0U) {
+        snapshot_blob = snapshot_buffer;
+        snapshot_size = read_snapshot_from_block_device();
+    }
+    if (snapshot_size != 0U) {
         panic_phase = "snapshot";
         load_snapshot_state(snapshot_blob, snapshot_size);
         booted_from_snapshot = 1U;
@@ -26908,6 +33123,7 @@ void recorz_mvp_vm_run(
     context_handle = source_home_context_at(home_context_index)->context_handle;
     executable.block_defining_class = class_object_for_heap_object(top_level_receiver_object);
     executable.home_context_index = home_context_index;
+    executable.send_site_base = send_site_allocate(executable.instruction_count);
     execute_executable(&executable, top_level_receiver_object, top_level_receiver, 0U, 0, context_handle);
     source_home_context_at(home_context_index)->alive = 0U;
     mark_context_dead(context_handle);
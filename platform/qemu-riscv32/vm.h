@@ -23,8 +23,29 @@
 #define RECORZ_MVP_LIVE_METHOD_SOURCE_LIMIT 512U
 #define RECORZ_MVP_LIVE_METHOD_SOURCE_POOL_LIMIT 98304U
 #define RECORZ_MVP_RUNTIME_STRING_POOL_LIMIT 196608U
+#define RECORZ_MVP_RUNTIME_STRING_INDEX_SIZE 16384U
+#define RECORZ_MVP_LIVE_METHOD_PROGRAM_INSTRUCTION_LIMIT 32768U
+#define RECORZ_MVP_LIVE_METHOD_PROGRAM_LITERAL_LIMIT 4096U
+#define RECORZ_MVP_LIVE_METHOD_PROGRAM_LEXICAL_LIMIT 512U
+#define RECORZ_MVP_COMPILED_BLOCK_LIMIT 512U
+#define RECORZ_MVP_COMPILED_BLOCK_INSTRUCTION_LIMIT 8192U
+#define RECORZ_MVP_COMPILED_BLOCK_LITERAL_LIMIT 1024U
+#define RECORZ_MVP_COMPILED_BLOCK_LEXICAL_LIMIT 256U
+#define RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT 16384U
+#define RECORZ_MVP_METHOD_DICTIONARY_SLOT_LIMIT 8192U
+#define RECORZ_MVP_METHOD_CACHE_SIZE 512U
+#define RECORZ_MVP_SEND_SITE_LIMIT 8192U
+#define RECORZ_MVP_SEND_SITE_POLYMORPHIC_LIMIT 512U
+#define RECORZ_MVP_DYNAMIC_SELECTOR_LIMIT 1024U
+#define RECORZ_MVP_GC_NURSERY_LIMIT 4096U
+#define RECORZ_MVP_GC_REMEMBERED_SET_LIMIT 512U
+#define RECORZ_MVP_GC_GREY_STACK_LIMIT 2048U
+#define RECORZ_MVP_GC_ALLOCATION_TRIGGER 512U
+#define RECORZ_MVP_GC_OCCUPANCY_TRIGGER_PERCENT 50U
+#define RECORZ_MVP_SELECTOR_TABLE_SIZE 4096U
 #define RECORZ_MVP_SNAPSHOT_STRING_LIMIT 16384U
 #define RECORZ_MVP_SNAPSHOT_BUFFER_LIMIT 524288U
+#define RECORZ_MVP_DECODED_INSTRUCTION_LIMIT 16384U
 #else
 #define RECORZ_MVP_PROFILE_NAME "TARGET"
 #define RECORZ_MVP_HEAP_LIMIT 512U
@@ -35,8 +56,37 @@
 #define RECORZ_MVP_LIVE_METHOD_SOURCE_LIMIT 256U
 #define RECORZ_MVP_LIVE_METHOD_SOURCE_POOL_LIMIT 32768U
 #define RECORZ_MVP_RUNTIME_STRING_POOL_LIMIT 65536U
+#define RECORZ_MVP_RUNTIME_STRING_INDEX_SIZE 4096U
+#define RECORZ_MVP_LIVE_METHOD_PROGRAM_INSTRUCTION_LIMIT 4096U
+#define RECORZ_MVP_LIVE_METHOD_PROGRAM_LITERAL_LIMIT 512U
+#define RECORZ_MVP_LIVE_METHOD_PROGRAM_LEXICAL_LIMIT 64U
+#define RECORZ_MVP_COMPILED_BLOCK_LIMIT 64U
+#define RECORZ_MVP_COMPILED_BLOCK_INSTRUCTION_LIMIT 1024U
+#define RECORZ_MVP_COMPILED_BLOCK_LITERAL_LIMIT 128U
+#define RECORZ_MVP_COMPILED_BLOCK_LEXICAL_LIMIT 32U
+#define RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT 2048U
+#define RECORZ_MVP_METHOD_DICTIONARY_SLOT_LIMIT 1024U
+#define RECORZ_MVP_METHOD_CACHE_SIZE 64U
+#define RECORZ_MVP_SEND_SITE_LIMIT 512U
+#define RECORZ_MVP_SEND_SITE_POLYMORPHIC_LIMIT 32U
+#define RECORZ_MVP_DYNAMIC_SELECTOR_LIMIT 64U
+#define RECORZ_MVP_GC_NURSERY_LIMIT 128U
+#define RECORZ_MVP_GC_REMEMBERED_SET_LIMIT 32U
+#define RECORZ_MVP_GC_GREY_STACK_LIMIT 64U
+#define RECORZ_MVP_GC_ALLOCATION_TRIGGER 64U
+#define RECORZ_MVP_GC_OCCUPANCY_TRIGGER_PERCENT 40U
+#define RECORZ_MVP_SELECTOR_TABLE_SIZE 1024U
 #define RECORZ_MVP_SNAPSHOT_STRING_LIMIT 8192U
 #define RECORZ_MVP_SNAPSHOT_BUFFER_LIMIT 24576U
+#define RECORZ_MVP_DECODED_INSTRUCTION_LIMIT 1024U
+#endif
+
+#if !defined(RECORZ_MVP_THREADED_DISPATCH)
+#if defined(__GNUC__)
+#define RECORZ_MVP_THREADED_DISPATCH 1
+#else
+#define RECORZ_MVP_THREADED_DISPATCH 0
+#endif
 #endif
 
 #define RECORZ_MVP_PROGRAM_LEXICAL_LIMIT 32U
@@ -82,8 +132,12 @@ struct recorz_mvp_seed {
     uint16_t root_object_indices[RECORZ_MVP_SEED_ROOT_TRANSCRIPT_FONT + 1];
     const uint16_t *glyph_object_indices_by_code;
     uint16_t glyph_code_count;
+    const uint32_t *compiled_method_body_words;
+    uint16_t compiled_method_body_word_count;
 };
 
+uint8_t *recorz_mvp_vm_snapshot_buffer(void);
+
 void recorz_mvp_vm_run(
     const struct recorz_mvp_program *program,
     const struct recorz_mvp_seed *seed,
@@ -11,10 +11,10 @@ uint8_t machine_try_getc(char *out);
 char machine_wait_getc(void);
 void machine_discard_pending_input(void);
 void machine_puts(const char *text);
-void machine_wait_forever(void);
+void machine_wait_forever(void) __attribute__((noreturn));
 void machine_shutdown(void);
 void machine_set_panic_hook(machine_panic_hook hook);
-void machine_panic(const char *message);
+void machine_panic(const char *message) __attribute__((noreturn));
 void machine_ramfb_init(void *framebuffer, uint32_t width, uint32_t height, uint32_t stride);
 uint32_t machine_fw_cfg_try_read_file(const char *target, void *buffer, uint32_t buffer_size);
 
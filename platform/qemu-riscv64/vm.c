@@ -149,6 +149,8 @@
 #define CHARACTER_SCANNER_FIELD_INDEX RECORZ_MVP_CHARACTER_SCANNER_FIELD_INDEX
 #define CHARACTER_SCANNER_FIELD_X RECORZ_MVP_CHARACTER_SCANNER_FIELD_X
 #define CHARACTER_SCANNER_FIELD_Y RECORZ_MVP_CHARACTER_SCANNER_FIELD_Y
+#define LARGE_POSITIVE_INTEGER_FIELD_DIGIT0 RECORZ_MVP_LARGE_POSITIVE_INTEGER_FIELD_DIGIT0
+#define LARGE_POSITIVE_INTEGER_DIGIT_COUNT 4U
 
 #define BITMAP_STORAGE_FRAMEBUFFER RECORZ_MVP_BITMAP_STORAGE_FRAMEBUFFER
 #define BITMAP_STORAGE_GLYPH_MONO RECORZ_MVP_BITMAP_STORAGE_GLYPH_MONO
@@ -162,8 +164,8 @@
 #define CHARACTER_SCANNER_STOP_CONTROL 4U
 #define CHARACTER_SCANNER_STOP_SELECTION 5U
 #define CHARACTER_SCANNER_STOP_CURSOR 6U
-#define MAX_OBJECT_KIND RECORZ_MVP_OBJECT_WORKSPACE_DEBUGGER_MODEL
-#define MAX_SELECTOR_ID RECORZ_MVP_SELECTOR_RESTORE_ON_TOOL
+#define MAX_OBJECT_KIND RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER
+#define MAX_SELECTOR_ID RECORZ_MVP_SELECTOR_MIN
 #define MAX_GLOBAL_ID RECORZ_MVP_GLOBAL_WORKSPACE_SELECTION
 
 #define WORKSPACE_VIEW_NONE 0U
@@ -3075,6 +3077,31 @@ static struct recorz_mvp_value small_integer_value(int32_t integer) {
     return (struct recorz_mvp_value){RECORZ_MVP_VALUE_SMALL_INTEGER, integer, 0};
 }
 
+/* The shared runtime headers read values through these accessors. */
+static uint8_t value_is_nil(struct recorz_mvp_value value) {
+    return (uint8_t)(value.kind == RECORZ_MVP_VALUE_NIL);
+}
+
+static uint8_t value_is_object(struct recorz_mvp_value value) {
+    return (uint8_t)(value.kind == RECORZ_MVP_VALUE_OBJECT);
+}
+
+static uint8_t value_is_small_integer(struct recorz_mvp_value value) {
+    return (uint8_t)(value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER);
+}
+
+static uint8_t value_is_string(struct recorz_mvp_value value) {
+    return (uint8_t)(value.kind == RECORZ_MVP_VALUE_STRING);
+}
+
+static int32_t value_integer(struct recorz_mvp_value value) {
+    return value.integer;
+}
+
+static const char *value_string(struct recorz_mvp_value value) {
+    return value.string;
+}
+
 static uint8_t condition_value_is_true(struct recorz_mvp_value value) {
     if (value.kind != RECORZ_MVP_VALUE_OBJECT) {
         machine_panic("conditional branch expects a boolean object");
@@ -13628,6 +13655,138 @@ static void execute_entry_class_new(
     push(object_value(instance_handle));
 }
 
+/* Indexable objects need variable-sized heap runs, which this target's fixed-slot heap does not provide. */
+static void execute_entry_class_new_size(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    machine_panic("Class new: is unsupported on this target");
+}
+
+static void execute_entry_array_at(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    machine_panic("Array at: is unsupported on this target");
+}
+
+static void execute_entry_array_at_put(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    machine_panic("Array at:put: is unsupported on this target");
+}
+
+static void execute_entry_byte_array_at(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    machine_panic("ByteArray at: is unsupported on this target");
+}
+
+static void execute_entry_byte_array_at_put(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    machine_panic("ByteArray at:put: is unsupported on this target");
+}
+
+static void execute_entry_word_array_at(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    machine_panic("WordArray at: is unsupported on this target");
+}
+
+static void execute_entry_word_array_at_put(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    machine_panic("WordArray at:put: is unsupported on this target");
+}
+
+static void render_large_positive_integer(const struct recorz_mvp_heap_object *object) {
+    char scratch[PRINT_BUFFER_SIZE];
+    uint64_t magnitude = 0U;
+    uint32_t index = 0U;
+    uint32_t out_index = 0U;
+    uint8_t digit_index = LARGE_POSITIVE_INTEGER_DIGIT_COUNT;
+
+    while (digit_index > 0U) {
+        --digit_index;
+        magnitude = (magnitude << 16U) | small_integer_u32(
+            heap_get_field(object, (uint8_t)(LARGE_POSITIVE_INTEGER_FIELD_DIGIT0 + digit_index)),
+            "LargePositiveInteger digit is not a small integer"
+        );
+    }
+    do {
+        scratch[index++] = (char)('0' + (magnitude % 10U));
+        magnitude /= 10U;
+    } while (magnitude > 0U && index < PRINT_BUFFER_SIZE - 1U);
+    while (index > 0U) {
+        print_buffer[out_index++] = scratch[--index];
+    }
+    print_buffer[out_index] = '\0';
+}
+
+static void execute_entry_large_positive_integer_print_string(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    if (object->kind != RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER) {
+        machine_panic("LargePositiveInteger printString expects a LargePositiveInteger receiver");
+    }
+    render_large_positive_integer(object);
+    push(string_value(print_buffer));
+}
+
 static void execute_entry_kernel_installer_class_named(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
@@ -16788,6 +16947,20 @@ static void execute_entry_kernel_installer_clear_startup(
     push(receiver);
 }
 
+static void execute_entry_kernel_installer_garbage_collect(
+    const struct recorz_mvp_heap_object *object,
+    struct recorz_mvp_value receiver,
+    const struct recorz_mvp_value arguments[],
+    const char *text
+) {
+    (void)object;
+    (void)receiver;
+    (void)arguments;
+    (void)text;
+    /* This target never reclaims heap slots, so a requested collection frees nothing. */
+    push(small_integer_value(0));
+}
+
 static void execute_entry_test_runner_run_class_named(
     const struct recorz_mvp_heap_object *object,
     struct recorz_mvp_value receiver,
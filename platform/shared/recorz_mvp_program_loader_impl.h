@@ -68,6 +68,25 @@ static void validate_instruction(
         case RECORZ_MVP_OP_PUSH_NIL:
         case RECORZ_MVP_OP_PUSH_SELF:
         case RECORZ_MVP_OP_PUSH_THIS_CONTEXT:
+#if RECORZ_MVP_SPECIAL_SEND_OPCODES
+        case RECORZ_MVP_OP_SEND_ADD:
+        case RECORZ_MVP_OP_SEND_SUBTRACT:
+        case RECORZ_MVP_OP_SEND_MULTIPLY:
+        case RECORZ_MVP_OP_SEND_LESS_THAN:
+        case RECORZ_MVP_OP_SEND_GREATER_THAN:
+        case RECORZ_MVP_OP_SEND_LESS_EQUAL:
+        case RECORZ_MVP_OP_SEND_GREATER_EQUAL:
+        case RECORZ_MVP_OP_SEND_EQUAL:
+        case RECORZ_MVP_OP_SEND_NOT_EQUAL:
+        case RECORZ_MVP_OP_SEND_INTEGER_DIVIDE:
+        case RECORZ_MVP_OP_SEND_MODULO:
+        case RECORZ_MVP_OP_SEND_BIT_AND:
+        case RECORZ_MVP_OP_SEND_BIT_OR:
+        case RECORZ_MVP_OP_SEND_BIT_XOR:
+        case RECORZ_MVP_OP_SEND_BIT_SHIFT:
+        case RECORZ_MVP_OP_SEND_MAX:
+        case RECORZ_MVP_OP_SEND_MIN:
+#endif
             if (instruction->operand_a != 0U || instruction->operand_b != 0U) {
                 machine_panic("program manifest stack opcode carries unexpected operands");
             }
@@ -9,6 +9,9 @@
 
 static struct recorz_mvp_seed_object loaded_objects[RECORZ_MVP_HEAP_LIMIT];
 static uint16_t loaded_glyph_object_indices[RECORZ_MVP_GLYPH_CODE_LIMIT];
+#ifdef RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT
+static uint32_t loaded_compiled_method_body_words[RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT];
+#endif
 static struct recorz_mvp_seed loaded_seed;
 
 static uint16_t read_u16_le(const uint8_t *bytes) {
@@ -29,6 +32,7 @@ const struct recorz_mvp_seed *recorz_mvp_seed_load(const uint8_t *blob, uint32_t
     uint16_t global_binding_count;
     uint16_t root_binding_count;
     uint16_t glyph_code_count;
+    uint16_t body_word_count;
     uint16_t global_index;
     uint16_t object_index;
     uint32_t offset;
@@ -53,17 +57,27 @@ const struct recorz_mvp_seed *recorz_mvp_seed_load(const uint8_t *blob, uint32_t
     global_binding_count = read_u16_le(blob + 8U);
     root_binding_count = read_u16_le(blob + 10U);
     glyph_code_count = read_u16_le(blob + 12U);
+    body_word_count = read_u16_le(blob + 14U);
     loaded_seed.object_count = object_count;
     loaded_seed.glyph_code_count = glyph_code_count;
 
     if (glyph_code_count > RECORZ_MVP_GLYPH_CODE_LIMIT) {
         machine_panic("seed manifest glyph code count exceeds table capacity");
     }
+#ifdef RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT
+    if (body_word_count > RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT) {
+        machine_panic("seed manifest compiled method bodies exceed pool capacity");
+    }
+#else
+    if (body_word_count != 0U) {
+        machine_panic("seed manifest compiled method bodies are not supported");
+    }
+#endif
 
     expected_size = RECORZ_MVP_SEED_HEADER_SIZE + ((uint32_t)object_count * RECORZ_MVP_SEED_OBJECT_SIZE) +
                     ((uint32_t)global_binding_count * RECORZ_MVP_SEED_BINDING_SIZE) +
                     ((uint32_t)root_binding_count * RECORZ_MVP_SEED_BINDING_SIZE) +
-                    ((uint32_t)glyph_code_count * 2U);
+                    ((uint32_t)glyph_code_count * 2U) + ((uint32_t)body_word_count * 4U);
     if (size != expected_size) {
         machine_panic("seed manifest size mismatch");
     }
@@ -163,6 +177,14 @@ const struct recorz_mvp_seed *recorz_mvp_seed_load(const uint8_t *blob, uint32_t
         loaded_glyph_object_indices[object_index] = glyph_object_index;
     }
 
+#ifdef RECORZ_MVP_COMPILED_METHOD_BODY_WORD_LIMIT
+    for (object_index = 0U; object_index < body_word_count; ++object_index) {
+        loaded_compiled_method_body_words[object_index] = (uint32_t)read_i32_le(blob + offset);
+        offset += 4U;
+    }
+    loaded_seed.compiled_method_body_words = loaded_compiled_method_body_words;
+    loaded_seed.compiled_method_body_word_count = body_word_count;
+#endif
     loaded_seed.objects = loaded_objects;
     loaded_seed.glyph_object_indices_by_code = loaded_glyph_object_indices;
     return &loaded_seed;
@@ -50,7 +50,7 @@ static void workspace_capture_plain_return_state_if_needed(
             struct recorz_mvp_value session_workspace_value =
                 heap_get_field(session_object, session_workspace_field_index);
 
-            if (session_workspace_value.kind == RECORZ_MVP_VALUE_OBJECT &&
+            if (value_is_object(session_workspace_value) &&
                 heap_object_for_value(session_workspace_value) == workspace_object) {
                 (void)perform_send_and_pop_result(
                     object_value(session_handle),
@@ -67,19 +67,19 @@ static void workspace_capture_plain_return_state_if_needed(
         workspace_object,
         workspace_current_view_kind_field_index(workspace_object)
     );
-    if (view_kind_value.kind == RECORZ_MVP_VALUE_SMALL_INTEGER &&
-        (uint32_t)view_kind_value.integer != WORKSPACE_VIEW_INPUT_MONITOR) {
+    if (value_is_small_integer(view_kind_value) &&
+        (uint32_t)value_integer(view_kind_value) != WORKSPACE_VIEW_INPUT_MONITOR) {
         return;
     }
-    if (view_kind_value.kind != RECORZ_MVP_VALUE_NIL &&
-        view_kind_value.kind != RECORZ_MVP_VALUE_SMALL_INTEGER) {
+    if (!value_is_nil(view_kind_value) &&
+        !value_is_small_integer(view_kind_value)) {
         return;
     }
     target_name_value = heap_get_field(
         workspace_object,
         workspace_current_target_name_field_index(workspace_object)
     );
-    if (target_name_value.kind != RECORZ_MVP_VALUE_NIL) {
+    if (!value_is_nil(target_name_value)) {
         return;
     }
     tool_handle = named_object_handle_for_name("BootWorkspaceTool");
@@ -87,8 +87,8 @@ static void workspace_capture_plain_return_state_if_needed(
         return;
     }
     current_source_value = workspace_current_source_value(workspace_object);
-    if (current_source_value.kind == RECORZ_MVP_VALUE_STRING &&
-        current_source_value.string != 0) {
+    if (value_is_string(current_source_value) &&
+        value_string(current_source_value) != 0) {
         arguments[0] = current_source_value;
     } else {
         arguments[0] = string_value("");
@@ -78,6 +78,56 @@ class QemuRiscv32MakefileTests(unittest.TestCase):
             self.assertIn("-DRECORZ_MVP_PROFILE_TARGET=1", result.stdout)
             self.assertNotIn("-DRECORZ_MVP_PROFILE_DEV=1", result.stdout)
 
+    @unittest.skipUnless(shutil.which("make"), "make is required for QEMU RISC-V Makefile tests")
+    def test_interpreter_dispatch_mode_can_be_selected_explicitly(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-makefile-dispatch-") as temp_dir:
+            build_dir = Path(temp_dir)
+            outputs: dict[str, str] = {}
+            for dispatch in ("threaded", "switch"):
+                result = subprocess.run(
+                    [
+                        "make",
+                        "-n",
+                        "-C",
+                        str(PLATFORM_DIR),
+                        f"BUILD_DIR={build_dir}",
+                        f"RV32_DISPATCH={dispatch}",
+                        "all",
+                    ],
+                    cwd=ROOT,
+                    capture_output=True,
+                    text=True,
+                )
+                if result.returncode != 0:
+                    self.fail(
+                        f"make -n all with RV32_DISPATCH={dispatch} failed\n"
+                        f"stdout:\n{result.stdout}\n"
+                        f"stderr:\n{result.stderr}"
+                    )
+                outputs[dispatch] = result.stdout
+
+            self.assertIn("vm.c", outputs["threaded"])
+            self.assertNotIn("-DRECORZ_MVP_THREADED_DISPATCH=0", outputs["threaded"])
+            self.assertIn("-DRECORZ_MVP_THREADED_DISPATCH=0", outputs["switch"])
+            self.assertIn("-march=rv32im -mabi=ilp32", outputs["switch"])
+
+            result = subprocess.run(
+                [
+                    "make",
+                    "-n",
+                    "-C",
+                    str(PLATFORM_DIR),
+                    f"BUILD_DIR={build_dir}",
+                    "RV32_DISPATCH=computed",
+                    "all",
+                ],
+                cwd=ROOT,
+                capture_output=True,
+                text=True,
+            )
+            self.assertNotEqual(result.returncode, 0)
+            self.assertIn("RV32_DISPATCH must be threaded or switch", result.stderr)
+
     @unittest.skipUnless(shutil.which("make"), "make is required for QEMU RISC-V Makefile tests")
     def test_continue_snapshot_uses_a_temporary_output_before_replacing_input_snapshot(self) -> None:
         with tempfile.TemporaryDirectory(prefix="qemu-riscv32-makefile-continue-snapshot-") as temp_dir:
@@ -250,9 +300,45 @@ class QemuRiscv32MakefileTests(unittest.TestCase):
             self.assertIn(f"rm -f \"{signal_path}\"", result.stdout)
             self.assertIn(f"CONTINUE_SNAPSHOT_SIGNAL=\"{signal_path}\"", result.stdout)
             self.assertIn(f"SNAPSHOT_PAYLOAD={snapshot_path}", result.stdout)
+            self.assertIn(f"SNAPSHOT_DISK={build_dir / 'dev' / 'live.disk'}", result.stdout)
             self.assertIn("continue-snapshot-interactive", result.stdout)
             self.assertIn(f"echo \"resuming {snapshot_path}\"", result.stdout)
 
+    @unittest.skipUnless(shutil.which("make"), "make is required for QEMU RISC-V Makefile tests")
+    def test_continue_snapshot_interactive_moves_snapshots_over_a_virtio_block_disk(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-makefile-snapshot-disk-") as temp_dir:
+            build_dir = Path(temp_dir)
+            snapshot_path = build_dir / "live.bin"
+            disk_path = build_dir / "live.disk"
+            result = subprocess.run(
+                [
+                    "make",
+                    "-n",
+                    "-C",
+                    str(PLATFORM_DIR),
+                    f"BUILD_DIR={build_dir}",
+                    f"SNAPSHOT_PAYLOAD={snapshot_path}",
+                    f"SNAPSHOT_DISK={disk_path}",
+                    "continue-snapshot-interactive",
+                ],
+                cwd=ROOT,
+                capture_output=True,
+                text=True,
+            )
+            if result.returncode != 0:
+                self.fail(
+                    "make -n continue-snapshot-interactive with SNAPSHOT_DISK failed\n"
+                    f"stdout:\n{result.stdout}\n"
+                    f"stderr:\n{result.stderr}"
+                )
+
+            self.assertIn(f"qemu_riscv_snapshot_disk.py pack --size 1048576 {snapshot_path} {disk_path}", result.stdout)
+            self.assertIn(f"-drive file={disk_path},if=none,format=raw,id=recorzsnapshot", result.stdout)
+            self.assertIn("-device virtio-blk-device,drive=recorzsnapshot", result.stdout)
+            self.assertNotIn("-fw_cfg name=opt/recorz-snapshot", result.stdout)
+            self.assertIn("grep -q 'recorz-snapshot-stored' ", result.stdout)
+            self.assertIn(f"qemu_riscv_snapshot_disk.py unpack {disk_path} {snapshot_path}.tmp", result.stdout)
+
     @unittest.skipUnless(shutil.which("make"), "make is required for QEMU RISC-V Makefile tests")
     def test_dev_regenerate_boot_source_routes_through_regenerate_boot_source(self) -> None:
         with tempfile.TemporaryDirectory(prefix="qemu-riscv32-makefile-dev-regenerate-") as temp_dir:
@@ -98,6 +98,7 @@ def _build_elf(
     example_path: Path = DEFAULT_EXAMPLE,
     *,
     profile: str = "dev",
+    dispatch: str = "threaded",
     file_in_payload: Path | None = None,
 ) -> Path:
     command = [
@@ -106,6 +107,7 @@ def _build_elf(
         str(PLATFORM_DIR),
         f"BUILD_DIR={build_dir}",
         f"RV32_PROFILE={profile}",
+        f"RV32_DISPATCH={dispatch}",
         f"EXAMPLE={example_path}",
     ]
     if file_in_payload is not None:
@@ -423,6 +425,42 @@ def _read_file_until(path: Path, marker: str, *, timeout: float) -> str:
     return output
 
 
+def _run_serial_to_completion(elf_path: Path, *, timeout: float = 5.0) -> str:
+    process = subprocess.Popen(
+        [
+            "qemu-system-riscv32",
+            "-machine",
+            "virt",
+            "-m",
+            "32M",
+            "-smp",
+            "1",
+            "-kernel",
+            str(elf_path),
+            "-serial",
+            "stdio",
+            "-display",
+            "none",
+            "-device",
+            "ramfb",
+        ],
+        cwd=ROOT,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.STDOUT,
+        text=True,
+    )
+    try:
+        try:
+            output, _ = process.communicate(timeout=timeout)
+        except subprocess.TimeoutExpired:
+            process.kill()
+            output, _ = process.communicate(timeout=5.0)
+    finally:
+        if process.stdout is not None:
+            process.stdout.close()
+    return output.replace("\r", "")
+
+
 @unittest.skipUnless(
     shutil.which("qemu-system-riscv32") and shutil.which("riscv64-unknown-elf-gcc"),
     "QEMU RV32 serial integration test requires qemu-system-riscv32 and riscv64-unknown-elf-gcc",
@@ -5099,6 +5137,12 @@ class QemuRiscv32SerialIntegrationTests(unittest.TestCase):
                 "SSTR": 16384,
                 "SNAP": 524288,
                 "MONO": 16,
+                "CMBW": 16384,
+                "MDIC": 8192,
+                "RSIX": 16384,
+                "SITE": 8192,
+                "DSEL": 1024,
+                "NURS": 4096,
             }
             for label, expected_limit in expected_limits.items():
                 match = re.search(rf"{label} (\d+)/(\d+)", output)
@@ -5107,6 +5151,8 @@ class QemuRiscv32SerialIntegrationTests(unittest.TestCase):
                 limit = int(match.group(2))
                 self.assertEqual(limit, expected_limit, label)
                 self.assertLess(used, limit, label)
+            for label in ("GCM", "GCP", "GCX", "GCI", "MCH", "MCM", "ICH", "ICM"):
+                self.assertRegex(output, rf"{label} \d+", f"missing {label} line in output:\n{output}")
 
     def test_runtime_string_pool_compacts_dead_workspace_strings(self) -> None:
         with tempfile.TemporaryDirectory(prefix="qemu-riscv32-runtime-strings-") as temp_dir:
@@ -5176,27 +5222,102 @@ class QemuRiscv32SerialIntegrationTests(unittest.TestCase):
             self.assertNotIn("panic: runtime string pool overflow", output)
             self.assertIn("recorz qemu-riscv32 mvp: rendered", output)
 
-    def test_dev_profile_automatic_gc_reclaims_reinstalled_method_garbage_before_heap_overflow(self) -> None:
-        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-gc-method-reinstall-") as temp_dir:
+    def test_file_in_interns_selectors_missing_from_the_generated_registry(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-dynamic-selectors-") as temp_dir:
             temp_path = Path(temp_dir)
-            example_path = temp_path / "automatic_gc_method_reinstall.rz"
-            repeated_source = ["RecorzKernelClass: #GcProbe superclass: #Object\n!\n"]
-            repeated_source.extend(
-                "contents\n    ^'x'\n!\n"
-                for _ in range(1024)
+            example_path = temp_path / "dynamic_selectors.rz"
+            class_source = (
+                "RecorzKernelClass: #DynamicSelectorProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "value\n    ^self frobnicate: 'DYNAMIC'\n!\n"
+                "frobnicate: text\n    ^self twiddle\n!\n"
+                "twiddle\n    ^'SELECTOR OK'"
             )
+            escaped_class_source = class_source.replace("'", "''")
             example_path.write_text(
-                "KernelInstaller fileInClassChunks: '"
-                + "".join(repeated_source).replace("'", "''")
-                + "'.\n"
-                + "Transcript show: KernelInstaller memoryReport.",
+                "\n".join(
+                    [
+                        "| probeClass |",
+                        "Display clear.",
+                        f"probeClass := KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        "Transcript show: probeClass new value.",
+                        "Transcript cr.",
+                        "Transcript show: KernelInstaller memoryReport.",
+                    ]
+                ),
                 encoding="utf-8",
             )
-            elf_path = _build_elf(
-                temp_path / "build",
-                example_path,
-                profile="dev",
+            elf_path = _build_elf(temp_path / "build", example_path)
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=5.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertNotIn("panic:", output)
+            self.assertIn("SELECTOR OK", output)
+            self.assertRegex(output, r"DSEL 2/1024")
+            self.assertIn("recorz qemu-riscv32 mvp: rendered", output)
+
+    def test_workspace_minor_collections_keep_young_objects_stored_into_old_objects(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-minor-gc-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "minor_gc_remembered_set.rz"
+            class_source = (
+                "RecorzKernelClass: #MinorGcHolder superclass: #Object instanceVariableNames: 'item'\n!\n"
+                "item\n    ^item\n!\n"
+                "item: anObject\n    item := anObject.\n    ^self"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            holder_class = "(KernelInstaller classNamed: ''MinorGcHolder'')"
+            garbage_chain = "''garbage''"
+            for _ in range(8):
+                garbage_chain = f"({holder_class} new item: {garbage_chain})"
+            garbage_updates = [f"Workspace evaluate: '{garbage_chain}'." for _ in range(96)]
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        "KernelInstaller rememberObject: (KernelInstaller classNamed: 'MinorGcHolder') new named: 'holder'.",
+                        "Workspace evaluate: 'KernelInstaller objectNamed: ''holder'''.",
+                        "Workspace evaluate: '(KernelInstaller objectNamed: ''holder'') item: "
+                        f"({holder_class} new item: ''KEPT''). Transcript show: ''STORED''. Transcript cr'.",
+                        *garbage_updates,
+                        "Workspace evaluate: 'Transcript show: (KernelInstaller objectNamed: ''holder'') item item. Transcript cr'.",
+                        "Transcript show: KernelInstaller memoryReport.",
+                    ]
+                ),
+                encoding="utf-8",
             )
+            elf_path = _build_elf(temp_path / "build", example_path)
             process = subprocess.Popen(
                 [
                     "qemu-system-riscv32",
@@ -5222,7 +5343,7 @@ class QemuRiscv32SerialIntegrationTests(unittest.TestCase):
             )
             try:
                 try:
-                    output, _ = process.communicate(timeout=18.0)
+                    output, _ = process.communicate(timeout=5.0)
                 except subprocess.TimeoutExpired:
                     process.kill()
                     output, _ = process.communicate(timeout=5.0)
@@ -5231,21 +5352,1006 @@ class QemuRiscv32SerialIntegrationTests(unittest.TestCase):
                     process.stdout.close()
 
             output = output.replace("\r", "")
-            self.assertIn("MEMORY", output)
-            self.assertIn("recorz qemu-riscv32 mvp: created class GcProbe", output)
-            self.assertNotIn("panic: object heap overflow", output)
-            self.assertNotIn("panic: class method range contains a non-method descriptor", output)
-            gc_count_match = re.search(r"GCC (\d+)", output)
-            total_reclaimed_match = re.search(r"GCT (\d+)", output)
-            heap_match = re.search(r"HEAP (\d+)/(\d+)", output)
-            high_water_match = re.search(r"HWM (\d+)/(\d+)", output)
-            self.assertIsNotNone(gc_count_match, output)
-            self.assertIsNotNone(total_reclaimed_match, output)
-            self.assertIsNotNone(heap_match, output)
-            self.assertIsNotNone(high_water_match, output)
-            self.assertGreater(int(gc_count_match.group(1)), 0, output)
-            self.assertGreater(int(total_reclaimed_match.group(1)), 0, output)
-            self.assertGreater(int(high_water_match.group(1)), int(heap_match.group(1)), output)
+            self.assertNotIn("panic:", output)
+            self.assertIn("STORED", output)
+            self.assertIn("KEPT", output)
+            minor_match = re.search(r"GCM (\d+)", output)
+            self.assertIsNotNone(minor_match, output)
+            self.assertGreater(int(minor_match.group(1)), 0, output)
+            self.assertIn("recorz qemu-riscv32 mvp: rendered", output)
+
+    def test_nested_workspace_collection_keeps_method_temporaries_alive(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-precise-roots-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "precise_roots.rz"
+            class_source = (
+                "RecorzKernelClass: #PreciseRootProbe superclass: #Object instanceVariableNames: 'item'\n!\n"
+                "item\n    ^item\n!\n"
+                "item: anObject\n    item := anObject.\n    ^self\n!\n"
+                "keepAcrossNestedEvaluate\n"
+                "    | holder |\n"
+                "    holder := self class new item: 'KEPT'.\n"
+                "    Workspace evaluate: 'KernelInstaller garbageCollect'.\n"
+                "    ^holder item"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        "Workspace evaluate: 'Transcript show: (KernelInstaller classNamed: ''PreciseRootProbe'') "
+                        "new keepAcrossNestedEvaluate. Transcript cr'.",
+                        "Transcript show: KernelInstaller memoryReport.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(temp_path / "build", example_path)
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=5.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertNotIn("panic:", output)
+            self.assertIn("KEPT", output)
+            collection_match = re.search(r"GCC (\d+)", output)
+            self.assertIsNotNone(collection_match, output)
+            self.assertGreater(int(collection_match.group(1)), 0, output)
+            self.assertIn("recorz qemu-riscv32 mvp: rendered", output)
+
+    def test_indexable_objects_store_elements_and_survive_collection(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-indexable-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "indexable.rz"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        "Workspace evaluate: '| a | a := (KernelInstaller classNamed: ''Array'') new: 10. "
+                        "a at: 1 put: ''ONE''. a at: 10 put: ((KernelInstaller classNamed: ''Array'') new: 3). "
+                        "KernelInstaller rememberObject: a named: ''arr'''.",
+                        "Workspace evaluate: '| b | b := (KernelInstaller classNamed: ''ByteArray'') new: 40. "
+                        "b at: 17 put: 255. b at: 18 put: 7. KernelInstaller rememberObject: b named: ''bytes'''.",
+                        "Workspace evaluate: '| w | w := (KernelInstaller classNamed: ''WordArray'') new: 5. "
+                        "w at: 5 put: 123456789. w at: 1 put: 65535 * 65536 + 65535. "
+                        "KernelInstaller rememberObject: w named: ''words'''.",
+                        "Workspace evaluate: '(KernelInstaller classNamed: ''Array'') new: 100'.",
+                        "Workspace evaluate: 'KernelInstaller garbageCollect'.",
+                        "Workspace evaluate: 'Transcript show: ((KernelInstaller objectNamed: ''arr'') at: 1). "
+                        "Transcript show: ((KernelInstaller objectNamed: ''arr'') at: 10) size printString. "
+                        "Transcript show: ((KernelInstaller objectNamed: ''bytes'') at: 17) printString. "
+                        "Transcript show: ((KernelInstaller objectNamed: ''bytes'') at: 18) printString. "
+                        "Transcript show: ((KernelInstaller objectNamed: ''bytes'') at: 19) printString. "
+                        "Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: ((KernelInstaller objectNamed: ''words'') at: 5) "
+                        "printString. Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: ((KernelInstaller objectNamed: ''words'') at: 1) "
+                        "printString. Transcript show: ((KernelInstaller objectNamed: ''words'') at: 2) printString. "
+                        "Transcript cr'.",
+                        "Workspace evaluate: '((KernelInstaller classNamed: ''ByteArray'') new: 3) at: 1 put: 256'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(temp_path / "build", example_path)
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=5.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertIn("ONE325570", output)
+            self.assertIn("123456789", output)
+            self.assertIn("42949672950", output)
+            self.assertIn("panic: ByteArray element is out of byte range", output)
+
+    def test_integer_arithmetic_promotes_to_large_positive_integers(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-integer-arithmetic-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "integers.rz"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        "KernelInstaller fileInClassChunks: 'RecorzKernelClass: #Calc superclass: #Object "
+                        "instanceVariableNames: ''total''",
+                        "!",
+                        "fact: n",
+                        "    n <= 1 ifTrue: [^1].",
+                        "    ^n * (self fact: n - 1)",
+                        "!",
+                        "mod: a by: b",
+                        "    ^a \\\\ b",
+                        "'.",
+                        "Workspace evaluate: 'KernelInstaller rememberObject: (KernelInstaller classNamed: ''Calc'') "
+                        "new named: ''calc'''.",
+                        "Workspace evaluate: 'Transcript show: ((KernelInstaller objectNamed: ''calc'') fact: 20) "
+                        "printString. Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: (1073741823 + 1) printString. "
+                        "Transcript show: (7 // -2) printString. Transcript show: (6 bitXor: 3) printString. "
+                        "Transcript show: (3 max: 9) printString. Transcript cr'.",
+                        "Workspace evaluate: '(KernelInstaller objectNamed: ''calc'') mod: 3 by: 0'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(temp_path / "build", example_path)
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=5.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertIn("2432902008176640000", output)
+            self.assertIn("1073741824-459", output)
+            self.assertIn("panic: integer division by zero", output)
+
+    def test_deep_sends_run_on_the_interpreter_activation_stack(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-deep-sends-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "deep.rz"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        "KernelInstaller fileInClassChunks: 'RecorzKernelClass: #Walker superclass: #Object "
+                        "instanceVariableNames: ''total''",
+                        "!",
+                        "sum: n into: acc",
+                        "    n = 0 ifTrue: [^acc].",
+                        "    ^self sum: n - 1 into: acc + n",
+                        "!",
+                        "depth: n",
+                        "    n = 0 ifTrue: [^0].",
+                        "    ^1 + (self depth: n - 1)",
+                        "'.",
+                        "Workspace evaluate: 'KernelInstaller rememberObject: (KernelInstaller classNamed: ''Walker'') "
+                        "new named: ''walker'''.",
+                        "Workspace evaluate: 'Transcript show: ((KernelInstaller objectNamed: ''walker'') "
+                        "sum: 40000 into: 0) printString. Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: ((KernelInstaller objectNamed: ''walker'') "
+                        "depth: 100) printString. Transcript cr'.",
+                        "Workspace evaluate: '(KernelInstaller objectNamed: ''walker'') depth: 100000'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(temp_path / "build", example_path)
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=5.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertIn("800020000\n100\n", output)
+            self.assertIn("panic: interpreter activation stack overflow", output)
+
+    def test_tail_send_keeps_the_sender_alive_for_block_arguments(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-tail-send-blocks-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "tail_send_blocks.rz"
+            class_source = (
+                "RecorzKernelClass: #TailBlockProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "countdown: n with: aBlock\n    n = 0 ifTrue: [aBlock value].\n"
+                "    ^self countdown: n - 1 with: aBlock\n!\n"
+                "countdownValue: n with: aBlock\n    n = 0 ifTrue: [^aBlock value].\n"
+                "    ^self countdownValue: n - 1 with: aBlock\n!\n"
+                "find: n\n    ^self countdown: n with: [^40]\n!\n"
+                "keep: n\n    | saved |\n    saved := 50.\n    ^self countdownValue: n with: [saved]\n!\n"
+                "startFind: n\n    | result |\n    result := self find: n.\n    ^result + 1\n!\n"
+                "startKeep: n\n    | result |\n    result := self keep: n.\n    ^result + 1"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            probe = "(KernelInstaller classNamed: ''TailBlockProbe'') new"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} startFind: 2) printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} startFind: 3000) printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} startKeep: 3000) printString. Transcript cr'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            output = _run_serial_to_completion(_build_elf(temp_path / "build", example_path))
+
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^41\n41\n51$")
+
+    def test_nested_blocks_read_arguments_and_assign_outer_temporaries_by_index(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-nested-block-scopes-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "nested_block_scopes.rz"
+            nested_body = (
+                "    | total count |\n"
+                "    total := 0.\n"
+                "    count := 0.\n"
+                "    self {each} [:i | | inner |\n"
+                "        inner := i * step.\n"
+                "        self {each} [:j | total := total + inner + j + base. count := count + 1]].\n"
+                "    ^total * 100 + count"
+            )
+            accumulate_body = (
+                "    | log |\n"
+                "    log := 0.\n"
+                "    self {each} [:i | | acc |\n"
+                "        acc := base.\n"
+                "        self {each} [:j | acc := acc + (i * j)].\n"
+                "        log := log + acc].\n"
+                "    ^log"
+            )
+            class_source = (
+                "RecorzKernelClass: #NestedScopeProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "each: aBlock\n"
+                "    aBlock value: 1.\n"
+                "    aBlock value: 2.\n"
+                "    aBlock value: 3.\n"
+                "    ^nil\n!\n"
+                f"nest: base by: step\n{nested_body.format(each='each:')}\n!\n"
+                f"accumulate: base\n{accumulate_body.format(each='each:')}\n!\n"
+                # lateEach: is not installed yet, so these two stay with the source evaluator.
+                f"lateNest: base by: step\n{nested_body.format(each='lateEach:')}\n!\n"
+                f"lateAccumulate: base\n{accumulate_body.format(each='lateEach:')}\n!\n"
+                "lateEach: aBlock\n"
+                "    aBlock value: 1.\n"
+                "    aBlock value: 2.\n"
+                "    aBlock value: 3.\n"
+                "    ^nil"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            probe = "(KernelInstaller classNamed: ''NestedScopeProbe'') new"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} nest: 10 by: 2) printString. Transcript cr. "
+                        f"Transcript show: ({probe} accumulate: 5) printString. Transcript cr. "
+                        f"Transcript show: ({probe} lateNest: 10 by: 2) printString. Transcript cr. "
+                        f"Transcript show: ({probe} lateAccumulate: 5) printString. Transcript cr'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            output = _run_serial_to_completion(_build_elf(temp_path / "build", example_path))
+
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^14409\n51\n14409\n51$")
+
+    def test_compiled_block_returns_through_callee_and_writes_outer_variables(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-compiled-blocks-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "compiled_blocks.rz"
+            class_source = (
+                "RecorzKernelClass: #BlockReturnProbe superclass: #Object instanceVariableNames: 'base'\n!\n"
+                "each: aBlock\n"
+                "    aBlock value: 1.\n"
+                "    aBlock value: 2.\n"
+                "    aBlock value: 3.\n"
+                "    aBlock value: 4.\n"
+                "    ^nil\n!\n"
+                "firstAbove: limit\n"
+                "    self each: [:each | each > limit ifTrue: [^each]].\n"
+                "    ^0\n!\n"
+                "sumDoubled\n"
+                "    | total |\n"
+                "    total := 0.\n"
+                "    base := 100.\n"
+                "    self each: [:each | | doubled | doubled := each + each. total := total + doubled + base].\n"
+                "    ^total"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            probe = "(KernelInstaller classNamed: ''BlockReturnProbe'') new"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} firstAbove: 2) printString. Transcript cr. "
+                        f"Transcript show: ({probe} firstAbove: 9) printString. Transcript cr. "
+                        f"Transcript show: {probe} sumDoubled printString. Transcript cr'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(temp_path / "build", example_path)
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=5.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^3\n0\n420$")
+            self.assertIn("recorz qemu-riscv32 mvp: rendered", output)
+
+    def test_compiled_live_methods_match_evaluated_results(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-compiled-live-methods-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "compiled_live_methods.rz"
+            class_source = (
+                "RecorzKernelClass: #CompiledProbe superclass: #Object instanceVariableNames: 'items'\n!\n"
+                "temps\n    | a b |\n    a := 3.\n    b := a + 4.\n    ^a * b\n!\n"
+                "bump\n    items := items + 1.\n    ^self\n!\n"
+                "add: n\n    items := items + n.\n    ^self\n!\n"
+                "total\n    ^items\n!\n"
+                "me\n    ^self\n!\n"
+                "cascade\n    items := 0.\n    ^self bump; bump; bump; total\n!\n"
+                "mixedCascade\n    items := 0.\n    ^self me add: 2; bump; add: 3 + 4; total\n!\n"
+                "branchingCascade\n    items := 0.\n    ^self add: (items > 0 ifTrue: [5] ifFalse: [1]); add: 2; total\n!\n"
+                "blocks\n    | base |\n    base := 10.\n    [ base := base + 5 ] value.\n    ^[ base := base + 7. base ] value\n!\n"
+                "choose: n\n    ^n > 2 ifTrue: ['big'] ifFalse: ['small']\n!\n"
+                "onlyTrue: n\n    ^n > 2 ifTrue: ['yes']\n!\n"
+                "countdown: n into: acc\n    n = 0 ifTrue: [^acc].\n    ^self countdown: n - 1 into: acc + n\n!\n"
+                "repeat: n with: aBlock\n    n = 0 ifTrue: [^nil].\n    aBlock value: n.\n    ^self repeat: n - 1 with: aBlock\n!\n"
+                "loop: n\n    | total |\n    total := 0.\n    self repeat: n with: [:i | total := total + i].\n    ^total\n!\n"
+                "truth: x\n    ^x ifTrue: ['t'] ifFalse: ['f']"
+            )
+            truthy_source = (
+                "RecorzKernelClass: #TruthyProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "mustBeBoolean\n    ^true"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            escaped_truthy_source = truthy_source.replace("'", "''")
+            probe = "(KernelInstaller classNamed: ''CompiledProbe'') new"
+            truthy = "(KernelInstaller classNamed: ''TruthyProbe'') new"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_truthy_source}'.",
+                        f"Workspace evaluate: 'Transcript show: {probe} temps printString. Transcript cr'.",
+                        "Workspace evaluate: '| a b | a := 3. b := a + 4. Transcript show: (a * b) printString. "
+                        "Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: {probe} blocks printString. Transcript cr'.",
+                        "Workspace evaluate: '| base | base := 10. [ base := base + 5 ] value. "
+                        "Transcript show: ([ base := base + 7. base ] value) printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} choose: 3). Transcript show: ({probe} choose: 1). "
+                        f"Transcript show: (({probe} onlyTrue: 1) = nil ifTrue: [''none''] ifFalse: [''some'']). "
+                        "Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: (3 > 2 ifTrue: [''big''] ifFalse: [''small'']). "
+                        "Transcript show: (1 > 2 ifTrue: [''big''] ifFalse: [''small'']). "
+                        "Transcript show: ((1 > 2 ifTrue: [''yes'']) = nil ifTrue: [''none''] ifFalse: [''some'']). "
+                        "Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} truth: {truthy}). Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({truthy} ifTrue: [''t''] ifFalse: [''f'']). "
+                        "Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} countdown: 100 into: 0) printString. "
+                        f"Transcript cr. Transcript show: ({probe} loop: 100) printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: {probe} cascade printString. Transcript cr. "
+                        f"Transcript show: {probe} mixedCascade printString. Transcript cr. "
+                        f"Transcript show: {probe} branchingCascade printString. Transcript cr'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            output = _run_serial_to_completion(_build_elf(temp_path / "build", example_path))
+
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^21\n21\n22\n22\nbigsmallnone\nbigsmallnone\nt\nt\n5050\n5050\n3\n10\n3$")
+
+    def test_tagged_values_keep_small_integer_bounds_and_identity(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-tagged-values-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "tagged_values.rz"
+            class_source = (
+                "RecorzKernelClass: #TaggedValueProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "largest\n    ^1073741823\n!\n"
+                "smallest\n    ^-1073741824\n!\n"
+                "pastLargest\n    ^self largest + 1"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            probe = "(KernelInstaller classNamed: ''TaggedValueProbe'') new"
+            conditions = [
+                "nil = nil",
+                "true = true",
+                "false = false",
+                "true = false",
+                "nil = false",
+                "0 = nil",
+                "0 = false",
+                "''abc'' = ''abc''",
+                "''abc'' = ''abd''",
+                "''abc'' = nil",
+                "-1073741824 = -1073741824",
+                "1073741823 > -1073741824",
+                "Transcript = nil",
+                "Transcript = Display",
+                "Transcript = Transcript",
+            ]
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        "Workspace evaluate: 'Transcript show: 1073741823 printString. Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: -1073741824 printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: {probe} largest printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: {probe} smallest printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: {probe} pastLargest printString. Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: (1073741823 + 1 - 1) printString. Transcript cr'.",
+                        "Workspace evaluate: 'Transcript show: (-1073741824 * -1) printString. Transcript cr'.",
+                        *[
+                            f"Workspace evaluate: 'Transcript show: (({condition}) ifTrue: [''t''] ifFalse: [''f''])'."
+                            for condition in conditions
+                        ],
+                        "Workspace evaluate: 'Transcript cr'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            output = _run_serial_to_completion(_build_elf(temp_path / "build", example_path))
+
+            self.assertNotIn("panic:", output)
+            self.assertRegex(
+                output,
+                r"(?m)^1073741823\n-1073741824\n1073741823\n-1073741824\n1073741824\n1073741823\n1073741824\n"
+                r"tttfffftffttfft$",
+            )
+
+    def test_this_context_sender_reifies_a_lazy_caller_activation(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-lazy-context-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "lazy_context.rz"
+            class_source = (
+                "RecorzKernelClass: #LazyContextProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "relay\n    ^self report\n!\n"
+                "report\n    ^thisContext sender detail"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        "Workspace evaluate: 'Transcript show: (KernelInstaller classNamed: ''LazyContextProbe'') "
+                        "new relay. Transcript cr'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(temp_path / "build", example_path)
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=5.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^relay$")
+            self.assertIn("recorz qemu-riscv32 mvp: rendered", output)
+
+    def test_dev_profile_automatic_gc_reclaims_reinstalled_method_garbage_before_heap_overflow(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-gc-method-reinstall-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "automatic_gc_method_reinstall.rz"
+            repeated_source = ["RecorzKernelClass: #GcProbe superclass: #Object\n!\n"]
+            repeated_source.extend(
+                "contents\n    ^'x'\n!\n"
+                for _ in range(1024)
+            )
+            example_path.write_text(
+                "KernelInstaller fileInClassChunks: '"
+                + "".join(repeated_source).replace("'", "''")
+                + "'.\n"
+                + "Transcript show: KernelInstaller memoryReport.",
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(
+                temp_path / "build",
+                example_path,
+                profile="dev",
+            )
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                try:
+                    output, _ = process.communicate(timeout=18.0)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    output, _ = process.communicate(timeout=5.0)
+            finally:
+                if process.stdout is not None:
+                    process.stdout.close()
+
+            output = output.replace("\r", "")
+            self.assertIn("MEMORY", output)
+            self.assertIn("recorz qemu-riscv32 mvp: created class GcProbe", output)
+            self.assertNotIn("panic: object heap overflow", output)
+            self.assertNotIn("panic: class method range contains a non-method descriptor", output)
+            gc_count_match = re.search(r"GCC (\d+)", output)
+            total_reclaimed_match = re.search(r"GCT (\d+)", output)
+            heap_match = re.search(r"HEAP (\d+)/(\d+)", output)
+            high_water_match = re.search(r"HWM (\d+)/(\d+)", output)
+            self.assertIsNotNone(gc_count_match, output)
+            self.assertIsNotNone(total_reclaimed_match, output)
+            self.assertIsNotNone(heap_match, output)
+            self.assertIsNotNone(high_water_match, output)
+            self.assertGreater(int(gc_count_match.group(1)), 0, output)
+            self.assertGreater(int(total_reclaimed_match.group(1)), 0, output)
+            self.assertGreater(int(high_water_match.group(1)), int(heap_match.group(1)), output)
+
+    def test_switch_dispatch_build_runs_the_same_workload_as_threaded_dispatch(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-switch-dispatch-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "switch_dispatch.rz"
+            class_source = (
+                "RecorzKernelClass: #DispatchProbe superclass: #Object instanceVariableNames: 'total'\n!\n"
+                "sumTo: n\n    n = 0 ifTrue: [^0].\n    ^n + (self sumTo: n - 1)\n!\n"
+                "countDown: n from: acc\n    n = 0 ifTrue: [^acc].\n    ^self countDown: n - 1 from: acc + 2\n!\n"
+                "firstOver: limit\n    | probe |\n    probe := [:x | x > limit ifTrue: [^x]. x].\n"
+                "    probe value: limit - 1.\n    probe value: limit + 7.\n    ^0\n!\n"
+                "scaled: n\n    | factor block |\n    factor := 3.\n    block := [:x | total := x * factor].\n"
+                "    block value: n.\n    ^total"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            probe = "(KernelInstaller classNamed: ''DispatchProbe'') new"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} sumTo: 200) printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} countDown: 5000 from: 1) printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} firstOver: 40) printString. Transcript cr'.",
+                        f"Workspace evaluate: 'Transcript show: ({probe} scaled: 14) printString. Transcript cr'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            outputs = {
+                dispatch: _run_serial_to_completion(
+                    _build_elf(temp_path / f"build-{dispatch}", example_path, dispatch=dispatch)
+                )
+                for dispatch in ("threaded", "switch")
+            }
+
+            for output in outputs.values():
+                self.assertNotIn("panic:", output)
+                self.assertRegex(output, r"(?m)^20100\n10001\n47\n42$")
+            self.assertEqual(outputs["threaded"], outputs["switch"])
+
+    def test_long_do_it_collects_at_bytecode_safepoints_before_heap_overflow(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-gc-safepoint-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "gc_safepoint.rz"
+            class_source = (
+                "RecorzKernelClass: #ChurnProbe superclass: #Object instanceVariableNames: 'keep'\n!\n"
+                "keep\n    keep := (KernelInstaller classNamed: 'Array') new: 2.\n    keep at: 1 put: 'KEPT'.\n    ^self\n!\n"
+                "churn: n\n    n = 0 ifTrue: [^keep at: 1].\n    (KernelInstaller classNamed: 'Array') new: 4.\n"
+                "    ^self churn: n - 1"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        "Workspace evaluate: 'Transcript show: ((KernelInstaller classNamed: ''ChurnProbe'') new keep "
+                        "churn: 40000). Transcript cr'.",
+                        "Transcript show: KernelInstaller memoryReport.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            output = _run_serial_to_completion(_build_elf(temp_path / "build", example_path, profile="dev"))
+
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^KEPT$")
+            gc_count_match = re.search(r"GCC (\d+)", output)
+            self.assertIsNotNone(gc_count_match, output)
+            self.assertGreater(int(gc_count_match.group(1)), 40000 // 16384, output)
+
+    def test_object_moved_into_a_fresh_object_during_an_incremental_mark_survives_the_cycle(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-gc-incremental-barrier-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "gc_incremental_barrier.rz"
+            retained_lines = "".join(f"    holder at: {index} put: (self array: 2000).\n" for index in range(2, 11))
+            released_lines = "".join(f"    holder at: {index} put: nil.\n" for index in range(2, 12))
+            class_source = (
+                "RecorzKernelClass: #IncrementalMarkProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "array: size\n    ^(KernelInstaller classNamed: 'Array') new: size\n!\n"
+                "holder\n    ^KernelInstaller objectNamed: 'IncrementalMarkHolder'\n!\n"
+                "survivor\n    | survivor |\n    survivor := self array: 1.\n"
+                "    survivor at: 1 put: 'SURVIVED'.\n    ^survivor\n!\n"
+                "box\n    | box |\n    box := self array: 1.\n    box at: 1 put: self survivor.\n    ^box\n!\n"
+                "setUp\n    | holder |\n    holder := self array: 16.\n"
+                "    KernelInstaller rememberObject: holder named: 'IncrementalMarkHolder'.\n"
+                "    holder at: 1 put: self box.\n"
+                f"{retained_lines}"
+                "    holder at: 11 put: (self array: 200).\n"
+                f"{released_lines}"
+                "    self array: 2400.\n    ^self\n!\n"
+                "move\n    | holder fresh |\n    holder := self holder.\n"
+                "    holder at: 13 put: KernelInstaller memoryReport.\n"
+                "    fresh := self array: 1.\n"
+                "    fresh at: 1 put: ((holder at: 1) at: 1).\n"
+                "    (holder at: 1) at: 1 put: nil.\n"
+                "    holder at: 16 put: fresh.\n    ^self\n!\n"
+                "finish\n    self holder at: 14 put: KernelInstaller memoryReport.\n"
+                "    self array: 4000.\n    self array: 4000.\n    ^self\n!\n"
+                "report\n    | holder |\n    holder := self holder.\n"
+                "    Transcript show: 'AT MOVE'.\n    Transcript cr.\n    Transcript show: (holder at: 13).\n"
+                "    Transcript show: 'AFTER YIELDS'.\n    Transcript cr.\n    Transcript show: (holder at: 14).\n"
+                "    Transcript show: (((holder at: 16) at: 1) at: 1).\n    Transcript cr.\n    ^self"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            mover_source = (
+                "| probe | probe := (KernelInstaller classNamed: ''IncrementalMarkProbe'') new. "
+                "Workspace yield. probe move. " + "Workspace yield. " * 17
+            )
+            yielder_source = "Workspace yield. " * 20
+            probe = "(KernelInstaller classNamed: 'IncrementalMarkProbe') new"
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        f"Workspace spawnProcessNamed: 'MarkMover' source: '{mover_source}'.",
+                        f"Workspace spawnProcessNamed: 'MarkYielder1' source: '{yielder_source}'.",
+                        f"Workspace spawnProcessNamed: 'MarkYielder2' source: '{yielder_source}'.",
+                        "Workspace setContents: ''.",
+                        "Workspace interactiveInputMonitor.",
+                        "Workspace evaluate: '" + f"{probe} report".replace("'", "''") + "'.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            elf_path = _build_elf(temp_path / "build", example_path, profile="dev")
+            process = subprocess.Popen(
+                [
+                    "qemu-system-riscv32",
+                    "-machine",
+                    "virt",
+                    "-m",
+                    "32M",
+                    "-smp",
+                    "1",
+                    "-kernel",
+                    str(elf_path),
+                    "-serial",
+                    "stdio",
+                    "-monitor",
+                    "none",
+                    "-display",
+                    "none",
+                    "-device",
+                    "ramfb",
+                ],
+                cwd=ROOT,
+                stdin=subprocess.PIPE,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                text=True,
+            )
+            try:
+                output = _read_until(process, "VIEW: INPUT", timeout=8.0)
+                if process.stdin is None:
+                    self.fail("QEMU process stdin is not available")
+                process.stdin.write(
+                    f"KernelInstaller garbageCollect. {probe} setUp. "
+                    "(KernelInstaller objectNamed: 'MarkMover') resume. "
+                    "(KernelInstaller objectNamed: 'MarkYielder1') resume. "
+                    "(KernelInstaller objectNamed: 'MarkYielder2') resume. "
+                    f"{probe} finish\x04\x0f"
+                )
+                process.stdin.flush()
+                output += _read_until_any(process, ("SURVIVED", "panic:"), timeout=30.0)
+            finally:
+                if process.poll() is None:
+                    process.kill()
+                    process.wait(timeout=5.0)
+                if process.stdout is not None:
+                    process.stdout.close()
+                if process.stdin is not None:
+                    process.stdin.close()
+
+            output = output.replace("\r", "")
+            self.assertNotIn("panic:", output)
+            self.assertIn("AT MOVE", output)
+            at_move, after_yields = output.split("AT MOVE", 1)[1].split("AFTER YIELDS", 1)
+
+            def memory_stat(text: str, name: str) -> int:
+                match = re.search(rf"(?m)^{name} (\d+)$", text)
+                self.assertIsNotNone(match, output)
+                return int(match.group(1))
+
+            self.assertGreater(memory_stat(at_move, "GCI"), 0, output)
+            self.assertEqual(memory_stat(after_yields, "GCC"), memory_stat(at_move, "GCC") + 1, output)
+            self.assertEqual(memory_stat(after_yields, "GCM"), memory_stat(at_move, "GCM"), output)
+            self.assertGreater(memory_stat(after_yields, "GCI"), memory_stat(at_move, "GCI"), output)
+            self.assertRegex(after_yields, r"(?m)^SURVIVED$")
+
+    def test_reinstalled_and_overriding_methods_replace_warm_method_cache_entries(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-method-cache-reinstall-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "method_cache_reinstall.rz"
+            probe_source = (
+                "RecorzKernelClass: #CacheProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "answer\n    ^1\n!\n"
+                "ask\n    ^self answer"
+            )
+            child_source = (
+                "RecorzKernelClass: #CacheChild superclass: #CacheProbe instanceVariableNames: ''\n!\n"
+                "label\n    ^'child'"
+            )
+            ask_line = (
+                "Workspace evaluate: 'Transcript show: ((KernelInstaller classNamed: ''CacheProbe'') new ask * 10 + "
+                "(KernelInstaller classNamed: ''CacheChild'') new ask) printString. Transcript cr'."
+            )
+            example_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        "KernelInstaller fileInClassChunks: '" + probe_source.replace("'", "''") + "'.",
+                        "KernelInstaller fileInClassChunks: '" + child_source.replace("'", "''") + "'.",
+                        ask_line,
+                        ask_line,
+                        "KernelInstaller fileInMethodChunks: 'answer",
+                        "    ^2",
+                        "!' onClass: (KernelInstaller classNamed: 'CacheProbe').",
+                        ask_line,
+                        "KernelInstaller fileInMethodChunks: 'answer",
+                        "    ^3",
+                        "!' onClass: (KernelInstaller classNamed: 'CacheChild').",
+                        ask_line,
+                        "Transcript show: KernelInstaller memoryReport.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            output = _run_serial_to_completion(_build_elf(temp_path / "build", example_path, profile="dev"))
+
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^11\n11\n22\n23$")
+            hit_match = re.search(r"MCH (\d+)", output)
+            self.assertIsNotNone(hit_match, output)
+            self.assertGreater(int(hit_match.group(1)), 0, output)
+
+    def test_send_site_dispatches_each_receiver_class_once_it_turns_polymorphic(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-polymorphic-send-site-") as temp_dir:
+            temp_path = Path(temp_dir)
+            example_path = temp_path / "polymorphic_send_site.rz"
+            receiver_classes = (
+                ("PolyOne", "Object", "answer\n    ^1"),
+                ("PolyTwo", "Object", "answer\n    ^2"),
+                ("PolyThree", "Object", "answer\n    ^3"),
+                ("PolyFour", "Object", "answer\n    ^4"),
+                ("PolyFive", "Object", "answer\n    ^5"),
+                ("PolySix", "PolyOne", "label\n    ^'six'"),
+                ("PolySeven", "PolyTwo", "answer\n    ^7"),
+            )
+            class_names = [name for name, _, _ in receiver_classes]
+
+            def digits_method(selector: str, names: list[str]) -> str:
+                appends = "".join(f"    digits := self append: '{name}' to: digits.\n" for name in names)
+                return f"{selector}\n    | digits |\n    digits := 0.\n{appends}    ^digits"
+
+            probe_source = "\n!\n".join(
+                [
+                    "RecorzKernelClass: #PolyProbe superclass: #Object instanceVariableNames: ''",
+                    "ask: receiver\n    ^receiver answer",
+                    "append: name to: digits\n    ^digits * 10 + (self ask: (KernelInstaller classNamed: name) new)",
+                    digits_method("forward", class_names),
+                    digits_method("backward", list(reversed(class_names))),
+                ]
+            )
+            lines = ["Display clear."]
+            for name, superclass_name, method_source in receiver_classes:
+                class_source = (
+                    f"RecorzKernelClass: #{name} superclass: #{superclass_name} instanceVariableNames: ''\n!\n"
+                    f"{method_source}"
+                )
+                lines.append("KernelInstaller fileInClassChunks: '" + class_source.replace("'", "''") + "'.")
+            lines.append("KernelInstaller fileInClassChunks: '" + probe_source.replace("'", "''") + "'.")
+            sweep_line = (
+                "Workspace evaluate: 'Transcript show: (KernelInstaller classNamed: ''PolyProbe'') new forward printString. "
+                "Transcript cr. Transcript show: (KernelInstaller classNamed: ''PolyProbe'') new backward printString. "
+                "Transcript cr'."
+            )
+            lines.extend([sweep_line, sweep_line, "Transcript show: KernelInstaller memoryReport."])
+            example_path.write_text("\n".join(lines), encoding="utf-8")
+            output = _run_serial_to_completion(_build_elf(temp_path / "build", example_path, profile="dev"))
+
+            self.assertNotIn("panic:", output)
+            self.assertRegex(output, r"(?m)^1234517\n7154321\n1234517\n7154321$")
+            hit_match = re.search(r"ICH (\d+)", output)
+            self.assertIsNotNone(hit_match, output)
+            self.assertGreater(int(hit_match.group(1)), 0, output)
 
     def test_in_image_source_compiler_supports_multistatement_methods_and_unary_expression_chains(self) -> None:
         with tempfile.TemporaryDirectory(prefix="qemu-riscv32-multistatement-source-") as temp_dir:
@@ -985,7 +985,7 @@ class QemuRiscv32SnapshotIntegrationTests(unittest.TestCase):
         self.assertIsInstance(header, dict)
         assert isinstance(header, dict)
         self.assertEqual(header["compatibility_profile"], "RV32MVP1")
-        self.assertEqual(header["compatibility_label"], "RV32MVP1 snapshot format v10")
+        self.assertEqual(header["compatibility_label"], "RV32MVP1 snapshot format v13")
         self.assertEqual(header["active_cursor_visible"], 1)
         self.assertEqual(header["active_cursor_x"], 12)
         self.assertEqual(header["active_cursor_y"], 34)
@@ -1030,7 +1030,7 @@ class QemuRiscv32SnapshotIntegrationTests(unittest.TestCase):
             )
             self.assertNotEqual(result.returncode, 0)
             self.assertIn(
-                "snapshot version mismatch: expected RV32MVP1 snapshot format v10, found v6. "
+                "snapshot version mismatch: expected RV32MVP1 snapshot format v13, found v6. "
                 "stale dev snapshots can usually be recovered with dev-restore or replaced with dev-reset",
                 result.stderr,
             )
@@ -1076,7 +1076,7 @@ class QemuRiscv32SnapshotIntegrationTests(unittest.TestCase):
                 if qemu_process.stdout is not None:
                     qemu_process.stdout.close()
             self.assertIn(
-                "snapshot version mismatch: expected RV32MVP1 snapshot v10; stale dev snapshot, use dev-reset or dev-restore",
+                "snapshot version mismatch: expected RV32MVP1 snapshot v13; stale dev snapshot, use dev-reset or dev-restore",
                 panic_output,
             )
             self.assertIn("vm: phase=snapshot", panic_output)
@@ -2861,5 +2861,207 @@ class QemuRiscv32SnapshotIntegrationTests(unittest.TestCase):
         self.assertGreater(line_5[TEXT_FOREGROUND], 300)
 
 
+    def run_with_snapshot_disk(self, *, build_dir: Path, example_path: Path, disk_path: Path) -> str:
+        elf_path = self.build_elf(build_dir=build_dir, example_path=example_path)
+        process = subprocess.Popen(
+            [
+                "qemu-system-riscv32",
+                "-machine",
+                "virt",
+                "-m",
+                "32M",
+                "-smp",
+                "1",
+                "-kernel",
+                str(elf_path),
+                "-serial",
+                "stdio",
+                "-monitor",
+                "none",
+                "-display",
+                "none",
+                "-device",
+                "ramfb",
+                "-drive",
+                f"file={disk_path},if=none,format=raw,id=recorzsnapshot",
+                "-device",
+                "virtio-blk-device,drive=recorzsnapshot",
+            ],
+            cwd=ROOT,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.STDOUT,
+            text=True,
+        )
+        try:
+            try:
+                output, _ = process.communicate(timeout=SNAPSHOT_SERIAL_TIMEOUT)
+            except subprocess.TimeoutExpired:
+                process.kill()
+                output, _ = process.communicate(timeout=5.0)
+        finally:
+            if process.stdout is not None:
+                process.stdout.close()
+        return output.replace("\r", "")
+
+    def test_snapshot_disk_checkpoint_parks_the_running_process_and_keeps_the_session_alive(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-snapshot-disk-checkpoint-") as temp_dir:
+            temp_path = Path(temp_dir)
+            disk_path = temp_path / "live.disk"
+            disk_path.write_bytes(bytes(1024 * 1024))
+            save_path = temp_path / "checkpoint.rz"
+            save_path.write_text(
+                "\n".join(
+                    [
+                        "| process |",
+                        "process := Workspace spawnProcessNamed: 'Saver' source: 'Transcript show: ''BEFORE''. "
+                        "KernelInstaller saveSnapshot. Transcript show: ''AFTER''.'.",
+                        "process resume.",
+                        "Transcript cr.",
+                        "Transcript show: 'MAIN DONE'; cr.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            resume_path = temp_path / "resume.rz"
+            resume_path.write_text(
+                "\n".join(
+                    [
+                        "Transcript show: (Workspace objectDetailNamed: 'Saver'); cr.",
+                        "(KernelInstaller objectNamed: 'Saver') resume.",
+                        "Transcript cr.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+
+            save_log = self.run_with_snapshot_disk(
+                build_dir=temp_path / "save", example_path=save_path, disk_path=disk_path
+            )
+            self.assertIn("recorz-snapshot-stored ", save_log)
+            self.assertIn("recorz qemu-riscv32 mvp: snapshot checkpointed", save_log)
+            self.assertIn("AFTER\nMAIN DONE\n", save_log)
+            self.assertNotIn("recorz-snapshot-data", save_log)
+            self.assertNotIn("panic:", save_log)
+
+            resume_log = self.run_with_snapshot_disk(
+                build_dir=temp_path / "resume", example_path=resume_path, disk_path=disk_path
+            )
+            self.assertIn("recorz qemu-riscv32 mvp: loaded snapshot", resume_log)
+            self.assertIn("state: runnable", resume_log)
+            self.assertIn("AFTER", resume_log)
+            self.assertNotIn("panic:", resume_log)
+
+    def test_nested_block_scopes_resolve_after_a_snapshot_round_trip(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-snapshot-nested-block-scopes-") as temp_dir:
+            temp_path = Path(temp_dir)
+            disk_path = temp_path / "live.disk"
+            disk_path.write_bytes(bytes(1024 * 1024))
+            class_source = (
+                "RecorzKernelClass: #SavedScopeProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "each: aBlock\n    aBlock value: 1.\n    aBlock value: 2.\n    aBlock value: 3.\n    ^nil\n!\n"
+                "nest: base by: step\n"
+                "    | total count |\n"
+                "    total := 0.\n"
+                "    count := 0.\n"
+                "    self each: [:i | | inner |\n"
+                "        inner := i * step.\n"
+                "        self each: [:j | total := total + inner + j + base. count := count + 1]].\n"
+                "    ^total * 100 + count\n!\n"
+                "lateAccumulate: base\n"
+                "    | log |\n"
+                "    log := 0.\n"
+                "    self lateEach: [:i | | acc |\n"
+                "        acc := base.\n"
+                "        self lateEach: [:j | acc := acc + (i * j)].\n"
+                "        log := log + acc].\n"
+                "    ^log\n!\n"
+                "lateEach: aBlock\n    aBlock value: 1.\n    aBlock value: 2.\n    aBlock value: 3.\n    ^nil"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            probe = "(KernelInstaller classNamed: ''SavedScopeProbe'') new"
+            run_probe = (
+                f"Workspace evaluate: 'Transcript show: ({probe} nest: 10 by: 2) printString. Transcript cr. "
+                f"Transcript show: ({probe} lateAccumulate: 5) printString. Transcript cr'."
+            )
+            save_path = temp_path / "save.rz"
+            save_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        run_probe,
+                        "KernelInstaller saveSnapshot.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            resume_path = temp_path / "resume.rz"
+            resume_path.write_text(run_probe + "\n", encoding="utf-8")
+
+            save_log = self.run_with_snapshot_disk(
+                build_dir=temp_path / "save", example_path=save_path, disk_path=disk_path
+            )
+            self.assertIn("14409\n51\n", save_log)
+            self.assertIn("recorz qemu-riscv32 mvp: snapshot checkpointed", save_log)
+            self.assertNotIn("panic:", save_log)
+
+            resume_log = self.run_with_snapshot_disk(
+                build_dir=temp_path / "resume", example_path=resume_path, disk_path=disk_path
+            )
+            self.assertIn("recorz qemu-riscv32 mvp: loaded snapshot", resume_log)
+            self.assertIn("14409\n51\n", resume_log)
+            self.assertNotIn("panic:", resume_log)
+
+    def test_snapshot_disk_checkpoint_returns_into_the_method_and_restores_the_session_startup_hook(self) -> None:
+        with tempfile.TemporaryDirectory(prefix="qemu-riscv32-snapshot-disk-checkpoint-hook-") as temp_dir:
+            temp_path = Path(temp_dir)
+            disk_path = temp_path / "live.disk"
+            disk_path.write_bytes(bytes(1024 * 1024))
+            class_source = (
+                "RecorzKernelClass: #CheckpointProbe superclass: #Object instanceVariableNames: ''\n!\n"
+                "filler\n    ^'aaaaaaaaaaaaaaaaaaaaaaaaaaaaa' size + 1 + 2 + 3 + 4 + 5 + 6 + 7 + 8\n!\n"
+                "checkpoint\n    | before after |\n    before := 'before checkpoint'.\n"
+                "    KernelInstaller saveSnapshot.\n    after := 'after checkpoint'.\n"
+                "    Transcript show: before; cr.\n    Transcript show: after; cr.\n"
+                "    Transcript show: (3 + 4) printString; cr.\n    ^self\n!\n"
+                "filler\n    ^1\n!\n"
+                "run\n    | kept |\n    kept := 'kept across checkpoint'.\n    self checkpoint.\n"
+                "    Transcript show: kept; cr.\n    ^self"
+            )
+            escaped_class_source = class_source.replace("'", "''")
+            save_path = temp_path / "checkpoint.rz"
+            save_path.write_text(
+                "\n".join(
+                    [
+                        "Display clear.",
+                        f"KernelInstaller fileInClassChunks: '{escaped_class_source}'.",
+                        "Workspace saveAndReopen.",
+                        "Workspace evaluate: '(KernelInstaller classNamed: ''CheckpointProbe'') new run'.",
+                        "Transcript show: 'SAVED'; cr.",
+                    ]
+                ),
+                encoding="utf-8",
+            )
+            resume_path = temp_path / "resume.rz"
+            resume_path.write_text("Transcript show: 'RELOADED'; cr.\n", encoding="utf-8")
+
+            save_log = self.run_with_snapshot_disk(
+                build_dir=temp_path / "save", example_path=save_path, disk_path=disk_path
+            )
+            self.assertIn(
+                "before checkpoint\nafter checkpoint\n7\nkept across checkpoint\nSAVED\n",
+                save_log,
+            )
+            self.assertNotIn("panic:", save_log)
+
+            resume_log = self.run_with_snapshot_disk(
+                build_dir=temp_path / "resume", example_path=resume_path, disk_path=disk_path
+            )
+            self.assertIn("recorz qemu-riscv32 mvp: loaded snapshot", resume_log)
+            self.assertIn("RELOADED", resume_log)
+            self.assertNotIn("WORKSPACE", resume_log)
+            self.assertNotIn("panic:", resume_log)
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -1,4 +1,6 @@
+import os
 import re
+import subprocess
 import sys
 import struct
 import unittest
@@ -22,6 +24,21 @@ def _workspace_tool_primitive_bindings() -> list[str]:
     return [match.group("binding") for match in WORKSPACE_TOOL_PRIMITIVE_PATTERN.finditer(source)]
 
 
+def _run_builder_for_target(target: str, script: str) -> str:
+    env = dict(os.environ)
+    env[mvp.TARGET_ENV] = target
+    env["PYTHONPATH"] = os.pathsep.join([str(ROOT / "tools"), str(ROOT / "src")])
+    completed = subprocess.run(
+        [sys.executable, "-c", "import build_qemu_riscv_mvp_image as mvp\n" + script],
+        cwd=ROOT,
+        env=env,
+        check=True,
+        capture_output=True,
+        text=True,
+    )
+    return completed.stdout
+
+
 class QemuRiscvMvpLoweringTests(unittest.TestCase):
     def test_lowers_transcript_show_and_cr(self) -> None:
         program = mvp.build_program("Transcript show: 'HELLO'; cr")
@@ -54,7 +71,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertIn((mvp.LITERAL_SMALL_INTEGER, 480), [(literal.kind, literal.value) for literal in program.literals])
         self.assertIn(mvp.OP_STORE_LEXICAL, [instruction.opcode for instruction in program.instructions])
         self.assertIn(mvp.OP_PUSH_LEXICAL, [instruction.opcode for instruction in program.instructions])
-        self.assertIn("RECORZ_MVP_SELECTOR_MULTIPLY", [instruction.operand_a for instruction in program.instructions if instruction.opcode == mvp.OP_SEND])
+        self.assertIn(mvp.OPCODE_CONSTANT_NAMES["send_multiply"], [instruction.opcode for instruction in program.instructions])
         self.assertIn("RECORZ_MVP_SELECTOR_PRINT_STRING", [instruction.operand_a for instruction in program.instructions if instruction.opcode == mvp.OP_SEND])
 
     def test_builds_program_manifest_with_top_level_lexical_names(self) -> None:
@@ -305,7 +322,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertIn("RECORZ_MVP_SELECTOR_BITS", selectors)
         self.assertIn("RECORZ_MVP_SELECTOR_WIDTH", selectors)
         self.assertIn("RECORZ_MVP_SELECTOR_HEIGHT", selectors)
-        self.assertIn("RECORZ_MVP_SELECTOR_MULTIPLY", selectors)
+        self.assertIn(mvp.OPCODE_CONSTANT_NAMES["send_multiply"], [instruction.opcode for instruction in program.instructions])
 
     def test_lowers_heap_object_class_introspection(self) -> None:
         program = mvp.build_program(
@@ -533,9 +550,17 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 ["width", "height", "storageKind", "storageId"],
                 "width ^width",
             ),
+            [mvp.encode_compiled_method_instruction("return_field", 0)],
+        )
+        self.assertEqual(
+            mvp.compile_kernel_method_program(
+                "Bitmap",
+                ["width", "height", "storageKind", "storageId"],
+                "height: aNumber height := aNumber. ^self",
+            ),
             [
-                mvp.encode_compiled_method_instruction("push_field", 0),
-                mvp.encode_compiled_method_instruction("return_top"),
+                mvp.encode_compiled_method_instruction("store_field_from_argument", 1, 0),
+                mvp.encode_compiled_method_instruction("return_receiver"),
             ],
         )
         self.assertEqual(
@@ -610,9 +635,11 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertEqual(
             {source.relative_path for source in sources.values()},
             {
+                "Array.rz",
                 "BitBlt.rz",
                 "Bitmap.rz",
                 "BitmapFactory.rz",
+                "ByteArray.rz",
                 "Class.rz",
                 "CharacterScanner.rz",
                 "Context.rz",
@@ -642,6 +669,8 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 "WorkspaceReturnState.rz",
                 "WorkspaceDebuggerModel.rz",
                 "WorkspaceTool.rz",
+                "WordArray.rz",
+                "LargePositiveInteger.rz",
             },
         )
         self.assertEqual(transcript_show.class_name, "Transcript")
@@ -922,7 +951,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertEqual(mvp.RUNTIME_SPEC_PATH.name, "runtime_spec.json")
         self.assertEqual(mvp.RUNTIME_SPEC["program"]["magic"], "RCZP")
         self.assertEqual(mvp.RUNTIME_SPEC["image"]["profile"], "RV64MVP1")
-        self.assertEqual(mvp.RUNTIME_SPEC["seed"]["version"], 16)
+        self.assertEqual(mvp.RUNTIME_SPEC["seed"]["version"], 17)
         self.assertEqual(
             mvp.OPCODE_VALUES,
             mvp.build_constant_value_map_from_explicit_specs(mvp.OPCODE_SPEC),
@@ -987,34 +1016,34 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["formBeDisplay"], 17)
         self.assertEqual(
             mvp.PRIMITIVE_BINDING_VALUES["kernelInstallerInstallCompiledMethodOnClassSelectorIdArgumentCount"],
-            20,
+            21,
         )
         self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["formWriteStyledText"], 14)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceSetCurrentViewKind"], 35)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceSetCurrentTargetName"], 36)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceObjectDetailNamed"], 48)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceContextFrameAtNamed"], 53)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceDebugFrameCount"], 54)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceDebugFrameListFrom"], 55)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceDebugFrameDetailAt"], 56)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceProcessCount"], 57)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceProcessNameAt"], 58)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceProcessLabelsVisibleFromCount"], 59)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceSpawnProcessNamedSource"], 60)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceYield"], 61)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceContextFrameSummariesVisibleFromCountNamed"], 62)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceRuntimeMetadata"], 71)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspacePackageCount"], 72)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceVisibleContentsTopLinesColumns"], 75)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceVisibleContentsTopLeftLinesColumns"], 76)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceBrowseInteractiveViews"], 93)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["textStyleWithText"], 115)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processSetLabelStateContext"], 128)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processSuspend"], 129)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processResume"], 130)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processStepInto"], 131)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processStepOver"], 132)
-        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processTerminate"], 133)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceSetCurrentViewKind"], 37)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceSetCurrentTargetName"], 38)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceObjectDetailNamed"], 50)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceContextFrameAtNamed"], 55)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceDebugFrameCount"], 56)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceDebugFrameListFrom"], 57)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceDebugFrameDetailAt"], 58)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceProcessCount"], 59)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceProcessNameAt"], 60)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceProcessLabelsVisibleFromCount"], 61)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceSpawnProcessNamedSource"], 62)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceYield"], 63)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceContextFrameSummariesVisibleFromCountNamed"], 64)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceRuntimeMetadata"], 73)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspacePackageCount"], 74)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceVisibleContentsTopLinesColumns"], 77)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceVisibleContentsTopLeftLinesColumns"], 78)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["workspaceBrowseInteractiveViews"], 95)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["textStyleWithText"], 117)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processSetLabelStateContext"], 130)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processSuspend"], 131)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processResume"], 132)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processStepInto"], 133)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processStepOver"], 134)
+        self.assertEqual(mvp.PRIMITIVE_BINDING_VALUES["processTerminate"], 135)
         for binding_name in _workspace_tool_primitive_bindings():
             self.assertIn(binding_name, mvp.PRIMITIVE_BINDING_VALUES)
         self.assertEqual(
@@ -1581,6 +1610,20 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 ("RECORZ_MVP_SELECTOR_RUNTIME_METADATA", 417),
                 ("RECORZ_MVP_SELECTOR_IS_READ_ONLY_DETAIL_TARGET", 418),
                 ("RECORZ_MVP_SELECTOR_RESTORE_ON_TOOL", 419),
+                ("RECORZ_MVP_SELECTOR_GARBAGE_COLLECT", 420),
+                ("RECORZ_MVP_SELECTOR_AT_PUT", 421),
+                ("RECORZ_MVP_SELECTOR_NEW_ARG", 422),
+                ("RECORZ_MVP_SELECTOR_LESS_EQUAL", 423),
+                ("RECORZ_MVP_SELECTOR_GREATER_EQUAL", 424),
+                ("RECORZ_MVP_SELECTOR_NOT_EQUAL", 425),
+                ("RECORZ_MVP_SELECTOR_INTEGER_DIVIDE", 426),
+                ("RECORZ_MVP_SELECTOR_MODULO", 427),
+                ("RECORZ_MVP_SELECTOR_BIT_AND", 428),
+                ("RECORZ_MVP_SELECTOR_BIT_OR", 429),
+                ("RECORZ_MVP_SELECTOR_BIT_XOR", 430),
+                ("RECORZ_MVP_SELECTOR_BIT_SHIFT", 431),
+                ("RECORZ_MVP_SELECTOR_MAX", 432),
+                ("RECORZ_MVP_SELECTOR_MIN", 433),
             ],
         )
 
@@ -1596,14 +1639,17 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertEqual(mvp.SEED_FIELD_KIND_DEFINITIONS[2], ("RECORZ_MVP_SEED_FIELD_OBJECT_INDEX", 2))
         self.assertEqual(mvp.OBJECT_KIND_SPECS[0], ("Transcript", "RECORZ_MVP_OBJECT_TRANSCRIPT"))
         self.assertEqual(
-            mvp.OBJECT_KIND_SPECS[-6:],
+            mvp.OBJECT_KIND_SPECS[-9:],
             [
-                ("WorkspaceVisibleOrigin", "RECORZ_MVP_OBJECT_WORKSPACE_VISIBLE_ORIGIN"),
                 ("Process", "RECORZ_MVP_OBJECT_PROCESS"),
                 ("WorkspaceReturnState", "RECORZ_MVP_OBJECT_WORKSPACE_RETURN_STATE"),
                 ("WorkspaceBrowserModel", "RECORZ_MVP_OBJECT_WORKSPACE_BROWSER_MODEL"),
                 ("WorkspaceEditorModel", "RECORZ_MVP_OBJECT_WORKSPACE_EDITOR_MODEL"),
                 ("WorkspaceDebuggerModel", "RECORZ_MVP_OBJECT_WORKSPACE_DEBUGGER_MODEL"),
+                ("Array", "RECORZ_MVP_OBJECT_ARRAY"),
+                ("ByteArray", "RECORZ_MVP_OBJECT_BYTE_ARRAY"),
+                ("WordArray", "RECORZ_MVP_OBJECT_WORD_ARRAY"),
+                ("LargePositiveInteger", "RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER"),
             ],
         )
         self.assertEqual(
@@ -1655,11 +1701,17 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 "WorkspaceBrowserModel",
                 "WorkspaceEditorModel",
                 "WorkspaceDebuggerModel",
+                "Array",
+                "ByteArray",
+                "WordArray",
+                "LargePositiveInteger",
             ],
         )
         self.assertEqual(
             mvp.KERNEL_CLASS_HEADERS_IN_DESCRIPTOR_ORDER[-1],
-            mvp.KernelClassHeader("WorkspaceDebuggerModel", 41, 41, 35, ("processName", "frameIndex", "frameCount", "detailMode")),
+            mvp.KernelClassHeader(
+                "LargePositiveInteger", 45, 45, 39, ("digit0", "digit1", "digit2", "digit3")
+            ),
         )
         self.assertEqual(
             mvp.KERNEL_CLASS_HEADERS_BY_NAME["Class"],
@@ -1753,7 +1805,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertEqual(mvp.KERNEL_CLASS_NAME_TO_OBJECT_KIND["BitBlt"], mvp.SEED_OBJECT_BITBLT)
         self.assertEqual(mvp.KERNEL_CLASS_NAME_TO_OBJECT_KIND["CompiledMethod"], mvp.SEED_OBJECT_COMPILED_METHOD)
         self.assertEqual(mvp.KERNEL_CLASS_NAME_TO_OBJECT_KIND["KernelInstaller"], mvp.SEED_OBJECT_KERNEL_INSTALLER)
-        self.assertEqual(mvp.OBJECT_KIND_DEFINITIONS[-1], ("RECORZ_MVP_OBJECT_WORKSPACE_DEBUGGER_MODEL", 42))
+        self.assertEqual(mvp.OBJECT_KIND_DEFINITIONS[-1], ("RECORZ_MVP_OBJECT_LARGE_POSITIVE_INTEGER", 46))
         self.assertEqual(mvp.CLASS_FIELD_METHOD_START, mvp.kernel_instance_variable_index("Class", "methodStart"))
         self.assertEqual(mvp.METHOD_FIELD_ENTRY, mvp.kernel_instance_variable_index("MethodDescriptor", "entry"))
         self.assertEqual(
@@ -1887,6 +1939,10 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 "WorkspaceBrowserModel",
                 "WorkspaceEditorModel",
                 "WorkspaceDebuggerModel",
+                "Array",
+                "ByteArray",
+                "WordArray",
+                "LargePositiveInteger",
             ],
         )
         self.assertEqual(
@@ -1913,7 +1969,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
             ],
         )
         self.assertEqual(
-            mvp.METHOD_ENTRY_ORDER[48:88],
+            mvp.METHOD_ENTRY_ORDER[50:90],
             [
                 "RECORZ_MVP_METHOD_ENTRY_WORKSPACE_FILE_IN",
                 "RECORZ_MVP_METHOD_ENTRY_WORKSPACE_CONTENTS",
@@ -1958,7 +2014,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
             ],
         )
         self.assertEqual(
-            mvp.METHOD_ENTRY_ORDER[-30:],
+            mvp.METHOD_ENTRY_ORDER[-40:],
             [
                 "RECORZ_MVP_METHOD_ENTRY_WORKSPACE_TOOL_BROWSE_REGENERATED_FILE_IN_SOURCE",
                 "RECORZ_MVP_METHOD_ENTRY_WORKSPACE_TOOL_STATUS_TEXT",
@@ -1990,6 +2046,16 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 "RECORZ_MVP_METHOD_ENTRY_WORKSPACE_DEBUGGER_MODEL_FRAME_COUNT",
                 "RECORZ_MVP_METHOD_ENTRY_WORKSPACE_DEBUGGER_MODEL_DETAIL_MODE",
                 "RECORZ_MVP_METHOD_ENTRY_WORKSPACE_DEBUGGER_MODEL_SET_PROCESS_NAME_FRAME_INDEX_FRAME_COUNT_DETAIL_MODE",
+                "RECORZ_MVP_METHOD_ENTRY_ARRAY_SIZE",
+                "RECORZ_MVP_METHOD_ENTRY_ARRAY_AT",
+                "RECORZ_MVP_METHOD_ENTRY_ARRAY_AT_PUT",
+                "RECORZ_MVP_METHOD_ENTRY_BYTE_ARRAY_SIZE",
+                "RECORZ_MVP_METHOD_ENTRY_BYTE_ARRAY_AT",
+                "RECORZ_MVP_METHOD_ENTRY_BYTE_ARRAY_AT_PUT",
+                "RECORZ_MVP_METHOD_ENTRY_WORD_ARRAY_SIZE",
+                "RECORZ_MVP_METHOD_ENTRY_WORD_ARRAY_AT",
+                "RECORZ_MVP_METHOD_ENTRY_WORD_ARRAY_AT_PUT",
+                "RECORZ_MVP_METHOD_ENTRY_LARGE_POSITIVE_INTEGER_PRINT_STRING",
             ],
         )
 
@@ -2398,6 +2464,10 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 "WorkspaceBrowserModel",
                 "WorkspaceEditorModel",
                 "WorkspaceDebuggerModel",
+                "Array",
+                "ByteArray",
+                "WordArray",
+                "LargePositiveInteger",
             ],
         )
         self.assertEqual(
@@ -2746,7 +2816,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
                 (mvp.SEED_FIELD_NIL, 0),
                 (mvp.SEED_FIELD_SMALL_INTEGER, mvp.SEED_OBJECT_CLASS),
                 (mvp.SEED_FIELD_OBJECT_INDEX, dynamic_sections.seed_layout["method_descriptors"].start_index),
-                (mvp.SEED_FIELD_SMALL_INTEGER, 2),
+                (mvp.SEED_FIELD_SMALL_INTEGER, 3),
             ],
         )
         self.assertIsNone(
@@ -2898,11 +2968,13 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertIn("#define RECORZ_MVP_PROGRAM_MAGIC_0 'R'", header)
         self.assertIn("#define RECORZ_MVP_IMAGE_SECTION_PROGRAM 1U", header)
         self.assertIn("#define RECORZ_MVP_IMAGE_ENTRY_SIZE 16U", header)
-        self.assertIn("#define RECORZ_MVP_SEED_VERSION 16U", header)
+        self.assertIn("#define RECORZ_MVP_SEED_VERSION 17U", header)
         self.assertIn("#define RECORZ_MVP_SEED_INVALID_OBJECT_INDEX 65535U", header)
-        self.assertIn("#define RECORZ_MVP_COMPILED_METHOD_MAX_INSTRUCTIONS 4U", header)
+        self.assertIn("#define RECORZ_MVP_COMPILED_METHOD_MAX_INSTRUCTIONS 128U", header)
+        self.assertIn("#define RECORZ_MVP_COMPILED_METHOD_MAX_LITERALS 16U", header)
+        self.assertIn("#define RECORZ_MVP_COMPILED_METHOD_INLINE_INSTRUCTIONS 4U", header)
         self.assertIn("#define RECORZ_MVP_METHOD_UPDATE_MAGIC_0 'R'", header)
-        self.assertIn("#define RECORZ_MVP_METHOD_UPDATE_VERSION 1U", header)
+        self.assertIn("#define RECORZ_MVP_METHOD_UPDATE_VERSION 2U", header)
         self.assertIn("#define RECORZ_MVP_METHOD_UPDATE_HEADER_SIZE 16U", header)
         self.assertIn('#define RECORZ_MVP_METHOD_UPDATE_FW_CFG_NAME "opt/recorz-method-update"', header)
         self.assertIn("enum recorz_mvp_compiled_method_opcode {", header)
@@ -3360,7 +3432,7 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
     def test_builds_compiled_method_update_manifest(self) -> None:
         manifest = mvp.build_method_update_manifest("Transcript", "cr\n    ^self")
         header_size = struct.calcsize(mvp.METHOD_UPDATE_HEADER_FORMAT)
-        magic, version, class_kind, selector, argument_count, instruction_count, reserved = struct.unpack(
+        magic, version, class_kind, selector, argument_count, instruction_count, literal_count = struct.unpack(
             mvp.METHOD_UPDATE_HEADER_FORMAT,
             manifest[:header_size],
         )
@@ -3371,12 +3443,123 @@ class QemuRiscvMvpLoweringTests(unittest.TestCase):
         self.assertEqual(selector, mvp.SELECTOR_VALUES["RECORZ_MVP_SELECTOR_CR"])
         self.assertEqual(argument_count, 0)
         self.assertEqual(instruction_count, 1)
-        self.assertEqual(reserved, 0)
+        self.assertEqual(literal_count, 0)
         self.assertEqual(
             struct.unpack("<I", manifest[header_size:header_size + 4]),
             (mvp.encode_compiled_method_instruction("return_receiver"),),
         )
 
+    def test_builds_pooled_compiled_method_body_with_literal_frame(self) -> None:
+        body = mvp.compile_kernel_method_body(
+            "Transcript",
+            [],
+            "show: text Display defaultForm writeString: text. Display defaultForm writeString: 100000. ^self",
+        )
+        write_string = mvp.encode_compiled_method_instruction(
+            "send",
+            mvp.SELECTOR_VALUES["RECORZ_MVP_SELECTOR_WRITE_STRING"],
+            1,
+        )
+
+        self.assertEqual(
+            body.instructions,
+            [
+                mvp.encode_compiled_method_instruction("push_root", mvp.SEED_ROOT_DEFAULT_FORM),
+                mvp.encode_compiled_method_instruction("push_argument", 0),
+                write_string,
+                mvp.encode_compiled_method_instruction("pop"),
+                mvp.encode_compiled_method_instruction("push_root", mvp.SEED_ROOT_DEFAULT_FORM),
+                mvp.encode_compiled_method_instruction("push_literal", 0, 0),
+                write_string,
+                mvp.encode_compiled_method_instruction("return_receiver"),
+            ],
+        )
+        self.assertEqual(body.literals, [100000])
+        self.assertFalse(mvp.compiled_method_body_is_inline(body))
+
+        manifest = mvp.build_method_update_manifest(
+            "Transcript",
+            "show: text\n    Display defaultForm writeString: text.\n    Display defaultForm writeString: 100000.\n    ^self",
+        )
+        header_size = struct.calcsize(mvp.METHOD_UPDATE_HEADER_FORMAT)
+        header = struct.unpack(mvp.METHOD_UPDATE_HEADER_FORMAT, manifest[:header_size])
+        self.assertEqual(header[5:], (len(body.instructions), 1))
+        self.assertEqual(len(manifest), header_size + (len(body.instructions) + 1) * 4)
+        self.assertEqual(struct.unpack_from("<I", manifest, len(manifest) - 4), (100000,))
+
+    def test_keeps_compiled_method_limits_per_target(self) -> None:
+        self.assertEqual(mvp.TARGET_NAME, mvp.DEFAULT_TARGET)
+        self.assertEqual(mvp.COMPILED_METHOD_MAX_INSTRUCTIONS, 128)
+        self.assertEqual(mvp.COMPILED_METHOD_MAX_LITERALS, 16)
+        output = _run_builder_for_target(
+            "qemu-riscv64",
+            "\n".join(
+                [
+                    "print(mvp.COMPILED_METHOD_MAX_INSTRUCTIONS, mvp.COMPILED_METHOD_MAX_LITERALS)",
+                    "print(int.from_bytes(mvp.build_seed_manifest()[14:16], 'little'))",
+                    "try:",
+                    "    mvp.compile_kernel_method_body('Transcript', [], "
+                    "'show: text Display defaultForm writeString: text. Display defaultForm writeString: 100000. ^self')",
+                    "except mvp.LoweringError:",
+                    "    print('rejected')",
+                ]
+            ),
+        )
+        self.assertEqual(output.split(), ["4", "0", "0", "rejected"])
+
+    def test_qemu_riscv64_kernel_methods_use_only_opcodes_that_target_validates(self) -> None:
+        rv64_source = (ROOT / "platform" / "qemu-riscv64" / "vm.c").read_text(encoding="utf-8")
+        supported = set(
+            re.findall(r"^#define COMPILED_METHOD_OP_\w+ (RECORZ_MVP_COMPILED_METHOD_OP_\w+)$", rv64_source, re.MULTILINE)
+        )
+        output = _run_builder_for_target(
+            "qemu-riscv64",
+            "\n".join(
+                [
+                    "names = {value: name for name, value in mvp.COMPILED_METHOD_OPCODE_VALUES.items()}",
+                    "bodies = list(mvp.COMPILED_METHOD_BODY_BY_ENTRY_NAME.values())",
+                    "bodies.append(mvp.compile_kernel_method_body('Probe', ['value'], 'value\\n    ^value'))",
+                    "bodies.append(mvp.compile_kernel_method_body('Probe', ['value'], 'value: v\\n    value := v.\\n    ^self'))",
+                    "print('\\n'.join(sorted({names[word & 0xFF] for body in bodies for word in body.instructions})))",
+                ]
+            ),
+        )
+        used = set(output.split())
+
+        self.assertIn("RECORZ_MVP_COMPILED_METHOD_OP_PUSH_FIELD", used)
+        self.assertIn("RECORZ_MVP_COMPILED_METHOD_OP_STORE_FIELD", used)
+        self.assertEqual(used - supported, set())
+
+    def test_lowers_special_sends_only_for_targets_that_run_them(self) -> None:
+        script = "\n".join(
+            [
+                "program = mvp.build_program('Transcript show: (3 + 4) printString')",
+                "body = mvp.compile_kernel_method_body('Probe', [], 'double: n\\n    ^n + n')",
+                "names = {value: name for name, value in mvp.COMPILED_METHOD_OPCODE_VALUES.items()}",
+                "print(mvp.OPCODE_CONSTANT_NAMES['send_add'] in [instruction.opcode for instruction in program.instructions])",
+                "print(' '.join(names[word & 0xFF] for word in body.instructions))",
+                "print([line for line in mvp.render_generated_runtime_bindings_header().splitlines()"
+                " if 'RECORZ_MVP_SPECIAL_SEND_OPCODES' in line][0])",
+            ]
+        )
+        rv32_output = _run_builder_for_target("qemu-riscv32", script).splitlines()
+        rv64_output = _run_builder_for_target("qemu-riscv64", script).splitlines()
+
+        self.assertEqual(rv32_output[0], "True")
+        self.assertIn("RECORZ_MVP_COMPILED_METHOD_OP_SEND_ADD", rv32_output[1])
+        self.assertEqual(rv32_output[2], "#define RECORZ_MVP_SPECIAL_SEND_OPCODES 1")
+        self.assertEqual(rv64_output[0], "False")
+        self.assertEqual(
+            rv64_output[1].split(),
+            [
+                "RECORZ_MVP_COMPILED_METHOD_OP_PUSH_ARGUMENT",
+                "RECORZ_MVP_COMPILED_METHOD_OP_PUSH_ARGUMENT",
+                "RECORZ_MVP_COMPILED_METHOD_OP_SEND",
+                "RECORZ_MVP_COMPILED_METHOD_OP_RETURN_TOP",
+            ],
+        )
+        self.assertEqual(rv64_output[2], "#define RECORZ_MVP_SPECIAL_SEND_OPCODES 0")
+
     def test_rejects_primitive_method_update_manifest(self) -> None:
         with self.assertRaises(mvp.LoweringError):
             mvp.build_method_update_manifest("Form", "clear\n    <primitive: #formClear>")
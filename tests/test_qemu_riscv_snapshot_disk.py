@@ -0,0 +1,131 @@
+from __future__ import annotations
+
+import struct
+import unittest
+
+from tools.qemu_riscv_snapshot_disk import (
+    SECTOR_SIZE,
+    SNAPSHOT_DELTA_FIRST_OFFSET,
+    SNAPSHOT_DELTA_HEADER_SIZE,
+    SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET,
+    SNAPSHOT_SECTION_COUNT,
+    SNAPSHOT_SECTION_OBJECTS,
+    SNAPSHOT_SECTION_STRINGS,
+    pack_snapshot_disk,
+    snapshot_checksum,
+    snapshot_section_lengths,
+    unpack_snapshot_disk,
+)
+from tools.inspect_qemu_riscv_snapshot import (
+    SNAPSHOT_DIRECTORY_ENTRY_SIZE,
+    SNAPSHOT_DIRECTORY_OFFSET,
+    SNAPSHOT_OBJECT_SIZE,
+    SNAPSHOT_PAYLOAD_OFFSET,
+    lz_compress,
+)
+
+
+def _snapshot(size: int) -> bytes:
+    blob = bytearray(size)
+    blob[:4] = b"RCZT"
+    struct.pack_into("<I", blob, 60, size)
+    blob[-1] = 0x5A
+    return bytes(blob)
+
+
+def _image(objects: list[bytes], strings: bytes, generation: int = 1, compress: bool = False) -> bytes:
+    header = bytearray(SNAPSHOT_PAYLOAD_OFFSET)
+    header[:4] = b"RCZT"
+    struct.pack_into("<HH", header, 4, 13, len(objects))
+    struct.pack_into("<I", header, 18, len(strings))
+    struct.pack_into("<H", header, 66, generation)
+    sections = [b""] * SNAPSHOT_SECTION_COUNT
+    sections[SNAPSHOT_SECTION_OBJECTS] = b"".join(objects)
+    sections[SNAPSHOT_SECTION_STRINGS] = strings
+    body = bytearray()
+    for section, raw in enumerate(sections):
+        stored = lz_compress(raw) if compress and raw else raw
+        if len(stored) >= len(raw):
+            stored = raw
+        entry = SNAPSHOT_DIRECTORY_OFFSET + (section * SNAPSHOT_DIRECTORY_ENTRY_SIZE)
+        struct.pack_into("<II", header, entry, len(raw), len(stored))
+        body += stored
+    struct.pack_into("<I", header, 60, len(header) + len(body))
+    return bytes(header + body)
+
+
+def _object(marker: int) -> bytes:
+    return bytes([marker]) * SNAPSHOT_OBJECT_SIZE
+
+
+def _delta(base: bytes, target: bytes, patches: dict[int, bytes], sequence: int = 1) -> bytes:
+    old_lengths = snapshot_section_lengths(base)
+    new_lengths = snapshot_section_lengths(target)
+    kept = [min(old, new) for old, new in zip(old_lengths, new_lengths)]
+    kept[SNAPSHOT_SECTION_OBJECTS] = old_lengths[SNAPSHOT_SECTION_OBJECTS]
+    record = bytearray(SNAPSHOT_DELTA_HEADER_SIZE)
+    record[:4] = b"RCZD"
+    struct.pack_into("<HHHH", record, 4, 13, struct.unpack_from("<H", target, 66)[0], sequence, len(patches))
+    for section in range(SNAPSHOT_SECTION_COUNT):
+        struct.pack_into("<I", record, SNAPSHOT_DELTA_FIRST_OFFSET + (section * 4), kept[section])
+    record[SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET:] = target[:SNAPSHOT_PAYLOAD_OFFSET]
+    for handle, data in patches.items():
+        record += struct.pack("<H", handle) + data
+    offset = SNAPSHOT_PAYLOAD_OFFSET
+    for section in range(SNAPSHOT_SECTION_COUNT):
+        record += target[offset + kept[section] : offset + new_lengths[section]]
+        offset += new_lengths[section]
+    struct.pack_into("<I", record, 12, len(record))
+    struct.pack_into("<I", record, 16, snapshot_checksum(bytes(record[SNAPSHOT_DELTA_FIRST_OFFSET:])))
+    return bytes(record)
+
+
+def _chain_disk(base: bytes, delta: bytes) -> bytes:
+    padded = base + bytes(-len(base) % SECTOR_SIZE)
+    return pack_snapshot_disk(padded + delta, 64 * SECTOR_SIZE)
+
+
+class QemuRiscvSnapshotDiskTests(unittest.TestCase):
+    def test_pack_and_unpack_round_trip_a_snapshot(self) -> None:
+        snapshot = _snapshot(1000)
+
+        disk = pack_snapshot_disk(snapshot, 4096)
+
+        self.assertEqual(len(disk), 4096)
+        self.assertEqual(unpack_snapshot_disk(disk), snapshot)
+
+    def test_blank_disk_holds_no_snapshot(self) -> None:
+        self.assertIsNone(unpack_snapshot_disk(pack_snapshot_disk(None, 4096)))
+
+    def test_pack_rejects_snapshots_larger_than_the_disk(self) -> None:
+        with self.assertRaises(SystemExit):
+            pack_snapshot_disk(_snapshot(1000), 512)
+
+    def test_unpack_consolidates_appended_delta_records(self) -> None:
+        base = _image([_object(1), _object(2)], b"ab\0")
+        target = _image([_object(1), _object(7), _object(3)], b"ab\0cd\0")
+
+        disk = _chain_disk(base, _delta(base, target, {2: _object(7)}))
+
+        self.assertEqual(unpack_snapshot_disk(disk), target)
+
+    def test_unpack_expands_a_compressed_base_before_replaying_deltas(self) -> None:
+        base = _image([_object(1)] * 8, b"ab\0", compress=True)
+        target = _image([_object(1)] * 8 + [_object(4)], b"ab\0")
+
+        disk = _chain_disk(base, _delta(_image([_object(1)] * 8, b"ab\0"), target, {}))
+
+        self.assertLess(len(base), len(target))
+        self.assertEqual(unpack_snapshot_disk(disk), target)
+
+    def test_unpack_ignores_deltas_from_another_generation(self) -> None:
+        base = _image([_object(1)], b"")
+        stale = _image([_object(9)], b"", generation=2)
+
+        disk = _chain_disk(base, _delta(base, stale, {1: _object(9)}))
+
+        self.assertEqual(unpack_snapshot_disk(disk), base)
+
+
+if __name__ == "__main__":
+    unittest.main()
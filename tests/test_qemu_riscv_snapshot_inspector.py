@@ -7,34 +7,42 @@ from tools.inspect_qemu_riscv_snapshot import (
     MAX_GLOBAL_ID,
     MAX_ROOT_ID,
     METHOD_SOURCE_NAME_LIMIT,
-    SNAPSHOT_HEADER_SIZE,
+    SNAPSHOT_DIRECTORY_OFFSET,
+    SNAPSHOT_DIRECTORY_ENTRY_SIZE,
     SNAPSHOT_MAGIC,
-    SNAPSHOT_NAMED_OBJECT_RECORD_SIZE,
     SNAPSHOT_OBJECT_SIZE,
+    SNAPSHOT_PAYLOAD_OFFSET,
+    SNAPSHOT_SECTION_COUNT,
+    SNAPSHOT_SECTION_NAMED_OBJECTS,
+    SNAPSHOT_SECTION_OBJECTS,
+    SNAPSHOT_SECTION_ROOTS,
+    SNAPSHOT_SECTION_STRINGS,
     SNAPSHOT_VERSION,
     WORKSPACE_CURSOR_GLOBAL_ID,
     WORKSPACE_GLOBAL_ID,
     WORKSPACE_SELECTION_GLOBAL_ID,
+    expand_snapshot,
     extract_workspace_current_source,
     inspect_snapshot,
+    lz_compress,
+    lz_decompress,
 )
 
 
 def _encode_nil() -> bytes:
-    return bytes(8)
+    return bytes(4)
 
 
 def _encode_small_integer(value: int) -> bytes:
-    return bytes([3, 0, 0, 0]) + struct.pack("<i", value)
+    return struct.pack("<i", (value << 1) | 1)
 
 
-def _encode_string(offset: int, text: str) -> bytes:
-    encoded = text.encode("utf-8")
-    return bytes([2, 0]) + struct.pack("<H", len(encoded)) + struct.pack("<I", offset)
+def _encode_string(offset: int) -> bytes:
+    return struct.pack("<I", ((offset + 1) << 2) | 2)
 
 
 def _encode_object_reference(handle: int) -> bytes:
-    return bytes([1, 0, 0, 0]) + struct.pack("<I", handle)
+    return struct.pack("<I", handle << 2)
 
 
 def _encode_field(field: object, string_section: bytearray) -> bytes:
@@ -46,7 +54,7 @@ def _encode_field(field: object, string_section: bytearray) -> bytes:
         offset = len(string_section)
         string_section.extend(field.encode("utf-8"))
         string_section.append(0)
-        return _encode_string(offset, field)
+        return _encode_string(offset)
     if isinstance(field, tuple) and len(field) == 2 and field[0] == "object":
         return _encode_object_reference(int(field[1]))
     raise AssertionError(f"unsupported snapshot field {field!r}")
@@ -57,6 +65,7 @@ def _build_snapshot(
     objects: list[tuple[int, int, tuple[object, ...]]],
     global_handles: dict[int, int] | None = None,
     named_objects: list[tuple[int, str]] | None = None,
+    compress: bool = False,
 ) -> bytes:
     string_section = bytearray()
     object_section = bytearray()
@@ -71,8 +80,8 @@ def _build_snapshot(
         object_record[1] = len(fields)
         struct.pack_into("<H", object_record, 2, class_handle)
         for field_index, field in enumerate(fields):
-            start = 4 + (field_index * 8)
-            object_record[start : start + 8] = _encode_field(field, string_section)
+            start = 4 + (field_index * 4)
+            object_record[start : start + 4] = _encode_field(field, string_section)
         object_section.extend(object_record)
 
     global_section = bytearray(MAX_GLOBAL_ID * 2)
@@ -86,21 +95,28 @@ def _build_snapshot(
         encoded_name = name.encode("utf-8")
         if len(encoded_name) >= METHOD_SOURCE_NAME_LIMIT:
             raise AssertionError("named object name exceeds snapshot capacity")
-        record = bytearray(SNAPSHOT_NAMED_OBJECT_RECORD_SIZE)
-        struct.pack_into("<H", record, 0, handle)
-        record[2 : 2 + len(encoded_name)] = encoded_name
-        named_object_section.extend(record)
-
-    total_size = (
-        SNAPSHOT_HEADER_SIZE
-        + len(object_section)
-        + len(global_section)
-        + len(root_section)
-        + len(glyph_section)
-        + len(named_object_section)
-        + len(string_section)
-    )
-    header = bytearray(SNAPSHOT_HEADER_SIZE)
+        named_object_section.extend(struct.pack("<H", handle) + encoded_name + b"\0")
+
+    sections = [b""] * SNAPSHOT_SECTION_COUNT
+    sections[SNAPSHOT_SECTION_OBJECTS] = bytes(object_section)
+    sections[SNAPSHOT_SECTION_ROOTS] = bytes(global_section + root_section + glyph_section)
+    sections[SNAPSHOT_SECTION_NAMED_OBJECTS] = bytes(named_object_section)
+    sections[SNAPSHOT_SECTION_STRINGS] = bytes(string_section)
+    header = bytearray(SNAPSHOT_PAYLOAD_OFFSET)
+    payload = bytearray()
+    for section, raw in enumerate(sections):
+        stored = lz_compress(raw) if compress and raw else raw
+        if len(stored) >= len(raw):
+            stored = raw
+        struct.pack_into(
+            "<II",
+            header,
+            SNAPSHOT_DIRECTORY_OFFSET + (section * SNAPSHOT_DIRECTORY_ENTRY_SIZE),
+            len(raw),
+            len(stored),
+        )
+        payload.extend(stored)
+    total_size = len(header) + len(payload)
     header[0:4] = SNAPSHOT_MAGIC
     struct.pack_into("<H", header, 4, SNAPSHOT_VERSION)
     struct.pack_into("<H", header, 6, len(objects))
@@ -108,18 +124,17 @@ def _build_snapshot(
     struct.pack_into("<I", header, 18, len(string_section))
     struct.pack_into("<I", header, 60, total_size)
 
-    return bytes(
-        header
-        + object_section
-        + global_section
-        + root_section
-        + glyph_section
-        + named_object_section
-        + string_section
-    )
+    return bytes(header + payload)
 
 
-def _build_workspace_snapshot(*, view_kind: int, target_name: str, current_source: str, last_source: str) -> bytes:
+def _build_workspace_snapshot(
+    *,
+    view_kind: int,
+    target_name: str,
+    current_source: str,
+    last_source: str,
+    compress: bool = False,
+) -> bytes:
     return _build_snapshot(
         objects=[
             (
@@ -129,6 +144,7 @@ def _build_workspace_snapshot(*, view_kind: int, target_name: str, current_sourc
             )
         ],
         global_handles={WORKSPACE_GLOBAL_ID: 1},
+        compress=compress,
     )
 
 
@@ -241,6 +257,30 @@ class QemuRiscvSnapshotInspectorTests(unittest.TestCase):
         self.assertEqual(workspace_selection["end_line"], 23)
         self.assertEqual(workspace_selection["end_column"], 88)
 
+    def test_inspect_snapshot_reads_compressed_sections(self) -> None:
+        source_text = "Transcript show: 'again'. " * 40
+        snapshot = _build_workspace_snapshot(
+            view_kind=8,
+            target_name="Exported",
+            current_source=source_text,
+            last_source=source_text,
+            compress=True,
+        )
+        expanded = expand_snapshot(snapshot)
+
+        inspection = inspect_snapshot(snapshot)
+
+        self.assertLess(len(snapshot), len(expanded))
+        self.assertEqual(inspection["header"]["total_size"], len(snapshot))
+        self.assertEqual(inspection["header"]["raw_size"], len(expanded))
+        self.assertEqual(inspection["workspace"]["current_source"], source_text)
+        self.assertEqual(inspect_snapshot(expanded)["workspace"], inspection["workspace"])
+
+    def test_lz_blocks_expand_overlapping_matches(self) -> None:
+        self.assertEqual(lz_decompress(b"\x35abc\x03\x00", 12), b"abc" * 4)
+        data = bytes(range(7)) * 50 + bytes(300) + b"tail"
+        self.assertEqual(lz_decompress(lz_compress(data), len(data)), data)
+
     def test_extract_workspace_current_source_returns_image_visible_source(self) -> None:
         source_text = "RecorzKernelClass: #Exported superclass: #Object"
         snapshot = _build_workspace_snapshot(
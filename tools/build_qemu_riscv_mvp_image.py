@@ -17,6 +17,8 @@ from typing import Callable
 ROOT = Path(__file__).resolve().parents[1]
 KERNEL_MVP_ROOT = ROOT / "kernel" / "mvp"
 KERNEL_SOURCE_BUNDLE_ENV = "RECORZ_MVP_KERNEL_SOURCE_BUNDLE"
+TARGET_ENV = "RECORZ_MVP_TARGET"
+DEFAULT_TARGET = "qemu-riscv32"
 RUNTIME_SPEC_PATH = ROOT / "platform" / "qemu-riscv64" / "runtime_spec.json"
 if str(ROOT / "src") not in sys.path:
     sys.path.insert(0, str(ROOT / "src"))
@@ -105,6 +107,14 @@ def constant_value(ids: dict[str, str], values: dict[str, int], name: str) -> in
     return values[ids[name]]
 
 
+def load_target_spec(runtime_spec: dict[str, object]) -> tuple[str, dict[str, object]]:
+    target_name = os.environ.get(TARGET_ENV) or DEFAULT_TARGET
+    targets = dict(runtime_spec["targets"])
+    if target_name not in targets:
+        raise SystemExit(f"{TARGET_ENV} names unknown MVP target {target_name!r}; expected one of {sorted(targets)}")
+    return target_name, dict(targets[target_name])
+
+
 RUNTIME_SPEC = load_runtime_spec()
 PROGRAM_RUNTIME_SPEC = dict(RUNTIME_SPEC["program"])
 IMAGE_RUNTIME_SPEC = dict(RUNTIME_SPEC["image"])
@@ -112,6 +122,7 @@ SEED_RUNTIME_SPEC = dict(RUNTIME_SPEC["seed"])
 COMPILED_METHOD_RUNTIME_SPEC = dict(RUNTIME_SPEC["compiled_method"])
 METHOD_UPDATE_RUNTIME_SPEC = dict(RUNTIME_SPEC["method_update"])
 METHOD_IMPLEMENTATION_RUNTIME_SPEC = list(RUNTIME_SPEC["method_implementations"])
+TARGET_NAME, TARGET_RUNTIME_SPEC = load_target_spec(RUNTIME_SPEC)
 
 OPCODE_SPEC = list(RUNTIME_SPEC["opcodes"])
 LITERAL_KIND_SPEC = list(RUNTIME_SPEC["literal_kinds"])
@@ -171,7 +182,11 @@ SEED_BINDING_FORMAT = str(SEED_RUNTIME_SPEC["binding_format"])
 SEED_OBJECT_HEADER_FORMAT = str(SEED_RUNTIME_SPEC["object_header_format"])
 SEED_FIELD_FORMAT = str(SEED_RUNTIME_SPEC["field_format"])
 SEED_INVALID_OBJECT_INDEX = int(SEED_RUNTIME_SPEC["invalid_object_index"])
-COMPILED_METHOD_MAX_INSTRUCTIONS = int(COMPILED_METHOD_RUNTIME_SPEC["max_instructions"])
+COMPILED_METHOD_MAX_INSTRUCTIONS = int(TARGET_RUNTIME_SPEC["compiled_method_max_instructions"])
+COMPILED_METHOD_MAX_LITERALS = int(TARGET_RUNTIME_SPEC["compiled_method_max_literals"])
+COMPILED_METHOD_SUPERINSTRUCTIONS = bool(TARGET_RUNTIME_SPEC["compiled_method_superinstructions"])
+SPECIAL_SEND_OPCODES = bool(TARGET_RUNTIME_SPEC["special_send_opcodes"])
+COMPILED_METHOD_INLINE_INSTRUCTIONS = int(COMPILED_METHOD_RUNTIME_SPEC["inline_instructions"])
 METHOD_UPDATE_MAGIC = str(METHOD_UPDATE_RUNTIME_SPEC["magic"]).encode("ascii")
 METHOD_UPDATE_VERSION = int(METHOD_UPDATE_RUNTIME_SPEC["version"])
 METHOD_UPDATE_HEADER_FORMAT = str(METHOD_UPDATE_RUNTIME_SPEC["header_format"])
@@ -219,6 +234,12 @@ class Program:
     lexical_names: list[str]
 
 
+@dataclass
+class CompiledMethodBody:
+    instructions: list[int]
+    literals: list[int]
+
+
 @dataclass
 class SeedObject:
     object_kind: int
@@ -678,6 +699,13 @@ COMPILED_METHOD_OP_PUSH_THIS_CONTEXT = constant_value(
     COMPILED_METHOD_OPCODE_VALUES,
     "push_this_context",
 )
+COMPILED_METHOD_OP_DUP = constant_value(COMPILED_METHOD_OPCODE_IDS, COMPILED_METHOD_OPCODE_VALUES, "dup")
+COMPILED_METHOD_OP_STORE_FIELD = constant_value(COMPILED_METHOD_OPCODE_IDS, COMPILED_METHOD_OPCODE_VALUES, "store_field")
+COMPILED_METHOD_OP_STORE_LEXICAL = constant_value(
+    COMPILED_METHOD_OPCODE_IDS,
+    COMPILED_METHOD_OPCODE_VALUES,
+    "store_lexical",
+)
 
 
 def encode_compiled_method_instruction(opcode_name: str, operand_a: int = 0, operand_b: int = 0) -> int:
@@ -687,6 +715,55 @@ def encode_compiled_method_instruction(opcode_name: str, operand_a: int = 0, ope
     return opcode | ((operand_a & 0xFF) << 8) | ((operand_b & 0xFFFF) << 16)
 
 
+def drop_unread_store_copies(instructions: list[int]) -> list[int]:
+    # Kernel method bodies have no jumps, so instructions can be dropped without renumbering targets.
+    # The copy a dup keeps for a store that is followed by ^self is never read.
+    return [
+        instruction
+        for instruction_index, instruction in enumerate(instructions)
+        if not (
+            instruction & 0xFF == COMPILED_METHOD_OP_DUP
+            and instruction_index + 2 < len(instructions)
+            and instructions[instruction_index + 1] & 0xFF in (COMPILED_METHOD_OP_STORE_FIELD, COMPILED_METHOD_OP_STORE_LEXICAL)
+            and instructions[instruction_index + 2] & 0xFF == COMPILED_METHOD_OP_RETURN_RECEIVER
+        )
+    ]
+
+
+def fuse_compiled_method_instructions(instructions: list[int]) -> list[int]:
+    # Kernel method bodies have no jumps, so adjacent pairs can be fused without renumbering targets.
+    fused: list[int] = []
+    index = 0
+    while index < len(instructions):
+        instruction = instructions[index]
+        following = instructions[index + 1] if index + 1 < len(instructions) else None
+        opcode = instruction & 0xFF
+        operand_a = (instruction >> 8) & 0xFF
+        if following is not None:
+            following_opcode = following & 0xFF
+            following_operand_a = (following >> 8) & 0xFF
+            following_operand_b = (following >> 16) & 0xFFFF
+            if opcode == COMPILED_METHOD_OP_PUSH_FIELD and following_opcode == COMPILED_METHOD_OP_RETURN_TOP:
+                fused.append(encode_compiled_method_instruction("return_field", operand_a))
+                index += 2
+                continue
+            if opcode == COMPILED_METHOD_OP_PUSH_ARGUMENT and following_opcode == COMPILED_METHOD_OP_STORE_FIELD:
+                fused.append(
+                    encode_compiled_method_instruction("store_field_from_argument", following_operand_a, operand_a)
+                )
+                index += 2
+                continue
+            if opcode == COMPILED_METHOD_OP_PUSH_ARGUMENT and following_opcode == COMPILED_METHOD_OP_STORE_LEXICAL:
+                fused.append(
+                    encode_compiled_method_instruction("store_lexical_from_argument", operand_a, following_operand_b)
+                )
+                index += 2
+                continue
+        fused.append(instruction)
+        index += 1
+    return fused
+
+
 def split_kernel_method_chunks(source_text: str) -> list[str]:
     chunks: list[str] = []
     chunk_lines: list[str] = []
@@ -1278,26 +1355,54 @@ def kernel_root_constant_name(root_name: str) -> str:
     return f"RECORZ_MVP_SEED_ROOT_{upper_snake_name(root_name)}"
 
 
+BINARY_SELECTOR_CONSTANT_STEMS = {
+    "+": "ADD",
+    "-": "SUBTRACT",
+    "*": "MULTIPLY",
+    "=": "EQUAL",
+    "<": "LESS_THAN",
+    ">": "GREATER_THAN",
+    "<=": "LESS_EQUAL",
+    ">=": "GREATER_EQUAL",
+    "~=": "NOT_EQUAL",
+    "//": "INTEGER_DIVIDE",
+    "\\\\": "MODULO",
+}
+
+# One-argument sends of these selectors lower to dedicated opcodes with an inline SmallInteger path.
+SPECIAL_SEND_OPCODE_NAMES = {
+    "+": "send_add",
+    "-": "send_subtract",
+    "*": "send_multiply",
+    "<": "send_less_than",
+    ">": "send_greater_than",
+    "<=": "send_less_equal",
+    ">=": "send_greater_equal",
+    "=": "send_equal",
+    "~=": "send_not_equal",
+    "//": "send_integer_divide",
+    "\\\\": "send_modulo",
+    "bitAnd:": "send_bit_and",
+    "bitOr:": "send_bit_or",
+    "bitXor:": "send_bit_xor",
+    "bitShift:": "send_bit_shift",
+    "max:": "send_max",
+    "min:": "send_min",
+}
+
+
 def kernel_selector_constant_stem(selector: str) -> str:
     if selector == "value:":
         return "VALUE_ARG"
+    if selector == "new:":
+        return "NEW_ARG"
     if ":" in selector:
         keyword_parts = [part for part in selector.split(":") if part]
         return "_".join(upper_snake_name(part) for part in keyword_parts)
     if re.fullmatch(r"[A-Za-z_]\w*", selector):
         return upper_snake_name(selector)
-    if selector == "+":
-        return "ADD"
-    if selector == "-":
-        return "SUBTRACT"
-    if selector == "*":
-        return "MULTIPLY"
-    if selector == "=":
-        return "EQUAL"
-    if selector == "<":
-        return "LESS_THAN"
-    if selector == ">":
-        return "GREATER_THAN"
+    if selector in BINARY_SELECTOR_CONSTANT_STEMS:
+        return BINARY_SELECTOR_CONSTANT_STEMS[selector]
     raise LoweringError(f"kernel MVP selector {selector!r} cannot be converted into a constant stem")
 
 
@@ -1599,13 +1704,14 @@ def load_kernel_builder_class_sources() -> dict[str, str]:
     return builder_sources_by_name
 
 
-def compile_kernel_method_program(class_name: str, instance_variables: list[str], source: str) -> list[int]:
+def compile_kernel_method_body(class_name: str, instance_variables: list[str], source: str) -> CompiledMethodBody:
     compiled = compile_method(source, class_name, instance_variables)
     arg_indices = {name: index for index, name in enumerate(compiled.arg_names)}
     field_indices = {name: index for index, name in enumerate(instance_variables)}
     instructions = list(compiled.instructions)
     return_receiver = False
     lowered: list[int] = []
+    literal_words: list[int] = []
 
     if compiled.temp_names:
         raise LoweringError(f"Kernel method {class_name}>>{compiled.selector} uses unsupported temporaries")
@@ -1631,12 +1737,28 @@ def compile_kernel_method_program(class_name: str, instance_variables: list[str]
                 )
             literal = compiled.literals[literal_index]
             if isinstance(literal, int):
-                if literal < -32768 or literal > 32767:
+                if -32768 <= literal <= 32767:
+                    lowered.append(
+                        encode_compiled_method_instruction("push_small_integer", 0, literal & 0xFFFF)
+                    )
+                    instruction_index += 1
+                    continue
+                if literal < -(1 << 31) or literal >= (1 << 31):
                     raise LoweringError(
                         f"Kernel method {class_name}>>{compiled.selector} uses an out-of-range small integer literal {literal}"
                     )
+                if literal & 0xFFFFFFFF not in literal_words:
+                    if len(literal_words) >= COMPILED_METHOD_MAX_LITERALS:
+                        raise LoweringError(
+                            f"Kernel method {class_name}>>{compiled.selector} uses more than {COMPILED_METHOD_MAX_LITERALS} literals"
+                        )
+                    literal_words.append(literal & 0xFFFFFFFF)
                 lowered.append(
-                    encode_compiled_method_instruction("push_small_integer", 0, literal & 0xFFFF)
+                    encode_compiled_method_instruction(
+                        "push_literal",
+                        0,
+                        literal_words.index(literal & 0xFFFFFFFF),
+                    )
                 )
                 instruction_index += 1
                 continue
@@ -1729,9 +1851,12 @@ def compile_kernel_method_program(class_name: str, instance_variables: list[str]
                 raise LoweringError(
                     f"Kernel method {class_name}>>{compiled.selector} uses unsupported selector {send_site.selector!r}"
                 )
-            lowered.append(
-                encode_compiled_method_instruction("send", SELECTOR_VALUES[selector_id], send_site.argument_count)
-            )
+            if SPECIAL_SEND_OPCODES and send_site.argument_count == 1 and send_site.selector in SPECIAL_SEND_OPCODE_NAMES:
+                lowered.append(encode_compiled_method_instruction(SPECIAL_SEND_OPCODE_NAMES[send_site.selector]))
+            else:
+                lowered.append(
+                    encode_compiled_method_instruction("send", SELECTOR_VALUES[selector_id], send_site.argument_count)
+                )
             instruction_index += 1
             continue
         if instruction.opcode == "push_this_context":
@@ -1770,11 +1895,18 @@ def compile_kernel_method_program(class_name: str, instance_variables: list[str]
     lowered.append(
         encode_compiled_method_instruction("return_receiver" if return_receiver else "return_top")
     )
+    lowered = drop_unread_store_copies(lowered)
+    if COMPILED_METHOD_SUPERINSTRUCTIONS:
+        lowered = fuse_compiled_method_instructions(lowered)
     if not lowered or len(lowered) > COMPILED_METHOD_MAX_INSTRUCTIONS:
         raise LoweringError(
             f"Kernel method {class_name}>>{compiled.selector} lowers to {len(lowered)} instructions; MVP compiled methods support at most {COMPILED_METHOD_MAX_INSTRUCTIONS}"
         )
-    return lowered
+    return CompiledMethodBody(instructions=lowered, literals=literal_words)
+
+
+def compile_kernel_method_program(class_name: str, instance_variables: list[str], source: str) -> list[int]:
+    return compile_kernel_method_body(class_name, instance_variables, source).instructions
 
 
 def build_method_update_manifest(class_name: str, source: str) -> bytes:
@@ -1792,7 +1924,7 @@ def build_method_update_manifest(class_name: str, source: str) -> bytes:
     if selector not in KERNEL_SELECTOR_DECLARATIONS_BY_SELECTOR:
         raise LoweringError(f"kernel MVP method update references undeclared selector {selector!r}")
 
-    instructions = compile_kernel_method_program(class_name, list(class_header.instance_variables), source)
+    body = compile_kernel_method_body(class_name, list(class_header.instance_variables), source)
     manifest = bytearray(
         struct.pack(
             METHOD_UPDATE_HEADER_FORMAT,
@@ -1801,12 +1933,12 @@ def build_method_update_manifest(class_name: str, source: str) -> bytes:
             KERNEL_CLASS_NAME_TO_OBJECT_KIND[class_name],
             SELECTOR_VALUES[SELECTOR_IDS[selector]],
             argument_count,
-            len(instructions),
-            0,
+            len(body.instructions),
+            len(body.literals),
         )
     )
-    for instruction in instructions:
-        manifest.extend(struct.pack("<I", instruction))
+    for word in body.instructions + body.literals:
+        manifest.extend(struct.pack("<I", word))
     return bytes(manifest)
 
 
@@ -1861,11 +1993,14 @@ BUILTIN_METHODS_BY_KIND = {
 for entry_name, owner_kind, selector, argument_count in METHOD_ENTRY_DEFINITIONS:
     BUILTIN_METHODS_BY_KIND[owner_kind].append((selector, argument_count, entry_name))
 
-COMPILED_METHOD_PROGRAM_BY_ENTRY_NAME = {
-    entry_name: compile_kernel_method_program(source.class_name, list(source.instance_variables), source.source_text)
+COMPILED_METHOD_BODY_BY_ENTRY_NAME = {
+    entry_name: compile_kernel_method_body(source.class_name, list(source.instance_variables), source.source_text)
     for entry_name, source in KERNEL_METHOD_SOURCE_BY_ENTRY_NAME.items()
     if source.implementation_kind == KERNEL_METHOD_IMPLEMENTATION_COMPILED
 }
+COMPILED_METHOD_PROGRAM_BY_ENTRY_NAME = {
+    entry_name: body.instructions for entry_name, body in COMPILED_METHOD_BODY_BY_ENTRY_NAME.items()
+}
 PRIMITIVE_BINDING_VALUES: dict[str, int] = {}
 PRIMITIVE_BINDING_BY_ENTRY_NAME: dict[str, int] = {}
 for entry_name, source in KERNEL_METHOD_SOURCE_BY_ENTRY_NAME.items():
@@ -2169,6 +2304,13 @@ def render_generated_runtime_bindings_header() -> str:
     append_macro_definition(lines, "RECORZ_MVP_SEED_BINDING_SIZE", f"{struct.calcsize(SEED_BINDING_FORMAT)}U")
     append_macro_definition(lines, "RECORZ_MVP_SEED_INVALID_OBJECT_INDEX", f"{SEED_INVALID_OBJECT_INDEX}U")
     append_macro_definition(lines, "RECORZ_MVP_COMPILED_METHOD_MAX_INSTRUCTIONS", f"{COMPILED_METHOD_MAX_INSTRUCTIONS}U")
+    append_macro_definition(lines, "RECORZ_MVP_COMPILED_METHOD_MAX_LITERALS", f"{COMPILED_METHOD_MAX_LITERALS}U")
+    append_macro_definition(lines, "RECORZ_MVP_SPECIAL_SEND_OPCODES", "1" if SPECIAL_SEND_OPCODES else "0")
+    append_macro_definition(
+        lines,
+        "RECORZ_MVP_COMPILED_METHOD_INLINE_INSTRUCTIONS",
+        f"{COMPILED_METHOD_INLINE_INSTRUCTIONS}U",
+    )
     append_magic_byte_definitions(lines, "RECORZ_MVP_METHOD_UPDATE_MAGIC", METHOD_UPDATE_MAGIC)
     append_macro_definition(lines, "RECORZ_MVP_METHOD_UPDATE_VERSION", f"{METHOD_UPDATE_VERSION}U")
     append_macro_definition(lines, "RECORZ_MVP_METHOD_UPDATE_HEADER_SIZE", f"{struct.calcsize(METHOD_UPDATE_HEADER_FORMAT)}U")
@@ -2377,6 +2519,9 @@ class Lowerer:
                 raise LoweringError(
                     f"Unsupported selector {send_site.selector!r}; the MVP target only supports display access, bitmap/form factories, BitBlt fill/copy, text, arithmetic, and printString"
                 )
+            if SPECIAL_SEND_OPCODES and send_site.argument_count == 1 and send_site.selector in SPECIAL_SEND_OPCODE_NAMES:
+                self.instructions.append(Instruction(OPCODE_CONSTANT_NAMES[SPECIAL_SEND_OPCODE_NAMES[send_site.selector]]))
+                return
             self.instructions.append(Instruction(OP_SEND, selector_id, send_site.argument_count))
             return
 
@@ -2903,6 +3048,29 @@ def build_selector_seed_objects(
     return selector_indices_by_value, selector_seed_objects
 
 
+def compiled_method_body_is_inline(body: CompiledMethodBody) -> bool:
+    return not body.literals and len(body.instructions) <= COMPILED_METHOD_INLINE_INSTRUCTIONS
+
+
+def build_compiled_method_body_words(
+    compiled_method_entry_order: list[str] | tuple[str, ...] = COMPILED_METHOD_ENTRY_ORDER,
+) -> tuple[dict[str, int], list[int]]:
+    body_offsets: dict[str, int] = {}
+    body_words: list[int] = []
+
+    for entry_name in compiled_method_entry_order:
+        body = COMPILED_METHOD_BODY_BY_ENTRY_NAME[entry_name]
+        if compiled_method_body_is_inline(body):
+            continue
+        body_offsets[entry_name] = len(body_words)
+        body_words.append(len(body.instructions) + len(body.literals))
+        body_words.extend(body.instructions)
+        body_words.extend(body.literals)
+    if len(body_words) > 0xFFFF:
+        raise LoweringError(f"compiled method bodies need {len(body_words)} words; the seed header supports at most 65535")
+    return body_offsets, body_words
+
+
 def build_compiled_method_seed_objects(
     compiled_method_start_index: int,
     compiled_method_class_index: int,
@@ -2910,21 +3078,27 @@ def build_compiled_method_seed_objects(
 ) -> tuple[dict[str, int], list[SeedObject]]:
     compiled_method_indices: dict[str, int] = {}
     compiled_method_seed_objects: list[SeedObject] = []
+    body_offsets, _body_words = build_compiled_method_body_words(compiled_method_entry_order)
 
     for entry_name in compiled_method_entry_order:
-        program = COMPILED_METHOD_PROGRAM_BY_ENTRY_NAME[entry_name]
+        body = COMPILED_METHOD_BODY_BY_ENTRY_NAME[entry_name]
         compiled_method_indices[entry_name] = compiled_method_start_index + len(compiled_method_seed_objects)
+        if entry_name in body_offsets:
+            fields = {
+                "word1": (SEED_FIELD_SMALL_INTEGER, body_offsets[entry_name]),
+                "word2": (SEED_FIELD_SMALL_INTEGER, len(body.instructions)),
+                "word3": (SEED_FIELD_SMALL_INTEGER, len(body.literals)),
+            }
+        else:
+            fields = {
+                f"word{index}": (SEED_FIELD_SMALL_INTEGER, instruction)
+                for index, instruction in enumerate(body.instructions)
+            }
         compiled_method_seed_objects.append(
             SeedObject(
                 SEED_OBJECT_COMPILED_METHOD,
                 compiled_method_class_index,
-                materialize_named_seed_fields(
-                    "CompiledMethod",
-                    {
-                        f"word{index}": (SEED_FIELD_SMALL_INTEGER, instruction)
-                        for index, instruction in enumerate(program)
-                    },
-                ),
+                materialize_named_seed_fields("CompiledMethod", fields),
             )
         )
 
@@ -3254,7 +3428,10 @@ def encode_seed_manifest(
     bindings: SeedBindings,
     glyph_object_indices: list[int],
     build_context: BootImageSeedBuildContext = BOOT_IMAGE_SEED_BUILD_CONTEXT,
+    compiled_method_body_words: list[int] | None = None,
 ) -> bytes:
+    if compiled_method_body_words is None:
+        compiled_method_body_words = []
     manifest = bytearray(
         struct.pack(
             SEED_HEADER_FORMAT,
@@ -3264,7 +3441,7 @@ def encode_seed_manifest(
             len(bindings.global_bindings),
             len(bindings.root_bindings),
             len(build_context.glyph_bitmap_boot_specs),
-            0,
+            len(compiled_method_body_words),
         )
     )
     for seed_object in seed_objects:
@@ -3284,6 +3461,8 @@ def encode_seed_manifest(
         manifest.extend(struct.pack(SEED_BINDING_FORMAT, binding_id, object_index))
     for object_index in glyph_object_indices:
         manifest.extend(struct.pack("<H", object_index))
+    for word in compiled_method_body_words:
+        manifest.extend(struct.pack("<I", word))
     return bytes(manifest)
 
 
@@ -3295,7 +3474,8 @@ def build_seed_manifest() -> bytes:
     for section_spec in build_context.dynamic_seed_object_section_specs:
         seed_objects.extend(dynamic_sections.seed_objects_for_layout_section(section_spec.layout_section_name))
     bindings = build_seed_bindings(seed_object_indices_by_name, build_context)
-    return encode_seed_manifest(seed_objects, bindings, glyph_object_indices, build_context)
+    _body_offsets, body_words = build_compiled_method_body_words(build_context.compiled_method_entry_order)
+    return encode_seed_manifest(seed_objects, bindings, glyph_object_indices, build_context, body_words)
 
 
 def build_entry_manifest() -> bytes:
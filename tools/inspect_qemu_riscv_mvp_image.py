@@ -75,6 +75,27 @@ def inspect_program_manifest(blob: bytes) -> dict[str, object]:
     }
 
 
+def compiled_method_instructions(summary: dict[str, object], body_words: list[int]) -> list[int]:
+    fields = summary["fields"]
+    field_count = int(summary["field_count"])
+    if field_count == 4 and fields[0][0] == mvp.SEED_FIELD_NIL:
+        if any(field[0] != mvp.SEED_FIELD_SMALL_INTEGER for field in fields[1:]):
+            raise ImageInspectionError("compiled method body fields are invalid")
+        body_offset, instruction_count, literal_count = (field[1] for field in fields[1:])
+        if body_offset < 0 or body_offset >= len(body_words):
+            raise ImageInspectionError("compiled method body offset is out of range")
+        if body_words[body_offset] != instruction_count + literal_count:
+            raise ImageInspectionError("compiled method body size does not match its header")
+        if body_offset + 1 + instruction_count + literal_count > len(body_words):
+            raise ImageInspectionError("compiled method body is truncated")
+        return body_words[body_offset + 1 : body_offset + 1 + instruction_count]
+    if field_count == 0:
+        raise ImageInspectionError("compiled method field count is invalid")
+    if any(field[0] != mvp.SEED_FIELD_SMALL_INTEGER for field in fields[:field_count]):
+        raise ImageInspectionError("compiled method instruction does not match entry")
+    return [field[1] for field in fields[:field_count]]
+
+
 def inspect_seed_manifest(blob: bytes) -> dict[str, object]:
     header_size = struct.calcsize(mvp.SEED_HEADER_FORMAT)
     object_size = struct.calcsize(mvp.SEED_OBJECT_HEADER_FORMAT) + (4 * struct.calcsize(mvp.SEED_FIELD_FORMAT))
@@ -90,15 +111,16 @@ def inspect_seed_manifest(blob: bytes) -> dict[str, object]:
         global_binding_count,
         root_binding_count,
         glyph_code_count,
-        _reserved,
+        body_word_count,
     ) = struct.unpack_from(mvp.SEED_HEADER_FORMAT, blob, 0)
     if magic != mvp.SEED_MAGIC:
         raise ImageInspectionError("seed manifest magic mismatch")
     expected_size = header_size + (object_count * object_size) + (global_binding_count * binding_size) + (
         root_binding_count * binding_size
-    ) + (glyph_code_count * 2)
+    ) + (glyph_code_count * 2) + (body_word_count * 4)
     if len(blob) != expected_size:
         raise ImageInspectionError("seed manifest size mismatch")
+    body_words = list(struct.unpack_from(f"<{body_word_count}I", blob, len(blob) - (body_word_count * 4)))
 
     offset = header_size
     objects: list[dict[str, object]] = []
@@ -307,12 +329,8 @@ def inspect_seed_manifest(blob: bytes) -> dict[str, object]:
                     implementation_summary = objects[implementation_index]
                     if implementation_summary["object_kind"] != mvp.SEED_OBJECT_COMPILED_METHOD:
                         raise ImageInspectionError("compiled method entry implementation is invalid")
-                    if int(implementation_summary["field_count"]) != len(compiled_expected):
-                        raise ImageInspectionError("compiled method field count is invalid")
-                    for field_index, expected_instruction in enumerate(compiled_expected):
-                        field = implementation_summary["fields"][field_index]
-                        if field[0] != mvp.SEED_FIELD_SMALL_INTEGER or field[1] != expected_instruction:
-                            raise ImageInspectionError("compiled method instruction does not match entry")
+                    if compiled_method_instructions(implementation_summary, body_words) != compiled_expected:
+                        raise ImageInspectionError("compiled method instruction does not match entry")
                     continue
                 raise AssertionError("unreachable method entry validation path")
             declared_method_count += method_count
@@ -365,6 +383,7 @@ def inspect_seed_manifest(blob: bytes) -> dict[str, object]:
         "globals": globals_summary,
         "roots": roots_summary,
         "glyph_code_count": glyph_code_count,
+        "compiled_method_body_word_count": body_word_count,
     }
 
 
@@ -19,12 +19,12 @@ import build_qemu_riscv_mvp_image as mvp  # noqa: E402
 
 
 SNAPSHOT_MAGIC = b"RCZT"
-SNAPSHOT_VERSION = 10
-SUPPORTED_SNAPSHOT_VERSIONS = {10}
+SNAPSHOT_VERSION = 13
+SUPPORTED_SNAPSHOT_VERSIONS = {13}
 SNAPSHOT_COMPATIBILITY_PROFILE = "RV32MVP1"
 SNAPSHOT_COMPATIBILITY_LABEL = f"{SNAPSHOT_COMPATIBILITY_PROFILE} snapshot format v{SNAPSHOT_VERSION}"
-SNAPSHOT_HEADER_SIZE = 64
-SNAPSHOT_VALUE_SIZE = 8
+SNAPSHOT_HEADER_SIZE = 68
+SNAPSHOT_VALUE_SIZE = 4
 OBJECT_FIELD_LIMIT = 4
 METHOD_SOURCE_NAME_LIMIT = 96
 CLASS_COMMENT_LIMIT = 128
@@ -33,25 +33,18 @@ STACK_LIMIT = 64
 LEXICAL_LIMIT = 32
 SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT = 2048
 SNAPSHOT_OBJECT_SIZE = 4 + (OBJECT_FIELD_LIMIT * SNAPSHOT_VALUE_SIZE)
-SNAPSHOT_DYNAMIC_CLASS_RECORD_SIZE = (
-    8
-    + (2 * METHOD_SOURCE_NAME_LIMIT)
-    + CLASS_COMMENT_LIMIT
-    + (OBJECT_FIELD_LIMIT * METHOD_SOURCE_NAME_LIMIT)
-)
-SNAPSHOT_PACKAGE_RECORD_SIZE = METHOD_SOURCE_NAME_LIMIT + CLASS_COMMENT_LIMIT
-SNAPSHOT_NAMED_OBJECT_RECORD_SIZE = 2 + METHOD_SOURCE_NAME_LIMIT
-SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SIZE = 13 + METHOD_SOURCE_NAME_LIMIT
 SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE = 9
-SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_SIZE = 4 + SCHEDULED_PROCESS_SOURCE_TEXT_LIMIT
-SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_SIZE = (
-    26
-    + SNAPSHOT_VALUE_SIZE
-    + (MAX_SEND_ARGS * SNAPSHOT_VALUE_SIZE)
-    + (STACK_LIMIT * SNAPSHOT_VALUE_SIZE)
-    + (LEXICAL_LIMIT * SNAPSHOT_VALUE_SIZE)
-)
 SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE = 12
+SNAPSHOT_SECTION_COUNT = 15
+SNAPSHOT_SECTION_OBJECTS = 0
+SNAPSHOT_SECTION_ROOTS = 1
+SNAPSHOT_SECTION_NAMED_OBJECTS = 4
+SNAPSHOT_SECTION_STRINGS = 14
+SNAPSHOT_DIRECTORY_OFFSET = SNAPSHOT_HEADER_SIZE
+SNAPSHOT_DIRECTORY_ENTRY_SIZE = 8
+SNAPSHOT_PAYLOAD_OFFSET = SNAPSHOT_DIRECTORY_OFFSET + (SNAPSHOT_SECTION_COUNT * SNAPSHOT_DIRECTORY_ENTRY_SIZE)
+SNAPSHOT_LZ_MIN_MATCH = 4
+SNAPSHOT_LZ_MAX_OFFSET = 0xFFFF
 MONO_BITMAP_MAX_HEIGHT = 64
 GLYPH_BITMAP_COUNT = 128
 
@@ -138,7 +131,9 @@ class SnapshotHeader:
     scheduled_activation_count: int
     scheduled_process_count: int
     scheduled_runnable_head: int
+    compiled_method_body_word_count: int
     total_size: int
+    method_dictionary_slot_count: int
 
 
 @dataclass(frozen=True)
@@ -158,25 +153,151 @@ def _read_u32_le(blob: bytes, offset: int) -> int:
 
 
 def _decode_snapshot_value(slot: bytes, string_section: bytes, object_count: int) -> SnapshotValue:
-    kind = slot[0]
-    aux = _read_u16_le(slot, 2)
-    raw_u32 = _read_u32_le(slot, 4)
+    word = _read_u32_le(slot, 0)
 
-    if kind == 0:
-        return SnapshotValue("nil", None)
-    if kind == 1:
-        if raw_u32 == 0 or raw_u32 > object_count:
-            raise SnapshotInspectionError("snapshot object reference is out of range")
-        return SnapshotValue("object", raw_u32)
-    if kind == 2:
-        if raw_u32 + aux >= len(string_section):
+    if word & 1:
+        return SnapshotValue("small_integer", struct.unpack_from("<i", slot, 0)[0] >> 1)
+    if word & 3 == 2:
+        offset = (word >> 2) - 1
+        if offset < 0 or offset >= len(string_section):
             raise SnapshotInspectionError("snapshot string value is out of range")
-        if string_section[raw_u32 + aux] != 0:
-            raise SnapshotInspectionError("snapshot string value is not terminated")
-        return SnapshotValue("string", string_section[raw_u32 : raw_u32 + aux].decode("utf-8"))
-    if kind == 3:
-        return SnapshotValue("small_integer", struct.unpack_from("<i", slot, 4)[0])
-    raise SnapshotInspectionError(f"unknown snapshot value kind {kind}")
+        try:
+            terminator = string_section.index(0, offset)
+        except ValueError as exc:
+            raise SnapshotInspectionError("snapshot string value is not terminated") from exc
+        return SnapshotValue("string", string_section[offset:terminator].decode("utf-8"))
+    if word == 0:
+        return SnapshotValue("nil", None)
+    if word >> 2 > object_count:
+        raise SnapshotInspectionError("snapshot object reference is out of range")
+    return SnapshotValue("object", word >> 2)
+
+
+def _lz_read_length(data: bytes, offset: int, length: int) -> tuple[int, int]:
+    if length != 15:
+        return length, offset
+    while True:
+        if offset >= len(data):
+            raise SnapshotInspectionError("snapshot section payload is invalid")
+        extra = data[offset]
+        offset += 1
+        length += extra
+        if extra != 255:
+            return length, offset
+
+
+def lz_decompress(data: bytes, expected: int) -> bytes:
+    """Inflate one LZ4-style section block as written by the VM."""
+    out = bytearray()
+    offset = 0
+    while offset < len(data):
+        token = data[offset]
+        offset += 1
+        length, offset = _lz_read_length(data, offset, token >> 4)
+        if offset + length > len(data):
+            raise SnapshotInspectionError("snapshot section payload is invalid")
+        out += data[offset : offset + length]
+        offset += length
+        if offset == len(data):
+            break
+        if offset + 2 > len(data):
+            raise SnapshotInspectionError("snapshot section payload is invalid")
+        match_offset = _read_u16_le(data, offset)
+        offset += 2
+        length, offset = _lz_read_length(data, offset, token & 15)
+        length += SNAPSHOT_LZ_MIN_MATCH
+        if match_offset == 0 or match_offset > len(out):
+            raise SnapshotInspectionError("snapshot section payload is invalid")
+        for _index in range(length):
+            out.append(out[-match_offset])
+    if len(out) != expected:
+        raise SnapshotInspectionError("snapshot section payload is invalid")
+    return bytes(out)
+
+
+def _lz_put_length(out: bytearray, length: int) -> None:
+    if length < 15:
+        return
+    length -= 15
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def _lz_put_sequence(out: bytearray, literals: bytes, match_offset: int, match_length: int) -> None:
+    match_code = match_length - SNAPSHOT_LZ_MIN_MATCH if match_length else 0
+    out.append((min(len(literals), 15) << 4) | min(match_code, 15))
+    _lz_put_length(out, len(literals))
+    out += literals
+    if match_length:
+        out += struct.pack("<H", match_offset)
+        _lz_put_length(out, match_code)
+
+
+def lz_compress(data: bytes) -> bytes:
+    """Compress one section into a block lz_decompress (and the VM loader) accepts."""
+    out = bytearray()
+    table: dict[bytes, int] = {}
+    anchor = 0
+    position = 0
+    while position + SNAPSHOT_LZ_MIN_MATCH <= len(data):
+        word = data[position : position + SNAPSHOT_LZ_MIN_MATCH]
+        candidate = table.get(word)
+        table[word] = position
+        if candidate is None or position - candidate > SNAPSHOT_LZ_MAX_OFFSET:
+            position += 1
+            continue
+        length = SNAPSHOT_LZ_MIN_MATCH
+        while position + length < len(data) and data[candidate + length] == data[position + length]:
+            length += 1
+        _lz_put_sequence(out, data[anchor:position], position - candidate, length)
+        position += length
+        anchor = position
+    _lz_put_sequence(out, data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def snapshot_section_directory(blob: bytes) -> list[tuple[int, int]]:
+    """Return the (raw, stored) size of every section."""
+    return [
+        struct.unpack_from("<II", blob, SNAPSHOT_DIRECTORY_OFFSET + (section * SNAPSHOT_DIRECTORY_ENTRY_SIZE))
+        for section in range(SNAPSHOT_SECTION_COUNT)
+    ]
+
+
+def snapshot_sections(blob: bytes) -> list[bytes]:
+    """Return the raw bytes of every section, inflating compressed ones."""
+    if len(blob) < SNAPSHOT_PAYLOAD_OFFSET:
+        raise SnapshotInspectionError("snapshot is too small")
+    sections: list[bytes] = []
+    offset = SNAPSHOT_PAYLOAD_OFFSET
+    for raw_size, stored_size in snapshot_section_directory(blob):
+        if stored_size > raw_size or offset + stored_size > len(blob):
+            raise SnapshotInspectionError("snapshot section directory is invalid")
+        payload = blob[offset : offset + stored_size]
+        sections.append(payload if stored_size == raw_size else lz_decompress(payload, raw_size))
+        offset += stored_size
+    if offset != len(blob):
+        raise SnapshotInspectionError("snapshot section directory is invalid")
+    return sections
+
+
+def expand_snapshot(blob: bytes) -> bytes:
+    """Rewrite a snapshot with every section stored raw."""
+    sections = snapshot_sections(blob)
+    expanded = bytearray(blob[:SNAPSHOT_PAYLOAD_OFFSET])
+    for section, payload in enumerate(sections):
+        struct.pack_into(
+            "<II",
+            expanded,
+            SNAPSHOT_DIRECTORY_OFFSET + (section * SNAPSHOT_DIRECTORY_ENTRY_SIZE),
+            len(payload),
+            len(payload),
+        )
+        expanded += payload
+    struct.pack_into("<I", expanded, 60, len(expanded))
+    return bytes(expanded)
 
 
 def parse_snapshot(blob: bytes) -> ParsedSnapshot:
@@ -211,7 +332,9 @@ def parse_snapshot(blob: bytes) -> ParsedSnapshot:
         scheduled_activation_count=_read_u16_le(blob, 52),
         scheduled_process_count=_read_u16_le(blob, 54),
         scheduled_runnable_head=_read_u16_le(blob, 56),
+        compiled_method_body_word_count=_read_u16_le(blob, 58),
         total_size=_read_u32_le(blob, 60),
+        method_dictionary_slot_count=_read_u16_le(blob, 64),
     )
     if header.version not in SUPPORTED_SNAPSHOT_VERSIONS:
         raise SnapshotInspectionError(
@@ -224,40 +347,26 @@ def parse_snapshot(blob: bytes) -> ParsedSnapshot:
     if header.total_size != len(blob):
         raise SnapshotInspectionError("snapshot size mismatch")
 
-    string_section_offset = (
-        SNAPSHOT_HEADER_SIZE
-        + (header.object_count * SNAPSHOT_OBJECT_SIZE)
-        + (MAX_GLOBAL_ID * 2)
-        + (MAX_ROOT_ID * 2)
-        + (GLYPH_BITMAP_COUNT * 2)
-        + (header.dynamic_class_count * SNAPSHOT_DYNAMIC_CLASS_RECORD_SIZE)
-        + (header.package_count * SNAPSHOT_PACKAGE_RECORD_SIZE)
-        + (header.named_object_count * SNAPSHOT_NAMED_OBJECT_RECORD_SIZE)
-        + (header.live_method_source_count * SNAPSHOT_LIVE_METHOD_SOURCE_RECORD_SIZE)
-        + header.live_method_source_byte_count
-        + (header.live_string_literal_count * SNAPSHOT_LIVE_STRING_LITERAL_RECORD_SIZE)
-        + header.live_string_literal_byte_count
-        + (header.mono_bitmap_count * MONO_BITMAP_MAX_HEIGHT * 4)
-        + (header.scheduled_process_source_count * SNAPSHOT_SCHEDULED_PROCESS_SOURCE_RECORD_SIZE)
-        + (header.scheduled_activation_count * SNAPSHOT_SCHEDULED_ACTIVATION_RECORD_SIZE)
-        + (header.scheduled_process_count * SNAPSHOT_SCHEDULED_PROCESS_RECORD_SIZE)
-    )
-    if string_section_offset + header.string_byte_count != len(blob):
+    sections = snapshot_sections(blob)
+    object_section = sections[SNAPSHOT_SECTION_OBJECTS]
+    string_section = sections[SNAPSHOT_SECTION_STRINGS]
+    if len(object_section) != header.object_count * SNAPSHOT_OBJECT_SIZE:
+        raise SnapshotInspectionError("snapshot fixed section size mismatch")
+    if len(string_section) != header.string_byte_count:
         raise SnapshotInspectionError("snapshot string section size mismatch")
-    string_section = blob[string_section_offset:]
 
     objects: list[SnapshotObject] = []
-    offset = SNAPSHOT_HEADER_SIZE
+    offset = 0
     for _handle in range(1, header.object_count + 1):
-        kind = blob[offset]
-        field_count = blob[offset + 1]
-        class_handle = _read_u16_le(blob, offset + 2)
+        kind = object_section[offset]
+        field_count = object_section[offset + 1]
+        class_handle = _read_u16_le(object_section, offset + 2)
         fields: list[SnapshotValue] = []
         field_offset = offset + 4
         for _field_index in range(OBJECT_FIELD_LIMIT):
             fields.append(
                 _decode_snapshot_value(
-                    blob[field_offset : field_offset + SNAPSHOT_VALUE_SIZE],
+                    object_section[field_offset : field_offset + SNAPSHOT_VALUE_SIZE],
                     string_section,
                     header.object_count,
                 )
@@ -266,32 +375,34 @@ def parse_snapshot(blob: bytes) -> ParsedSnapshot:
         objects.append(SnapshotObject(kind, field_count, class_handle, tuple(fields)))
         offset += SNAPSHOT_OBJECT_SIZE
 
+    root_section = sections[SNAPSHOT_SECTION_ROOTS]
+    if len(root_section) != (MAX_GLOBAL_ID + MAX_ROOT_ID + GLYPH_BITMAP_COUNT) * 2:
+        raise SnapshotInspectionError("snapshot fixed section size mismatch")
     global_handles = tuple(
-        _read_u16_le(blob, offset + (global_index * 2))
+        _read_u16_le(root_section, global_index * 2)
         for global_index in range(MAX_GLOBAL_ID)
     )
-    offset += MAX_GLOBAL_ID * 2
-    offset += MAX_ROOT_ID * 2
-    offset += GLYPH_BITMAP_COUNT * 2
-    offset += header.dynamic_class_count * SNAPSHOT_DYNAMIC_CLASS_RECORD_SIZE
-    offset += header.package_count * SNAPSHOT_PACKAGE_RECORD_SIZE
 
+    named_section = sections[SNAPSHOT_SECTION_NAMED_OBJECTS]
     named_objects: list[tuple[int, str]] = []
+    offset = 0
     for _named_index in range(header.named_object_count):
-        handle = _read_u16_le(blob, offset)
-        name_bytes = blob[offset + 2 : offset + SNAPSHOT_NAMED_OBJECT_RECORD_SIZE]
-
-        offset += SNAPSHOT_NAMED_OBJECT_RECORD_SIZE
+        if offset + 2 > len(named_section):
+            raise SnapshotInspectionError("snapshot section record is truncated")
+        handle = _read_u16_le(named_section, offset)
         if handle == 0 or handle > header.object_count:
             raise SnapshotInspectionError("snapshot named object handle is out of range")
         try:
-            terminator = name_bytes.index(0)
+            terminator = named_section.index(0, offset + 2)
         except ValueError as exc:
             raise SnapshotInspectionError("snapshot named object name is not terminated") from exc
-        name = name_bytes[:terminator].decode("utf-8")
+        name = named_section[offset + 2 : terminator].decode("utf-8")
+        offset = terminator + 1
         if not name:
             raise SnapshotInspectionError("snapshot named object name is empty")
         named_objects.append((handle, name))
+    if offset != len(named_section):
+        raise SnapshotInspectionError("snapshot fixed section size mismatch")
 
     return ParsedSnapshot(
         header=header,
@@ -531,6 +642,8 @@ def inspect_snapshot(blob: bytes) -> dict[str, object]:
             "package_count": snapshot.header.package_count,
             "named_object_count": snapshot.header.named_object_count,
             "mono_bitmap_count": snapshot.header.mono_bitmap_count,
+            "compiled_method_body_word_count": snapshot.header.compiled_method_body_word_count,
+            "method_dictionary_slot_count": snapshot.header.method_dictionary_slot_count,
             "next_dynamic_method_entry_execution_id": snapshot.header.next_dynamic_method_entry_execution_id,
             "string_byte_count": snapshot.header.string_byte_count,
             "cursor_x": snapshot.header.cursor_x,
@@ -551,6 +664,7 @@ def inspect_snapshot(blob: bytes) -> dict[str, object]:
             "scheduled_process_count": snapshot.header.scheduled_process_count,
             "scheduled_runnable_head": snapshot.header.scheduled_runnable_head,
             "total_size": snapshot.header.total_size,
+            "raw_size": SNAPSHOT_PAYLOAD_OFFSET + sum(raw for raw, _stored in snapshot_section_directory(blob)),
         },
         "workspace": _workspace_summary(snapshot),
         "workspace_tool": _workspace_tool_summary(snapshot),
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Convert between Recorz snapshot files and raw virtio-blk snapshot disk images.
+
+A disk holds a full base snapshot followed by the delta records appended by later checkpoints of the
+same generation; unpacking replays the chain into one consolidated snapshot."""
+
+from __future__ import annotations
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+
+ROOT = Path(__file__).resolve().parents[1]
+if str(ROOT / "tools") not in sys.path:
+    sys.path.insert(0, str(ROOT / "tools"))
+
+import inspect_qemu_riscv_snapshot as layout  # noqa: E402
+
+
+SNAPSHOT_MAGIC = b"RCZT"
+SNAPSHOT_DELTA_MAGIC = b"RCZD"
+SNAPSHOT_HEADER_SIZE = 68
+SNAPSHOT_TOTAL_SIZE_OFFSET = 60
+SNAPSHOT_GENERATION_OFFSET = 66
+SNAPSHOT_SECTION_COUNT = 15
+SNAPSHOT_SECTION_OBJECTS = 0
+SNAPSHOT_SECTION_STRINGS = 14
+SNAPSHOT_DELTA_FIRST_OFFSET = 20
+SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET = SNAPSHOT_DELTA_FIRST_OFFSET + (SNAPSHOT_SECTION_COUNT * 4)
+SNAPSHOT_DELTA_HEADER_SIZE = SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET + layout.SNAPSHOT_PAYLOAD_OFFSET
+SNAPSHOT_DELTA_PATCH_RECORD_SIZE = 2 + layout.SNAPSHOT_OBJECT_SIZE
+SECTOR_SIZE = 512
+DEFAULT_DISK_SIZE = 1024 * 1024
+
+
+def pack_snapshot_disk(snapshot: bytes | None, disk_size: int = DEFAULT_DISK_SIZE) -> bytes:
+    if disk_size % SECTOR_SIZE != 0:
+        raise SystemExit(f"disk size {disk_size} is not a multiple of {SECTOR_SIZE} bytes")
+    if snapshot is None:
+        return bytes(disk_size)
+    if len(snapshot) > disk_size:
+        raise SystemExit(f"snapshot of {len(snapshot)} bytes does not fit a {disk_size} byte disk")
+    return snapshot + bytes(disk_size - len(snapshot))
+
+
+def _sector_count(size: int) -> int:
+    return (size + SECTOR_SIZE - 1) // SECTOR_SIZE
+
+
+def snapshot_checksum(data: bytes) -> int:
+    value = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def snapshot_section_lengths(header: bytes) -> list[int]:
+    return [raw for raw, _stored in layout.snapshot_section_directory(header)]
+
+
+def apply_snapshot_delta(snapshot: bytes, delta: bytes) -> bytes:
+    """Consolidate one appended delta record into the expanded snapshot it was written against."""
+    image_header = delta[SNAPSHOT_DELTA_IMAGE_HEADER_OFFSET:SNAPSHOT_DELTA_HEADER_SIZE]
+    old_lengths = snapshot_section_lengths(snapshot)
+    new_lengths = snapshot_section_lengths(image_header)
+    patch_count = struct.unpack_from("<H", delta, 10)[0]
+    cursor = SNAPSHOT_DELTA_HEADER_SIZE + (patch_count * SNAPSHOT_DELTA_PATCH_RECORD_SIZE)
+    merged = bytearray(image_header)
+    old_offset = layout.SNAPSHOT_PAYLOAD_OFFSET
+    for section in range(SNAPSHOT_SECTION_COUNT):
+        kept = struct.unpack_from("<I", delta, SNAPSHOT_DELTA_FIRST_OFFSET + (section * 4))[0]
+        appended = new_lengths[section] - kept
+        if kept > old_lengths[section] or appended < 0 or cursor + appended > len(delta):
+            raise SystemExit("snapshot delta layout is invalid")
+        merged += snapshot[old_offset : old_offset + kept]
+        merged += delta[cursor : cursor + appended]
+        cursor += appended
+        old_offset += old_lengths[section]
+    if cursor != len(delta) or len(merged) != struct.unpack_from("<I", image_header, SNAPSHOT_TOTAL_SIZE_OFFSET)[0]:
+        raise SystemExit("snapshot delta layout is invalid")
+    object_bytes = struct.unpack_from("<I", delta, SNAPSHOT_DELTA_FIRST_OFFSET)[0]
+    for index in range(patch_count):
+        offset = SNAPSHOT_DELTA_HEADER_SIZE + (index * SNAPSHOT_DELTA_PATCH_RECORD_SIZE)
+        handle = struct.unpack_from("<H", delta, offset)[0]
+        if handle == 0 or handle * layout.SNAPSHOT_OBJECT_SIZE > object_bytes:
+            raise SystemExit("snapshot delta object patch is out of range")
+        start = layout.SNAPSHOT_PAYLOAD_OFFSET + ((handle - 1) * layout.SNAPSHOT_OBJECT_SIZE)
+        merged[start : start + layout.SNAPSHOT_OBJECT_SIZE] = delta[offset + 2 : offset + SNAPSHOT_DELTA_PATCH_RECORD_SIZE]
+    return bytes(merged)
+
+
+def _read_delta(disk: bytes, offset: int, version: int, generation: int, sequence: int) -> bytes | None:
+    if offset + SNAPSHOT_DELTA_HEADER_SIZE > len(disk) or disk[offset : offset + 4] != SNAPSHOT_DELTA_MAGIC:
+        return None
+    if struct.unpack_from("<HHH", disk, offset + 4) != (version, generation, sequence):
+        return None
+    size, checksum = struct.unpack_from("<II", disk, offset + 12)
+    if size < SNAPSHOT_DELTA_HEADER_SIZE or offset + size > len(disk):
+        return None
+    delta = disk[offset : offset + size]
+    if snapshot_checksum(delta[SNAPSHOT_DELTA_FIRST_OFFSET:]) != checksum:
+        return None
+    return delta
+
+
+def unpack_snapshot_disk(disk: bytes) -> bytes | None:
+    if len(disk) < SNAPSHOT_HEADER_SIZE or disk[:4] != SNAPSHOT_MAGIC:
+        return None
+    size = struct.unpack_from("<I", disk, SNAPSHOT_TOTAL_SIZE_OFFSET)[0]
+    if size < SNAPSHOT_HEADER_SIZE or size > len(disk):
+        raise SystemExit(f"snapshot disk records an invalid snapshot size {size}")
+    snapshot = disk[:size]
+    version = struct.unpack_from("<H", disk, 4)[0]
+    generation = struct.unpack_from("<H", disk, SNAPSHOT_GENERATION_OFFSET)[0]
+    offset = _sector_count(size) * SECTOR_SIZE
+    sequence = 1
+    while (delta := _read_delta(disk, offset, version, generation, sequence)) is not None:
+        if sequence == 1:
+            snapshot = layout.expand_snapshot(snapshot)
+        snapshot = apply_snapshot_delta(snapshot, delta)
+        offset += _sector_count(len(delta)) * SECTOR_SIZE
+        sequence += 1
+    return snapshot
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    commands = parser.add_subparsers(dest="command", required=True)
+    pack_parser = commands.add_parser("pack", help="write a disk image holding a snapshot file")
+    pack_parser.add_argument("snapshot_path", type=Path)
+    pack_parser.add_argument("disk_path", type=Path)
+    pack_parser.add_argument("--size", type=int, default=DEFAULT_DISK_SIZE)
+    unpack_parser = commands.add_parser("unpack", help="extract the snapshot stored on a disk image")
+    unpack_parser.add_argument("disk_path", type=Path)
+    unpack_parser.add_argument("snapshot_path", type=Path)
+    args = parser.parse_args()
+
+    if args.command == "pack":
+        snapshot = args.snapshot_path.read_bytes() if args.snapshot_path.exists() else None
+        args.disk_path.parent.mkdir(parents=True, exist_ok=True)
+        args.disk_path.write_bytes(pack_snapshot_disk(snapshot, args.size))
+        return
+    snapshot = unpack_snapshot_disk(args.disk_path.read_bytes())
+    if snapshot is None:
+        raise SystemExit(f"no snapshot stored on {args.disk_path}")
+    args.snapshot_path.parent.mkdir(parents=True, exist_ok=True)
+    args.snapshot_path.write_bytes(snapshot)
+
+
+if __name__ == "__main__":
+    main()